@@ -49,6 +49,8 @@ public:
     static constexpr size_t MAX_PDU_TRANSPORT_CHANNEL_ELEMENT_SIZE = 72U;
     static constexpr size_t MAX_CAN_CHANNEL_ELEMENT_SIZE           = 72U;
     static constexpr size_t MAX_FLEXRAY_CHANNEL_ELEMENT_SIZE       = 72U;
+    // Maximum number of PDUs routed per cyclic run
+    static constexpr size_t MAX_PDUS_PER_RUN                       = 32U;
 
     RoutingSystem(::async::ContextType context, ::can::ICanSystem& canSystem);
 
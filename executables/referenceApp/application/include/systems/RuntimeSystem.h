@@ -15,6 +15,9 @@
 #include <console/AsyncCommandWrapper.h>
 #include <lifecycle/AsyncLifecycleComponent.h>
 #include <lifecycle/console/StatisticsCommand.h>
+#ifdef TRACING
+#include <runtime/console/TraceCommand.h>
+#endif
 
 namespace systems
 {
@@ -42,6 +45,10 @@ private:
 
     ::lifecycle::StatisticsCommand _statisticsCommand;
     ::console::AsyncCommandWrapper _asyncCommandWrapperForStatisticsCommand;
+#ifdef TRACING
+    ::runtime::TraceCommand _traceCommand;
+    ::console::AsyncCommandWrapper _asyncCommandWrapperForTraceCommand;
+#endif
 };
 
 } // namespace systems
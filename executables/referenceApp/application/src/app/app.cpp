@@ -19,7 +19,7 @@
 #include "systems/RuntimeSystem.h"
 #include "systems/SafetySystem.h"
 #include "systems/SysAdminSystem.h"
-#if defined(SUPPORT_FREERTOS) && defined(TRACING)
+#ifdef TRACING
 #include "runtime/Tracer.h"
 #endif
 
@@ -272,7 +272,8 @@ void startApp()
 #endif
 
 #if TRACING
-    runtime::Tracer::init();
+    // the trace blocks are streamed with the console command "trace drain"
+    runtime::Tracer::init(runtime::Tracer::Mode::RING);
     runtime::Tracer::start();
 #endif
 
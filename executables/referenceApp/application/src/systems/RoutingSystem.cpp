@@ -150,7 +150,7 @@ void RoutingSystem::execute()
     _pduTransportIntegration.checkTransmissionTimeouts();
     _pduTransportIntegration.sendUdpFrames();
 
-    _integration.route();
+    (void)_integration.routeBatch(MAX_PDUS_PER_RUN);
 }
 
 void RoutingSystem::handleError(
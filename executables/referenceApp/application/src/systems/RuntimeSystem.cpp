@@ -24,6 +24,10 @@ RuntimeSystem::RuntimeSystem(
 , _timeout()
 , _statisticsCommand(runtimeMonitor)
 , _asyncCommandWrapperForStatisticsCommand(_statisticsCommand, context)
+#ifdef TRACING
+, _traceCommand()
+, _asyncCommandWrapperForTraceCommand(_traceCommand, context)
+#endif
 {
     setTransitionContext(context);
 }
@@ -12,6 +12,7 @@
 
 #include <async/Config.h>
 #include <async/StaticContextHook.h>
+#include <runtime/HistogramRuntimeStatistics.h>
 #include <runtime/RuntimeMonitor.h>
 #include <runtime/RuntimeStatistics.h>
 
@@ -35,9 +36,17 @@ struct AsyncBinding : public Config
     using AdapterType = ThreadXAdapter<AsyncBinding>;
 #endif
 
+#ifdef PLATFORM_SUPPORT_RUNTIME_HISTOGRAMS
+    // percentiles over windows of 10 measurement periods
+    using RuntimeStatisticsType
+        = ::runtime::HistogramRuntimeStatistics<::runtime::RuntimeStatistics, 10U>;
+#else
+    using RuntimeStatisticsType = ::runtime::RuntimeStatistics;
+#endif
+
     using RuntimeMonitorType = ::runtime::declare::RuntimeMonitor<
-        ::runtime::RuntimeStatistics,
-        ::runtime::RuntimeStatistics,
+        RuntimeStatisticsType,
+        RuntimeStatisticsType,
         AdapterType::OS_TASK_COUNT,
         ISR_GROUP_COUNT>;
 
@@ -52,6 +52,7 @@ enum
     // ------------
     ISR_GROUP_CAN,
     ISR_GROUP_ENET,
+    ISR_GROUP_IO,
     ISR_GROUP_COUNT,
 };
 
@@ -31,11 +31,11 @@ protected:
 
 private:
     using TaskStatistics = ::runtime::declare::StatisticsContainer<
-        ::runtime::RuntimeStatistics,
+        ::async::AsyncBinding::RuntimeStatisticsType,
         ::async::AsyncBindingType::AdapterType::OS_TASK_COUNT>;
 
-    using IsrGroupStatistics
-        = ::runtime::declare::StatisticsContainer<::runtime::RuntimeStatistics, ISR_GROUP_COUNT>;
+    using IsrGroupStatistics = ::runtime::declare::
+        StatisticsContainer<::async::AsyncBinding::RuntimeStatisticsType, ISR_GROUP_COUNT>;
 
     ::async::AsyncBinding::RuntimeMonitorType& _runtimeMonitor;
 
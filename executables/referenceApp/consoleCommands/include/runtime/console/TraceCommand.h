@@ -0,0 +1,38 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <etl/array.h>
+#include <runtime/Tracer.h>
+#include <util/command/GroupCommand.h>
+
+namespace runtime
+{
+/**
+ * Console command streaming the blocks the Tracer records in ring mode, e.g. to a host that
+ * decodes them while the application keeps running.
+ */
+class TraceCommand : public ::util::command::GroupCommand
+{
+public:
+    TraceCommand();
+
+protected:
+    DECLARE_COMMAND_GROUP_GET_INFO
+    void executeCommand(::util::command::CommandContext& context, uint8_t idx) override;
+
+private:
+    void drain(::util::command::CommandContext& context);
+
+    ::etl::array<uint32_t, Tracer::BLOCK_WORD_SIZE> _block;
+};
+
+} // namespace runtime
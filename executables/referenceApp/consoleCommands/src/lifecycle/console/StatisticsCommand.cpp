@@ -11,13 +11,28 @@
 #include "lifecycle/console/StatisticsCommand.h"
 
 #include <async/Async.h>
+#include <runtime/HistogramRuntimeStatistics.h>
 #include <runtime/StatisticsWriter.h>
 #include <util/format/SharedStringWriter.h>
 
 namespace
 {
-void format(
-    ::runtime::StatisticsWriter& statisticsWriter, ::runtime::RuntimeStatistics const& statistics)
+using RuntimeStatisticsType = ::async::AsyncBinding::RuntimeStatisticsType;
+
+void formatPercentiles(
+    ::runtime::StatisticsWriter& /* statisticsWriter */,
+    ::runtime::RuntimeStatistics const& /* statistics */)
+{}
+
+template<class Statistics, uint32_t HistogramWindow>
+void formatPercentiles(
+    ::runtime::StatisticsWriter& statisticsWriter,
+    ::runtime::HistogramRuntimeStatistics<Statistics, HistogramWindow> const& statistics)
+{
+    statisticsWriter.writeRuntimePercentiles(6U, statistics.getHistogram());
+}
+
+void format(::runtime::StatisticsWriter& statisticsWriter, RuntimeStatisticsType const& statistics)
 {
     statisticsWriter.writeRuntimePercentage("%", statistics.getTotalRuntime());
     statisticsWriter.writeRuntimeMS("total ", 9U, statistics.getTotalRuntime());
@@ -25,6 +40,7 @@ void format(
     statisticsWriter.writeRuntime("avg ", 6U, statistics.getAverageRuntime());
     statisticsWriter.writeRuntime("min ", 6U, statistics.getMinRuntime());
     statisticsWriter.writeRuntime("max ", 6U, statistics.getMaxRuntime());
+    formatPercentiles(statisticsWriter, statistics);
 }
 
 template<typename T, typename I>
@@ -46,7 +62,7 @@ void printCpu(
     ::runtime::StatisticsWriter statisticsWriter(writer, totalRuntime, *ticksPerUs);
 
     using FormatStatisticsType
-        = ::runtime::StatisticsWriter::FormatStatistics<::runtime::RuntimeStatistics>::Type;
+        = ::runtime::StatisticsWriter::FormatStatistics<RuntimeStatisticsType>::Type;
 
     FormatStatisticsType formatStatistics = FormatStatisticsType::create<&format>();
 
@@ -0,0 +1,95 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "runtime/console/TraceCommand.h"
+
+#include <util/format/SharedStringWriter.h>
+
+namespace
+{
+// blocks drained by one command, more blocks may be completed while they are printed
+constexpr size_t MAX_DRAINED_BLOCK_COUNT = TRACING_BUFFER_SIZE / TRACING_BLOCK_SIZE;
+constexpr size_t WORDS_PER_LINE          = 8U;
+
+enum Id
+{
+    ID_START,
+    ID_STOP,
+    ID_DRAIN
+};
+
+} // namespace
+
+namespace runtime
+{
+DEFINE_COMMAND_GROUP_GET_INFO_BEGIN(TraceCommand, "trace", "ring mode tracing command")
+COMMAND_GROUP_COMMAND(ID_START, "start", "starts tracing")
+COMMAND_GROUP_COMMAND(ID_STOP, "stop", "stops tracing")
+COMMAND_GROUP_COMMAND(ID_DRAIN, "drain", "prints the complete blocks that haven't been printed")
+DEFINE_COMMAND_GROUP_GET_INFO_END
+
+TraceCommand::TraceCommand() : _block() {}
+
+void TraceCommand::drain(::util::command::CommandContext& context)
+{
+    ::util::format::SharedStringWriter writer(context);
+
+    for (size_t block = 0U; block < MAX_DRAINED_BLOCK_COUNT; ++block)
+    {
+        if (Tracer::drain(_block) == 0U)
+        {
+            break;
+        }
+        // each block starts with its header and can be decoded on its own
+        for (size_t i = 0U; i < _block.size(); ++i)
+        {
+            if ((i % WORDS_PER_LINE) == 0U)
+            {
+                writer.printf("trace:%08x", _block[i]);
+            }
+            else
+            {
+                writer.printf(" %08x", _block[i]);
+            }
+            if ((((i + 1U) % WORDS_PER_LINE) == 0U) || ((i + 1U) == _block.size()))
+            {
+                writer.printf("\n");
+            }
+        }
+    }
+}
+
+void TraceCommand::executeCommand(::util::command::CommandContext& context, uint8_t idx)
+{
+    switch (idx)
+    {
+        case ID_START:
+        {
+            Tracer::start();
+            break;
+        }
+        case ID_STOP:
+        {
+            Tracer::stop();
+            break;
+        }
+        case ID_DRAIN:
+        {
+            drain(context);
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+} // namespace runtime
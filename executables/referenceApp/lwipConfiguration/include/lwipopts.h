@@ -113,7 +113,7 @@
 #endif
 
 #ifndef MEMP_NUM_PBUF
-#define MEMP_NUM_PBUF 0
+#define MEMP_NUM_PBUF TCP_SND_QUEUELEN // reference pbufs for zero-copy TCP sends
 #endif
 
 #ifndef MEMP_NUM_TCP_SEG
@@ -47,3 +47,9 @@ set(PLATFORM_SUPPORT_UDS
 set(PLATFORM_SUPPORT_MIDDLEWARE
     ON
     CACHE BOOL "Turn middleware service demo support on or off" FORCE)
+set(PLATFORM_SUPPORT_LOCK_FREE_RUNNABLE_QUEUE
+    ON
+    CACHE BOOL "Turn lock-free runnable queue of async contexts on or off" FORCE)
+set(PLATFORM_SUPPORT_RUNTIME_HISTOGRAMS
+    ON
+    CACHE BOOL "Turn runtime histograms of the statistics command on or off" FORCE)
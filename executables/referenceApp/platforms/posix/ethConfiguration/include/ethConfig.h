@@ -19,6 +19,10 @@ static constexpr size_t NUM_NETIFS                          = 2;
 static constexpr uint16_t VLAN_UNTAGGED                     = 0xFFFF;
 // TODO: Choose appropriate MAC. Locally administrated seems to cause issues on S32K1xx.
 static constexpr ::etl::array<uint8_t const, 6> MAC_ADDRESS = {0x10, 0x11, 0x22, 0x77, 0x77, 0x88};
+// received frames that can be held by lwip at the same time
+static constexpr size_t NUM_RX_FRAMES                       = 32;
+// maximum number of frames read from the tap interface per wake-up, must fit into the pbuf queue
+static constexpr size_t RX_FRAME_BUDGET                     = 8;
 } // namespace ethX
 
 namespace eth0
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <async/util/Call.h>
+#include <bsp/IoReactor.h>
 #include <can/SocketCanTransceiver.h>
 #include <lifecycle/AsyncLifecycleComponent.h>
 #include <systems/ICanSystem.h>
@@ -24,7 +26,7 @@ class CanSystem final
 {
 public:
     // [PUBLIC_API_START]
-    explicit CanSystem(::async::ContextType context);
+    CanSystem(::async::ContextType context, ::bsp::IoReactor& ioReactor);
     CanSystem(CanSystem const&)            = delete;
     CanSystem& operator=(CanSystem const&) = delete;
 
@@ -36,10 +38,15 @@ public:
     // [PUBLIC_API_END]
 private:
     void execute() final;
+    void receive();
+    void wakeup();
 
 private:
     ::async::TimeoutType _timeout;
     ::async::ContextType _context;
+    ::bsp::IoReactor& _ioReactor;
+    ::async::Function _receive;
+    ::bsp::IoReactor::Source _socketSource;
 
     ::can::SocketCanTransceiver _canTransceiver;
 };
@@ -0,0 +1,26 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <bsp/IoReactor.h>
+
+namespace systems
+{
+
+/**
+ * Starts the thread of \p ioReactor with an interrupt function for the RTOS port, the ready
+ * sources are dispatched from an interrupt of the ISR group ISR_GROUP_IO.
+ *
+ * \return false if the interrupt can't be installed or the reactor can't be started
+ */
+bool startIoReactor(::bsp::IoReactor& ioReactor);
+
+} // namespace systems
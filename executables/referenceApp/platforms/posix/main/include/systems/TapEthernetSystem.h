@@ -11,7 +11,9 @@
 #pragma once
 
 #include "TapEthernetDriver.h"
+#include "ethConfig.h"
 
+#include <bsp/IoReactor.h>
 #include <ethernet/EthernetLogger.h>
 #include <lifecycle/AsyncLifecycleComponent.h>
 #include <systems/IEthernetDriverSystem.h>
@@ -25,7 +27,7 @@ class TapEthernetSystem final
 , public ::async::IRunnable
 {
 public:
-    explicit TapEthernetSystem(::async::ContextType context);
+    TapEthernetSystem(::async::ContextType context, ::bsp::IoReactor& ioReactor);
 
     void init() override;
 
@@ -45,7 +47,9 @@ public:
 
     ::async::ContextType _context;
     ::async::TimeoutType _rxTimeout;
-    ::ethernet::TapEthernetDriver _driver;
+    ::bsp::IoReactor& _ioReactor;
+    ::bsp::IoReactor::Source _rxSource;
+    ::ethernet::declare::TapEthernetDriver<ethX::NUM_RX_FRAMES> _driver;
 };
 
 } // namespace systems
@@ -0,0 +1,60 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "systems/IoReactorInterrupt.h"
+
+#include "FreeRTOS.h"
+#include "async/Config.h"
+#include "async/Hook.h"
+
+#include <csignal>
+#include <unistd.h>
+
+namespace systems
+{
+namespace
+{
+
+::bsp::IoReactor* ioReactorInstance = nullptr;
+
+void ioReactorSignalHandler(int /* sig */)
+{
+    // Like the tick handler of the port, the handler runs with all signals blocked. The critical
+    // nesting keeps a yield when leaving the ISR group from unblocking them.
+    portENTER_CRITICAL();
+    ::asyncEnterIsrGroup(ISR_GROUP_IO);
+    ioReactorInstance->dispatch();
+    ::asyncLeaveIsrGroup(ISR_GROUP_IO);
+    portEXIT_CRITICAL();
+}
+
+void raiseIoReactorInterrupt()
+{
+    // SIGALRM and SIGUSR1 are used by the port. Like the tick, the signal is sent to the process
+    // and is delivered to the thread of the running task, the only one with unblocked signals.
+    (void)kill(getpid(), SIGRTMIN);
+}
+
+} // namespace
+
+bool startIoReactor(::bsp::IoReactor& ioReactor)
+{
+    ioReactorInstance = &ioReactor;
+    struct sigaction action = {};
+    action.sa_handler       = &ioReactorSignalHandler;
+    sigfillset(&action.sa_mask);
+    if (sigaction(SIGRTMIN, &action, nullptr) < 0)
+    {
+        return false;
+    }
+    return ioReactor.start(::bsp::IoReactor::InterruptFunction::create<&raiseIoReactorInterrupt>());
+}
+
+} // namespace systems
@@ -0,0 +1,43 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "systems/IoReactorInterrupt.h"
+
+#include "async/Config.h"
+#include "async/Hook.h"
+#include "tx_api.h"
+
+namespace systems
+{
+namespace
+{
+
+::bsp::IoReactor* ioReactorInstance = nullptr;
+
+void raiseIoReactorInterrupt()
+{
+    // The reactor thread enters the interrupt like the timer thread of the port, which suspends
+    // the running thread until the interrupt is left.
+    _tx_thread_context_save();
+    ::asyncEnterIsrGroup(ISR_GROUP_IO);
+    ioReactorInstance->dispatch();
+    ::asyncLeaveIsrGroup(ISR_GROUP_IO);
+    _tx_thread_context_restore();
+}
+
+} // namespace
+
+bool startIoReactor(::bsp::IoReactor& ioReactor)
+{
+    ioReactorInstance = &ioReactor;
+    return ioReactor.start(::bsp::IoReactor::InterruptFunction::create<&raiseIoReactorInterrupt>());
+}
+
+} // namespace systems
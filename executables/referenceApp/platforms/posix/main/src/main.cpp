@@ -9,8 +9,10 @@
  ********************************************************************************/
 
 #include "lifecycle/StaticBsp.h"
+#include "systems/IoReactorInterrupt.h"
 
 #include <async/AsyncBinding.h>
+#include <bsp/IoReactor.h>
 #include <etl/alignment.h>
 #include <lifecycle/LifecycleManager.h>
 #include <safeSupervisor/SafeSupervisor.h>
@@ -36,6 +38,8 @@ StaticBsp staticBsp;
 
 StaticBsp& getStaticBsp() { return staticBsp; }
 
+::bsp::IoReactor ioReactor;
+
 #ifdef PLATFORM_SUPPORT_CAN
 ::etl::typed_storage<::systems::CanSystem> canSystem;
 #endif // PLATFORM_SUPPORT_CAN
@@ -47,13 +51,22 @@ StaticBsp& getStaticBsp() { return staticBsp; }
 void platformLifecycleAdd(::lifecycle::LifecycleManager& lifecycleManager, uint8_t const level)
 {
     (void)lifecycleManager;
+    if (level == 1)
+    {
+        // Without the reactor thread, the systems can't add their sources and poll instead.
+        if (ioReactor.open() && !::systems::startIoReactor(ioReactor))
+        {
+            ioReactor.close();
+        }
+    }
     if (level == 2)
     {
 #ifdef PLATFORM_SUPPORT_CAN
-        lifecycleManager.addComponent("can", canSystem.create(TASK_CAN), level);
+        lifecycleManager.addComponent("can", canSystem.create(TASK_CAN, ioReactor), level);
 #endif // PLATFORM_SUPPORT_CAN
 #ifdef PLATFORM_SUPPORT_ETHERNET
-        lifecycleManager.addComponent("eth", tapEthernetSystem.create(TASK_ETHERNET), level);
+        lifecycleManager.addComponent(
+            "eth", tapEthernetSystem.create(TASK_ETHERNET, ioReactor), level);
 #endif // PLATFORM_SUPPORT_ETHERNET
     }
 }
@@ -19,12 +19,17 @@ static int const MAX_RECEIVED_PER_RUN          = 3;
 namespace
 {
 
-::can::SocketCanTransceiver::DeviceConfig canConfig{"vcan0", ::busid::CAN_0};
+::can::SocketCanTransceiver::DeviceConfig canConfig{"vcan0", ::busid::CAN_0, false, false};
 
 } // namespace
 
-CanSystem::CanSystem(::async::ContextType context)
-: _timeout(), _context(context), _canTransceiver(canConfig)
+CanSystem::CanSystem(::async::ContextType context, ::bsp::IoReactor& ioReactor)
+: _timeout()
+, _context(context)
+, _ioReactor(ioReactor)
+, _receive(::async::Function::CallType::create<CanSystem, &CanSystem::receive>(*this))
+, _socketSource(context, _receive)
+, _canTransceiver(canConfig)
 {
     setTransitionContext(context);
 }
@@ -35,14 +40,24 @@ void CanSystem::run()
 {
     _canTransceiver.init();
     _canTransceiver.open();
-    ::async::scheduleAtFixedRate(
-        _context, *this, _timeout, TIMEOUT_CAN_SYSTEM_IN_MS, ::async::TimeUnit::MILLISECONDS);
+    if (_ioReactor.add(_socketSource, _canTransceiver.getFileDescriptor()))
+    {
+        _canTransceiver.enableEventMode(
+            ::can::SocketCanTransceiver::WakeupFunction::create<CanSystem, &CanSystem::wakeup>(
+                *this));
+    }
+    else
+    {
+        ::async::scheduleAtFixedRate(
+            _context, *this, _timeout, TIMEOUT_CAN_SYSTEM_IN_MS, ::async::TimeUnit::MILLISECONDS);
+    }
     transitionDone();
 }
 
 void CanSystem::shutdown()
 {
     _timeout.cancel();
+    _ioReactor.remove(_socketSource);
     _canTransceiver.close();
     _canTransceiver.shutdown();
     transitionDone();
@@ -57,6 +72,36 @@ void CanSystem::shutdown()
     return nullptr;
 }
 
-void CanSystem::execute() { _canTransceiver.run(MAX_SENT_PER_RUN, MAX_RECEIVED_PER_RUN); }
+void CanSystem::execute()
+{
+    bool const wasReadable = _canTransceiver.isReadable();
+    _canTransceiver.run(MAX_SENT_PER_RUN, MAX_RECEIVED_PER_RUN);
+    if (_canTransceiver.isReadable())
+    {
+        // more frames may be waiting
+        ::async::execute(_context, *this);
+        return;
+    }
+    if (wasReadable)
+    {
+        // the socket has no more frames
+        _ioReactor.rearm(_socketSource);
+    }
+    if (_canTransceiver.hasPendingEvents())
+    {
+        // Frames left in the send queue don't wake up the context again. Has no effect while
+        // polling, as the timeout is active then.
+        ::async::schedule(
+            _context, *this, _timeout, TIMEOUT_CAN_SYSTEM_IN_MS, ::async::TimeUnit::MILLISECONDS);
+    }
+}
+
+void CanSystem::receive()
+{
+    _canTransceiver.setReadable();
+    execute();
+}
+
+void CanSystem::wakeup() { ::async::execute(_context, *this); }
 
 } // namespace systems
@@ -12,13 +12,19 @@
 
 #include "ethConfig.h"
 
-#include <poll.h>
-
 namespace systems
 {
+static_assert(
+    ethX::RX_FRAME_BUDGET <= ::lwiputils::PbufQueue::MAX_SIZE,
+    "frames read per wake-up must fit into the pbuf queue");
 
-TapEthernetSystem::TapEthernetSystem(::async::ContextType const context)
-: _context(context), _rxTimeout(), _driver(ethX::MAC_ADDRESS)
+TapEthernetSystem::TapEthernetSystem(
+    ::async::ContextType const context, ::bsp::IoReactor& ioReactor)
+: _context(context)
+, _rxTimeout()
+, _ioReactor(ioReactor)
+, _rxSource(context, *this)
+, _driver(ethX::MAC_ADDRESS)
 {}
 
 void TapEthernetSystem::init() { transitionDone(); }
@@ -33,14 +39,18 @@ void TapEthernetSystem::run()
     else
     {
         ::util::logger::Logger::info(::util::logger::ETHERNET, "TapEthernetDriver started!");
-        ::async::scheduleAtFixedRate(
-            _context, *this, _rxTimeout, 1, ::async::TimeUnitType::MILLISECONDS);
+        if (!_ioReactor.add(_rxSource, _driver.getTapInterfaceFd()))
+        {
+            ::async::scheduleAtFixedRate(
+                _context, *this, _rxTimeout, 1, ::async::TimeUnitType::MILLISECONDS);
+        }
     }
     transitionDone();
 }
 
 void TapEthernetSystem::shutdown()
 {
+    _ioReactor.remove(_rxSource);
     _driver.stop();
     _rxTimeout.cancel();
     transitionDone();
@@ -48,15 +58,22 @@ void TapEthernetSystem::shutdown()
 
 void TapEthernetSystem::execute()
 {
-    pollfd pollFds[1];
-    pollFds[0].fd     = _driver.getTapInterfaceFd();
-    pollFds[0].events = POLLIN;
-    while (poll(pollFds, 1, 0) > 0)
+    size_t const count = _driver.readFrames(ethX::RX_FRAME_BUDGET);
+    if (count == ethX::RX_FRAME_BUDGET)
     {
-        if ((pollFds[0].revents & POLLIN) != 0)
-        {
-            _driver.readFrame();
-        }
+        // more frames may be waiting
+        ::async::execute(_context, *this);
+    }
+    else if (_driver.canReadFrame())
+    {
+        // the tap interface has no more data
+        _ioReactor.rearm(_rxSource);
+    }
+    else
+    {
+        // Receive buffers exhausted or pbuf queue full. Waiting for the tap interface would
+        // return immediately, so retry once lwip has processed some frames.
+        ::async::schedule(_context, *this, _rxTimeout, 1, ::async::TimeUnitType::MILLISECONDS);
     }
 }
 
@@ -13,16 +13,34 @@
  */
 #pragma once
 
+#include "async/IExecutor.h"
 #include "async/TaskContext.h"
 #include "async/TaskInitializer.h"
 
 #include <etl/array.h>
 #include <etl/error_handler.h>
+#include <etl/type_traits.h>
 
 namespace async
 {
 namespace internal
 {
+/**
+ * Timer of the task contexts, Binding::TimerType if the binding defines it, e.g.
+ * ::timer::TimingWheelTimer<LockType> for contexts with many concurrent timeouts.
+ */
+template<class Binding, class = void>
+struct TimerTypeOf
+{
+    using Type = ::timer::Timer<LockType>;
+};
+
+template<class Binding>
+struct TimerTypeOf<Binding, ::etl::void_t<typename Binding::TimerType>>
+{
+    using Type = typename Binding::TimerType;
+};
+
 template<bool HasNestedInterrupts = (ASYNC_CONFIG_NESTED_INTERRUPTS != 0)>
 class NestedInterruptLock : public LockType
 {};
@@ -67,7 +85,8 @@ public:
  * `Binding` type to adapt and configure task-related components, such as `TaskContext`,
  * `TaskConfig`, and idle and timer tasks.
  *
- * \tparam Binding The binding type specifying application-specific configurations.
+ * \tparam Binding The binding type specifying application-specific configurations. It may
+ *         define TimerType to replace the ::timer::Timer of the task contexts.
  */
 template<class Binding>
 class FreeRtosAdapter
@@ -82,7 +101,8 @@ public:
 
     using AdapterType = FreeRtosAdapter<Binding>;
 
-    using TaskContextType  = TaskContext<AdapterType>;
+    using TimerType        = typename internal::TimerTypeOf<Binding>::Type;
+    using TaskContextType  = TaskContext<AdapterType, TimerType>;
     using TaskFunctionType = typename TaskContextType::TaskFunctionType;
 
     using TaskConfigsType = internal::TaskConfigHolder<OS_TASK_COUNT>;
@@ -203,6 +223,25 @@ public:
      */
     static void cancel(TimeoutType& timeout);
 
+    /**
+     * Serves the runnables of a context by an executor instead of the task of the context, e.g.
+     * by a pool of worker threads. Timeouts of the context still expire in its task and their
+     * runnables are handed over to the executor. Must be called before the context is used.
+     *
+     * \param context The task context.
+     * \param executor The executor serving the runnables of the context, nullptr for the task.
+     */
+    static void setContextExecutor(ContextType context, IExecutor* executor);
+
+    /**
+     * Executes the runnable of an expired timeout, either directly or by the executor of the
+     * context.
+     *
+     * \param context The task context of the timeout.
+     * \param runnable The runnable of the timeout.
+     */
+    static void executeExpired(ContextType context, RunnableType& runnable);
+
     /// Notifies the system of an interrupt entry.
     static void enterIsr();
 
@@ -229,6 +268,7 @@ private:
     static TaskInitializer* _idleTaskInitializer;
     static TaskInitializer* _timerTaskInitializer;
     static ::etl::array<TaskContextType, TASK_COUNT> _taskContexts;
+    static ::etl::array<IExecutor*, TASK_COUNT> _contextExecutors;
     static ::etl::array<uint32_t, OS_TASK_COUNT> _stackSizes;
     static char const* _timerTaskName;
     static BaseType_t _higherPriorityTaskWokenFlag;
@@ -252,6 +292,9 @@ template<class Binding>
     array<typename FreeRtosAdapter<Binding>::TaskContextType, FreeRtosAdapter<Binding>::TASK_COUNT>
         FreeRtosAdapter<Binding>::_taskContexts;
 template<class Binding>
+::etl::array<IExecutor*, FreeRtosAdapter<Binding>::TASK_COUNT>
+    FreeRtosAdapter<Binding>::_contextExecutors;
+template<class Binding>
 ::etl::array<uint32_t, FreeRtosAdapter<Binding>::OS_TASK_COUNT>
     FreeRtosAdapter<Binding>::_stackSizes;
 template<class Binding>
@@ -383,7 +426,15 @@ inline void FreeRtosAdapter<Binding>::callIdleTaskFunction()
 template<class Binding>
 inline void FreeRtosAdapter<Binding>::execute(ContextType const context, RunnableType& runnable)
 {
-    _taskContexts[static_cast<size_t>(context)].execute(runnable);
+    IExecutor* const executor = _contextExecutors[static_cast<size_t>(context)];
+    if (executor != nullptr)
+    {
+        executor->execute(runnable);
+    }
+    else
+    {
+        _taskContexts[static_cast<size_t>(context)].execute(runnable);
+    }
 }
 
 template<class Binding>
@@ -420,6 +471,29 @@ inline void FreeRtosAdapter<Binding>::cancel(TimeoutType& timeout)
     }
 }
 
+template<class Binding>
+inline void
+FreeRtosAdapter<Binding>::setContextExecutor(ContextType const context, IExecutor* const executor)
+{
+    _contextExecutors[static_cast<size_t>(context)] = executor;
+}
+
+template<class Binding>
+inline void
+FreeRtosAdapter<Binding>::executeExpired(ContextType const context, RunnableType& runnable)
+{
+    IExecutor* const executor
+        = (static_cast<size_t>(context) < TASK_COUNT) ? _contextExecutors[context] : nullptr;
+    if (executor != nullptr)
+    {
+        executor->execute(runnable);
+    }
+    else
+    {
+        runnable.execute();
+    }
+}
+
 template<class Binding>
 inline BaseType_t* FreeRtosAdapter<Binding>::getHigherPriorityTaskWoken()
 {
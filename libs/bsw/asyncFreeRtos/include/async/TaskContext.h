@@ -37,12 +37,14 @@ namespace async
  * for task creation, scheduling and processing callbacks.
  *
  * \tparam Binding The specific binding type associated with the TaskContext.
+ * \tparam TimerType The timer managing the timeouts of this context, e.g. ::timer::Timer or
+ *         ::timer::TimingWheelTimer for contexts with many concurrent timeouts.
  */
-template<class Binding>
+template<class Binding, class TimerType = ::timer::Timer<LockType>>
 class TaskContext : public EventDispatcher<2U, LockType>
 {
 public:
-    using TaskFunctionType = ::etl::delegate<void(TaskContext<Binding>&)>;
+    using TaskFunctionType = ::etl::delegate<void(TaskContext<Binding, TimerType>&)>;
     using StackType        = ::etl::span<StackType_t>;
 
     TaskContext();
@@ -138,21 +140,20 @@ public:
      * Default function to be executed by a task within this context.
      * \param taskContext The context in which the task executes.
      */
-    static void defaultTaskFunction(TaskContext<Binding>& taskContext);
+    static void defaultTaskFunction(TaskContext<Binding, TimerType>& taskContext);
 
     /**
      * Default function to be executed by the idle task.
      * \param taskContext The context in which the task executes.
      */
-    static void defaultIdleFunction(TaskContext<Binding>& taskContext);
+    static void defaultIdleFunction(TaskContext<Binding, TimerType>& taskContext);
 
 private:
-    friend class EventPolicy<TaskContext<Binding>, 0U>;
-    friend class EventPolicy<TaskContext<Binding>, 1U>;
+    friend class EventPolicy<TaskContext<Binding, TimerType>, 0U>;
+    friend class EventPolicy<TaskContext<Binding, TimerType>, 1U>;
 
-    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding>, 0U>;
-    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding>, 1U>;
-    using TimerType              = ::timer::Timer<LockType>;
+    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding, TimerType>, 0U>;
+    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding, TimerType>, 1U>;
 
     static EventMaskType const STOP_EVENT_MASK = static_cast<EventMaskType>(
         static_cast<EventMaskType>(1U) << static_cast<EventMaskType>(EVENT_COUNT));
@@ -166,7 +167,8 @@ private:
 
     static void staticTaskFunction(void* param);
 
-    RunnableExecutor<RunnableType, ExecuteEventPolicyType, LockType> _runnableExecutor;
+    RunnableExecutor<RunnableType, ExecuteEventPolicyType, LockType, RunnableQueueType>
+        _runnableExecutor;
     TimerType _timer;
     TimerEventPolicyType _timerEventPolicy;
     TaskFunctionType _taskFunction;
@@ -178,8 +180,8 @@ private:
 /**
  * Inline implementations.
  */
-template<class Binding>
-inline TaskContext<Binding>::TaskContext()
+template<class Binding, class TimerType>
+inline TaskContext<Binding, TimerType>::TaskContext()
 : _runnableExecutor(*this)
 , _timerEventPolicy(*this)
 , _taskFunction()
@@ -192,8 +194,8 @@ inline TaskContext<Binding>::TaskContext()
     _runnableExecutor.init();
 }
 
-template<class Binding>
-void TaskContext<Binding>::initTask(
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::initTask(
     ContextType const context, char const* const name, TaskFunctionType const taskFunction)
 {
     _context      = context;
@@ -203,14 +205,14 @@ void TaskContext<Binding>::initTask(
                         : TaskFunctionType::template create<&TaskContext::defaultIdleFunction>();
 }
 
-template<class Binding>
-void TaskContext<Binding>::initTaskHandle(TaskHandle_t const taskHandle)
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::initTaskHandle(TaskHandle_t const taskHandle)
 {
     _taskHandle = taskHandle;
 }
 
-template<class Binding>
-void TaskContext<Binding>::createTask(
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::createTask(
     ContextType const context,
     StaticTask_t& task,
     char const* const name,
@@ -233,32 +235,32 @@ void TaskContext<Binding>::createTask(
         &task);
 }
 
-template<class Binding>
-inline char const* TaskContext<Binding>::getName() const
+template<class Binding, class TimerType>
+inline char const* TaskContext<Binding, TimerType>::getName() const
 {
     return _name;
 }
 
-template<class Binding>
-inline TaskHandle_t TaskContext<Binding>::getTaskHandle() const
+template<class Binding, class TimerType>
+inline TaskHandle_t TaskContext<Binding, TimerType>::getTaskHandle() const
 {
     return _taskHandle;
 }
 
-template<class Binding>
-inline uint32_t TaskContext<Binding>::getUnusedStackSize() const
+template<class Binding, class TimerType>
+inline uint32_t TaskContext<Binding, TimerType>::getUnusedStackSize() const
 {
     return getUnusedStackSize(_taskHandle);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::execute(RunnableType& runnable)
+template<class Binding, class TimerType>
+inline void TaskContext<Binding, TimerType>::execute(RunnableType& runnable)
 {
     _runnableExecutor.enqueue(runnable);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::schedule(
+template<class Binding, class TimerType>
+inline void TaskContext<Binding, TimerType>::schedule(
     RunnableType& runnable, TimeoutType& timeout, uint32_t const delay, TimeUnitType const unit)
 {
     if (!_timer.isActive(timeout))
@@ -272,8 +274,8 @@ inline void TaskContext<Binding>::schedule(
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::scheduleAtFixedRate(
+template<class Binding, class TimerType>
+inline void TaskContext<Binding, TimerType>::scheduleAtFixedRate(
     RunnableType& runnable, TimeoutType& timeout, uint32_t const period, TimeUnitType const unit)
 {
     if (!_timer.isActive(timeout))
@@ -287,14 +289,14 @@ inline void TaskContext<Binding>::scheduleAtFixedRate(
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::cancel(TimeoutType& timeout)
+template<class Binding, class TimerType>
+inline void TaskContext<Binding, TimerType>::cancel(TimeoutType& timeout)
 {
     _timer.cancel(timeout);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::setEvents(EventMaskType const eventMask)
+template<class Binding, class TimerType>
+inline void TaskContext<Binding, TimerType>::setEvents(EventMaskType const eventMask)
 {
     BaseType_t* const higherPriorityTaskHasWoken = Binding::getHigherPriorityTaskWoken();
     if (higherPriorityTaskHasWoken != nullptr)
@@ -307,8 +309,8 @@ inline void TaskContext<Binding>::setEvents(EventMaskType const eventMask)
     }
 }
 
-template<class Binding>
-inline EventMaskType TaskContext<Binding>::waitEvents()
+template<class Binding, class TimerType>
+inline EventMaskType TaskContext<Binding, TimerType>::waitEvents()
 {
     EventMaskType eventMask = 0U;
     uint32_t ticks          = Binding::WAIT_EVENTS_TICK_COUNT;
@@ -332,22 +334,22 @@ inline EventMaskType TaskContext<Binding>::waitEvents()
     }
 }
 
-template<class Binding>
-inline EventMaskType TaskContext<Binding>::peekEvents()
+template<class Binding, class TimerType>
+inline EventMaskType TaskContext<Binding, TimerType>::peekEvents()
 {
     EventMaskType eventMask = 0U;
     (void)xTaskNotifyWait(0U, WAIT_EVENT_MASK, &eventMask, 0U);
     return eventMask;
 }
 
-template<class Binding>
-void TaskContext<Binding>::callTaskFunction()
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::callTaskFunction()
 {
     _taskFunction(*this);
 }
 
-template<class Binding>
-void TaskContext<Binding>::dispatch()
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::dispatch()
 {
     EventMaskType eventMask = 0U;
     while ((eventMask & STOP_EVENT_MASK) == 0U)
@@ -357,14 +359,14 @@ void TaskContext<Binding>::dispatch()
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::stopDispatch()
+template<class Binding, class TimerType>
+inline void TaskContext<Binding, TimerType>::stopDispatch()
 {
     setEvents(STOP_EVENT_MASK);
 }
 
-template<class Binding>
-void TaskContext<Binding>::dispatchWhileWork()
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::dispatchWhileWork()
 {
     while (true)
     {
@@ -381,33 +383,35 @@ void TaskContext<Binding>::dispatchWhileWork()
     }
 }
 
-template<class Binding>
-uint32_t TaskContext<Binding>::getUnusedStackSize(TaskHandle_t const taskHandle)
+template<class Binding, class TimerType>
+uint32_t TaskContext<Binding, TimerType>::getUnusedStackSize(TaskHandle_t const taskHandle)
 {
     return static_cast<uint32_t>(uxTaskGetStackHighWaterMark(taskHandle))
            * static_cast<uint32_t>(sizeof(StackType_t));
 }
 
-template<class Binding>
-void TaskContext<Binding>::defaultTaskFunction(TaskContext<Binding>& taskContext)
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::defaultTaskFunction(
+    TaskContext<Binding, TimerType>& taskContext)
 {
     taskContext.dispatch();
 }
 
-template<class Binding>
-void TaskContext<Binding>::defaultIdleFunction(TaskContext<Binding>& taskContext)
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::defaultIdleFunction(
+    TaskContext<Binding, TimerType>& taskContext)
 {
     taskContext.dispatchWhileWork();
 }
 
-template<class Binding>
-void TaskContext<Binding>::handleTimeout()
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::handleTimeout()
 {
     while (_timer.processNextTimeout(getSystemTimeUs32Bit())) {}
 }
 
-template<class Binding>
-void TaskContext<Binding>::staticTaskFunction(void* const param)
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::staticTaskFunction(void* const param)
 {
     TaskContext& taskContext = *reinterpret_cast<TaskContext*>(param);
     taskContext.callTaskFunction();
@@ -15,7 +15,9 @@
 
 #include "async/IRunnable.h"
 #include "async/Lock.h"
+#include "async/LockFreeQueue.h"
 #include "async/ModifiableLock.h"
+#include "async/Queue.h"
 
 #include <timer/Timeout.h>
 
@@ -29,6 +31,13 @@ using EventMaskType      = uint32_t;
 using LockType           = Lock;
 using ModifiableLockType = ModifiableLock;
 
+#ifdef PLATFORM_SUPPORT_LOCK_FREE_RUNNABLE_QUEUE
+// runnables are enqueued without disabling interrupts
+using RunnableQueueType = LockFreeQueue<RunnableType>;
+#else
+using RunnableQueueType = Queue<RunnableType>;
+#endif
+
 ContextType const CONTEXT_INVALID = 0xFFU;
 
 /**
@@ -15,6 +15,7 @@
 
 #include <bsp/timer/SystemTimerMock.h>
 #include <os/FreeRtosMock.h>
+#include <timer/TimingWheelTimer.h>
 
 namespace
 {
@@ -24,6 +25,12 @@ using namespace ::testing;
 struct TestStatistics
 {};
 
+class ExecutorMock : public IExecutor
+{
+public:
+    MOCK_METHOD(void, execute, (IRunnable & runnable), (override));
+};
+
 struct TestBinding
 {
     static size_t const TASK_COUNT             = 3U;
@@ -33,6 +40,17 @@ struct TestBinding
     using FunctionStatisticsType = TestStatistics;
 };
 
+struct TimingWheelBinding : public TestBinding
+{
+    using TimerType = ::timer::TimingWheelTimer<LockType>;
+};
+
+static_assert(
+    ::etl::is_same<
+        FreeRtosAdapter<TestBinding>::TaskContextType,
+        TaskContext<FreeRtosAdapter<TestBinding>, ::timer::Timer<LockType>>>::value,
+    "task contexts use ::timer::Timer by default");
+
 class FreeRtosAdapterTest : public Test
 {
 public:
@@ -276,6 +294,76 @@ TEST_F(FreeRtosAdapterTest, testExecuteAndScheduleCalls)
     }
 }
 
+/**
+ * \desc: To test the schedule functionality with a timer type defined by the binding
+ */
+TEST_F(FreeRtosAdapterTest, testScheduleWithBindingTimerType)
+{
+    using TimingWheelCutType = FreeRtosAdapter<TimingWheelBinding>;
+    static_assert(
+        ::etl::is_same<
+            TimingWheelCutType::TaskContextType,
+            TaskContext<TimingWheelCutType, ::timer::TimingWheelTimer<LockType>>>::value,
+        "task contexts use the timer type of the binding");
+
+    char const* name = "test";
+    TimingWheelCutType::Task<1U, 256U> task(name);
+    uint32_t taskHandle = 12;
+    EXPECT_CALL(
+        _freeRtosMock,
+        xTaskCreateStatic(
+            NotNull(), name, 256U / sizeof(StackType_t), NotNull(), 1U, NotNull(), NotNull()))
+        .WillOnce(Return(&taskHandle));
+    EXPECT_CALL(_freeRtosMock, vTaskStartScheduler());
+    TimingWheelCutType::run(
+        TimingWheelCutType::StartAppFunctionType::
+            create<FreeRtosAdapterTest, &FreeRtosAdapterTest::startApp>(*this));
+    {
+        EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit()).WillOnce(Return(100U));
+        EXPECT_CALL(_freeRtosMock, xTaskNotify(&taskHandle, _, eSetBits));
+        TimingWheelCutType::schedule(1U, _runnableMock, _timeout, 1000U, TimeUnit::MICROSECONDS);
+        TimingWheelCutType::cancel(_timeout);
+        // cancel again should be neutral
+        TimingWheelCutType::cancel(_timeout);
+    }
+    {
+        EXPECT_CALL(_systemTimerMock, getSystemTimeUs32Bit()).WillOnce(Return(100U));
+        EXPECT_CALL(_freeRtosMock, xTaskNotify(&taskHandle, _, eSetBits));
+        TimingWheelCutType::scheduleAtFixedRate(
+            1U, _runnableMock, _timeout, 900U, TimeUnit::MICROSECONDS);
+        TimingWheelCutType::cancel(_timeout);
+    }
+}
+
+TEST_F(FreeRtosAdapterTest, testContextExecutor)
+{
+    StrictMock<ExecutorMock> executorMock;
+    CutType::setContextExecutor(2U, &executorMock);
+    {
+        // expect runnables of the context to be handed over to the executor
+        EXPECT_CALL(executorMock, execute(Ref(_runnableMock)));
+        CutType::execute(2U, _runnableMock);
+        Mock::VerifyAndClearExpectations(&executorMock);
+    }
+    {
+        // expect runnables of expired timeouts to be handed over to the executor
+        EXPECT_CALL(executorMock, execute(Ref(_runnableMock)));
+        CutType::executeExpired(2U, _runnableMock);
+        Mock::VerifyAndClearExpectations(&executorMock);
+    }
+    {
+        // expect runnables of expired timeouts of other contexts to be executed directly
+        EXPECT_CALL(_runnableMock, execute());
+        CutType::executeExpired(1U, _runnableMock);
+        Mock::VerifyAndClearExpectations(&_runnableMock);
+    }
+    CutType::setContextExecutor(2U, nullptr);
+    {
+        EXPECT_CALL(_runnableMock, execute());
+        CutType::executeExpired(2U, _runnableMock);
+    }
+}
+
 /**
  * \refs: SMD_asyncFreeRtos_TaskContextInformational
  * \desc: To test the minimum stack size
@@ -0,0 +1,171 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <async/EventPolicy.h>
+#include <async/IRunnable.h>
+#include <async/LockFreeQueue.h>
+#include <async/Queue.h>
+#include <async/RunnableExecutor.h>
+#include <benchmark/benchmark.h>
+
+#include <etl/delegate.h>
+
+#include <array>
+#include <mutex>
+#include <signal.h>
+
+namespace
+{
+constexpr size_t RUNNABLE_COUNT = 64U;
+
+/**
+ * Lock of the POSIX FreeRTOS port: taskENTER_CRITICAL() blocks all signals of the calling thread.
+ * The mutex stands in for the scheduler, which runs one task at a time.
+ */
+class PosixCriticalSectionLock
+{
+public:
+    PosixCriticalSectionLock()
+    {
+        sigset_t allSignals;
+        (void)sigfillset(&allSignals);
+        (void)pthread_sigmask(SIG_BLOCK, &allSignals, nullptr);
+        mutex().lock();
+    }
+
+    ~PosixCriticalSectionLock()
+    {
+        mutex().unlock();
+        sigset_t allSignals;
+        (void)sigfillset(&allSignals);
+        (void)pthread_sigmask(SIG_UNBLOCK, &allSignals, nullptr);
+    }
+
+private:
+    static std::mutex& mutex()
+    {
+        static std::mutex instance;
+        return instance;
+    }
+};
+
+class EventDispatcher
+{
+public:
+    using HandlerFunctionType = ::etl::delegate<void()>;
+
+    void setEventHandler(size_t, HandlerFunctionType const handlerFunction)
+    {
+        _handlerFunction = handlerFunction;
+    }
+
+    void removeEventHandler(size_t) { _handlerFunction = HandlerFunctionType(); }
+
+    void setEvents(::async::EventMaskType) {}
+
+    void handleEvents() { _handlerFunction(); }
+
+private:
+    HandlerFunctionType _handlerFunction;
+};
+
+class Runnable : public ::async::IRunnable
+{
+public:
+    void execute() override { benchmark::DoNotOptimize(++_executions); }
+
+    size_t _executions = 0U;
+};
+
+template<typename QueueType>
+using Executor = ::async::RunnableExecutor<
+    ::async::IRunnable,
+    ::async::EventPolicy<EventDispatcher, 0U>,
+    PosixCriticalSectionLock,
+    QueueType>;
+
+/**
+ * Enqueues RUNNABLE_COUNT runnables and executes them from the same thread.
+ */
+template<typename QueueType>
+void BM_enqueue_and_execute(benchmark::State& state)
+{
+    EventDispatcher dispatcher;
+    Executor<QueueType> executor(dispatcher);
+    executor.init();
+    std::array<Runnable, RUNNABLE_COUNT> runnables;
+
+    for (auto _ : state)
+    {
+        for (auto& runnable : runnables)
+        {
+            executor.enqueue(runnable);
+        }
+        dispatcher.handleEvents();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * RUNNABLE_COUNT));
+    executor.shutdown();
+}
+
+BENCHMARK_TEMPLATE(BM_enqueue_and_execute, ::async::Queue<::async::IRunnable>)
+    ->Name("BM_enqueue_and_execute/Queue");
+BENCHMARK_TEMPLATE(BM_enqueue_and_execute, ::async::LockFreeQueue<::async::IRunnable>)
+    ->Name("BM_enqueue_and_execute/LockFreeQueue");
+
+/**
+ * Enqueues runnables from several threads into one executor. The first thread also executes
+ * them, i.e. it is the task owning the executor.
+ */
+template<typename QueueType>
+void BM_concurrent_enqueue(benchmark::State& state)
+{
+    static EventDispatcher dispatcher;
+    static Executor<QueueType>* executor = nullptr;
+    static std::array<std::array<Runnable, RUNNABLE_COUNT>, 8U> runnables;
+
+    if (state.thread_index() == 0)
+    {
+        executor = new Executor<QueueType>(dispatcher);
+        executor->init();
+    }
+    for (auto _ : state)
+    {
+        for (auto& runnable : runnables[static_cast<size_t>(state.thread_index())])
+        {
+            executor->enqueue(runnable);
+        }
+        if (state.thread_index() == 0)
+        {
+            dispatcher.handleEvents();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * RUNNABLE_COUNT));
+    if (state.thread_index() == 0)
+    {
+        // runnables left by the other threads
+        dispatcher.handleEvents();
+        executor->shutdown();
+        delete executor;
+        executor = nullptr;
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_concurrent_enqueue, ::async::Queue<::async::IRunnable>)
+    ->Name("BM_concurrent_enqueue/Queue")
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_concurrent_enqueue, ::async::LockFreeQueue<::async::IRunnable>)
+    ->Name("BM_concurrent_enqueue/LockFreeQueue")
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,38 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include "async/IRunnable.h"
+
+namespace async
+{
+/**
+ * Executes runnables of a context outside of the task of the context, e.g. in a pool of worker
+ * threads.
+ */
+class IExecutor
+{
+public:
+    /**
+     * Enqueues a runnable for execution. A runnable that is still enqueued isn't enqueued again.
+     * Can be called from any context.
+     * \param runnable Runnable to be executed
+     */
+    virtual void execute(IRunnable& runnable) = 0;
+
+protected:
+    IExecutor& operator=(IExecutor const&) = default;
+};
+
+} // namespace async
@@ -0,0 +1,97 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/**
+ * \ingroup async
+ */
+#pragma once
+
+#include <etl/atomic.h>
+
+namespace async
+{
+/**
+ * An intrusive multi-producer single-consumer queue that doesn't need a lock. It can be used
+ * instead of Queue where disabling interrupts for each enqueue and dequeue is too expensive.
+ *
+ * Producers push nodes onto a list with a compare-and-swap of the last node. The consumer takes
+ * all nodes with a single exchange and gets them in the order they have been enqueued. A node
+ * that is still enqueued isn't enqueued again, like with Queue.
+ *
+ * \tparam Node Type of the nodes, derived from QueueNode<Node>.
+ */
+template<typename Node>
+class LockFreeQueue
+{
+public:
+    LockFreeQueue();
+
+    LockFreeQueue(LockFreeQueue const&)            = delete;
+    LockFreeQueue& operator=(LockFreeQueue const&) = delete;
+
+    /**
+     * Enqueues a node if it isn't enqueued yet. Can be called concurrently from any context.
+     * \param node node to enqueue
+     * \return true if the node has been enqueued, false if it already was enqueued
+     */
+    bool enqueue(Node& node);
+
+    /**
+     * Takes all enqueued nodes. Must only be called by a single consumer. The nodes stay enqueued
+     * and are linked in the order they have been enqueued, the consumer dequeues each of them,
+     * e.g. with ``node = node->dequeue()``.
+     * \return first of the taken nodes, nullptr if the queue is empty
+     */
+    Node* dequeueAll();
+
+private:
+    ::etl::atomic<Node*> _last;
+};
+
+/**
+ * Inline implementations.
+ */
+template<typename Node>
+LockFreeQueue<Node>::LockFreeQueue() : _last(nullptr)
+{}
+
+template<typename Node>
+bool LockFreeQueue<Node>::enqueue(Node& node)
+{
+    if (!node.tryEnqueue())
+    {
+        return false;
+    }
+    Node* last = _last.load(::etl::memory_order_relaxed);
+    do
+    {
+        node.setNext(last);
+    } while (!_last.compare_exchange_weak(
+        last, &node, ::etl::memory_order_release, ::etl::memory_order_relaxed));
+    return true;
+}
+
+template<typename Node>
+Node* LockFreeQueue<Node>::dequeueAll()
+{
+    Node* node  = _last.exchange(nullptr, ::etl::memory_order_acquire);
+    Node* first = nullptr;
+    // the nodes are linked from the last to the first one
+    while (node != nullptr)
+    {
+        Node* const prev = node->getNext();
+        node->setNext(first);
+        first = node;
+        node  = prev;
+    }
+    return first;
+}
+
+} // namespace async
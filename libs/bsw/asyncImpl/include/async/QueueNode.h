@@ -13,24 +13,63 @@
  */
 #pragma once
 
+#include <etl/atomic.h>
+
 namespace async
 {
+/**
+ * Link of a node in a Queue or LockFreeQueue.
+ *
+ * The link is atomic for the LockFreeQueue, all accesses except tryEnqueue() are relaxed. Copying
+ * a node doesn't copy its link, a copy is never enqueued.
+ */
 template<typename T>
 class QueueNode
 {
 public:
     QueueNode();
+    QueueNode(QueueNode const& other);
+
+    QueueNode& operator=(QueueNode const& other);
 
     bool isEnqueued() const;
 
+    /**
+     * Checks whether an IExecutor executes the node, e.g. the WorkerPool of the POSIX platform.
+     * Such an executor keeps the node enqueued meanwhile with the link running() or
+     * runningAndEnqueued(), so the node must not be enqueued into a Queue or LockFreeQueue.
+     */
+    bool isRunning() const;
+
+    /** Link of a node executed by an IExecutor. */
+    static T* running();
+
+    /** Link of a node executed by an IExecutor that has been enqueued again meanwhile. */
+    static T* runningAndEnqueued();
+
     T* getNext() const;
     void setNext(T* next);
 
     void enqueue();
+
+    /**
+     * Marks the node as enqueued if it isn't yet. Thread-safe.
+     * \return true if the node has been marked, false if it already was enqueued
+     */
+    bool tryEnqueue();
+
+    /**
+     * Replaces the link if it equals an expected value. Thread-safe.
+     * \param expected expected value of the link
+     * \param next new value of the link
+     * \return true if the link has been replaced
+     */
+    bool compareAndSetNext(T* expected, T* next);
+
     T* dequeue();
 
 private:
-    T* _next;
+    ::etl::atomic<T*> _next;
 };
 
 /**
@@ -40,35 +79,78 @@ template<typename T>
 inline QueueNode<T>::QueueNode() : _next(reinterpret_cast<T*>(1U))
 {}
 
+template<typename T>
+inline QueueNode<T>::QueueNode(QueueNode const& /* other */) : _next(reinterpret_cast<T*>(1U))
+{}
+
+template<typename T>
+inline QueueNode<T>& QueueNode<T>::operator=(QueueNode const& /* other */)
+{
+    return *this;
+}
+
 template<typename T>
 inline bool QueueNode<T>::isEnqueued() const
 {
-    return _next != reinterpret_cast<T*>(1U);
+    return _next.load(::etl::memory_order_relaxed) != reinterpret_cast<T*>(1U);
+}
+
+template<typename T>
+inline bool QueueNode<T>::isRunning() const
+{
+    T* const next = _next.load(::etl::memory_order_relaxed);
+    return (next == running()) || (next == runningAndEnqueued());
+}
+
+template<typename T>
+inline T* QueueNode<T>::running()
+{
+    return reinterpret_cast<T*>(2U);
+}
+
+template<typename T>
+inline T* QueueNode<T>::runningAndEnqueued()
+{
+    return reinterpret_cast<T*>(3U);
 }
 
 template<typename T>
 inline T* QueueNode<T>::getNext() const
 {
-    return _next;
+    return _next.load(::etl::memory_order_relaxed);
 }
 
 template<typename T>
 inline void QueueNode<T>::setNext(T* const next)
 {
-    _next = next;
+    _next.store(next, ::etl::memory_order_relaxed);
 }
 
 template<typename T>
 inline void QueueNode<T>::enqueue()
 {
-    _next = nullptr;
+    _next.store(nullptr, ::etl::memory_order_relaxed);
+}
+
+template<typename T>
+inline bool QueueNode<T>::tryEnqueue()
+{
+    T* notEnqueued = reinterpret_cast<T*>(1U);
+    return _next.compare_exchange_strong(notEnqueued, nullptr, ::etl::memory_order_acquire);
+}
+
+template<typename T>
+inline bool QueueNode<T>::compareAndSetNext(T* expected, T* const next)
+{
+    return _next.compare_exchange_strong(
+        expected, next, ::etl::memory_order_acq_rel, ::etl::memory_order_acquire);
 }
 
 template<typename T>
 inline T* QueueNode<T>::dequeue()
 {
-    T* const prevNext = _next;
-    _next             = reinterpret_cast<T*>(1U);
+    T* const prevNext = _next.load(::etl::memory_order_relaxed);
+    _next.store(reinterpret_cast<T*>(1U), ::etl::memory_order_release);
     return prevNext;
 }
 
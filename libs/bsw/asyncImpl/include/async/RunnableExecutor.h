@@ -13,8 +13,10 @@
  */
 #pragma once
 
+#include "async/LockFreeQueue.h"
 #include "async/Queue.h"
 
+#include <etl/error_handler.h>
 #include <platform/config.h>
 
 namespace async
@@ -26,8 +28,15 @@ namespace async
  * \tparam Runnable Type of functions, that will be executed.
  * \tparam EventPolicy EventPolicy is derived from EventDispatcher. Method enqueue will set Event,
  * specified in EventPolicy.
+ * \tparam Lock Lock guarding a Queue.
+ * \tparam QueueType Queue<Runnable> or LockFreeQueue<Runnable>. The Lock isn't used for a
+ * LockFreeQueue, which is drained in batches instead of dequeuing the runnables one by one.
  */
-template<typename Runnable, typename EventPolicy, typename Lock>
+template<
+    typename Runnable,
+    typename EventPolicy,
+    typename Lock,
+    typename QueueType = Queue<Runnable>>
 class RunnableExecutor
 {
 public:
@@ -39,63 +48,91 @@ public:
     /**
      * Places a Runnable in the internal queue and sets the event in the EventDispatcher. When
      * handleEvents is called on the EventDispatcher, all Runnables in the queue are executed
-     * sequentially, and the queue is emptied.
+     * sequentially, and the queue is emptied. A runnable that is executed by an IExecutor at
+     * the same time (see QueueNode::isRunning()) can't be enqueued and raises an assertion.
      * \param runnable Runnable to be executed
      */
     void enqueue(Runnable& runnable);
 
 private:
+    static void enqueueRunnable(Queue<Runnable>& queue, Runnable& runnable);
+    static void enqueueRunnable(LockFreeQueue<Runnable>& queue, Runnable& runnable);
+
+    static void executeAll(Queue<Runnable>& queue);
+    static void executeAll(LockFreeQueue<Runnable>& queue);
+
     void handleEvent();
 
-    Queue<Runnable> _queue;
+    QueueType _queue;
     EventPolicy _eventPolicy;
 };
 
 /**
  * Inline implementations.
  */
-template<typename Runnable, typename EventPolicy, typename Lock>
-RunnableExecutor<Runnable, EventPolicy, Lock>::RunnableExecutor(
+template<typename Runnable, typename EventPolicy, typename Lock, typename QueueType>
+RunnableExecutor<Runnable, EventPolicy, Lock, QueueType>::RunnableExecutor(
     typename EventPolicy::EventDispatcherType& eventDispatcher)
 : _queue(), _eventPolicy(eventDispatcher)
 {}
 
-template<typename Runnable, typename EventPolicy, typename Lock>
-void RunnableExecutor<Runnable, EventPolicy, Lock>::init()
+template<typename Runnable, typename EventPolicy, typename Lock, typename QueueType>
+void RunnableExecutor<Runnable, EventPolicy, Lock, QueueType>::init()
 {
     _eventPolicy.setEventHandler(
         EventPolicy::HandlerFunctionType::
             template create<RunnableExecutor, &RunnableExecutor::handleEvent>(*this));
 }
 
-template<typename Runnable, typename EventPolicy, typename Lock>
-void RunnableExecutor<Runnable, EventPolicy, Lock>::shutdown()
+template<typename Runnable, typename EventPolicy, typename Lock, typename QueueType>
+void RunnableExecutor<Runnable, EventPolicy, Lock, QueueType>::shutdown()
 {
     _eventPolicy.removeEventHandler();
 }
 
-template<typename Runnable, typename EventPolicy, typename Lock>
-inline void RunnableExecutor<Runnable, EventPolicy, Lock>::enqueue(Runnable& runnable)
+template<typename Runnable, typename EventPolicy, typename Lock, typename QueueType>
+inline void RunnableExecutor<Runnable, EventPolicy, Lock, QueueType>::enqueue(Runnable& runnable)
+{
+    // the link of the runnable is in use until the executor has finished it
+    ETL_ASSERT(
+        !runnable.isRunning(), ETL_ERROR_GENERIC("runnable is executed by an IExecutor"));
+    enqueueRunnable(_queue, runnable);
+    _eventPolicy.setEvent();
+}
+
+template<typename Runnable, typename EventPolicy, typename Lock, typename QueueType>
+inline void RunnableExecutor<Runnable, EventPolicy, Lock, QueueType>::enqueueRunnable(
+    Queue<Runnable>& queue, Runnable& runnable)
 {
+    ESR_UNUSED const Lock lock;
+    if (!runnable.isEnqueued())
     {
-        ESR_UNUSED const Lock lock;
-        if (!runnable.isEnqueued())
-        {
-            _queue.enqueue(runnable);
-        }
+        queue.enqueue(runnable);
     }
-    _eventPolicy.setEvent();
 }
 
-template<typename Runnable, typename EventPolicy, typename Lock>
-void RunnableExecutor<Runnable, EventPolicy, Lock>::handleEvent()
+template<typename Runnable, typename EventPolicy, typename Lock, typename QueueType>
+inline void RunnableExecutor<Runnable, EventPolicy, Lock, QueueType>::enqueueRunnable(
+    LockFreeQueue<Runnable>& queue, Runnable& runnable)
+{
+    (void)queue.enqueue(runnable);
+}
+
+template<typename Runnable, typename EventPolicy, typename Lock, typename QueueType>
+void RunnableExecutor<Runnable, EventPolicy, Lock, QueueType>::handleEvent()
+{
+    executeAll(_queue);
+}
+
+template<typename Runnable, typename EventPolicy, typename Lock, typename QueueType>
+void RunnableExecutor<Runnable, EventPolicy, Lock, QueueType>::executeAll(Queue<Runnable>& queue)
 {
     while (true)
     {
         Runnable* runnable;
         {
             ESR_UNUSED const Lock lock;
-            runnable = _queue.dequeue();
+            runnable = queue.dequeue();
         }
         if (runnable != nullptr)
         {
@@ -108,4 +145,23 @@ void RunnableExecutor<Runnable, EventPolicy, Lock>::handleEvent()
     }
 }
 
+template<typename Runnable, typename EventPolicy, typename Lock, typename QueueType>
+void RunnableExecutor<Runnable, EventPolicy, Lock, QueueType>::executeAll(
+    LockFreeQueue<Runnable>& queue)
+{
+    Runnable* runnable = queue.dequeueAll();
+    while (runnable != nullptr)
+    {
+        while (runnable != nullptr)
+        {
+            // dequeued before executing, so it can enqueue itself again
+            Runnable* const next = runnable->dequeue();
+            runnable->execute();
+            runnable = next;
+        }
+        // runnables enqueued meanwhile are executed too, like with a Queue
+        runnable = queue.dequeueAll();
+    }
+}
+
 } // namespace async
@@ -0,0 +1,165 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "async/LockFreeQueue.h"
+
+#include "async/QueueNode.h"
+
+#include <gmock/gmock.h>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::async;
+using namespace ::testing;
+
+class TestNode : public QueueNode<TestNode>
+{
+public:
+    size_t _producer = 0U;
+    size_t _index    = 0U;
+};
+
+TEST(LockFreeQueueTest, testAll)
+{
+    LockFreeQueue<TestNode> cut;
+    TestNode node1;
+    TestNode node2;
+    TestNode node3;
+    {
+        // expect empty queue on beginning
+        EXPECT_TRUE(cut.dequeueAll() == nullptr);
+    }
+    {
+        // enqueue single node and expect it to be returned
+        EXPECT_TRUE(cut.enqueue(node1));
+        EXPECT_TRUE(node1.isEnqueued());
+        EXPECT_EQ(&node1, cut.dequeueAll());
+        // expect it to stay enqueued until it is dequeued
+        EXPECT_TRUE(node1.isEnqueued());
+        EXPECT_FALSE(cut.enqueue(node1));
+        EXPECT_TRUE(node1.dequeue() == nullptr);
+        EXPECT_FALSE(node1.isEnqueued());
+        EXPECT_TRUE(cut.dequeueAll() == nullptr);
+    }
+    {
+        // enqueue multiple nodes and expect them in the order of enqueuing
+        EXPECT_TRUE(cut.enqueue(node1));
+        EXPECT_TRUE(cut.enqueue(node2));
+        EXPECT_TRUE(cut.enqueue(node3));
+        // expect enqueued node not to be enqueued again
+        EXPECT_FALSE(cut.enqueue(node1));
+        TestNode* node = cut.dequeueAll();
+        EXPECT_EQ(&node1, node);
+        node = node->dequeue();
+        EXPECT_EQ(&node2, node);
+        node = node->dequeue();
+        EXPECT_EQ(&node3, node);
+        EXPECT_TRUE(node->dequeue() == nullptr);
+        EXPECT_FALSE(node1.isEnqueued());
+        EXPECT_FALSE(node2.isEnqueued());
+        EXPECT_FALSE(node3.isEnqueued());
+        EXPECT_TRUE(cut.dequeueAll() == nullptr);
+    }
+    {
+        // enqueue a dequeued node of a batch before the rest of the batch is dequeued
+        EXPECT_TRUE(cut.enqueue(node1));
+        EXPECT_TRUE(cut.enqueue(node2));
+        TestNode* node = cut.dequeueAll();
+        node           = node->dequeue();
+        EXPECT_TRUE(cut.enqueue(node1));
+        EXPECT_FALSE(cut.enqueue(node2));
+        EXPECT_EQ(&node2, node);
+        EXPECT_TRUE(node->dequeue() == nullptr);
+        EXPECT_EQ(&node1, cut.dequeueAll());
+        EXPECT_TRUE(node1.dequeue() == nullptr);
+    }
+}
+
+TEST(LockFreeQueueTest, testConcurrentProducers)
+{
+    static size_t const PRODUCER_COUNT      = 4U;
+    static size_t const NODES_PER_PRODUCER  = 64U;
+    static size_t const ROUNDS_PER_PRODUCER = 2000U;
+
+    LockFreeQueue<TestNode> cut;
+    std::array<std::array<TestNode, NODES_PER_PRODUCER>, PRODUCER_COUNT> nodes;
+    std::array<std::atomic<size_t>, PRODUCER_COUNT * NODES_PER_PRODUCER> pending{};
+    std::atomic<size_t> runningProducers{PRODUCER_COUNT};
+    for (size_t producer = 0U; producer < PRODUCER_COUNT; ++producer)
+    {
+        for (size_t index = 0U; index < NODES_PER_PRODUCER; ++index)
+        {
+            nodes[producer][index]._producer = producer;
+            nodes[producer][index]._index    = index;
+        }
+    }
+
+    std::vector<std::thread> producers;
+    for (size_t producer = 0U; producer < PRODUCER_COUNT; ++producer)
+    {
+        producers.emplace_back(
+            [&, producer]()
+            {
+                for (size_t round = 0U; round < ROUNDS_PER_PRODUCER; ++round)
+                {
+                    for (size_t index = 0U; index < NODES_PER_PRODUCER; ++index)
+                    {
+                        if (cut.enqueue(nodes[producer][index]))
+                        {
+                            ++pending[(producer * NODES_PER_PRODUCER) + index];
+                        }
+                    }
+                }
+                --runningProducers;
+            });
+    }
+
+    size_t dequeued = 0U;
+    while (true)
+    {
+        bool const done = (runningProducers == 0U);
+        TestNode* node  = cut.dequeueAll();
+        while (node != nullptr)
+        {
+            --pending[(node->_producer * NODES_PER_PRODUCER) + node->_index];
+            ++dequeued;
+            node = node->dequeue();
+        }
+        if (done)
+        {
+            break;
+        }
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    // expect each enqueued node to be taken exactly once
+    EXPECT_GE(dequeued, PRODUCER_COUNT * NODES_PER_PRODUCER);
+    for (auto const& count : pending)
+    {
+        EXPECT_EQ(0U, count);
+    }
+    for (auto const& producerNodes : nodes)
+    {
+        for (auto const& node : producerNodes)
+        {
+            EXPECT_FALSE(node.isEnqueued());
+        }
+    }
+}
+
+} // namespace
@@ -60,6 +60,61 @@ TEST(QueueNodeTest, testAll)
         EXPECT_EQ(&next, cut.dequeue());
         EXPECT_FALSE(cut.isEnqueued());
     }
+    {
+        // expect node to be enqueued only once
+        EXPECT_TRUE(cut.tryEnqueue());
+        EXPECT_TRUE(cut.isEnqueued());
+        EXPECT_TRUE(cut.getNext() == 0L);
+        EXPECT_FALSE(cut.tryEnqueue());
+        EXPECT_EQ(0L, cut.dequeue());
+        EXPECT_FALSE(cut.isEnqueued());
+    }
+    {
+        // expect link to be replaced only if it has the expected value
+        TestNode next;
+        cut.enqueue();
+        EXPECT_FALSE(cut.compareAndSetNext(&next, &cut));
+        EXPECT_TRUE(cut.getNext() == 0L);
+        EXPECT_TRUE(cut.compareAndSetNext(0L, &next));
+        EXPECT_EQ(&next, cut.getNext());
+        EXPECT_EQ(&next, cut.dequeue());
+    }
+    {
+        // expect the links of an executor to mark the node as running and enqueued
+        EXPECT_FALSE(cut.isRunning());
+        EXPECT_TRUE(cut.tryEnqueue());
+        EXPECT_FALSE(cut.isRunning());
+        cut.setNext(TestNode::running());
+        EXPECT_TRUE(cut.isRunning());
+        EXPECT_TRUE(cut.isEnqueued());
+        EXPECT_FALSE(cut.tryEnqueue());
+        EXPECT_TRUE(cut.compareAndSetNext(TestNode::running(), TestNode::runningAndEnqueued()));
+        EXPECT_TRUE(cut.isRunning());
+        EXPECT_EQ(TestNode::runningAndEnqueued(), cut.dequeue());
+        EXPECT_FALSE(cut.isRunning());
+    }
+}
+
+TEST(QueueNodeTest, testCopy)
+{
+    TestNode node;
+    TestNode next;
+    node.enqueue();
+    node.setNext(&next);
+    {
+        // expect a copy not to be enqueued
+        TestNode copy(node);
+        EXPECT_FALSE(copy.isEnqueued());
+    }
+    {
+        // expect the link not to be assigned
+        TestNode other;
+        other = node;
+        EXPECT_FALSE(other.isEnqueued());
+        node = other;
+        EXPECT_TRUE(node.isEnqueued());
+        EXPECT_EQ(&next, node.getNext());
+    }
 }
 
 } // namespace
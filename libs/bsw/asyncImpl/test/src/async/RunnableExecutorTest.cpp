@@ -11,6 +11,7 @@
 #include "async/RunnableExecutor.h"
 
 #include "async/EventPolicy.h"
+#include "async/LockFreeQueue.h"
 #include "async/QueueNode.h"
 #include "async/RunnableMock.h"
 
@@ -18,6 +19,11 @@
 
 #include <gmock/gmock.h>
 
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace
 {
 using namespace ::async;
@@ -96,4 +102,175 @@ TEST_F(RunnableExecutorTest, testAll)
     }
 }
 
+TEST_F(RunnableExecutorTest, testLockFreeQueue)
+{
+    RunnableExecutor<
+        IRunnable,
+        EventPolicy<RunnableExecutorTest, 2>,
+        TestLock,
+        LockFreeQueue<IRunnable>>
+        cut(*this);
+    HandlerFunctionType eventHandler;
+    {
+        // expect event handler to be set on init
+        EXPECT_CALL(*this, setEventHandler(2U, _)).WillOnce(SaveArg<1>(&eventHandler));
+        cut.init();
+        EXPECT_TRUE(eventHandler.is_valid());
+        Mock::VerifyAndClearExpectations(this);
+    }
+    {
+        // expect event to be set on each added runnable, also if it is enqueued again
+        EXPECT_CALL(*this, setEvents(1U << 2U)).Times(4);
+        cut.enqueue(_runnableMock1);
+        cut.enqueue(_runnableMock2);
+        cut.enqueue(_runnableMock3);
+        cut.enqueue(_runnableMock1);
+        Mock::VerifyAndClearExpectations(this);
+    }
+    {
+        // expect all runnables to be executed once in order on handle event, including a
+        // runnable enqueued by an executed one
+        EXPECT_CALL(*this, setEvents(1U << 2U)).Times(2);
+        Sequence seq;
+        EXPECT_CALL(_runnableMock1, execute())
+            .InSequence(seq)
+            .WillOnce(
+                [&]()
+                {
+                    cut.enqueue(_runnableMock1);
+                    cut.enqueue(_runnableMock2);
+                });
+        EXPECT_CALL(_runnableMock2, execute()).InSequence(seq);
+        EXPECT_CALL(_runnableMock3, execute()).InSequence(seq);
+        EXPECT_CALL(_runnableMock1, execute()).InSequence(seq);
+        eventHandler();
+        Mock::VerifyAndClearExpectations(this);
+        Mock::VerifyAndClearExpectations(&_runnableMock1);
+        EXPECT_FALSE(_runnableMock1.isEnqueued());
+        EXPECT_FALSE(_runnableMock2.isEnqueued());
+        EXPECT_FALSE(_runnableMock3.isEnqueued());
+    }
+    {
+        // expect nothing to be executed on handle event
+        eventHandler();
+    }
+    {
+        // expect event handler to be removed on shutdown
+        EXPECT_CALL(*this, removeEventHandler(2U));
+        cut.shutdown();
+        Mock::VerifyAndClearExpectations(this);
+    }
+}
+
+TEST_F(RunnableExecutorTest, testRunnableExecutedByExecutorIsNotEnqueued)
+{
+    RunnableExecutor<IRunnable, EventPolicy<RunnableExecutorTest, 2>, TestLock> cut(*this);
+    RunnableExecutor<
+        IRunnable,
+        EventPolicy<RunnableExecutorTest, 3>,
+        TestLock,
+        LockFreeQueue<IRunnable>>
+        lockFreeCut(*this);
+    // expect an assertion instead of silently dropping a runnable executed by an IExecutor
+    _runnableMock1.setNext(IRunnable::running());
+    EXPECT_THROW(cut.enqueue(_runnableMock1), ::etl::exception);
+    EXPECT_THROW(lockFreeCut.enqueue(_runnableMock1), ::etl::exception);
+    _runnableMock1.setNext(IRunnable::runningAndEnqueued());
+    EXPECT_THROW(cut.enqueue(_runnableMock1), ::etl::exception);
+    (void)_runnableMock1.dequeue();
+    EXPECT_FALSE(_runnableMock1.isEnqueued());
+}
+
+/**
+ * Event dispatcher that lets the consumer wait for runnables, like a task context does.
+ */
+class StressEventDispatcher
+{
+public:
+    using HandlerFunctionType = ::etl::delegate<void()>;
+
+    void setEventHandler(size_t /* event */, HandlerFunctionType const handlerFunction)
+    {
+        _handlerFunction = handlerFunction;
+    }
+
+    void removeEventHandler(size_t /* event */) { _handlerFunction = HandlerFunctionType(); }
+
+    void setEvents(EventMaskType const /* events */) { _event = true; }
+
+    bool handleEvents()
+    {
+        if (!_event.exchange(false))
+        {
+            std::this_thread::yield();
+            return false;
+        }
+        _handlerFunction();
+        return true;
+    }
+
+private:
+    HandlerFunctionType _handlerFunction;
+    std::atomic<bool> _event{false};
+};
+
+class CountingRunnable : public IRunnable
+{
+public:
+    void execute() override { ++_executions; }
+
+    std::atomic<size_t> _executions{0U};
+};
+
+TEST(RunnableExecutorStressTest, testConcurrentEnqueue)
+{
+    static size_t const PRODUCER_COUNT      = 4U;
+    static size_t const RUNNABLE_COUNT      = 16U;
+    static size_t const ROUNDS_PER_PRODUCER = 5000U;
+
+    StressEventDispatcher dispatcher;
+    RunnableExecutor<
+        IRunnable,
+        EventPolicy<StressEventDispatcher, 0>,
+        TestLock,
+        LockFreeQueue<IRunnable>>
+        cut(dispatcher);
+    cut.init();
+
+    std::array<CountingRunnable, RUNNABLE_COUNT> runnables;
+    std::atomic<size_t> runningProducers{PRODUCER_COUNT};
+    std::vector<std::thread> producers;
+    for (size_t producer = 0U; producer < PRODUCER_COUNT; ++producer)
+    {
+        producers.emplace_back(
+            [&]()
+            {
+                for (size_t round = 0U; round < ROUNDS_PER_PRODUCER; ++round)
+                {
+                    // all producers share the runnables, so most of them are still enqueued
+                    cut.enqueue(runnables[round % RUNNABLE_COUNT]);
+                }
+                --runningProducers;
+            });
+    }
+    while (runningProducers != 0U)
+    {
+        (void)dispatcher.handleEvents();
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    (void)dispatcher.handleEvents();
+
+    // expect each runnable to be executed at least once after it has been enqueued the last time
+    for (auto const& runnable : runnables)
+    {
+        EXPECT_GT(runnable._executions, 0U);
+        EXPECT_LE(runnable._executions, PRODUCER_COUNT * ROUNDS_PER_PRODUCER / RUNNABLE_COUNT);
+        EXPECT_FALSE(runnable.isEnqueued());
+    }
+    cut.shutdown();
+}
+
 } // namespace
@@ -28,11 +28,11 @@
 
 namespace async
 {
-template<class Binding>
+template<class Binding, class TimerType = ::timer::Timer<LockType>>
 class TaskContext : public EventDispatcher<2U, LockType>
 {
 public:
-    using TaskFunctionType       = ::etl::delegate<void(TaskContext<Binding>&)>;
+    using TaskFunctionType       = ::etl::delegate<void(TaskContext<Binding, TimerType>&)>;
     using StaticTaskFunctionType = void (*)(ULONG);
     using StackType              = ::etl::span<ULONG>;
 
@@ -67,15 +67,14 @@ public:
     void stopDispatch();
     void dispatchWhileWork();
 
-    static void defaultTaskFunction(TaskContext<Binding>& taskContext);
+    static void defaultTaskFunction(TaskContext<Binding, TimerType>& taskContext);
 
 private:
-    friend class EventPolicy<TaskContext<Binding>, 0U>;
-    friend class EventPolicy<TaskContext<Binding>, 1U>;
+    friend class EventPolicy<TaskContext<Binding, TimerType>, 0U>;
+    friend class EventPolicy<TaskContext<Binding, TimerType>, 1U>;
 
-    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding>, 0U>;
-    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding>, 1U>;
-    using TimerType              = ::timer::Timer<LockType>;
+    using ExecuteEventPolicyType = EventPolicy<TaskContext<Binding, TimerType>, 0U>;
+    using TimerEventPolicyType   = EventPolicy<TaskContext<Binding, TimerType>, 1U>;
 
     static EventMaskType const STOP_EVENT_MASK = static_cast<EventMaskType>(
         static_cast<EventMaskType>(1U) << static_cast<EventMaskType>(EVENT_COUNT));
@@ -87,7 +86,8 @@ private:
 
     void handleTimeout();
 
-    RunnableExecutor<RunnableType, ExecuteEventPolicyType, LockType> _runnableExecutor;
+    RunnableExecutor<RunnableType, ExecuteEventPolicyType, LockType, RunnableQueueType>
+        _runnableExecutor;
     TimerType _timer;
     TimerEventPolicyType _timerEventPolicy;
     TaskFunctionType _taskFunction;
@@ -100,8 +100,8 @@ private:
 /**
  * Inline implementations.
  */
-template<class Binding>
-inline TaskContext<Binding>::TaskContext()
+template<class Binding, class TimerType>
+inline TaskContext<Binding, TimerType>::TaskContext()
 : _runnableExecutor(*this)
 , _timer()
 , _timerEventPolicy(*this)
@@ -115,8 +115,8 @@ inline TaskContext<Binding>::TaskContext()
     _runnableExecutor.init();
 }
 
-template<class Binding>
-void TaskContext<Binding>::initTask(
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::initTask(
     ContextType const context, char const* const name, TX_THREAD& taskHandle)
 {
     _context    = context;
@@ -124,8 +124,8 @@ void TaskContext<Binding>::initTask(
     _taskHandle = &taskHandle;
 }
 
-template<class Binding>
-void TaskContext<Binding>::createTask(
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::createTask(
     ContextType const context,
     TX_THREAD& task,
     char const* const name,
@@ -163,8 +163,8 @@ void TaskContext<Binding>::createTask(
     _taskHandle = &task;
 }
 
-template<class Binding>
-void TaskContext<Binding>::startTask()
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::startTask()
 {
     if (_taskHandle != nullptr)
     {
@@ -172,8 +172,8 @@ void TaskContext<Binding>::startTask()
     }
 }
 
-template<class Binding>
-inline char const* TaskContext<Binding>::getName() const
+template<class Binding, class TimerType>
+inline char const* TaskContext<Binding, TimerType>::getName() const
 {
     if (_name != nullptr)
     {
@@ -185,20 +185,20 @@ inline char const* TaskContext<Binding>::getName() const
     }
 }
 
-template<class Binding>
-inline TX_THREAD& TaskContext<Binding>::getTaskHandle() const
+template<class Binding, class TimerType>
+inline TX_THREAD& TaskContext<Binding, TimerType>::getTaskHandle() const
 {
     return *_taskHandle;
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::execute(RunnableType& runnable)
+template<class Binding, class TimerType>
+inline void TaskContext<Binding, TimerType>::execute(RunnableType& runnable)
 {
     _runnableExecutor.enqueue(runnable);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::schedule(
+template<class Binding, class TimerType>
+inline void TaskContext<Binding, TimerType>::schedule(
     RunnableType& runnable, TimeoutType& timeout, uint32_t const delay, TimeUnitType const unit)
 {
     if (!_timer.isActive(timeout))
@@ -212,8 +212,8 @@ inline void TaskContext<Binding>::schedule(
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::scheduleAtFixedRate(
+template<class Binding, class TimerType>
+inline void TaskContext<Binding, TimerType>::scheduleAtFixedRate(
     RunnableType& runnable, TimeoutType& timeout, uint32_t const period, TimeUnitType const unit)
 {
     if (!_timer.isActive(timeout))
@@ -228,14 +228,14 @@ inline void TaskContext<Binding>::scheduleAtFixedRate(
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::cancel(TimeoutType& timeout)
+template<class Binding, class TimerType>
+inline void TaskContext<Binding, TimerType>::cancel(TimeoutType& timeout)
 {
     _timer.cancel(timeout);
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::setEvents(EventMaskType const eventMask)
+template<class Binding, class TimerType>
+inline void TaskContext<Binding, TimerType>::setEvents(EventMaskType const eventMask)
 {
     tx_event_flags_set(
         &_eventObject,
@@ -244,8 +244,8 @@ inline void TaskContext<Binding>::setEvents(EventMaskType const eventMask)
     );
 }
 
-template<class Binding>
-inline EventMaskType TaskContext<Binding>::waitEvents()
+template<class Binding, class TimerType>
+inline EventMaskType TaskContext<Binding, TimerType>::waitEvents()
 {
     EventMaskType eventMask = 0U;
     uint32_t ticks          = Binding::WAIT_EVENTS_TICK_COUNT;
@@ -276,14 +276,14 @@ inline EventMaskType TaskContext<Binding>::waitEvents()
     }
 }
 
-template<class Binding>
-void TaskContext<Binding>::callTaskFunction()
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::callTaskFunction()
 {
     _taskFunction(*this);
 }
 
-template<class Binding>
-void TaskContext<Binding>::dispatch()
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::dispatch()
 {
     EventMaskType eventMask = 0U;
     while ((eventMask & STOP_EVENT_MASK) == 0U)
@@ -293,21 +293,22 @@ void TaskContext<Binding>::dispatch()
     }
 }
 
-template<class Binding>
-inline void TaskContext<Binding>::stopDispatch()
+template<class Binding, class TimerType>
+inline void TaskContext<Binding, TimerType>::stopDispatch()
 {
     _runnableExecutor.shutdown();
     setEvents(STOP_EVENT_MASK);
 }
 
-template<class Binding>
-void TaskContext<Binding>::defaultTaskFunction(TaskContext<Binding>& taskContext)
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::defaultTaskFunction(
+    TaskContext<Binding, TimerType>& taskContext)
 {
     taskContext.dispatch();
 }
 
-template<class Binding>
-void TaskContext<Binding>::handleTimeout()
+template<class Binding, class TimerType>
+void TaskContext<Binding, TimerType>::handleTimeout()
 {
     while (_timer.processNextTimeout(getSystemTimeUs32Bit())) {}
 }
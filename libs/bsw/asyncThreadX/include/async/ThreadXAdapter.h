@@ -14,6 +14,7 @@
 #pragma once
 
 #include "ThreadXConfig.h"
+#include "async/IExecutor.h"
 #include "async/TaskContext.h"
 #include "async/TaskInitializer.h"
 #include "interrupts/suspendResumeAllInterrupts.h"
@@ -21,6 +22,7 @@
 
 #include <etl/array.h>
 #include <etl/error_handler.h>
+#include <etl/type_traits.h>
 
 extern "C"
 {
@@ -31,6 +33,22 @@ namespace async
 {
 namespace internal
 {
+/**
+ * Timer of the task contexts, Binding::TimerType if the binding defines it, e.g.
+ * ::timer::TimingWheelTimer<LockType> for contexts with many concurrent timeouts.
+ */
+template<class Binding, class = void>
+struct TimerTypeOf
+{
+    using Type = ::timer::Timer<LockType>;
+};
+
+template<class Binding>
+struct TimerTypeOf<Binding, ::etl::void_t<typename Binding::TimerType>>
+{
+    using Type = typename Binding::TimerType;
+};
+
 template<bool HasNestedInterrupts = (ASYNC_CONFIG_NESTED_INTERRUPTS != 0)>
 class NestedInterruptLock : public LockType
 {};
@@ -74,7 +92,8 @@ public:
  * `Binding` type to adapt and configure task-related components, such as `TaskContext`,
  * `TaskConfig`, and backgroud task.
  *
- * \tparam Binding The binding type specifying application-specific configurations.
+ * \tparam Binding The binding type specifying application-specific configurations. It may
+ *         define TimerType to replace the ::timer::Timer of the task contexts.
  */
 template<class Binding>
 class ThreadXAdapter
@@ -88,7 +107,8 @@ public:
 
     using AdapterType = ThreadXAdapter<Binding>;
 
-    using TaskContextType        = TaskContext<AdapterType>;
+    using TimerType              = typename internal::TimerTypeOf<Binding>::Type;
+    using TaskContextType        = TaskContext<AdapterType, TimerType>;
     using TaskFunctionType       = typename TaskContextType::TaskFunctionType;
     using StaticTaskFunctionType = typename TaskContextType::StaticTaskFunctionType;
 
@@ -150,6 +170,25 @@ public:
 
     static void cancel(TimeoutType& timeout);
 
+    /**
+     * Serves the runnables of a context by an executor instead of the task of the context, e.g.
+     * by a pool of worker threads. Timeouts of the context still expire in its task and their
+     * runnables are handed over to the executor. Must be called before the context is used.
+     *
+     * \param context The task context.
+     * \param executor The executor serving the runnables of the context, nullptr for the task.
+     */
+    static void setContextExecutor(ContextType context, IExecutor* executor);
+
+    /**
+     * Executes the runnable of an expired timeout, either directly or by the executor of the
+     * context.
+     *
+     * \param context The task context of the timeout.
+     * \param runnable The runnable of the timeout.
+     */
+    static void executeExpired(ContextType context, RunnableType& runnable);
+
     static void callInitFromThreadXKernel();
 
 private:
@@ -163,6 +202,7 @@ private:
     static TaskInitializer* _idleTaskInitializer;
     static TaskInitializer* _timerTaskInitializer;
     static ::etl::array<TaskContextType, OS_TASK_COUNT> _taskContexts;
+    static ::etl::array<IExecutor*, OS_TASK_COUNT> _contextExecutors;
     static ::etl::array<uint32_t, OS_TASK_COUNT> _stackSizes;
     static char const* _timerTaskName;
 };
@@ -183,6 +223,9 @@ template<class Binding>
     array<typename ThreadXAdapter<Binding>::TaskContextType, ThreadXAdapter<Binding>::OS_TASK_COUNT>
         ThreadXAdapter<Binding>::_taskContexts;
 template<class Binding>
+::etl::array<IExecutor*, ThreadXAdapter<Binding>::OS_TASK_COUNT>
+    ThreadXAdapter<Binding>::_contextExecutors;
+template<class Binding>
 ::etl::array<uint32_t, ThreadXAdapter<Binding>::OS_TASK_COUNT> ThreadXAdapter<Binding>::_stackSizes;
 template<class Binding>
 char const* ThreadXAdapter<Binding>::_timerTaskName;
@@ -301,7 +344,15 @@ bool ThreadXAdapter<Binding>::getStackUsage(size_t const taskIdx, StackUsage& st
 template<class Binding>
 inline void ThreadXAdapter<Binding>::execute(ContextType const context, RunnableType& runnable)
 {
-    _taskContexts[static_cast<size_t>(context)].execute(runnable);
+    IExecutor* const executor = _contextExecutors[static_cast<size_t>(context)];
+    if (executor != nullptr)
+    {
+        executor->execute(runnable);
+    }
+    else
+    {
+        _taskContexts[static_cast<size_t>(context)].execute(runnable);
+    }
 }
 
 template<class Binding>
@@ -338,6 +389,30 @@ inline void ThreadXAdapter<Binding>::cancel(TimeoutType& timeout)
     }
 }
 
+template<class Binding>
+inline void
+ThreadXAdapter<Binding>::setContextExecutor(ContextType const context, IExecutor* const executor)
+{
+    _contextExecutors[static_cast<size_t>(context)] = executor;
+}
+
+template<class Binding>
+inline void
+ThreadXAdapter<Binding>::executeExpired(ContextType const context, RunnableType& runnable)
+{
+    IExecutor* const executor = (static_cast<size_t>(context) < OS_TASK_COUNT)
+                                    ? _contextExecutors[static_cast<size_t>(context)]
+                                    : nullptr;
+    if (executor != nullptr)
+    {
+        executor->execute(runnable);
+    }
+    else
+    {
+        runnable.execute();
+    }
+}
+
 template<class Binding>
 void ThreadXAdapter<Binding>::staticTaskFunction(ULONG param)
 {
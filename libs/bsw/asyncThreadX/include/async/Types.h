@@ -15,7 +15,9 @@
 
 #include "async/IRunnable.h"
 #include "async/Lock.h"
+#include "async/LockFreeQueue.h"
 #include "async/ModifiableLock.h"
+#include "async/Queue.h"
 #include "tx_api.h"
 
 #include <timer/Timeout.h>
@@ -30,6 +32,13 @@ using EventMaskType      = ULONG;
 using LockType           = Lock;
 using ModifiableLockType = ModifiableLock;
 
+#ifdef PLATFORM_SUPPORT_LOCK_FREE_RUNNABLE_QUEUE
+// runnables are enqueued without disabling interrupts
+using RunnableQueueType = LockFreeQueue<RunnableType>;
+#else
+using RunnableQueueType = Queue<RunnableType>;
+#endif
+
 ContextType const CONTEXT_INVALID = 0xFFU;
 ContextType const CONTEXT_TIMER   = 0x00U;
 
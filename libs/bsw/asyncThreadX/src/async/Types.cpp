@@ -21,7 +21,7 @@ void TimeoutType::expired()
     RunnableType* const runnable = _runnable;
     if (runnable != nullptr)
     {
-        runnable->execute();
+        AsyncBindingType::AdapterType::executeExpired(_context, *runnable);
     }
 }
 
@@ -0,0 +1,156 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <can/canframes/CanId.h>
+#include <can/filter/BitFieldFilter.h>
+#include <can/filter/ExtendedIdFilter.h>
+#include <can/filter/IntervalFilter.h>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+constexpr size_t NUM_FRAMES = 1024U;
+
+uint32_t nextRandom(uint32_t& seed)
+{
+    seed = (seed * 1103515245U) + 12345U;
+    return seed >> 8U;
+}
+
+/**
+ * Returns state.range(0) sparse J1939 style extended ids.
+ */
+std::vector<uint32_t> sparseIds(size_t const count)
+{
+    std::vector<uint32_t> ids;
+    uint32_t seed = 42U;
+    for (size_t i = 0U; i < count; ++i)
+    {
+        ids.push_back(::can::CanId::extended(0x18000000U | (nextRandom(seed) & 0xFFFFFFU)));
+    }
+    return ids;
+}
+
+/**
+ * Returns received ids where every second id is one of the given ids.
+ */
+std::vector<uint32_t> receivedIds(std::vector<uint32_t> const& ids)
+{
+    std::vector<uint32_t> received;
+    uint32_t seed = 7U;
+    for (size_t i = 0U; i < NUM_FRAMES; ++i)
+    {
+        received.push_back(
+            ((i % 2U) == 0U)
+                ? ids[nextRandom(seed) % ids.size()]
+                : ::can::CanId::extended(0x18000000U | (nextRandom(seed) & 0xFFFFFFU)));
+    }
+    return received;
+}
+
+template<class Filter>
+void matchAll(benchmark::State& state, Filter const& filter, std::vector<uint32_t> const& received)
+{
+    for (auto _ : state)
+    {
+        for (uint32_t const id : received)
+        {
+            benchmark::DoNotOptimize(filter.match(id));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * received.size()));
+}
+
+/**
+ * The filters a listener needs today for sparse extended ids: one IntervalFilter per id.
+ */
+struct IntervalFilterList
+{
+    bool match(uint32_t const id) const
+    {
+        for (auto const& filter : filters)
+        {
+            if (filter->match(id))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::vector<std::unique_ptr<::can::IntervalFilter>> filters;
+};
+} // namespace
+
+/**
+ * Benchmarks a single IntervalFilter for reference, it can't hold sparse ids.
+ */
+void BM_match_interval(benchmark::State& state)
+{
+    auto const ids = sparseIds(static_cast<size_t>(state.range(0)));
+    ::can::IntervalFilter filter;
+    for (uint32_t const id : ids)
+    {
+        filter.add(id);
+    }
+    matchAll(state, static_cast<::can::IFilter const&>(filter), receivedIds(ids));
+}
+
+/**
+ * Benchmarks a BitFieldFilter for reference, it only holds base ids.
+ */
+void BM_match_bit_field(benchmark::State& state)
+{
+    uint32_t seed = 42U;
+    std::vector<uint32_t> ids;
+    ::can::BitFieldFilter filter;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        ids.push_back(nextRandom(seed) % (::can::BitFieldFilter::MAX_ID + 1U));
+        filter.add(ids.back());
+    }
+    matchAll(state, static_cast<::can::IFilter const&>(filter), receivedIds(ids));
+}
+
+/**
+ * Benchmarks matching sparse extended ids with a list of IntervalFilters.
+ */
+void BM_match_interval_list(benchmark::State& state)
+{
+    auto const ids = sparseIds(static_cast<size_t>(state.range(0)));
+    IntervalFilterList filter;
+    for (uint32_t const id : ids)
+    {
+        filter.filters.emplace_back(new ::can::IntervalFilter(id, id));
+    }
+    matchAll(state, filter, receivedIds(ids));
+}
+
+/**
+ * Benchmarks matching sparse extended ids with an ExtendedIdFilter.
+ */
+void BM_match_extended_id(benchmark::State& state)
+{
+    auto const ids = sparseIds(static_cast<size_t>(state.range(0)));
+    ::can::declare::ExtendedIdFilter<256> filter;
+    for (uint32_t const id : ids)
+    {
+        filter.add(id);
+    }
+    matchAll(state, static_cast<::can::IFilter const&>(filter), receivedIds(ids));
+}
+
+BENCHMARK(BM_match_interval)->Arg(16)->Arg(256);
+BENCHMARK(BM_match_bit_field)->Arg(16)->Arg(256);
+BENCHMARK(BM_match_interval_list)->Arg(16)->Arg(256);
+BENCHMARK(BM_match_extended_id)->Arg(16)->Arg(256);
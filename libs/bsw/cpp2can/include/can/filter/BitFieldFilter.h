@@ -17,6 +17,7 @@
 
 #include "can/canframes/CANFrame.h"
 #include "can/filter/AbstractStaticBitFieldFilter.h"
+#include "can/filter/ExtendedIdFilter.h"
 #include "can/filter/IFilter.h"
 #include "can/filter/IMerger.h"
 #include "can/filter/IntervalFilter.h"
@@ -136,6 +137,23 @@ public:
         }
     }
 
+    /**
+     * merges with an ExtendedIdFilter
+     * \param    filter    ExtendedIdFilter to merge with
+     */
+    void mergeWithExtendedId(ExtendedIdFilter const& filter) override
+    {
+        for (ExtendedIdFilter::Range const& range : filter.getRanges())
+        {
+            if (range.from > MAX_ID)
+            {
+                break;
+            }
+            uint32_t const toId = (range.to <= MAX_ID) ? range.to : MAX_ID;
+            add(range.from, toId);
+        }
+    }
+
     uint8_t const* getRawBitField() const { return &_mask[0]; }
 
     BitFieldFilter(BitFieldFilter const&)            = delete;
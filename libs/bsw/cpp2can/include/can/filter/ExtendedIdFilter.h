@@ -0,0 +1,167 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/**
+ * Contains ExtendedIdFilter class.
+ * \file ExtendedIdFilter.h
+ * \ingroup filter
+ */
+#pragma once
+
+#include "can/filter/IFilter.h"
+#include "can/filter/IMerger.h"
+#include "can/filter/IntervalFilter.h"
+
+#include <etl/span.h>
+
+#include <platform/estdint.h>
+
+namespace can
+{
+/**
+ * Cpp2CAN ExtendedIdFilter
+ *
+ * Filter for many sparse identifiers up to IntervalFilter::MAX_ID, i.e. including extended
+ * identifiers. The filter holds a sorted table of disjoint ranges of identifiers and matches an
+ * identifier with a binary search.
+ *
+ * Adjacent and overlapping ranges are joined when they are added. If the table is full, the two
+ * ranges with the smallest gap between them are joined, so that the filter matches all identifiers
+ * that have been added plus the identifiers of the gap.
+ *
+ * \see IFilter
+ * \see declare::ExtendedIdFilter
+ */
+class ExtendedIdFilter
+: public IFilter
+, public IMerger
+{
+public:
+    /** maximum id the filter may take */
+    static uint32_t const MAX_ID = IntervalFilter::MAX_ID;
+
+    /** Range of identifiers from \c from to \c to, both included. */
+    struct Range
+    {
+        uint32_t from;
+        uint32_t to;
+    };
+
+    /**
+     * constructor
+     * \param ranges    storage for the ranges of the filter
+     * \pre !ranges.empty()
+     * \post getRanges().empty()
+     */
+    explicit ExtendedIdFilter(::etl::span<Range> ranges);
+
+    /**
+     * \see IFilter::add()
+     * \param filterId    id to add to filter, set to MAX_ID if it exceeds MAX_ID
+     */
+    void add(uint32_t filterId) override;
+
+    /**
+     * \see IFilter::add()
+     * \param from    lower bound of range to add, set to MAX_ID if it exceeds MAX_ID
+     * \param to      upper bound of range to add, set to MAX_ID if it exceeds MAX_ID
+     */
+    void add(uint32_t from, uint32_t to) override;
+
+    /**
+     * \see IFilter::match()
+     */
+    bool match(uint32_t filterId) const override;
+
+    /**
+     * \see IFilter::clear()
+     */
+    void clear() override;
+
+    /**
+     * \see IFilter::open()
+     */
+    void open() override;
+
+    /**
+     * \see IFilter::acceptMerger()
+     */
+    void acceptMerger(IMerger& merger) override { merger.mergeWithExtendedId(*this); }
+
+    /**
+     * merges with a BitFieldFilter
+     * \param filter    BitFieldFilter to merge with
+     */
+    void mergeWithBitField(BitFieldFilter const& filter) override;
+
+    /**
+     * merges with a AbstractStaticBitFieldFilter
+     * \param filter    AbstractStaticBitFieldFilter to merge with
+     */
+    void mergeWithStaticBitField(AbstractStaticBitFieldFilter const& filter) override;
+
+    /**
+     * merges with a IntervalFilter
+     * \param filter    IntervalFilter to merge with
+     */
+    void mergeWithInterval(IntervalFilter const& filter) override;
+
+    /**
+     * merges with a ExtendedIdFilter
+     * \param filter    ExtendedIdFilter to merge with
+     */
+    void mergeWithExtendedId(ExtendedIdFilter const& filter) override;
+
+    /**
+     * \return sorted ranges of the filter
+     */
+    ::etl::span<Range const> getRanges() const
+    {
+        return ::etl::span<Range const>(_ranges.data(), _size);
+    }
+
+    /**
+     * \return maximum number of ranges the filter can hold
+     */
+    size_t getCapacity() const { return _ranges.size(); }
+
+    ExtendedIdFilter(ExtendedIdFilter const&)            = delete;
+    ExtendedIdFilter& operator=(ExtendedIdFilter const&) = delete;
+
+private:
+    void mergeBaseIds(IFilter const& filter);
+    void insert(size_t index, Range const& range);
+    void erase(size_t begin, size_t end);
+    void joinClosest(size_t index, Range const& range);
+
+    ::etl::span<Range> _ranges;
+    size_t _size;
+};
+
+namespace declare
+{
+/**
+ * ExtendedIdFilter holding up to CAPACITY ranges.
+ * \tparam CAPACITY    maximum number of disjoint ranges
+ */
+template<size_t CAPACITY>
+class ExtendedIdFilter : public ::can::ExtendedIdFilter
+{
+    static_assert(CAPACITY > 0U, "ExtendedIdFilter needs to hold at least one range");
+
+public:
+    ExtendedIdFilter() : ::can::ExtendedIdFilter(::etl::span<Range>(_rangeArray)) {}
+
+private:
+    Range _rangeArray[CAPACITY] = {};
+};
+} // namespace declare
+
+} // namespace can
@@ -20,6 +20,7 @@ namespace can
 class BitFieldFilter;
 class AbstractStaticBitFieldFilter;
 class IntervalFilter;
+class ExtendedIdFilter;
 
 /**
  * interface for class that are able to merge with other filter classes
@@ -29,6 +30,7 @@ class IntervalFilter;
  * \see BitFieldFilter
  * \see AbstractStaticBitFieldFilter
  * \see IntervalFilter
+ * \see ExtendedIdFilter
  */
 class IMerger
 {
@@ -54,6 +56,15 @@ public:
      * \param filter    IntervalFilter to merge with
      */
     virtual void mergeWithInterval(IntervalFilter const& filter) = 0;
+
+    /**
+     * merges with a ExtendedIdFilter
+     * \param filter    ExtendedIdFilter to merge with
+     *
+     * The default implementation merges each range of the filter with mergeWithInterval(), so
+     * mergers that don't know ExtendedIdFilter keep working.
+     */
+    virtual void mergeWithExtendedId(ExtendedIdFilter const& filter);
 };
 
 } // namespace can
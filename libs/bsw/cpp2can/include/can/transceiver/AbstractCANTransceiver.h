@@ -19,6 +19,7 @@
 #include "can/framemgmt/AbstractBitFieldFilteredCANFrameListener.h"
 #include "can/framemgmt/AbstractIntervalFilteredCANFrameListener.h"
 #include "can/framemgmt/IFilteredCANFrameSentListener.h"
+#include "can/transceiver/CANFrameListenerIndex.h"
 #include "can/transceiver/ICANTransceiverStateListener.h"
 #include "can/transceiver/ICanTransceiver.h"
 
@@ -124,6 +125,24 @@ public:
      */
     void removeCANFrameSentListener(IFilteredCANFrameSentListener& listener) override;
 
+    /**
+     * Sets the index used by notifyListeners() to find the listeners of a received CANFrame.
+     * \param    index         index to build from the registered listeners
+     * \param    spareIndex    second index, the indices are used alternately
+     *
+     * The index is rebuilt whenever a listener is added or removed. Without an index or if the
+     * index can't hold the registered listeners, the filters of all listeners are checked.
+     *
+     * The index is built into the spare index outside of the critical section, which only
+     * invalidates the index and swaps the indices when the build is complete. Until then, the
+     * filters of all listeners are checked. Listeners should nevertheless be registered during
+     * initialization, as a removed listener may still be visited by a build in progress.
+     *
+     * \attention
+     * Filters of listeners must not change after adding them!
+     */
+    void setListenerIndex(CANFrameListenerIndex& index, CANFrameListenerIndex& spareIndex);
+
     /**
      * \return    busId of transceiver
      */
@@ -181,6 +200,10 @@ protected:
      */
     void notifyStateListenerWithState(ICANTransceiverStateListener::CANTransceiverState state);
 
+private:
+    void invalidateListenerIndex();
+    void updateListenerIndex();
+
 protected:
     BitFieldFilter _filter;
     ::etl::intrusive_list<ICANFrameListener, ::etl::bidirectional_link<0>> _listeners;
@@ -194,6 +217,13 @@ protected:
     uint8_t _busId;
     ICANTransceiverStateListener* _stateListener;
     ICANTransceiverStateListener::CANTransceiverState _transceiverState;
+
+private:
+    CANFrameListenerIndex* _listenerIndex;
+    CANFrameListenerIndex* _spareListenerIndex;
+    uint32_t _listenerGeneration;
+    bool _listenerIndexValid;
+    bool _listenerIndexBuilding;
 };
 
 inline ICanTransceiver::State AbstractCANTransceiver::getState() const { return _state; }
@@ -0,0 +1,132 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/**
+ * Contains class CANFrameListenerIndex.
+ * \file CANFrameListenerIndex.h
+ * \ingroup transceiver
+ */
+#pragma once
+
+#include "can/filter/BitFieldFilter.h"
+#include "can/filter/IMerger.h"
+#include "can/framemgmt/ICANFrameListener.h"
+
+#include <etl/intrusive_list.h>
+#include <etl/span.h>
+
+#include <platform/estdint.h>
+
+namespace can
+{
+/**
+ * Dispatch index for the ICANFrameListeners of a transceiver.
+ *
+ * The index is built from the filters of the listeners through the IMerger visitor. For base
+ * identifiers (up to BitFieldFilter::MAX_ID), it holds one entry per identifier that refers to the
+ * set of matching listeners. Identifiers above are looked up in a sorted table of the intervals
+ * of IntervalFilters. Listeners with other filters, e.g. ExtendedIdFilter, are checked with
+ * IFilter::match() for each frame. Looking up the listeners of a frame thus doesn't depend on the
+ * number of registered listeners.
+ *
+ * Filters are expected not to change after the listener has been registered.
+ *
+ * If there are more than MAX_LISTENERS listeners or more than MAX_LISTENER_SETS different sets of
+ * listeners for base identifiers, build() fails and the transceiver falls back to checking the
+ * filters of all listeners.
+ */
+class CANFrameListenerIndex : private IMerger
+{
+public:
+    using ListenerList = ::etl::intrusive_list<ICANFrameListener, ::etl::bidirectional_link<0>>;
+    /// Bit i is set for the i-th listener.
+    using ListenerMask = uint32_t;
+
+    static uint8_t const MAX_LISTENERS     = 32U;
+    static uint8_t const MAX_LISTENER_SETS = 255U;
+
+    CANFrameListenerIndex();
+
+    CANFrameListenerIndex(CANFrameListenerIndex const&)            = delete;
+    CANFrameListenerIndex& operator=(CANFrameListenerIndex const&) = delete;
+
+    /**
+     * Builds the index from the filters of the given listeners, keeping their order.
+     * \return true if the index is valid
+     */
+    bool build(ListenerList& listeners);
+
+    /**
+     * Builds the index from the filters of the given listeners, keeping their order.
+     * \return true if the index is valid
+     */
+    bool build(::etl::span<ICANFrameListener* const> listeners);
+
+    bool isValid() const { return _valid; }
+
+    /**
+     * Returns the mask of listeners to call for a frame with the given identifier, including the
+     * listeners which need to be checked with IFilter::match().
+     * \pre isValid()
+     */
+    ListenerMask lookup(uint32_t id) const;
+
+    /**
+     * Returns whether the filter of the listener with the given index has to be checked with
+     * IFilter::match().
+     */
+    bool needsMatch(uint8_t index) const { return (_matchMask & (1U << index)) != 0U; }
+
+    /**
+     * Returns the listener with the given index.
+     * \pre index < MAX_LISTENERS
+     */
+    ICANFrameListener& getListener(uint8_t index) const { return *_listeners[index]; }
+
+private:
+    static uint8_t const MAX_BOUNDS = (2U * MAX_LISTENERS) + 1U;
+
+    enum class FilterKind : uint8_t
+    {
+        NONE,
+        BIT_FIELD,
+        STATIC_BIT_FIELD,
+        INTERVAL
+    };
+
+    void mergeWithBitField(BitFieldFilter const& filter) override;
+    void mergeWithStaticBitField(AbstractStaticBitFieldFilter const& filter) override;
+    void mergeWithInterval(IntervalFilter const& filter) override;
+    void mergeWithExtendedId(ExtendedIdFilter const& filter) override;
+
+    ListenerMask matchBase(uint16_t id) const;
+    bool addListenerSet(uint16_t id, ListenerMask mask);
+    void addBound(uint32_t bound);
+
+    ICANFrameListener* _listeners[MAX_LISTENERS];
+    IFilter const* _filters[MAX_LISTENERS];
+    FilterKind _kinds[MAX_LISTENERS];
+    uint8_t _listenerCount;
+    ListenerMask _matchMask;
+
+    /// Index into _listenerSets for each base identifier, 0 for no listener.
+    uint8_t _baseSets[BitFieldFilter::NUMBER_OF_BITS];
+    ListenerMask _listenerSets[MAX_LISTENER_SETS + 1U];
+    uint16_t _listenerSetCount;
+
+    /// Sorted lower bounds of the segments above the base identifiers.
+    uint32_t _bounds[MAX_BOUNDS];
+    ListenerMask _boundMasks[MAX_BOUNDS];
+    uint8_t _boundCount;
+
+    bool _valid;
+};
+
+} // namespace can
@@ -0,0 +1,201 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "can/filter/ExtendedIdFilter.h"
+
+#include "can/filter/AbstractStaticBitFieldFilter.h"
+#include "can/filter/BitFieldFilter.h"
+
+#include <etl/algorithm.h>
+#include <etl/error_handler.h>
+#include <etl/limits.h>
+#include <etl/utility.h>
+
+namespace can
+{
+// define const variables for GCC
+uint32_t const ExtendedIdFilter::MAX_ID;
+
+ExtendedIdFilter::ExtendedIdFilter(::etl::span<Range> const ranges) : _ranges(ranges), _size(0U)
+{
+    ETL_ASSERT(
+        !ranges.empty(), ETL_ERROR_GENERIC("ExtendedIdFilter needs to hold at least one range"));
+}
+
+// virtual
+void ExtendedIdFilter::add(uint32_t const filterId) { add(filterId, filterId); }
+
+void ExtendedIdFilter::add(uint32_t from, uint32_t to)
+{
+    from = ::etl::min(from, MAX_ID);
+    to   = ::etl::min(to, MAX_ID);
+    if (from > to)
+    {
+        ::ETL_OR_STD::swap(from, to);
+    }
+    // first range that overlaps or touches the new one
+    uint32_t const touchingTo = (from > 0U) ? (from - 1U) : 0U;
+    Range* const first       = ::etl::lower_bound(
+        _ranges.begin(),
+        _ranges.begin() + _size,
+        touchingTo,
+        [](Range const& range, uint32_t const id) { return range.to < id; });
+    size_t const begin = static_cast<size_t>(first - _ranges.begin());
+    size_t end         = begin;
+    // to + 1 can't overflow as to <= MAX_ID
+    while ((end < _size) && (_ranges[end].from <= (to + 1U)))
+    {
+        ++end;
+    }
+
+    if (begin < end)
+    {
+        _ranges[begin].from = ::etl::min(_ranges[begin].from, from);
+        _ranges[begin].to   = ::etl::max(_ranges[end - 1U].to, to);
+        erase(begin + 1U, end);
+    }
+    else if (_size < _ranges.size())
+    {
+        insert(begin, Range{from, to});
+    }
+    else
+    {
+        joinClosest(begin, Range{from, to});
+    }
+}
+
+// virtual
+bool ExtendedIdFilter::match(uint32_t const filterId) const
+{
+    Range const* const begin = _ranges.begin();
+    Range const* const next  = ::etl::upper_bound(
+        begin,
+        begin + _size,
+        filterId,
+        [](uint32_t const id, Range const& range) { return id < range.from; });
+    return (next != begin) && (filterId <= (next - 1)->to);
+}
+
+void ExtendedIdFilter::clear() { _size = 0U; }
+
+void ExtendedIdFilter::open()
+{
+    _ranges[0U] = Range{0U, MAX_ID};
+    _size       = 1U;
+}
+
+void ExtendedIdFilter::mergeWithBitField(BitFieldFilter const& filter) { mergeBaseIds(filter); }
+
+void ExtendedIdFilter::mergeWithStaticBitField(AbstractStaticBitFieldFilter const& filter)
+{
+    mergeBaseIds(filter);
+}
+
+void ExtendedIdFilter::mergeWithInterval(IntervalFilter const& filter)
+{
+    if (filter.getLowerBound() <= filter.getUpperBound())
+    {
+        add(filter.getLowerBound(), filter.getUpperBound());
+    }
+}
+
+void ExtendedIdFilter::mergeWithExtendedId(ExtendedIdFilter const& filter)
+{
+    for (Range const& range : filter.getRanges())
+    {
+        add(range.from, range.to);
+    }
+}
+
+void ExtendedIdFilter::mergeBaseIds(IFilter const& filter)
+{
+    uint32_t runStart = 0U;
+    bool inRun        = false;
+    for (uint32_t id = 0U; id <= BitFieldFilter::MAX_ID; ++id)
+    {
+        bool const matches = filter.match(id);
+        if (matches && (!inRun))
+        {
+            runStart = id;
+            inRun    = true;
+        }
+        else if ((!matches) && inRun)
+        {
+            add(runStart, id - 1U);
+            inRun = false;
+        }
+        else
+        {
+            // run continues
+        }
+    }
+    if (inRun)
+    {
+        add(runStart, BitFieldFilter::MAX_ID);
+    }
+}
+
+void ExtendedIdFilter::insert(size_t const index, Range const& range)
+{
+    (void)::etl::copy_backward(
+        _ranges.begin() + index, _ranges.begin() + _size, _ranges.begin() + _size + 1U);
+    _ranges[index] = range;
+    ++_size;
+}
+
+void ExtendedIdFilter::erase(size_t const begin, size_t const end)
+{
+    (void)::etl::copy(_ranges.begin() + end, _ranges.begin() + _size, _ranges.begin() + begin);
+    _size -= (end - begin);
+}
+
+void ExtendedIdFilter::joinClosest(size_t index, Range const& range)
+{
+    uint32_t const noGap    = ::etl::numeric_limits<uint32_t>::max();
+    uint32_t const leftGap  = (index > 0U) ? (range.from - _ranges[index - 1U].to) : noGap;
+    uint32_t const rightGap = (index < _size) ? (_ranges[index].from - range.to) : noGap;
+
+    size_t closest     = 0U;
+    uint32_t closestGap = noGap;
+    for (size_t i = 0U; (i + 1U) < _size; ++i)
+    {
+        uint32_t const gap = _ranges[i + 1U].from - _ranges[i].to;
+        if (gap < closestGap)
+        {
+            closest    = i;
+            closestGap = gap;
+        }
+    }
+
+    if ((leftGap <= closestGap) || (rightGap <= closestGap))
+    {
+        // extend a neighbor, a range in the gap of two ranges always ends up here
+        if (leftGap <= rightGap)
+        {
+            _ranges[index - 1U].to = range.to;
+        }
+        else
+        {
+            _ranges[index].from = range.from;
+        }
+    }
+    else
+    {
+        _ranges[closest].to = _ranges[closest + 1U].to;
+        erase(closest + 1U, closest + 2U);
+        if (index > closest)
+        {
+            --index;
+        }
+        insert(index, range);
+    }
+}
+
+} // namespace can
@@ -0,0 +1,28 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "can/filter/IMerger.h"
+
+#include "can/filter/ExtendedIdFilter.h"
+#include "can/filter/IntervalFilter.h"
+
+namespace can
+{
+// virtual
+void IMerger::mergeWithExtendedId(ExtendedIdFilter const& filter)
+{
+    for (ExtendedIdFilter::Range const& range : filter.getRanges())
+    {
+        IntervalFilter const interval(range.from, range.to);
+        mergeWithInterval(interval);
+    }
+}
+
+} // namespace can
@@ -11,6 +11,7 @@
 #include "can/transceiver/AbstractCANTransceiver.h"
 
 #include <bsp/timer/SystemTimer.h>
+#include <etl/binary.h>
 #include <interrupts/SuspendResumeAllInterruptsScopedLock.h>
 
 #include <platform/config.h>
@@ -31,32 +32,51 @@ AbstractCANTransceiver::AbstractCANTransceiver(uint8_t const busId)
 , _busId(busId)
 , _stateListener(nullptr)
 , _transceiverState(ICANTransceiverStateListener::CANTransceiverState::ACTIVE)
+, _listenerIndex(nullptr)
+, _spareListenerIndex(nullptr)
+, _listenerGeneration(0U)
+, _listenerIndexValid(false)
+, _listenerIndexBuilding(false)
 {}
 
 void AbstractCANTransceiver::addCANFrameListener(ICANFrameListener& listener)
 {
-    ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
-    if (!_listeners.contains_node(listener))
     {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        if (_listeners.contains_node(listener))
+        {
+            return;
+        }
         _listeners.push_back(listener);
         listener.getFilter().acceptMerger(_filter);
+        invalidateListenerIndex();
     }
+    updateListenerIndex();
 }
 
 void AbstractCANTransceiver::addVIPCANFrameListener(ICANFrameListener& listener)
 {
-    ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
-    if (!_listeners.contains_node(listener))
     {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        if (_listeners.contains_node(listener))
+        {
+            return;
+        }
         _listeners.push_front(listener);
         listener.getFilter().acceptMerger(_filter);
+        invalidateListenerIndex();
     }
+    updateListenerIndex();
 }
 
 void AbstractCANTransceiver::removeCANFrameListener(ICANFrameListener& listener)
 {
-    ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
-    _listeners.erase(listener);
+    {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        _listeners.erase(listener);
+        invalidateListenerIndex();
+    }
+    updateListenerIndex();
 }
 
 void AbstractCANTransceiver::addCANFrameSentListener(IFilteredCANFrameSentListener& listener)
@@ -71,6 +91,80 @@ void AbstractCANTransceiver::removeCANFrameSentListener(IFilteredCANFrameSentLis
     _sentListeners.erase(listener);
 }
 
+void AbstractCANTransceiver::setListenerIndex(
+    CANFrameListenerIndex& index, CANFrameListenerIndex& spareIndex)
+{
+    {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        _listenerIndex      = &index;
+        _spareListenerIndex = &spareIndex;
+        invalidateListenerIndex();
+    }
+    updateListenerIndex();
+}
+
+void AbstractCANTransceiver::invalidateListenerIndex()
+{
+    // Called within the critical section: notifyListeners() checks all filters until the index
+    // has been rebuilt, so that it never calls a removed listener.
+    _listenerIndexValid = false;
+    ++_listenerGeneration;
+}
+
+void AbstractCANTransceiver::updateListenerIndex()
+{
+    {
+        ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+        if ((_listenerIndex == nullptr) || _listenerIndexBuilding)
+        {
+            // a build in progress notices the changed generation and builds again
+            return;
+        }
+        _listenerIndexBuilding = true;
+    }
+    while (true)
+    {
+        ICANFrameListener* listeners[CANFrameListenerIndex::MAX_LISTENERS];
+        size_t count                      = 0U;
+        bool fits                         = true;
+        uint32_t generation               = 0U;
+        CANFrameListenerIndex* spareIndex = nullptr;
+        {
+            ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+            generation = _listenerGeneration;
+            spareIndex = _spareListenerIndex;
+            for (auto& listener : _listeners)
+            {
+                if (count == CANFrameListenerIndex::MAX_LISTENERS)
+                {
+                    fits = false;
+                    break;
+                }
+                listeners[count] = &listener;
+                ++count;
+            }
+        }
+        // The filters are visited outside of the critical section.
+        bool const valid
+            = fits
+              && spareIndex->build(::etl::span<ICANFrameListener* const>(&listeners[0], count));
+        {
+            ESR_UNUSED const SuspendResumeAllInterruptsScopedLock lock;
+            if (generation == _listenerGeneration)
+            {
+                if (valid)
+                {
+                    _spareListenerIndex = _listenerIndex;
+                    _listenerIndex      = spareIndex;
+                }
+                _listenerIndexValid    = valid;
+                _listenerIndexBuilding = false;
+                return;
+            }
+        }
+    }
+}
+
 void AbstractCANTransceiver::notifyListeners(CANFrame const& frame)
 {
     if (_state == State::CLOSED)
@@ -78,6 +172,24 @@ void AbstractCANTransceiver::notifyListeners(CANFrame const& frame)
         return; // don't receive messages in state CLOSED
     }
 
+    if (_listenerIndexValid)
+    {
+        CANFrameListenerIndex const& listenerIndex = *_listenerIndex;
+        uint32_t const id                          = frame.getId();
+        CANFrameListenerIndex::ListenerMask mask   = listenerIndex.lookup(id);
+        while (mask != 0U)
+        {
+            uint8_t const index = static_cast<uint8_t>(::etl::count_trailing_zeros(mask));
+            mask &= mask - 1U;
+            if ((!listenerIndex.needsMatch(index))
+                || listenerIndex.getListener(index).getFilter().match(id))
+            {
+                listenerIndex.getListener(index).frameReceived(frame);
+            }
+        }
+        return;
+    }
+
     for (auto& listener : _listeners)
     {
         if (listener.getFilter().match(frame.getId()))
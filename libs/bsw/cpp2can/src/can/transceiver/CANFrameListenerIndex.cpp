@@ -0,0 +1,218 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "can/transceiver/CANFrameListenerIndex.h"
+
+#include "can/filter/AbstractStaticBitFieldFilter.h"
+#include "can/filter/IntervalFilter.h"
+
+#include <etl/algorithm.h>
+
+namespace can
+{
+// define const variables for GCC
+uint8_t const CANFrameListenerIndex::MAX_LISTENERS;
+uint8_t const CANFrameListenerIndex::MAX_LISTENER_SETS;
+uint8_t const CANFrameListenerIndex::MAX_BOUNDS;
+
+namespace
+{
+uint32_t const FIRST_NON_BASE_ID = static_cast<uint32_t>(BitFieldFilter::MAX_ID) + 1U;
+}
+
+CANFrameListenerIndex::CANFrameListenerIndex()
+: IMerger()
+, _listeners()
+, _filters()
+, _kinds()
+, _listenerCount(0U)
+, _matchMask(0U)
+, _baseSets()
+, _listenerSets()
+, _listenerSetCount(0U)
+, _bounds()
+, _boundMasks()
+, _boundCount(0U)
+, _valid(false)
+{}
+
+bool CANFrameListenerIndex::build(ListenerList& listeners)
+{
+    ICANFrameListener* listenerArray[MAX_LISTENERS];
+    size_t count = 0U;
+    for (auto& listener : listeners)
+    {
+        if (count >= MAX_LISTENERS)
+        {
+            _valid = false;
+            return false;
+        }
+        listenerArray[count] = &listener;
+        ++count;
+    }
+    return build(::etl::span<ICANFrameListener* const>(&listenerArray[0], count));
+}
+
+bool CANFrameListenerIndex::build(::etl::span<ICANFrameListener* const> const listeners)
+{
+    _valid         = false;
+    _listenerCount = 0U;
+    _matchMask     = 0U;
+    if (listeners.size() > MAX_LISTENERS)
+    {
+        return false;
+    }
+    for (ICANFrameListener* const listener : listeners)
+    {
+        _listeners[_listenerCount] = listener;
+        _filters[_listenerCount]   = nullptr;
+        _kinds[_listenerCount]     = FilterKind::NONE;
+        listener->getFilter().acceptMerger(*this);
+        if (_kinds[_listenerCount] == FilterKind::NONE)
+        {
+            _matchMask |= (1U << _listenerCount);
+        }
+        ++_listenerCount;
+    }
+
+    // Base identifiers, set 0 is the empty set
+    _listenerSets[0U] = 0U;
+    _listenerSetCount = 1U;
+    for (uint16_t id = 0U; id < BitFieldFilter::NUMBER_OF_BITS; ++id)
+    {
+        if (!addListenerSet(id, matchBase(id)))
+        {
+            return false;
+        }
+    }
+
+    // Segments of identifiers above the base identifiers, only IntervalFilters can match them
+    _boundCount = 0U;
+    addBound(FIRST_NON_BASE_ID);
+    for (uint8_t i = 0U; i < _listenerCount; ++i)
+    {
+        if (_kinds[i] == FilterKind::INTERVAL)
+        {
+            auto const& filter = *static_cast<IntervalFilter const*>(_filters[i]);
+            if ((filter.getLowerBound() <= filter.getUpperBound())
+                && (filter.getUpperBound() >= FIRST_NON_BASE_ID))
+            {
+                addBound(::etl::max(filter.getLowerBound(), FIRST_NON_BASE_ID));
+                if (filter.getUpperBound() < 0xFFFFFFFFU)
+                {
+                    addBound(filter.getUpperBound() + 1U);
+                }
+            }
+        }
+    }
+    for (uint8_t b = 0U; b < _boundCount; ++b)
+    {
+        ListenerMask mask = 0U;
+        for (uint8_t i = 0U; i < _listenerCount; ++i)
+        {
+            if ((_kinds[i] == FilterKind::INTERVAL) && _filters[i]->match(_bounds[b]))
+            {
+                mask |= (1U << i);
+            }
+        }
+        _boundMasks[b] = mask;
+    }
+
+    _valid = true;
+    return true;
+}
+
+CANFrameListenerIndex::ListenerMask CANFrameListenerIndex::lookup(uint32_t const id) const
+{
+    if (id < FIRST_NON_BASE_ID)
+    {
+        return _listenerSets[_baseSets[id]] | _matchMask;
+    }
+    // _bounds[0] is FIRST_NON_BASE_ID, so the segment always exists
+    uint32_t const* const segment = ::etl::upper_bound(&_bounds[0], &_bounds[_boundCount], id) - 1;
+    return _boundMasks[segment - &_bounds[0]] | _matchMask;
+}
+
+void CANFrameListenerIndex::mergeWithBitField(BitFieldFilter const& filter)
+{
+    _filters[_listenerCount] = &filter;
+    _kinds[_listenerCount]   = FilterKind::BIT_FIELD;
+}
+
+void CANFrameListenerIndex::mergeWithStaticBitField(AbstractStaticBitFieldFilter const& filter)
+{
+    _filters[_listenerCount] = &filter;
+    _kinds[_listenerCount]   = FilterKind::STATIC_BIT_FIELD;
+}
+
+void CANFrameListenerIndex::mergeWithInterval(IntervalFilter const& filter)
+{
+    _filters[_listenerCount] = &filter;
+    _kinds[_listenerCount]   = FilterKind::INTERVAL;
+}
+
+void CANFrameListenerIndex::mergeWithExtendedId(ExtendedIdFilter const& /* filter */)
+{
+    // An ExtendedIdFilter stays FilterKind::NONE, its match() is a binary search of its ranges.
+}
+
+CANFrameListenerIndex::ListenerMask CANFrameListenerIndex::matchBase(uint16_t const id) const
+{
+    ListenerMask mask = 0U;
+    for (uint8_t i = 0U; i < _listenerCount; ++i)
+    {
+        if ((_kinds[i] != FilterKind::NONE) && _filters[i]->match(id))
+        {
+            mask |= (1U << i);
+        }
+    }
+    return mask;
+}
+
+bool CANFrameListenerIndex::addListenerSet(uint16_t const id, ListenerMask const mask)
+{
+    // Neighboring identifiers mostly share their listeners
+    if ((id > 0U) && (_listenerSets[_baseSets[id - 1U]] == mask))
+    {
+        _baseSets[id] = _baseSets[id - 1U];
+        return true;
+    }
+    for (uint16_t set = 0U; set < _listenerSetCount; ++set)
+    {
+        if (_listenerSets[set] == mask)
+        {
+            _baseSets[id] = static_cast<uint8_t>(set);
+            return true;
+        }
+    }
+    if (_listenerSetCount > MAX_LISTENER_SETS)
+    {
+        return false;
+    }
+    _listenerSets[_listenerSetCount] = mask;
+    _baseSets[id]                    = static_cast<uint8_t>(_listenerSetCount);
+    ++_listenerSetCount;
+    return true;
+}
+
+void CANFrameListenerIndex::addBound(uint32_t const bound)
+{
+    uint32_t* const end      = &_bounds[_boundCount];
+    uint32_t* const position = ::etl::lower_bound(&_bounds[0], end, bound);
+    if ((position != end) && (*position == bound))
+    {
+        return;
+    }
+    (void)::etl::copy_backward(position, end, end + 1);
+    *position = bound;
+    ++_boundCount;
+}
+
+} // namespace can
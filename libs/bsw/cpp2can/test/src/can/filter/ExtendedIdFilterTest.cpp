@@ -0,0 +1,336 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "can/filter/ExtendedIdFilter.h"
+
+#include "can/canframes/CanId.h"
+#include "can/filter/AbstractStaticBitFieldFilter.h"
+#include "can/filter/BitFieldFilter.h"
+
+#include <gmock/gmock.h>
+
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace ::can;
+using namespace ::testing;
+
+namespace
+{
+class StaticBitFieldFilter : public AbstractStaticBitFieldFilter
+{
+public:
+    uint8_t getMaskValue(uint16_t const byteIndex) const override
+    {
+        return (byteIndex == 0U) ? 0x81U : 0U;
+    }
+};
+
+/** A merger which doesn't override IMerger::mergeWithExtendedId(). */
+class IntervalMerger : public IMerger
+{
+public:
+    void mergeWithBitField(BitFieldFilter const& /* filter */) override {}
+
+    void mergeWithStaticBitField(AbstractStaticBitFieldFilter const& /* filter */) override {}
+
+    void mergeWithInterval(IntervalFilter const& filter) override
+    {
+        _intervals.emplace_back(filter.getLowerBound(), filter.getUpperBound());
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> _intervals;
+};
+
+MATCHER_P2(IsRange, from, to, "")
+{
+    return (arg.from == static_cast<uint32_t>(from)) && (arg.to == static_cast<uint32_t>(to));
+}
+} // namespace
+
+struct ExtendedIdFilterTest : Test
+{
+    declare::ExtendedIdFilter<4> fFilter;
+};
+
+/**
+ * \desc
+ * After default constructor no id must match.
+ */
+TEST_F(ExtendedIdFilterTest, DefaultConstructor)
+{
+    EXPECT_EQ(4U, fFilter.getCapacity());
+    EXPECT_TRUE(fFilter.getRanges().empty());
+    EXPECT_FALSE(fFilter.match(0x0U));
+    EXPECT_FALSE(fFilter.match(CanId::extended(0x18DAF110U)));
+    EXPECT_FALSE(fFilter.match(ExtendedIdFilter::MAX_ID));
+}
+
+/**
+ * \desc
+ * Added ids and ranges must match, ids in between must not.
+ */
+TEST_F(ExtendedIdFilterTest, AddIdsAndRanges)
+{
+    fFilter.add(CanId::extended(0x18DAF110U));
+    fFilter.add(CanId::extended(0x18DA10F1U), CanId::extended(0x18DA1FF1U));
+    fFilter.add(0x7DFU);
+    fFilter.add(CanId::extended(0xCFE6C00U), CanId::extended(0xCFE6B00U));
+
+    EXPECT_THAT(
+        fFilter.getRanges(),
+        ElementsAre(
+            IsRange(0x7DFU, 0x7DFU),
+            IsRange(CanId::extended(0xCFE6B00U), CanId::extended(0xCFE6C00U)),
+            IsRange(CanId::extended(0x18DA10F1U), CanId::extended(0x18DA1FF1U)),
+            IsRange(CanId::extended(0x18DAF110U), CanId::extended(0x18DAF110U))));
+
+    EXPECT_TRUE(fFilter.match(0x7DFU));
+    EXPECT_FALSE(fFilter.match(0x7DEU));
+    EXPECT_FALSE(fFilter.match(0x7E0U));
+    EXPECT_FALSE(fFilter.match(CanId::extended(0x7DFU)));
+    EXPECT_TRUE(fFilter.match(CanId::extended(0xCFE6B00U)));
+    EXPECT_TRUE(fFilter.match(CanId::extended(0xCFE6B80U)));
+    EXPECT_TRUE(fFilter.match(CanId::extended(0xCFE6C00U)));
+    EXPECT_FALSE(fFilter.match(CanId::extended(0xCFE6C01U)));
+    EXPECT_TRUE(fFilter.match(CanId::extended(0x18DA1000U + 0xF1U)));
+    EXPECT_FALSE(fFilter.match(CanId::extended(0x18DA10F0U)));
+    EXPECT_TRUE(fFilter.match(CanId::extended(0x18DAF110U)));
+    EXPECT_FALSE(fFilter.match(CanId::extended(0x18DAF111U)));
+    EXPECT_FALSE(fFilter.match(0xFFFFFFFFU));
+}
+
+/**
+ * \desc
+ * Overlapping and adjacent ranges are joined.
+ */
+TEST_F(ExtendedIdFilterTest, JoinOverlappingAndAdjacentRanges)
+{
+    fFilter.add(0x100U, 0x1FFU);
+    fFilter.add(0x300U, 0x3FFU);
+    fFilter.add(0x500U);
+    fFilter.add(0x200U);
+    EXPECT_THAT(
+        fFilter.getRanges(),
+        ElementsAre(IsRange(0x100U, 0x200U), IsRange(0x300U, 0x3FFU), IsRange(0x500U, 0x500U)));
+
+    fFilter.add(0x180U, 0x4FFU);
+    EXPECT_THAT(fFilter.getRanges(), ElementsAre(IsRange(0x100U, 0x500U)));
+
+    fFilter.add(0x0U, 0x50U);
+    fFilter.add(0x50U, 0x0U);
+    fFilter.add(0x10U);
+    EXPECT_THAT(fFilter.getRanges(), ElementsAre(IsRange(0x0U, 0x50U), IsRange(0x100U, 0x500U)));
+
+    fFilter.add(0x51U, 0xFFU);
+    EXPECT_THAT(fFilter.getRanges(), ElementsAre(IsRange(0x0U, 0x500U)));
+}
+
+/**
+ * \desc
+ * If the filter is full, the ranges with the smallest gap are joined and all added ids still
+ * match.
+ */
+TEST_F(ExtendedIdFilterTest, JoinClosestRangesIfFull)
+{
+    fFilter.add(0x100U);
+    fFilter.add(0x200U);
+    fFilter.add(0x210U);
+    fFilter.add(0x400U);
+    ASSERT_EQ(4U, fFilter.getRanges().size());
+
+    // gap 0x200..0x210 is the smallest, the new range is inserted in front of it
+    fFilter.add(0x0U);
+    EXPECT_THAT(
+        fFilter.getRanges(),
+        ElementsAre(
+            IsRange(0x0U, 0x0U),
+            IsRange(0x100U, 0x100U),
+            IsRange(0x200U, 0x210U),
+            IsRange(0x400U, 0x400U)));
+
+    // the first of the gaps of equal size is joined, the new range is inserted behind it
+    fFilter.add(0x800U);
+    EXPECT_THAT(
+        fFilter.getRanges(),
+        ElementsAre(
+            IsRange(0x0U, 0x100U),
+            IsRange(0x200U, 0x210U),
+            IsRange(0x400U, 0x400U),
+            IsRange(0x800U, 0x800U)));
+
+    // closer to the left neighbor than any two ranges
+    fFilter.add(0x420U);
+    EXPECT_THAT(fFilter.getRanges()[2U], IsRange(0x400U, 0x420U));
+
+    // closer to the right neighbor than any two ranges
+    fFilter.add(0x7F0U);
+    EXPECT_THAT(
+        fFilter.getRanges(),
+        ElementsAre(
+            IsRange(0x0U, 0x100U),
+            IsRange(0x200U, 0x210U),
+            IsRange(0x400U, 0x420U),
+            IsRange(0x7F0U, 0x800U)));
+
+    uint32_t const added[] = {0x0U, 0x100U, 0x200U, 0x210U, 0x400U, 0x420U, 0x7F0U, 0x800U};
+    for (uint32_t const id : added)
+    {
+        EXPECT_TRUE(fFilter.match(id));
+    }
+}
+
+/**
+ * \desc
+ * A filter with a single range extends it.
+ */
+TEST_F(ExtendedIdFilterTest, SingleRange)
+{
+    declare::ExtendedIdFilter<1> filter;
+    filter.add(0x300U);
+    filter.add(0x100U);
+    filter.add(0x200U);
+    EXPECT_THAT(filter.getRanges(), ElementsAre(IsRange(0x100U, 0x300U)));
+}
+
+/**
+ * \desc
+ * The filter needs storage for at least one range.
+ */
+TEST_F(ExtendedIdFilterTest, EmptyStorage)
+{
+    EXPECT_THROW(
+        { ExtendedIdFilter filter{::etl::span<ExtendedIdFilter::Range>()}; }, ::etl::exception);
+}
+
+/**
+ * \desc
+ * Ids above MAX_ID are set to MAX_ID.
+ */
+TEST_F(ExtendedIdFilterTest, ClampToMaxId)
+{
+    fFilter.add(0xFFFFFFFFU);
+    EXPECT_THAT(
+        fFilter.getRanges(),
+        ElementsAre(IsRange(ExtendedIdFilter::MAX_ID, ExtendedIdFilter::MAX_ID)));
+    EXPECT_TRUE(fFilter.match(ExtendedIdFilter::MAX_ID));
+    EXPECT_FALSE(fFilter.match(0xFFFFFFFFU));
+}
+
+/**
+ * \desc
+ * open() matches all ids up to MAX_ID, clear() none.
+ */
+TEST_F(ExtendedIdFilterTest, OpenAndClear)
+{
+    fFilter.add(0x123U);
+    fFilter.open();
+    EXPECT_TRUE(fFilter.match(0x0U));
+    EXPECT_TRUE(fFilter.match(0x7FFU));
+    EXPECT_TRUE(fFilter.match(CanId::extended(0x12345U)));
+    EXPECT_TRUE(fFilter.match(ExtendedIdFilter::MAX_ID));
+    fFilter.clear();
+    EXPECT_TRUE(fFilter.getRanges().empty());
+    EXPECT_FALSE(fFilter.match(0x123U));
+}
+
+/**
+ * \desc
+ * Other filters can be merged into the filter.
+ */
+TEST_F(ExtendedIdFilterTest, MergeWithOtherFilters)
+{
+    declare::ExtendedIdFilter<16> filter;
+
+    BitFieldFilter bitField;
+    bitField.add(0x10U, 0x1FU);
+    bitField.add(0x7FFU);
+    bitField.acceptMerger(filter);
+
+    StaticBitFieldFilter staticBitField;
+    staticBitField.acceptMerger(filter);
+
+    IntervalFilter interval(CanId::extended(0x1000U), CanId::extended(0x1FFFU));
+    interval.acceptMerger(filter);
+    IntervalFilter emptyInterval;
+    emptyInterval.acceptMerger(filter);
+
+    fFilter.add(CanId::extended(0x18DAF110U));
+    fFilter.acceptMerger(filter);
+
+    EXPECT_THAT(
+        filter.getRanges(),
+        ElementsAre(
+            IsRange(0x0U, 0x0U),
+            IsRange(0x7U, 0x7U),
+            IsRange(0x10U, 0x1FU),
+            IsRange(0x7FFU, 0x7FFU),
+            IsRange(CanId::extended(0x1000U), CanId::extended(0x1FFFU)),
+            IsRange(CanId::extended(0x18DAF110U), CanId::extended(0x18DAF110U))));
+}
+
+/**
+ * \desc
+ * A BitFieldFilter merges the base ids of the filter.
+ */
+TEST_F(ExtendedIdFilterTest, MergeIntoBitFieldFilter)
+{
+    fFilter.add(0x10U, 0x12U);
+    fFilter.add(0x7FEU, CanId::extended(0x10U));
+    fFilter.add(CanId::extended(0x20U));
+
+    BitFieldFilter bitField;
+    fFilter.acceptMerger(bitField);
+    for (uint32_t id = 0U; id <= BitFieldFilter::MAX_ID; ++id)
+    {
+        EXPECT_EQ(fFilter.match(id), bitField.match(id)) << id;
+    }
+}
+
+/**
+ * \desc
+ * A merger without its own mergeWithExtendedId() merges each range as an interval.
+ */
+TEST_F(ExtendedIdFilterTest, MergeIntoMergerWithoutExtendedIdSupport)
+{
+    fFilter.add(0x10U, 0x12U);
+    fFilter.add(CanId::extended(0x20U));
+
+    IntervalMerger merger;
+    fFilter.acceptMerger(merger);
+    EXPECT_THAT(
+        merger._intervals,
+        ElementsAre(
+            Pair(0x10U, 0x12U), Pair(CanId::extended(0x20U), CanId::extended(0x20U))));
+}
+
+/**
+ * \desc
+ * Matching gives the same result as a set of all added ids.
+ */
+TEST_F(ExtendedIdFilterTest, MatchLikeSet)
+{
+    declare::ExtendedIdFilter<64> filter;
+    std::set<uint32_t> ids;
+    uint32_t seed = 1U;
+    for (uint32_t i = 0U; i < 64U; ++i)
+    {
+        seed              = (seed * 1103515245U) + 12345U;
+        uint32_t const id = CanId::extended((seed >> 4U) & 0x3FFU);
+        filter.add(id);
+        ids.insert(id);
+    }
+    for (uint32_t raw = 0U; raw <= 0x400U; ++raw)
+    {
+        uint32_t const id = CanId::extended(raw);
+        EXPECT_EQ(ids.count(id) > 0U, filter.match(id)) << raw;
+    }
+}
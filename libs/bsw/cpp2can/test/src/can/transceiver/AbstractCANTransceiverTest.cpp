@@ -373,6 +373,114 @@ TEST_F(AbstractCANTransceiverTest, testNotifyListeners)
     fpTransceiver->removeCANFrameListener(listener5);
 }
 
+/**
+ * @test
+ * verification that listeners are notified through the listener index like without it
+ */
+TEST_F(AbstractCANTransceiverTest, testNotifyListenersWithIndex)
+{
+    EXPECT_CALL(*fpTransceiver, init()).Times(1);
+    EXPECT_CALL(*fpTransceiver, open()).Times(1);
+    fpTransceiver->init();
+    fpTransceiver->open();
+
+    uint8_t payload[2] = {0x01, 0x02};
+    CANFrame frame(0x555, payload, 2);
+    tBitFieldListener listener1;
+    tIntervalListener listener2;
+    StrictMock<CANFrameListenerMock> listener3;
+    FilterMock filter;
+    listener1.getFilter().add(0x555);
+    listener2.getFilter().add(0x500, CanId::extended(0x100));
+    EXPECT_CALL(listener3, getFilter()).WillRepeatedly(ReturnRef(filter));
+    EXPECT_CALL(filter, acceptMerger(_)).Times(AnyNumber());
+
+    CANFrameListenerIndex index;
+    CANFrameListenerIndex spareIndex;
+    fpTransceiver->addCANFrameListener(listener1);
+    fpTransceiver->setListenerIndex(index, spareIndex);
+    // the indices are built alternately, starting with the spare index
+    EXPECT_FALSE(index.isValid());
+    EXPECT_TRUE(spareIndex.isValid());
+    fpTransceiver->addCANFrameListener(listener2);
+    EXPECT_TRUE(index.isValid());
+    fpTransceiver->addVIPCANFrameListener(listener3);
+    EXPECT_EQ(&listener3, &spareIndex.getListener(0U));
+
+    {
+        InSequence sequence;
+        EXPECT_CALL(filter, match(0x555)).WillOnce(Return(true));
+        EXPECT_CALL(listener3, frameReceived(_));
+        EXPECT_CALL(listener1, frameReceived(_));
+        EXPECT_CALL(listener2, frameReceived(_));
+    }
+    fpTransceiver->inject(frame);
+    Mock::VerifyAndClearExpectations(&listener1);
+    Mock::VerifyAndClearExpectations(&listener2);
+
+    frame.setId(CanId::extended(0x80));
+    EXPECT_CALL(filter, match(CanId::extended(0x80))).WillOnce(Return(false));
+    EXPECT_CALL(listener1, frameReceived(_)).Times(0);
+    EXPECT_CALL(listener2, frameReceived(_)).Times(1);
+    fpTransceiver->inject(frame);
+    Mock::VerifyAndClearExpectations(&listener2);
+
+    fpTransceiver->removeCANFrameListener(listener2);
+    frame.setId(0x555);
+    EXPECT_CALL(filter, match(0x555)).WillOnce(Return(false));
+    EXPECT_CALL(listener1, frameReceived(_)).Times(1);
+    EXPECT_CALL(listener2, frameReceived(_)).Times(0);
+    fpTransceiver->inject(frame);
+
+    fpTransceiver->removeCANFrameListener(listener1);
+    fpTransceiver->removeCANFrameListener(listener3);
+}
+
+TEST_F(AbstractCANTransceiverTest, testListenerAddedWhileIndexIsBuilt)
+{
+    EXPECT_CALL(*fpTransceiver, init()).Times(1);
+    EXPECT_CALL(*fpTransceiver, open()).Times(1);
+    fpTransceiver->init();
+    fpTransceiver->open();
+
+    uint8_t payload[2] = {0x01, 0x02};
+    CANFrame frame(0x555, payload, 2);
+    tBitFieldListener listener1;
+    StrictMock<CANFrameListenerMock> listener2;
+    FilterMock filter;
+    listener1.getFilter().add(0x555);
+    EXPECT_CALL(listener2, getFilter()).WillRepeatedly(ReturnRef(filter));
+    EXPECT_CALL(filter, match(0x555)).WillRepeatedly(Return(false));
+
+    CANFrameListenerIndex index;
+    CANFrameListenerIndex spareIndex;
+    fpTransceiver->setListenerIndex(index, spareIndex);
+    // merged into the filter of the transceiver, then visited by the first build of the index,
+    // during which listener1 is added, e.g. by a context of higher priority
+    EXPECT_CALL(filter, acceptMerger(_))
+        .WillOnce(Return())
+        .WillOnce(
+            [this, &listener1, &frame](IMerger&)
+            {
+                fpTransceiver->addCANFrameListener(listener1);
+                // the index being built isn't used yet
+                EXPECT_CALL(listener1, frameReceived(_)).Times(1);
+                fpTransceiver->inject(frame);
+            })
+        .WillRepeatedly(Return());
+    fpTransceiver->addCANFrameListener(listener2);
+    Mock::VerifyAndClearExpectations(&listener1);
+    // built again into the same index
+    EXPECT_TRUE(index.isValid());
+    EXPECT_EQ(&listener1, &index.getListener(1U));
+
+    EXPECT_CALL(listener1, frameReceived(_)).Times(1);
+    fpTransceiver->inject(frame);
+
+    fpTransceiver->removeCANFrameListener(listener1);
+    fpTransceiver->removeCANFrameListener(listener2);
+}
+
 TEST_F(AbstractCANTransceiverTest, testNotifySentListeners)
 {
     uint8_t payload[6] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05};
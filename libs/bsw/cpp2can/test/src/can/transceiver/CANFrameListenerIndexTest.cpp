@@ -0,0 +1,234 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "can/transceiver/CANFrameListenerIndex.h"
+
+#include "can/canframes/CanId.h"
+#include "can/filter/FilterMock.h"
+#include "can/framemgmt/AbstractBitFieldFilteredCANFrameListener.h"
+#include "can/framemgmt/AbstractIntervalFilteredCANFrameListener.h"
+#include "can/framemgmt/CANFrameListenerMock.h"
+
+#include <gmock/gmock.h>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::can;
+using namespace ::testing;
+
+struct BitFieldListener : public AbstractBitFieldFilteredCANFrameListener
+{
+    void frameReceived(CANFrame const& /* frame */) override {}
+};
+
+struct IntervalListener : public AbstractIntervalFilteredCANFrameListener
+{
+    void frameReceived(CANFrame const& /* frame */) override {}
+};
+
+struct StaticBitFieldFilter : public AbstractStaticBitFieldFilter
+{
+    uint8_t getMaskValue(uint16_t const byteIndex) const override
+    {
+        return (byteIndex == 0x10U) ? 0x0FU : 0U;
+    }
+};
+
+struct StaticBitFieldListener : public ICANFrameListener
+{
+    void frameReceived(CANFrame const& /* frame */) override {}
+
+    IFilter& getFilter() override { return filter; }
+
+    StaticBitFieldFilter filter;
+};
+
+class CANFrameListenerIndexTest : public Test
+{
+protected:
+    void add(ICANFrameListener& listener) { listeners.push_back(listener); }
+
+    /**
+     * Compares the lookup of the index to checking the filters of all listeners.
+     */
+    void expectSameAsLinearScan(uint32_t const id)
+    {
+        CANFrameListenerIndex::ListenerMask expected = 0U;
+        uint8_t index                                = 0U;
+        for (auto& listener : listeners)
+        {
+            if (listener.getFilter().match(id))
+            {
+                expected |= (1U << index);
+            }
+            ++index;
+        }
+        EXPECT_EQ(expected, cut.lookup(id)) << "id 0x" << std::hex << id;
+    }
+
+    CANFrameListenerIndex::ListenerList listeners;
+    CANFrameListenerIndex cut;
+};
+
+TEST_F(CANFrameListenerIndexTest, empty_index_matches_nothing)
+{
+    EXPECT_FALSE(cut.isValid());
+    EXPECT_TRUE(cut.build(listeners));
+    EXPECT_TRUE(cut.isValid());
+    EXPECT_EQ(0U, cut.lookup(0x0U));
+    EXPECT_EQ(0U, cut.lookup(0x7FFU));
+    EXPECT_EQ(0U, cut.lookup(CanId::extended(0x1234567U)));
+}
+
+TEST_F(CANFrameListenerIndexTest, base_identifiers_are_looked_up_per_identifier)
+{
+    BitFieldListener bitField1;
+    BitFieldListener bitField2;
+    StaticBitFieldListener staticBitField;
+    IntervalListener interval;
+    bitField1.getFilter().add(0x123U);
+    bitField1.getFilter().add(0x200U, 0x2FFU);
+    bitField2.getFilter().add(0x123U);
+    bitField2.getFilter().add(0x7FFU);
+    interval.getFilter().add(0x280U, 0x300U);
+    add(bitField1);
+    add(staticBitField);
+    add(bitField2);
+    add(interval);
+
+    EXPECT_TRUE(cut.build(listeners));
+    EXPECT_EQ(&bitField1, &cut.getListener(0U));
+    EXPECT_EQ(&interval, &cut.getListener(3U));
+    EXPECT_EQ(0x5U, cut.lookup(0x123U));
+    EXPECT_EQ(0x2U, cut.lookup(0x80U));
+    EXPECT_EQ(0x9U, cut.lookup(0x2A0U));
+    EXPECT_EQ(0x4U, cut.lookup(0x7FFU));
+    for (uint32_t id = 0U; id <= 0x900U; ++id)
+    {
+        expectSameAsLinearScan(id);
+    }
+    for (uint8_t index = 0U; index < 4U; ++index)
+    {
+        EXPECT_FALSE(cut.needsMatch(index));
+    }
+    listeners.clear();
+}
+
+TEST_F(CANFrameListenerIndexTest, extended_identifiers_are_looked_up_in_intervals)
+{
+    IntervalListener interval1;
+    IntervalListener interval2;
+    IntervalListener interval3;
+    BitFieldListener bitField;
+    interval1.getFilter().add(0x700U, CanId::extended(0x18DA0000U));
+    interval2.getFilter().add(CanId::extended(0x18DAF100U), CanId::extended(0x18DAF1FFU));
+    interval3.getFilter().add(CanId::extended(0x18DA0000U), IntervalFilter::MAX_ID);
+    bitField.getFilter().open();
+    add(interval1);
+    add(bitField);
+    add(interval2);
+    add(interval3);
+
+    EXPECT_TRUE(cut.build(listeners));
+    EXPECT_EQ(0x3U, cut.lookup(0x7FFU));
+    EXPECT_EQ(0x1U, cut.lookup(0x800U));
+    EXPECT_EQ(0x9U, cut.lookup(CanId::extended(0x18DA0000U)));
+    EXPECT_EQ(0xCU, cut.lookup(CanId::extended(0x18DAF1F1U)));
+    EXPECT_EQ(0x8U, cut.lookup(IntervalFilter::MAX_ID));
+    EXPECT_EQ(0x0U, cut.lookup(IntervalFilter::MAX_ID + 1U));
+    EXPECT_EQ(0x0U, cut.lookup(0xFFFFFFFFU));
+
+    uint32_t const ids[] = {
+        0x6FFU,
+        0x1000U,
+        CanId::extended(0x0U),
+        CanId::extended(0x18D9FFFFU),
+        CanId::extended(0x18DA0001U),
+        CanId::extended(0x18DAF0FFU),
+        CanId::extended(0x18DAF100U),
+        CanId::extended(0x18DAF1FFU),
+        CanId::extended(0x18DAF200U),
+        CanId::extended(0x1FFFFFFFU)};
+    for (uint32_t const id : ids)
+    {
+        expectSameAsLinearScan(id);
+    }
+    listeners.clear();
+}
+
+TEST_F(CANFrameListenerIndexTest, filters_without_merger_need_match)
+{
+    FilterMock filter;
+    CANFrameListenerMock listener;
+    BitFieldListener bitField;
+    bitField.getFilter().add(0x10U);
+    EXPECT_CALL(listener, getFilter()).WillRepeatedly(ReturnRef(filter));
+    EXPECT_CALL(filter, acceptMerger(_)).Times(1);
+    add(bitField);
+    add(listener);
+
+    EXPECT_TRUE(cut.build(listeners));
+    EXPECT_FALSE(cut.needsMatch(0U));
+    EXPECT_TRUE(cut.needsMatch(1U));
+    EXPECT_EQ(0x3U, cut.lookup(0x10U));
+    EXPECT_EQ(0x2U, cut.lookup(0x11U));
+    EXPECT_EQ(0x2U, cut.lookup(CanId::extended(0x11U)));
+    listeners.clear();
+}
+
+TEST_F(CANFrameListenerIndexTest, too_many_listeners_invalidate_index)
+{
+    std::vector<std::unique_ptr<BitFieldListener>> bitFields;
+    for (uint8_t i = 0U; i <= CANFrameListenerIndex::MAX_LISTENERS; ++i)
+    {
+        bitFields.emplace_back(new BitFieldListener());
+        bitFields.back()->getFilter().add(i);
+        add(*bitFields.back());
+    }
+    EXPECT_FALSE(cut.build(listeners));
+    EXPECT_FALSE(cut.isValid());
+
+    listeners.pop_back();
+    EXPECT_TRUE(cut.build(listeners));
+    EXPECT_TRUE(cut.isValid());
+    EXPECT_EQ(0x80000000U, cut.lookup(CANFrameListenerIndex::MAX_LISTENERS - 1U));
+    listeners.clear();
+}
+
+TEST_F(CANFrameListenerIndexTest, too_many_listener_sets_invalidate_index)
+{
+    // Each combination of 9 listeners on identifiers 0..511 results in a different set
+    BitFieldListener bitFields[9];
+    for (uint8_t i = 0U; i < 9U; ++i)
+    {
+        for (uint16_t id = 0U; id < 512U; ++id)
+        {
+            if ((id & (1U << i)) != 0U)
+            {
+                bitFields[i].getFilter().add(id);
+            }
+        }
+        add(bitFields[i]);
+    }
+    EXPECT_FALSE(cut.build(listeners));
+    EXPECT_FALSE(cut.isValid());
+
+    // 8 listeners result in 256 sets including the empty set
+    listeners.pop_back();
+    EXPECT_TRUE(cut.build(listeners));
+    EXPECT_EQ(0xFFU, cut.lookup(0xFFU));
+    EXPECT_EQ(0x0U, cut.lookup(0x100U));
+    listeners.clear();
+}
+
+} // namespace
@@ -160,6 +160,27 @@ public:
      */
     virtual ErrorCode send(::etl::span<uint8_t const> const& data) = 0;
 
+    /**
+     * sends an amount of data without copying it, if supported by the socket
+     * \param   data  data to send. It must stay valid and unchanged until it has been
+     * reported as sent by IDataSendNotificationListener::dataSent() with
+     * SendResult::DATA_SENT.
+     * \return  status of transmission, see send()
+     * \note
+     * The default implementation calls send().
+     */
+    virtual ErrorCode sendZeroCopy(::etl::span<uint8_t const> const& data);
+
+    /**
+     * checks whether data sent with sendZeroCopy() is still referenced by the TCP stack
+     * \return  true if such data hasn't been acknowledged yet
+     * \note
+     * A socket closed with close() in this state keeps reporting acknowledged data with
+     * IDataSendNotificationListener::dataSent() and calls IDataListener::connectionClosed()
+     * once the data isn't referenced anymore. The default implementation returns false.
+     */
+    virtual bool hasUnacknowledgedZeroCopyData() const;
+
     /**
      * sets the listener to this socket instance
      * \param  pListener  IDataListener to attach
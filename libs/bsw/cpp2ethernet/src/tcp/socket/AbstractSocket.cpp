@@ -14,4 +14,11 @@ namespace tcp
 {
 AbstractSocket::AbstractSocket() : _dataListener(nullptr), _sendNotificationListener(nullptr) {}
 
+AbstractSocket::ErrorCode AbstractSocket::sendZeroCopy(::etl::span<uint8_t const> const& data)
+{
+    return send(data);
+}
+
+bool AbstractSocket::hasUnacknowledgedZeroCopyData() const { return false; }
+
 } // namespace tcp
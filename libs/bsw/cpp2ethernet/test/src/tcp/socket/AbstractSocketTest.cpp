@@ -38,4 +38,23 @@ TEST(AbstractSocketTest, DefaultConstructor)
     ASSERT_EQ(&sendListener, s.getSendNotificationListener());
 }
 
+TEST(AbstractSocketTest, SendZeroCopyDefaultsToSend)
+{
+    StrictMock<AbstractSocketMock> s;
+    uint8_t const data[] = {1U, 2U, 3U};
+
+    EXPECT_CALL(s, send(ElementsAreArray(data)))
+        .WillOnce(Return(AbstractSocket::ErrorCode::SOCKET_ERR_NO_MORE_BUFFER));
+    ASSERT_EQ(
+        AbstractSocket::ErrorCode::SOCKET_ERR_NO_MORE_BUFFER,
+        s.sendZeroCopy(::etl::span<uint8_t const>(data)));
+}
+
+TEST(AbstractSocketTest, NoUnacknowledgedZeroCopyDataByDefault)
+{
+    StrictMock<AbstractSocketMock> s;
+
+    ASSERT_FALSE(s.hasUnacknowledgedZeroCopyData());
+}
+
 } // anonymous namespace
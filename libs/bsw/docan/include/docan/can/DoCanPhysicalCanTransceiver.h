@@ -29,9 +29,21 @@ namespace docan
 {
 /**
  * DoCAN implementation of a physical CAN transceiver.
+ *
+ * By default, one data frame is sent per call to startSendDataFrames() and the next frame is only
+ * encoded after the transmission of the previous one has been confirmed. With MAX_PENDING_FRAMES
+ * greater than 1, consecutive frames up to the requested last frame index are sent in a pipeline:
+ * up to MAX_PENDING_FRAMES frames are written to the CAN transceiver at once and the next frame is
+ * written from canFrameSent(). The callback is called once all frames of the send job have been
+ * confirmed. The CAN transceiver has to send frames with the same identifier in the order they
+ * have been written and confirm them asynchronously. Confirmations of frames of a cancelled send
+ * job are ignored, so that they are not counted for the next send job.
+ *
  * \tparam Addressing class providing addressing used for encoding/decoding CAN frames
+ * \tparam MAX_PENDING_FRAMES maximum number of frames written to the CAN transceiver and not yet
+ * confirmed
  */
-template<class Addressing>
+template<class Addressing, uint8_t MAX_PENDING_FRAMES = 1U>
 class DoCanPhysicalCanTransceiver final
 : public IDoCanPhysicalTransceiver<typename Addressing::DataLinkLayerType>
 , private ::can::ICANFrameListener
@@ -48,6 +60,14 @@ public:
     using FrameSizeType        = typename DataLinkLayerType::FrameSizeType;
     using JobHandleType        = typename FrameTransmitterType::JobHandleType;
 
+    static_assert(MAX_PENDING_FRAMES > 0U, "at least one frame must be pending");
+
+    /**
+     * Maximum number of frames sent in a pipelined send job. The transmitter waits for a single
+     * callback for all frames of a send job, this keeps it within the TX callback timeout.
+     */
+    static constexpr FrameIndexType MAX_PIPELINED_FRAMES = 64U;
+
     /**
      * Constructor.
      * \param transceiver CAN transceiver
@@ -90,55 +110,89 @@ private:
     ::can::IFilter& getFilter() override;
     void canFrameSent(::can::CANFrame const& frame) override;
 
-    ::can::CANFrame _frame;
+    ::can::ICanTransceiver::ErrorCode writeNextFrame();
+    void writePendingFrames();
+
+    ::can::CANFrame _frames[MAX_PENDING_FRAMES];
+    uint8_t _frameDataSizes[MAX_PENDING_FRAMES];
     ::can::ICanTransceiver& _transceiver;
     ::can::IFilter& _filter;
     IDoCanAddressConverter<DataLinkLayerType> const& _addressConverter;
     AddressingType const& _addressing;
     IDoCanFrameReceiver<DataLinkLayerType>* _frameReceiver;
     IDoCanDataFrameTransmitterCallback<DataLinkLayerType>* _sendCallback;
+    FrameCodecType const* _sendCodec;
+    ::etl::span<uint8_t const> _sendData;
     JobHandleType _sendJobHandle;
-    uint8_t _sendDataSize;
+    DataLinkAddressType _sendTransmissionAddress;
+    FrameSizeType _sendConsecutiveFrameDataSize;
+    FrameIndexType _sendFirstFrameIndex;
+    FrameIndexType _sendNextFrameIndex;
+    FrameIndexType _sendEndFrameIndex;
+    FrameIndexType _sentFrameCount;
+    MessageSizeType _sentDataSize;
+    uint8_t _pendingFrameCount;
+    uint8_t _cancelledFrameCount;
     bool _sendPending;
+    bool _sendInvalid;
 };
 
 /**
  * Inline implementation.
  */
-template<class Addressing>
-DoCanPhysicalCanTransceiver<Addressing>::DoCanPhysicalCanTransceiver(
+template<class Addressing, uint8_t MAX_PENDING_FRAMES>
+DoCanPhysicalCanTransceiver<Addressing, MAX_PENDING_FRAMES>::DoCanPhysicalCanTransceiver(
     ::can::ICanTransceiver& transceiver,
     ::can::IFilter& filter,
     IDoCanAddressConverter<DataLinkLayerType> const& addressConverter,
     AddressingType const& addressing)
-: _frame()
+: _frames()
+, _frameDataSizes()
 , _transceiver(transceiver)
 , _filter(filter)
 , _addressConverter(addressConverter)
 , _addressing(addressing)
 , _frameReceiver(nullptr)
 , _sendCallback(nullptr)
+, _sendCodec(nullptr)
+, _sendData()
 , _sendJobHandle()
-, _sendDataSize(0U)
+, _sendTransmissionAddress()
+, _sendConsecutiveFrameDataSize(0U)
+, _sendFirstFrameIndex(0U)
+, _sendNextFrameIndex(0U)
+, _sendEndFrameIndex(0U)
+, _sentFrameCount(0U)
+, _sentDataSize(0U)
+, _pendingFrameCount(0U)
+, _cancelledFrameCount(0U)
 , _sendPending(false)
+, _sendInvalid(false)
 {}
 
-template<class Addressing>
-void DoCanPhysicalCanTransceiver<Addressing>::init(IDoCanFrameReceiver<DataLinkLayerType>& receiver)
+template<class Addressing, uint8_t MAX_PENDING_FRAMES>
+void DoCanPhysicalCanTransceiver<Addressing, MAX_PENDING_FRAMES>::init(
+    IDoCanFrameReceiver<DataLinkLayerType>& receiver)
 {
-    _frameReceiver = &receiver;
+    _frameReceiver       = &receiver;
+    _pendingFrameCount   = 0U;
+    _cancelledFrameCount = 0U;
     _transceiver.addCANFrameListener(*this);
 }
 
-template<class Addressing>
-void DoCanPhysicalCanTransceiver<Addressing>::shutdown()
+template<class Addressing, uint8_t MAX_PENDING_FRAMES>
+void DoCanPhysicalCanTransceiver<Addressing, MAX_PENDING_FRAMES>::shutdown()
 {
-    _frameReceiver = nullptr;
+    _frameReceiver       = nullptr;
+    _sendPending         = false;
+    _sendCallback        = nullptr;
+    _pendingFrameCount   = 0U;
+    _cancelledFrameCount = 0U;
     _transceiver.removeCANFrameListener(*this);
 }
 
-template<class Addressing>
-SendResult DoCanPhysicalCanTransceiver<Addressing>::startSendDataFrames(
+template<class Addressing, uint8_t MAX_PENDING_FRAMES>
+SendResult DoCanPhysicalCanTransceiver<Addressing, MAX_PENDING_FRAMES>::startSendDataFrames(
     FrameCodecType const& codec,
     IDoCanDataFrameTransmitterCallback<DataLinkLayerType>& callback,
     JobHandleType const jobHandle,
@@ -148,29 +202,37 @@ SendResult DoCanPhysicalCanTransceiver<Addressing>::startSendDataFrames(
     FrameSizeType const consecutiveFrameDataSize,
     ::etl::span<uint8_t const> const& data)
 {
-    (void)lastFrameIndex;
     if (!_sendPending)
     {
-        ::etl::span<uint8_t> payload(
-            _frame.getPayload(), static_cast<size_t>(_frame.getMaxPayloadLength()));
+        FrameIndexType endFrameIndex = firstFrameIndex + 1U;
+        if ((MAX_PENDING_FRAMES > 1U) && (lastFrameIndex > endFrameIndex))
+        {
+            endFrameIndex = (lastFrameIndex - firstFrameIndex > MAX_PIPELINED_FRAMES)
+                                ? (firstFrameIndex + MAX_PIPELINED_FRAMES)
+                                : lastFrameIndex;
+        }
+        _sendCodec                    = &codec;
+        _sendData                     = data;
+        _sendTransmissionAddress      = transmissionAddress;
+        _sendConsecutiveFrameDataSize = consecutiveFrameDataSize;
+        _sendFirstFrameIndex          = firstFrameIndex;
+        _sendNextFrameIndex           = firstFrameIndex;
+        _sendEndFrameIndex            = endFrameIndex;
+        _sentFrameCount               = 0U;
+        _sentDataSize                 = 0U;
+        _pendingFrameCount            = 0U;
 
-        if (codec.encodeDataFrame(
-                payload, data, firstFrameIndex, consecutiveFrameDataSize, _sendDataSize)
-            != CodecResult::OK)
+        ::can::ICanTransceiver::ErrorCode const result = writeNextFrame();
+        if (_sendInvalid)
         {
             return SendResult::INVALID;
         }
-
-        uint32_t canId;
-        _addressing.encodeTransmissionAddress(transmissionAddress, canId, payload);
-        _frame.setId(canId);
-        _frame.setPayloadLength(static_cast<uint8_t>(payload.size()));
-        ::can::ICanTransceiver::ErrorCode const result = _transceiver.write(_frame, *this);
         if (result == ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK)
         {
             _sendPending   = true;
             _sendCallback  = &callback;
             _sendJobHandle = jobHandle;
+            writePendingFrames();
             return SendResult::QUEUED_FULL;
         }
         if (result != ::can::ICanTransceiver::ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL)
@@ -182,8 +244,8 @@ SendResult DoCanPhysicalCanTransceiver<Addressing>::startSendDataFrames(
     return SendResult::FULL;
 }
 
-template<class Addressing>
-void DoCanPhysicalCanTransceiver<Addressing>::cancelSendDataFrames(
+template<class Addressing, uint8_t MAX_PENDING_FRAMES>
+void DoCanPhysicalCanTransceiver<Addressing, MAX_PENDING_FRAMES>::cancelSendDataFrames(
     IDoCanDataFrameTransmitterCallback<DataLinkLayerType>& callback, JobHandleType const jobHandle)
 {
     // This is done under lock in DoCanTransmitter.
@@ -191,11 +253,14 @@ void DoCanPhysicalCanTransceiver<Addressing>::cancelSendDataFrames(
     {
         _sendPending  = false;
         _sendCallback = nullptr;
+        // the frames written so far may still be confirmed
+        _cancelledFrameCount = static_cast<uint8_t>(_cancelledFrameCount + _pendingFrameCount);
+        _pendingFrameCount   = 0U;
     }
 }
 
-template<class Addressing>
-bool DoCanPhysicalCanTransceiver<Addressing>::sendFlowControl(
+template<class Addressing, uint8_t MAX_PENDING_FRAMES>
+bool DoCanPhysicalCanTransceiver<Addressing, MAX_PENDING_FRAMES>::sendFlowControl(
     FrameCodecType const& codec,
     DataLinkAddressType const transmissionAddress,
     FlowStatus const flowStatus,
@@ -214,8 +279,9 @@ bool DoCanPhysicalCanTransceiver<Addressing>::sendFlowControl(
     return _transceiver.write(frame) == ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK;
 }
 
-template<class Addressing>
-void DoCanPhysicalCanTransceiver<Addressing>::frameReceived(::can::CANFrame const& canFrame)
+template<class Addressing, uint8_t MAX_PENDING_FRAMES>
+void DoCanPhysicalCanTransceiver<Addressing, MAX_PENDING_FRAMES>::frameReceived(
+    ::can::CANFrame const& canFrame)
 {
     if (_frameReceiver == nullptr)
     {
@@ -242,28 +308,102 @@ void DoCanPhysicalCanTransceiver<Addressing>::frameReceived(::can::CANFrame cons
     (void)DoCanFrameDecoder<DataLinkLayerType>::decodeFrame(connection, payload, *_frameReceiver);
 }
 
-template<class Addressing>
-::can::IFilter& DoCanPhysicalCanTransceiver<Addressing>::getFilter()
+template<class Addressing, uint8_t MAX_PENDING_FRAMES>
+::can::IFilter& DoCanPhysicalCanTransceiver<Addressing, MAX_PENDING_FRAMES>::getFilter()
 {
     return _filter;
 }
 
-template<class Addressing>
-void DoCanPhysicalCanTransceiver<Addressing>::canFrameSent(::can::CANFrame const& frame)
+template<class Addressing, uint8_t MAX_PENDING_FRAMES>
+void DoCanPhysicalCanTransceiver<Addressing, MAX_PENDING_FRAMES>::canFrameSent(
+    ::can::CANFrame const& frame)
+{
+    bool const isNextFrame
+        = _sendPending && (frame == _frames[_sentFrameCount % MAX_PENDING_FRAMES]);
+    if ((_cancelledFrameCount > 0U) && (!isNextFrame))
+    {
+        // frames are confirmed in the order they have been written, this one belongs to a
+        // cancelled send job
+        --_cancelledFrameCount;
+    }
+    else if (_sendPending)
+    {
+        // the remaining frames of a cancelled send job have been dropped by the transceiver
+        _cancelledFrameCount = 0U;
+        // frames are confirmed in the order they have been written
+        _sentDataSize += _frameDataSizes[_sentFrameCount % MAX_PENDING_FRAMES];
+        ++_sentFrameCount;
+        if (_pendingFrameCount > 0U)
+        {
+            --_pendingFrameCount;
+        }
+        writePendingFrames();
+        if (_pendingFrameCount == 0U)
+        {
+            _sendPending = false;
+            if (_sendCallback != nullptr)
+            {
+                _sendCallback->dataFramesSent(_sendJobHandle, _sentFrameCount, _sentDataSize);
+            }
+        }
+    }
+}
+
+template<class Addressing, uint8_t MAX_PENDING_FRAMES>
+::can::ICanTransceiver::ErrorCode
+DoCanPhysicalCanTransceiver<Addressing, MAX_PENDING_FRAMES>::writeNextFrame()
+{
+    FrameIndexType const frameNumber = _sendNextFrameIndex - _sendFirstFrameIndex;
+    ::can::CANFrame& frame           = _frames[frameNumber % MAX_PENDING_FRAMES];
+    uint8_t& dataSize                = _frameDataSizes[frameNumber % MAX_PENDING_FRAMES];
+    ::etl::span<uint8_t> payload(
+        frame.getPayload(), static_cast<size_t>(frame.getMaxPayloadLength()));
+
+    _sendInvalid
+        = _sendCodec->encodeDataFrame(
+              payload, _sendData, _sendNextFrameIndex, _sendConsecutiveFrameDataSize, dataSize)
+          != CodecResult::OK;
+    if (_sendInvalid)
+    {
+        return ::can::ICanTransceiver::ErrorCode::CAN_ERR_ILLEGAL_STATE;
+    }
+
+    uint32_t canId;
+    _addressing.encodeTransmissionAddress(_sendTransmissionAddress, canId, payload);
+    frame.setId(canId);
+    frame.setPayloadLength(static_cast<uint8_t>(payload.size()));
+    ::can::ICanTransceiver::ErrorCode const result = _transceiver.write(frame, *this);
+    if (result == ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK)
+    {
+        ++_sendNextFrameIndex;
+        ++_pendingFrameCount;
+    }
+    return result;
+}
+
+template<class Addressing, uint8_t MAX_PENDING_FRAMES>
+void DoCanPhysicalCanTransceiver<Addressing, MAX_PENDING_FRAMES>::writePendingFrames()
 {
-    (void)frame;
-    if (_sendPending)
+    while ((_pendingFrameCount < MAX_PENDING_FRAMES) && (_sendNextFrameIndex < _sendEndFrameIndex))
     {
-        _sendPending = false;
-        if (_sendCallback != nullptr)
+        ::can::ICanTransceiver::ErrorCode const result = writeNextFrame();
+        if (result != ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK)
         {
-            _sendCallback->dataFramesSent(_sendJobHandle, 1U, _sendDataSize);
+            if ((result != ::can::ICanTransceiver::ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL)
+                || (_pendingFrameCount == 0U))
+            {
+                // finish the send job with the frames written so far, the transmitter continues
+                // with the next frame
+                _sendEndFrameIndex = _sendNextFrameIndex;
+            }
+            // otherwise retry with the next confirmation
+            break;
         }
     }
 }
 
-template<class Addressing>
-::can::ICANFrameListener& DoCanPhysicalCanTransceiver<Addressing>::getListener()
+template<class Addressing, uint8_t MAX_PENDING_FRAMES>
+::can::ICANFrameListener& DoCanPhysicalCanTransceiver<Addressing, MAX_PENDING_FRAMES>::getListener()
 {
     return *this;
 }
@@ -0,0 +1,228 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <etl/span.h>
+
+#include <platform/estdint.h>
+
+namespace docan
+{
+/**
+ * Index of message receivers or transmitters by their reception address.
+ *
+ * The index is an open addressing hash table with linear probing. An entry is keyed by the owner
+ * of an object (i.e. the DoCanReceiver or DoCanTransmitter that allocated it from a pool that may
+ * be shared by several transport layers) and the reception address of the object. Several objects
+ * may be added with the same key. The entry then only counts them and the owner has to search its
+ * own list of objects.
+ *
+ * The table must hold more entries than objects can be added at the same time.
+ *
+ * \tparam AddressType data link address type
+ * \tparam T type of indexed objects
+ */
+template<class AddressType, class T>
+class DoCanAddressIndex
+{
+public:
+    struct Entry
+    {
+        /// owner of the objects, nullptr for a free entry
+        void const* owner;
+        /// the object if it is the only one with the key, nullptr if unknown
+        T* value;
+        AddressType address;
+        uint8_t count;
+    };
+
+    /**
+     * Get the table size for a number of objects.
+     * \param count maximum number of objects added at the same time
+     * \return smallest power of 2 that is at least twice count
+     */
+    static constexpr size_t getTableSize(size_t count, size_t size = 1U)
+    {
+        return (size >= (2U * count)) ? size : getTableSize(count, 2U * size);
+    }
+
+    /**
+     * Constructor.
+     * \param entries storage for the entries, the size must be a power of 2
+     */
+    explicit DoCanAddressIndex(::etl::span<Entry> entries);
+
+    /**
+     * Get the number of entries.
+     * \return size of the table
+     */
+    size_t getCapacity() const;
+
+    /**
+     * Add an object.
+     * \param owner owner of the object
+     * \param address reception address of the object
+     * \param value object to add
+     */
+    void add(void const* owner, AddressType address, T& value);
+
+    /**
+     * Remove an object that has been added before.
+     * \param owner owner of the object
+     * \param address reception address of the object
+     */
+    void remove(void const* owner, AddressType address);
+
+    /**
+     * Find the entry for a key.
+     * \param owner owner of the objects
+     * \param address reception address of the objects
+     * \return pointer to the entry, nullptr if no object has been added with the key
+     */
+    Entry* find(void const* owner, AddressType address);
+
+private:
+    size_t getHomeIndex(void const* owner, AddressType address) const;
+
+    ::etl::span<Entry> _entries;
+    size_t const _mask;
+};
+
+namespace declare
+{
+/**
+ * DoCanAddressIndex holding storage for a number of objects.
+ * \tparam AddressType data link address type
+ * \tparam T type of indexed objects
+ * \tparam COUNT maximum number of objects added at the same time
+ */
+template<class AddressType, class T, size_t COUNT>
+class DoCanAddressIndex : public ::docan::DoCanAddressIndex<AddressType, T>
+{
+public:
+    using EntryType = typename ::docan::DoCanAddressIndex<AddressType, T>::Entry;
+
+    DoCanAddressIndex();
+
+private:
+    EntryType _entryArray[::docan::DoCanAddressIndex<AddressType, T>::getTableSize(COUNT)];
+};
+} // namespace declare
+
+/**
+ * Inline implementation.
+ */
+template<class AddressType, class T>
+DoCanAddressIndex<AddressType, T>::DoCanAddressIndex(::etl::span<Entry> const entries)
+: _entries(entries), _mask(entries.size() - 1U)
+{
+    for (Entry& entry : _entries)
+    {
+        entry = Entry{nullptr, nullptr, AddressType(), 0U};
+    }
+}
+
+template<class AddressType, class T>
+inline size_t DoCanAddressIndex<AddressType, T>::getCapacity() const
+{
+    return _entries.size();
+}
+
+template<class AddressType, class T>
+void DoCanAddressIndex<AddressType, T>::add(
+    void const* const owner, AddressType const address, T& value)
+{
+    size_t index = getHomeIndex(owner, address);
+    while (_entries[index].owner != nullptr)
+    {
+        Entry& entry = _entries[index];
+        if ((entry.owner == owner) && (entry.address == address))
+        {
+            ++entry.count;
+            entry.value = nullptr;
+            return;
+        }
+        index = (index + 1U) & _mask;
+    }
+    _entries[index] = Entry{owner, &value, address, 1U};
+}
+
+template<class AddressType, class T>
+void DoCanAddressIndex<AddressType, T>::remove(void const* const owner, AddressType const address)
+{
+    Entry* const entry = find(owner, address);
+    if (entry == nullptr)
+    {
+        return;
+    }
+    --entry->count;
+    entry->value = nullptr;
+    if (entry->count > 0U)
+    {
+        return;
+    }
+    // shift back following entries of the probe sequence into the free entry
+    size_t freeIndex = static_cast<size_t>(entry - _entries.data());
+    size_t index     = freeIndex;
+    while (true)
+    {
+        index = (index + 1U) & _mask;
+        if (_entries[index].owner == nullptr)
+        {
+            break;
+        }
+        size_t const homeIndex = getHomeIndex(_entries[index].owner, _entries[index].address);
+        // distance from home is larger than distance to the free entry
+        if (((index - homeIndex) & _mask) >= ((index - freeIndex) & _mask))
+        {
+            _entries[freeIndex] = _entries[index];
+            freeIndex           = index;
+        }
+    }
+    _entries[freeIndex].owner = nullptr;
+}
+
+template<class AddressType, class T>
+typename DoCanAddressIndex<AddressType, T>::Entry*
+DoCanAddressIndex<AddressType, T>::find(void const* const owner, AddressType const address)
+{
+    size_t index = getHomeIndex(owner, address);
+    while (_entries[index].owner != nullptr)
+    {
+        Entry& entry = _entries[index];
+        if ((entry.owner == owner) && (entry.address == address))
+        {
+            return &entry;
+        }
+        index = (index + 1U) & _mask;
+    }
+    return nullptr;
+}
+
+template<class AddressType, class T>
+inline size_t DoCanAddressIndex<AddressType, T>::getHomeIndex(
+    void const* const owner, AddressType const address) const
+{
+    uint32_t const key = static_cast<uint32_t>(address)
+                         ^ static_cast<uint32_t>(reinterpret_cast<uintptr_t>(owner) >> 3U);
+    // fibonacci hashing, the upper bits are mixed best
+    return static_cast<size_t>((key * 0x9E3779B1U) >> 16U) & _mask;
+}
+
+namespace declare
+{
+template<class AddressType, class T, size_t COUNT>
+DoCanAddressIndex<AddressType, T, COUNT>::DoCanAddressIndex()
+: ::docan::DoCanAddressIndex<AddressType, T>(::etl::span<EntryType>(_entryArray))
+{}
+} // namespace declare
+
+} // namespace docan
@@ -19,6 +19,8 @@
 
 namespace docan
 {
+class IDoCanFlowControlPolicy;
+
 /**
  * Class holding all needed parameters for a DoCan transport layer.
  */
@@ -125,6 +127,18 @@ public:
      */
     void setMaxBlockSize(uint8_t maxBlockSize);
 
+    /**
+     * Get the policy adapting the flow control parameters to the current load.
+     * \return pointer to policy, null pointer if the configured parameters are sent unchanged
+     */
+    IDoCanFlowControlPolicy* getFlowControlPolicy() const;
+
+    /**
+     * Set the policy adapting the flow control parameters to the current load.
+     * \param flowControlPolicy pointer to policy, null pointer to send the configured parameters
+     */
+    void setFlowControlPolicy(IDoCanFlowControlPolicy* flowControlPolicy);
+
     /**
      * Decode the min separation time. The returned decoded separation time is in microseconds.
      * \param encodedMinSeparationTime encoded min separation time as specified by section 9.6.5.4
@@ -145,6 +159,7 @@ private:
     uint16_t _waitRxTimeout;
     uint16_t _waitTxCallbackTimeout;
     uint16_t _waitFlowControlTimeout;
+    IDoCanFlowControlPolicy* _flowControlPolicy;
     uint8_t _encodedMinSeparationTime;
     uint8_t _maxBlockSize;
     uint8_t _maxAllocateRetryCount;
@@ -170,6 +185,7 @@ inline DoCanParameters::DoCanParameters(
 , _waitRxTimeout(waitRxTimeout)
 , _waitTxCallbackTimeout(waitTxCallbackTimeout)
 , _waitFlowControlTimeout(waitFlowControlTimeout)
+, _flowControlPolicy(nullptr)
 , _encodedMinSeparationTime(encodeMinSeparationTime(minSeparationTimeUs))
 , _maxBlockSize(maxBlockSize)
 , _maxAllocateRetryCount(maxAllocateRetryCount)
@@ -226,6 +242,16 @@ inline void DoCanParameters::setMaxBlockSize(uint8_t const maxBlockSize)
     _maxBlockSize = maxBlockSize;
 }
 
+inline IDoCanFlowControlPolicy* DoCanParameters::getFlowControlPolicy() const
+{
+    return _flowControlPolicy;
+}
+
+inline void DoCanParameters::setFlowControlPolicy(IDoCanFlowControlPolicy* const flowControlPolicy)
+{
+    _flowControlPolicy = flowControlPolicy;
+}
+
 inline uint32_t DoCanParameters::decodeMinSeparationTime(uint8_t const encodedMinSeparationTime)
 {
     if (encodedMinSeparationTime <= 0x7FU)
@@ -0,0 +1,133 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include "docan/common/DoCanParameters.h"
+#include "docan/receiver/IDoCanFlowControlPolicy.h"
+
+#include <etl/delegate.h>
+#include <etl/span.h>
+
+#include <platform/estdint.h>
+
+namespace docan
+{
+/**
+ * Flow control policy that lets a sender transmit at full speed while the ECU is idle and throttles
+ * it with increasing load.
+ *
+ * The load is the maximum of the reception load of the receiver and all load sources. A load source
+ * returns a load in percent, e.g. the share of transport message buffers in use, the task load
+ * derived from runtime::RuntimeMonitor statistics or the fill level of the receive queue of a
+ * transceiver.
+ * - Below the idle load neither a block size nor a minimum separation time is advertised.
+ * - From the idle load on the block size is limited to the loaded block size and the minimum
+ *   separation time rises linearly up to its maximum at a load of 100 percent.
+ *
+ * The configured parameters are kept under load if they are more restrictive.
+ */
+class DoCanAdaptiveFlowControlPolicy : public IDoCanFlowControlPolicy
+{
+public:
+    using LoadSourceType = ::etl::delegate<uint8_t()>;
+
+    static constexpr uint8_t MAX_LOAD = 100U;
+
+    /**
+     * Constructor.
+     * \param loadSources sources returning a load in percent, must outlive the policy
+     * \param idleLoad load in percent from which on the sender is throttled
+     * \param loadedBlockSize block size to advertise under load, 0 keeps the configured block size
+     * \param maxMinSeparationTimeUs (unit: us) minimum separation time to advertise at full load
+     */
+    DoCanAdaptiveFlowControlPolicy(
+        ::etl::span<LoadSourceType const> loadSources,
+        uint8_t idleLoad,
+        uint8_t loadedBlockSize,
+        uint32_t maxMinSeparationTimeUs);
+
+    /**
+     * Get the current load.
+     * \param receptionLoad percentage of message receivers currently in use
+     * \return maximum of the reception load and all load sources, limited to MAX_LOAD
+     */
+    uint8_t getLoad(uint8_t receptionLoad) const;
+
+    void adaptFlowControl(
+        DoCanTransportAddressPair const& transportAddressPair,
+        uint8_t receptionLoad,
+        uint8_t& maxBlockSize,
+        uint8_t& encodedMinSeparationTime) override;
+
+private:
+    ::etl::span<LoadSourceType const> _loadSources;
+    uint32_t _maxMinSeparationTimeUs;
+    uint8_t _idleLoad;
+    uint8_t _loadedBlockSize;
+};
+
+/**
+ * Inline implementation.
+ */
+inline DoCanAdaptiveFlowControlPolicy::DoCanAdaptiveFlowControlPolicy(
+    ::etl::span<LoadSourceType const> const loadSources,
+    uint8_t const idleLoad,
+    uint8_t const loadedBlockSize,
+    uint32_t const maxMinSeparationTimeUs)
+: _loadSources(loadSources)
+, _maxMinSeparationTimeUs(maxMinSeparationTimeUs)
+, _idleLoad(idleLoad)
+, _loadedBlockSize(loadedBlockSize)
+{}
+
+inline uint8_t DoCanAdaptiveFlowControlPolicy::getLoad(uint8_t const receptionLoad) const
+{
+    uint8_t load = receptionLoad;
+    for (auto const& loadSource : _loadSources)
+    {
+        uint8_t const sourceLoad = loadSource();
+        if (sourceLoad > load)
+        {
+            load = sourceLoad;
+        }
+    }
+    return (load < MAX_LOAD) ? load : MAX_LOAD;
+}
+
+inline void DoCanAdaptiveFlowControlPolicy::adaptFlowControl(
+    DoCanTransportAddressPair const& /* transportAddressPair */,
+    uint8_t const receptionLoad,
+    uint8_t& maxBlockSize,
+    uint8_t& encodedMinSeparationTime)
+{
+    uint8_t const load = getLoad(receptionLoad);
+    if (load < _idleLoad)
+    {
+        maxBlockSize             = 0U;
+        encodedMinSeparationTime = 0U;
+        return;
+    }
+    if ((_loadedBlockSize != 0U) && ((maxBlockSize == 0U) || (maxBlockSize > _loadedBlockSize)))
+    {
+        maxBlockSize = _loadedBlockSize;
+    }
+    uint32_t const loadRange = static_cast<uint32_t>(MAX_LOAD) - _idleLoad;
+    uint32_t const minSeparationTimeUs
+        = (loadRange > 0U)
+              ? ((_maxMinSeparationTimeUs * (static_cast<uint32_t>(load) - _idleLoad)) / loadRange)
+              : _maxMinSeparationTimeUs;
+    if (minSeparationTimeUs > DoCanParameters::decodeMinSeparationTime(encodedMinSeparationTime))
+    {
+        encodedMinSeparationTime = DoCanParameters::encodeMinSeparationTime(minSeparationTimeUs);
+    }
+}
+
+} // namespace docan
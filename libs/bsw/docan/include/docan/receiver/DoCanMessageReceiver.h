@@ -18,6 +18,7 @@
 #include <etl/intrusive_list.h>
 #include <etl/span.h>
 #include <transport/ITransportMessageProcessedListener.h>
+#include <transport/ITransportMessageSink.h>
 #include <transport/TransportMessage.h>
 
 #include <platform/estdint.h>
@@ -71,6 +72,12 @@ public:
      */
     ::transport::TransportMessage* getMessage() const;
 
+    /**
+     * Get the allocated sink if existing.
+     * \return pointer to sink if existing
+     */
+    ::transport::ITransportMessageSink* getSink() const;
+
     /**
      * Get the transport address pair representing the current connection.
      * \return reference to transport address pair
@@ -114,6 +121,13 @@ public:
      */
     uint8_t getEncodedMinSeparationTime() const;
 
+    /**
+     * Set the flow control parameters for the following blocks of this transfer.
+     * \param maxBlockSize max block size
+     * \param encodedMinSeparationTime encoded minimum separation time
+     */
+    void setFlowControlParameters(uint8_t maxBlockSize, uint8_t encodedMinSeparationTime);
+
     /**
      * Called to announce the result of a message allocation try.
      * \param message pointer to message, 0 indicates no success
@@ -122,6 +136,15 @@ public:
      */
     ReceiveResult allocated(::transport::TransportMessage* message, uint8_t maxRetryCount);
 
+    /**
+     * Called to announce the successful allocation of a sink. The payload is streamed into the
+     * sink instead of a transport message, starting with the first frame data.
+     * \param sink reference to the sink
+     * \param maxRetryCount maximum number of allowed retries
+     * \return result indicating state transition
+     */
+    ReceiveResult allocated(::transport::ITransportMessageSink& sink, uint8_t maxRetryCount);
+
     /**
      * Return whether a consecutive frame is expected
      * \return true if a consecutive frame is expected
@@ -150,6 +173,12 @@ public:
      */
     ::transport::TransportMessage* detachMessage();
 
+    /**
+     * Detach the sink. Reception address is kept.
+     * \return detached sink, 0L if none was attached
+     */
+    ::transport::ITransportMessageSink* detachSink();
+
     /**
      * Release the message. Reset reception address and message.
      * \return TransportMessage connected with this receivers, 0L if not set allocated
@@ -211,14 +240,16 @@ public:
 private:
     ConnectionType const _connection;
     ::transport::TransportMessage* _message;
+    ::transport::ITransportMessageSink* _sink;
     uint8_t const* const _firstFrameData;
     uint32_t _timer;
     MessageSizeType const _messageSize;
+    MessageSizeType _receivedSize;
     FrameSizeType const _firstFrameDataSize;
     FrameSizeType const _consecutiveFrameDataSize;
     bool _isTimerSet;
-    uint8_t const _maxBlockSize;
-    uint8_t const _encodedMinSeparationTime;
+    uint8_t _maxBlockSize;
+    uint8_t _encodedMinSeparationTime;
     bool _blocked;
 };
 
@@ -255,9 +286,11 @@ DoCanMessageReceiver<DataLinkLayer>::DoCanMessageReceiver(
 , ::etl::bidirectional_link<0>()
 , _connection(connection)
 , _message(nullptr)
+, _sink(nullptr)
 , _firstFrameData(firstFrameData.data())
 , _timer(0U)
 , _messageSize(messageSize)
+, _receivedSize(0U)
 , _firstFrameDataSize(static_cast<FrameSizeType>(firstFrameData.size()))
 , _consecutiveFrameDataSize(consecutiveFrameDataSize)
 , _isTimerSet(false)
@@ -272,6 +305,12 @@ inline ::transport::TransportMessage* DoCanMessageReceiver<DataLinkLayer>::getMe
     return _message;
 }
 
+template<class DataLinkLayer>
+inline ::transport::ITransportMessageSink* DoCanMessageReceiver<DataLinkLayer>::getSink() const
+{
+    return _sink;
+}
+
 template<class DataLinkLayer>
 inline DoCanTransportAddressPair const&
 DoCanMessageReceiver<DataLinkLayer>::getTransportAddressPair() const
@@ -319,6 +358,14 @@ inline uint8_t DoCanMessageReceiver<DataLinkLayer>::getEncodedMinSeparationTime(
     return _encodedMinSeparationTime;
 }
 
+template<class DataLinkLayer>
+inline void DoCanMessageReceiver<DataLinkLayer>::setFlowControlParameters(
+    uint8_t const maxBlockSize, uint8_t const encodedMinSeparationTime)
+{
+    _maxBlockSize             = maxBlockSize;
+    _encodedMinSeparationTime = encodedMinSeparationTime;
+}
+
 template<class DataLinkLayer>
 ReceiveResult DoCanMessageReceiver<DataLinkLayer>::allocated(
     ::transport::TransportMessage* const message, uint8_t const maxRetryCount)
@@ -330,6 +377,26 @@ ReceiveResult DoCanMessageReceiver<DataLinkLayer>::allocated(
     {
         _message = message;
         (void)_message->append(_firstFrameData, static_cast<FrameSizeType>(_firstFrameDataSize));
+        _receivedSize = _firstFrameDataSize;
+    }
+    return result;
+}
+
+template<class DataLinkLayer>
+ReceiveResult DoCanMessageReceiver<DataLinkLayer>::allocated(
+    ::transport::ITransportMessageSink& sink, uint8_t const maxRetryCount)
+{
+    auto const result
+        = DoCanMessageReceiveProtocolHandler<FrameIndexType>::allocated(true, maxRetryCount);
+    if (!DoCanMessageReceiveProtocolHandler<FrameIndexType>::isAllocating())
+    {
+        _sink         = &sink;
+        _receivedSize = _firstFrameDataSize;
+        if (!sink.chunkReceived(0U, ::etl::span<uint8_t const>(_firstFrameData, _receivedSize)))
+        {
+            return DoCanMessageReceiveProtocolHandler<FrameIndexType>::cancel(
+                ReceiveMessage::PROCESSING_FAILED);
+        }
     }
     return result;
 }
@@ -337,16 +404,16 @@ ReceiveResult DoCanMessageReceiver<DataLinkLayer>::allocated(
 template<class DataLinkLayer>
 inline bool DoCanMessageReceiver<DataLinkLayer>::isConsecutiveFrameExpected() const
 {
-    return _message != nullptr;
+    return (_message != nullptr) || (_sink != nullptr);
 }
 
 template<class DataLinkLayer>
 inline typename DoCanMessageReceiver<DataLinkLayer>::FrameSizeType
 DoCanMessageReceiver<DataLinkLayer>::getExpectedConsecutiveFrameDataSize() const
 {
-    return ((_message->validBytes() + _consecutiveFrameDataSize) <= _messageSize)
+    return ((_receivedSize + _consecutiveFrameDataSize) <= _messageSize)
                ? _consecutiveFrameDataSize
-               : static_cast<FrameSizeType>(_messageSize - _message->validBytes());
+               : static_cast<FrameSizeType>(_messageSize - _receivedSize);
 }
 
 template<class DataLinkLayer>
@@ -360,7 +427,17 @@ inline ReceiveResult DoCanMessageReceiver<DataLinkLayer>::consecutiveFrameReceiv
             sequenceNumber, _maxBlockSize);
     if (DoCanMessageReceiveProtocolHandler<FrameIndexType>::getState() != ReceiveState::DONE)
     {
-        (void)_message->append(data.data(), static_cast<uint16_t>(expectedSize));
+        MessageSizeType const offset = _receivedSize;
+        _receivedSize += expectedSize;
+        if (_sink == nullptr)
+        {
+            (void)_message->append(data.data(), static_cast<uint16_t>(expectedSize));
+        }
+        else if (!_sink->chunkReceived(offset, data.first(expectedSize)))
+        {
+            return DoCanMessageReceiveProtocolHandler<FrameIndexType>::cancel(
+                ReceiveMessage::PROCESSING_FAILED);
+        }
     }
     return result;
 }
@@ -373,6 +450,14 @@ template<class DataLinkLayer>
     return message;
 }
 
+template<class DataLinkLayer>
+::transport::ITransportMessageSink* DoCanMessageReceiver<DataLinkLayer>::detachSink()
+{
+    ::transport::ITransportMessageSink* const sink = _sink;
+    _sink                                          = nullptr;
+    return sink;
+}
+
 template<class DataLinkLayer>
 ::transport::TransportMessage* DoCanMessageReceiver<DataLinkLayer>::release()
 {
@@ -11,11 +11,13 @@
 #pragma once
 
 #include "docan/addressing/IDoCanAddressConverter.h"
+#include "docan/common/DoCanAddressIndex.h"
 #include "docan/common/DoCanConnection.h"
 #include "docan/common/DoCanConstants.h"
 #include "docan/common/DoCanParameters.h"
 #include "docan/datalink/IDoCanFlowControlFrameTransmitter.h"
 #include "docan/receiver/DoCanMessageReceiver.h"
+#include "docan/receiver/IDoCanFlowControlPolicy.h"
 
 #include <async/Async.h>
 #include <async/Types.h>
@@ -23,6 +25,7 @@
 #include <common/busid/BusId.h>
 #include <interrupts/SuspendResumeAllInterruptsScopedLock.h>
 #include <transport/ITransportMessageProvidingListener.h>
+#include <transport/ITransportMessageSink.h>
 #include <util/logger/Logger.h>
 
 #include <etl/error_handler.h>
@@ -52,6 +55,7 @@ public:
     using MessageReceiverType             = DoCanMessageReceiver<DataLinkLayerType>;
     using MessageReceiverListType
         = ::etl::intrusive_list<MessageReceiverType, etl::bidirectional_link<0>>;
+    using MessageReceiverIndexType = DoCanAddressIndex<DataLinkAddressType, MessageReceiverType>;
 
     /** Constructor.
      *
@@ -65,6 +69,10 @@ public:
      *
      * \param parameters reference to object holding parameters. No copy is held, so changes to the
      * parameters will affect further message reception
+     *
+     * \param messageReceiverIndex optional index for looking up message receivers by reception
+     * address, must hold more entries than the block pool. Without index the message receivers are
+     * searched linearly
      */
     DoCanReceiver(
         uint8_t busId,
@@ -74,7 +82,8 @@ public:
         ::etl::ipool& messageReceiverBlockPool,
         IDoCanAddressConverter<DataLinkLayerType>& addressConverter,
         DoCanParameters const& parameters,
-        uint8_t loggerComponent);
+        uint8_t loggerComponent,
+        MessageReceiverIndexType* messageReceiverIndex = nullptr);
 
     /**
      * Initializes the receiver.
@@ -150,6 +159,7 @@ private:
     void resetTimer(MessageReceiverType& messageReceiver) const;
 
     MessageReceiverType* findMessageReceiver(DataLinkAddressType receptionAddress);
+    MessageReceiverType* findMessageReceiverInList(DataLinkAddressType receptionAddress);
 
     void setRemoveLock();
     void releaseRemoveLock();
@@ -166,6 +176,7 @@ private:
     ::async::MemberCall<DoCanReceiver, &DoCanReceiver::processMessageReceivers>
         _processMessageReceivers;
     MessageReceiverListType _messageReceivers;
+    MessageReceiverIndexType* const _messageReceiverIndex;
     DoCanParameters const& _parameters;
     FrameSizeType const _maxFirstFrameDataSize;
     ::async::ContextType const _context;
@@ -188,13 +199,15 @@ DoCanReceiver<DataLinkLayer>::DoCanReceiver(
     ::etl::ipool& messageReceiverBlockPool,
     IDoCanAddressConverter<DataLinkLayerType>& addressConverter,
     DoCanParameters const& parameters,
-    uint8_t const loggerComponent)
+    uint8_t const loggerComponent,
+    MessageReceiverIndexType* const messageReceiverIndex)
 : _addressConverter(addressConverter)
 , _messageProvidingListener(messageProvidingListener)
 , _flowControlFrameTransmitter(flowControlFrameTransmitter)
 , _messageReceiverPool(messageReceiverBlockPool)
 , _processMessageReceivers(*this)
 , _messageReceivers()
+, _messageReceiverIndex(messageReceiverIndex)
 , _parameters(parameters)
 , _maxFirstFrameDataSize(static_cast<FrameSizeType>(
       static_cast<size_t>(messageReceiverBlockPool.max_item_size()) - sizeof(MessageReceiverType)))
@@ -223,6 +236,12 @@ void DoCanReceiver<DataLinkLayer>::init()
         _messageReceiverPool.max_item_size() - sizeof(MessageReceiverType)
             < ::etl::numeric_limits<FrameSizeType>::max(),
         ETL_ERROR_GENERIC("message receiver object size must fit"));
+
+    // Ensure the index can't run full, probing relies on a free entry
+    ETL_ASSERT(
+        (_messageReceiverIndex == nullptr)
+            || (_messageReceiverIndex->getCapacity() > _messageReceiverPool.max_size()),
+        ETL_ERROR_GENERIC("message receiver index must hold more entries than the pool"));
 }
 
 template<class DataLinkLayer>
@@ -285,6 +304,11 @@ void DoCanReceiver<DataLinkLayer>::firstDataFrameReceived(
                     firstFrameCopy,
                     blocked);
                 _messageReceivers.push_back(*messageReceiver);
+                if (_messageReceiverIndex != nullptr)
+                {
+                    _messageReceiverIndex->add(
+                        this, dataLinkAddressPair.getReceptionAddress(), *messageReceiver);
+                }
             }
             handleTransitions(
                 *messageReceiver, handleTransition(*messageReceiver), "firstDataFrameReceived");
@@ -402,7 +426,8 @@ void DoCanReceiver<DataLinkLayer>::processMessageReceivers()
                 messageReceiver,
                 allocateTransportMessage(messageReceiver, true),
                 "processMessageReceivers");
-            if (messageReceiver.getMessage() == nullptr)
+            if ((messageReceiver.getMessage() == nullptr)
+                && (messageReceiver.getSink() == nullptr))
             {
                 break;
             }
@@ -540,16 +565,28 @@ ReceiveResult DoCanReceiver<DataLinkLayer>::allocateTransportMessage(
     DoCanTransportAddressPair const transportAddressPair
         = messageReceiver.getTransportAddressPair();
     ::transport::TransportMessage* message = nullptr;
+    ::transport::ITransportMessageSink* sink = nullptr;
     if (!messageReceiver.isBlocked())
     {
-        ::transport::ITransportMessageProvider::ErrorCode const result
-            = _messageProvidingListener.getTransportMessage(
+        // a sink takes the payload as it arrives, otherwise it's received into a message
+        ::transport::ITransportMessageProvider::ErrorCode result
+            = _messageProvidingListener.getTransportMessageSink(
+                _busId,
+                transportAddressPair.getSourceId(),
+                transportAddressPair.getTargetId(),
+                messageReceiver.getMessageSize(),
+                messageReceiver.getFirstFrameData(),
+                sink);
+        if (result == ::transport::ITransportMessageProvider::ErrorCode::TPMSG_NOT_RESPONSIBLE)
+        {
+            result = _messageProvidingListener.getTransportMessage(
                 _busId,
                 transportAddressPair.getSourceId(),
                 transportAddressPair.getTargetId(),
                 messageReceiver.getMessageSize(),
                 messageReceiver.getFirstFrameData(),
                 message);
+        }
         if ((result != ::transport::ITransportMessageProvider::ErrorCode::TPMSG_OK)
             && (result
                 != ::transport::ITransportMessageProvider::ErrorCode::TPMSG_NO_MSG_AVAILABLE))
@@ -596,6 +633,10 @@ ReceiveResult DoCanReceiver<DataLinkLayer>::allocateTransportMessage(
             return messageReceiver.cancel();
         }
 
+        if (sink != nullptr)
+        {
+            return messageReceiver.allocated(*sink, _parameters.getMaxAllocateRetryCount());
+        }
         if (message != nullptr)
         {
             message->resetValidBytes();
@@ -629,6 +670,19 @@ DoCanReceiver<DataLinkLayer>::sendFlowControlFrame(MessageReceiverType& messageR
     }
     else
     {
+        IDoCanFlowControlPolicy* const flowControlPolicy = _parameters.getFlowControlPolicy();
+        if (flowControlPolicy != nullptr)
+        {
+            uint8_t maxBlockSize             = _parameters.getMaxBlockSize();
+            uint8_t encodedMinSeparationTime = _parameters.getEncodedMinSeparationTime();
+            flowControlPolicy->adaptFlowControl(
+                messageReceiver.getTransportAddressPair(),
+                static_cast<uint8_t>(
+                    (_messageReceiverPool.size() * 100U) / _messageReceiverPool.max_size()),
+                maxBlockSize,
+                encodedMinSeparationTime);
+            messageReceiver.setFlowControlParameters(maxBlockSize, encodedMinSeparationTime);
+        }
         success = _flowControlFrameTransmitter.sendFlowControl(
             messageReceiver.getFrameCodec(),
             messageReceiver.getTransmissionAddress(),
@@ -643,6 +697,12 @@ template<class DataLinkLayer>
 ReceiveResult
 DoCanReceiver<DataLinkLayer>::startProcessingTransportMessage(MessageReceiverType& messageReceiver)
 {
+    ::transport::ITransportMessageSink* const sink = messageReceiver.detachSink();
+    if (sink != nullptr)
+    {
+        sink->receptionEnded(true);
+        return messageReceiver.processed(true);
+    }
     ::transport::TransportMessage& message = *messageReceiver.detachMessage();
     bool const success
         = (_messageProvidingListener.messageReceived(_busId, message, this)
@@ -663,6 +723,11 @@ ReceiveResult DoCanReceiver<DataLinkLayer>::release(MessageReceiverType& message
     {
         _messageProvidingListener.releaseTransportMessage(*message);
     }
+    ::transport::ITransportMessageSink* const sink = messageReceiver.detachSink();
+    if (sink != nullptr)
+    {
+        sink->receptionEnded(false);
+    }
     for (auto& it : _messageReceivers)
     {
         if (it.isBlocked() && (it.getReceptionAddress() == receptionAddress))
@@ -710,6 +775,11 @@ bool DoCanReceiver<DataLinkLayer>::handlePendingMessageReceivers(
     DataLinkAddressType const receptionAddress)
 {
     bool blocked = false;
+    if ((_messageReceiverIndex != nullptr)
+        && (_messageReceiverIndex->find(this, receptionAddress) == nullptr))
+    {
+        return blocked;
+    }
     for (auto& it : _messageReceivers)
     {
         if (it.getReceptionAddress() == receptionAddress)
@@ -739,6 +809,34 @@ bool DoCanReceiver<DataLinkLayer>::handlePendingMessageReceivers(
 template<class DataLinkLayer>
 typename DoCanReceiver<DataLinkLayer>::MessageReceiverType*
 DoCanReceiver<DataLinkLayer>::findMessageReceiver(DataLinkAddressType const receptionAddress)
+{
+    if (_messageReceiverIndex == nullptr)
+    {
+        return findMessageReceiverInList(receptionAddress);
+    }
+    ::interrupts::SuspendResumeAllInterruptsScopedLock const lock;
+    typename MessageReceiverIndexType::Entry* const entry
+        = _messageReceiverIndex->find(this, receptionAddress);
+    if (entry == nullptr)
+    {
+        return nullptr;
+    }
+    if (entry->value != nullptr)
+    {
+        return entry->value;
+    }
+    MessageReceiverType* const messageReceiver = findMessageReceiverInList(receptionAddress);
+    if (entry->count == 1U)
+    {
+        // the remaining receiver after removal of others with the same address
+        entry->value = messageReceiver;
+    }
+    return messageReceiver;
+}
+
+template<class DataLinkLayer>
+typename DoCanReceiver<DataLinkLayer>::MessageReceiverType*
+DoCanReceiver<DataLinkLayer>::findMessageReceiverInList(DataLinkAddressType const receptionAddress)
 {
     for (auto& it : _messageReceivers)
     {
@@ -777,6 +875,10 @@ void DoCanReceiver<DataLinkLayer>::releaseRemoveLock()
             {
                 MessageReceiverType& messageReceiver = *it;
                 it                                   = _messageReceivers.erase(it);
+                if (_messageReceiverIndex != nullptr)
+                {
+                    _messageReceiverIndex->remove(this, messageReceiver.getReceptionAddress());
+                }
                 _messageReceiverPool.destroy(&messageReceiver);
                 --_releasedReceiverCount;
             }
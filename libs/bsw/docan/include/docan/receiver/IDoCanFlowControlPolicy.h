@@ -0,0 +1,42 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include "docan/common/DoCanTransportAddressPair.h"
+
+#include <platform/estdint.h>
+
+namespace docan
+{
+/**
+ * Interface for adapting the block size and minimum separation time a receiver advertises in
+ * flow control frames to the current load of the ECU.
+ */
+class IDoCanFlowControlPolicy
+{
+public:
+    /**
+     * Called before each flow control frame with flow status CTS is sent, i.e. once per block.
+     * \param transportAddressPair transport addresses of the reception
+     * \param receptionLoad percentage of message receivers currently in use
+     * \param maxBlockSize block size to advertise, holds the configured block size on call
+     * \param encodedMinSeparationTime encoded minimum separation time to advertise, holds the
+     * configured value on call
+     */
+    virtual void adaptFlowControl(
+        DoCanTransportAddressPair const& transportAddressPair,
+        uint8_t receptionLoad,
+        uint8_t& maxBlockSize,
+        uint8_t& encodedMinSeparationTime)
+        = 0;
+};
+
+} // namespace docan
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "docan/addressing/IDoCanAddressConverter.h"
+#include "docan/common/DoCanAddressIndex.h"
 #include "docan/common/DoCanConstants.h"
 #include "docan/common/DoCanParameters.h"
 #include "docan/datalink/DoCanFrameCodec.h"
@@ -57,6 +58,8 @@ public:
         = ::etl::intrusive_list<MessageTransmitterType, ::etl::bidirectional_link<0>>;
     using MessageTransmitterListIterator = typename ::etl::
         intrusive_list<MessageTransmitterType, ::etl::bidirectional_link<0>>::iterator;
+    using MessageTransmitterIndexType
+        = DoCanAddressIndex<DataLinkAddressType, MessageTransmitterType>;
 
     /** Constructor.
      *
@@ -71,6 +74,10 @@ public:
      *
      * \param parameters reference to object holding parameters for the transport layers. No copy is
      * held within the transport layer!
+     *
+     * \param messageTransmitterIndex optional index for looking up message transmitters by
+     * reception address, must hold more entries than the block pool. Without index the message
+     * transmitters are searched linearly
      */
     DoCanTransmitter(
         uint8_t busId,
@@ -80,7 +87,8 @@ public:
         ::etl::ipool& messageTransmitterBlockPool,
         IDoCanAddressConverter<DataLinkLayerType>& addressConverter,
         DoCanParameters const& parameters,
-        uint8_t const loggerComponent);
+        uint8_t const loggerComponent,
+        MessageTransmitterIndexType* messageTransmitterIndex = nullptr);
 
     /**
      * Initializes the transmitter.
@@ -157,8 +165,9 @@ private:
         char const* functionName);
     void resetTimer(MessageTransmitterType& messageTransmitter);
 
-    MessageTransmitterListIterator
+    MessageTransmitterType*
     findMessageTransmitterByReceptionAddress(DataLinkAddressType receptionAddress);
+    MessageTransmitterType* findMessageTransmitterInList(DataLinkAddressType receptionAddress);
     MessageTransmitterListIterator findMessageTransmitterByJobHandle(JobHandleType jobHandle);
 
     MessageTransmitterListIterator setSendLock();
@@ -174,6 +183,7 @@ private:
     ::async::MemberCall<DoCanTransmitter, &DoCanTransmitter::processMessageTransmitters>
         _processMessageTransmitters;
     MessageTransmitterListType _messageTransmitters;
+    MessageTransmitterIndexType* const _messageTransmitterIndex;
     DataFrameTransmitterType& _dataFrameTransmitter;
     IDoCanTickGenerator& _tickGenerator;
     MessageTransmitterListIterator _sendMessageTransmitterIt;
@@ -204,11 +214,13 @@ DoCanTransmitter<DataLinkLayer>::DoCanTransmitter(
     ::etl::ipool& messageTransmitterBlockPool,
     IDoCanAddressConverter<DataLinkLayerType>& addressConverter,
     DoCanParameters const& parameters,
-    uint8_t const loggerComponent)
+    uint8_t const loggerComponent,
+    MessageTransmitterIndexType* const messageTransmitterIndex)
 : _addressConverter(addressConverter)
 , _messageTransmitterPool(messageTransmitterBlockPool)
 , _processMessageTransmitters(*this)
 , _messageTransmitters()
+, _messageTransmitterIndex(messageTransmitterIndex)
 , _dataFrameTransmitter(dataFrameTransmitter)
 , _tickGenerator(tickGenerator)
 , _sendMessageTransmitterIt(_messageTransmitters.end())
@@ -229,6 +241,11 @@ DoCanTransmitter<DataLinkLayer>::DoCanTransmitter(
 template<class DataLinkLayer>
 inline void DoCanTransmitter<DataLinkLayer>::init()
 {
+    // Ensure the index can't run full, probing relies on a free entry
+    ETL_ASSERT(
+        (_messageTransmitterIndex == nullptr)
+            || (_messageTransmitterIndex->getCapacity() > _messageTransmitterPool.max_size()),
+        ETL_ERROR_GENERIC("message transmitter index must hold more entries than the pool"));
     _jobCounter               = 0U;
     _sendMessageTransmitterIt = _messageTransmitters.end();
 }
@@ -282,7 +299,7 @@ template<class DataLinkLayer>
     ::interrupts::SuspendResumeAllInterruptsScopedLock const lock;
     if ((frameCount > 1U)
         && (findMessageTransmitterByReceptionAddress(dataLinkAddressPair.getReceptionAddress())
-            != _messageTransmitters.end()))
+            != nullptr))
     {
         ::util::logger::Logger::warn(
             _loggerComponent,
@@ -318,6 +335,11 @@ template<class DataLinkLayer>
         frameCount,
         consecutiveFrameDataSize);
     _messageTransmitters.push_back(messageTransmitter);
+    if (_messageTransmitterIndex != nullptr)
+    {
+        _messageTransmitterIndex->add(
+            this, dataLinkAddressPair.getReceptionAddress(), messageTransmitter);
+    }
 
     ::async::execute(_context, _processMessageTransmitters);
     return ::transport::AbstractTransportLayer::ErrorCode::TP_OK;
@@ -355,9 +377,9 @@ void DoCanTransmitter<DataLinkLayer>::flowControlFrameReceived(
 {
     RemoveGuard const guard(this);
     ::interrupts::SuspendResumeAllInterruptsScopedLock const lock;
-    MessageTransmitterListIterator const messageTransmitter
+    MessageTransmitterType* const messageTransmitter
         = findMessageTransmitterByReceptionAddress(receptionAddress);
-    if (messageTransmitter == _messageTransmitters.end())
+    if (messageTransmitter == nullptr)
     {
         char formatBuffer[FORMAT_BUFFER_SIZE];
         ::util::logger::Logger::warn(
@@ -483,6 +505,12 @@ void DoCanTransmitter<DataLinkLayer>::handleResult(
                     *this, messageTransmitter.getJobHandle());
                 _pendingSend = false;
             }
+            if (_messageTransmitterIndex != nullptr)
+            {
+                // released transmitters can't be found by their reception address anymore
+                ::interrupts::SuspendResumeAllInterruptsScopedLock const lock;
+                _messageTransmitterIndex->remove(this, messageTransmitter.getReceptionAddress());
+            }
             messageTransmitter.release();
             // Ensure we don't wrap _releasedTransmitterCount back to 0
             ETL_ASSERT(
@@ -629,18 +657,47 @@ void DoCanTransmitter<DataLinkLayer>::resetTimer(MessageTransmitterType& message
 }
 
 template<class DataLinkLayer>
-typename DoCanTransmitter<DataLinkLayer>::MessageTransmitterListIterator
+typename DoCanTransmitter<DataLinkLayer>::MessageTransmitterType*
 DoCanTransmitter<DataLinkLayer>::findMessageTransmitterByReceptionAddress(
     DataLinkAddressType const receptionAddress)
 {
-    for (auto&& it = _messageTransmitters.begin(); it != _messageTransmitters.end(); ++it)
+    if (_messageTransmitterIndex == nullptr)
+    {
+        return findMessageTransmitterInList(receptionAddress);
+    }
+    typename MessageTransmitterIndexType::Entry* const entry
+        = _messageTransmitterIndex->find(this, receptionAddress);
+    if (entry == nullptr)
+    {
+        return nullptr;
+    }
+    if (entry->value != nullptr)
+    {
+        return entry->value;
+    }
+    MessageTransmitterType* const messageTransmitter
+        = findMessageTransmitterInList(receptionAddress);
+    if (entry->count == 1U)
+    {
+        // the remaining transmitter after removal of others with the same address
+        entry->value = messageTransmitter;
+    }
+    return messageTransmitter;
+}
+
+template<class DataLinkLayer>
+typename DoCanTransmitter<DataLinkLayer>::MessageTransmitterType*
+DoCanTransmitter<DataLinkLayer>::findMessageTransmitterInList(
+    DataLinkAddressType const receptionAddress)
+{
+    for (MessageTransmitterType& messageTransmitter : _messageTransmitters)
     {
-        if (receptionAddress == it->getReceptionAddress())
+        if (receptionAddress == messageTransmitter.getReceptionAddress())
         {
-            return it;
+            return &messageTransmitter;
         }
     }
-    return _messageTransmitters.end();
+    return nullptr;
 }
 
 template<class DataLinkLayer>
@@ -151,7 +151,8 @@ DoCanTransportLayer<DataLinkLayer>::DoCanTransportLayer(
       config.getMessageReceiverPool(),
       addressConverter,
       config.getParameters(),
-      loggerComponent)
+      loggerComponent,
+      config.getMessageReceiverIndex())
 , _transmitter(
       busId,
       context,
@@ -160,7 +161,8 @@ DoCanTransportLayer<DataLinkLayer>::DoCanTransportLayer(
       config.getMessageTransmitterPool(),
       addressConverter,
       config.getParameters(),
-      loggerComponent)
+      loggerComponent,
+      config.getMessageTransmitterIndex())
 , _processShutdown(*this)
 , _shutdownDelegate()
 , _context(context)
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "docan/common/DoCanAddressIndex.h"
 #include "docan/common/DoCanParameters.h"
 #include "docan/receiver/DoCanMessageReceiver.h"
 #include "docan/transmitter/DoCanMessageTransmitter.h"
@@ -26,6 +27,13 @@ template<class DataLinkLayer>
 class DoCanTransportLayerConfig
 {
 public:
+    using MessageReceiverIndexType = DoCanAddressIndex<
+        typename DataLinkLayer::AddressType,
+        DoCanMessageReceiver<DataLinkLayer>>;
+    using MessageTransmitterIndexType = DoCanAddressIndex<
+        typename DataLinkLayer::AddressType,
+        DoCanMessageTransmitter<DataLinkLayer>>;
+
     /**
      * Constructor.
      * \param messageReceiverPool reference to message receiver pool
@@ -37,6 +45,24 @@ public:
         ::etl::ipool& messageTransmitterPool,
         DoCanParameters const& parameters);
 
+    /**
+     * Constructor with indices for looking up message receivers and transmitters by reception
+     * address.
+     * \param messageReceiverPool reference to message receiver pool
+     * \param messageTransmitterPool reference to message transmitter pool
+     * \param messageReceiverIndex reference to index of message receivers, must hold more entries
+     *        than the receiver pool
+     * \param messageTransmitterIndex reference to index of message transmitters, must hold more
+     *        entries than the transmitter pool
+     * \param parameters reference to parameters
+     */
+    DoCanTransportLayerConfig(
+        ::etl::ipool& messageReceiverPool,
+        ::etl::ipool& messageTransmitterPool,
+        MessageReceiverIndexType& messageReceiverIndex,
+        MessageTransmitterIndexType& messageTransmitterIndex,
+        DoCanParameters const& parameters);
+
     /**
      * Get message receiver pool.
      * \return reference to receiver pool
@@ -47,6 +73,16 @@ public:
      * \return reference to transmitter pool
      */
     ::etl::ipool& getMessageTransmitterPool() const;
+    /**
+     * Get message receiver index.
+     * \return pointer to receiver index, nullptr if none
+     */
+    MessageReceiverIndexType* getMessageReceiverIndex() const;
+    /**
+     * Get message transmitter index.
+     * \return pointer to transmitter index, nullptr if none
+     */
+    MessageTransmitterIndexType* getMessageTransmitterIndex() const;
     /**
      * Get access to parameters.
      * \return reference to parameters
@@ -56,6 +92,8 @@ public:
 private:
     ::etl::ipool& _messageReceiverPool;
     ::etl::ipool& _messageTransmitterPool;
+    MessageReceiverIndexType* _messageReceiverIndex;
+    MessageTransmitterIndexType* _messageTransmitterIndex;
     DoCanParameters const& _parameters;
 };
 
@@ -73,10 +111,14 @@ public:
     explicit DoCanTransportLayerConfig(DoCanParameters const& parameters);
 
 private:
-    using RxType = ::docan::declare::DoCanMessageReceiver<DataLinkLayer, MaxFrameSize>;
-    using TxType = DoCanMessageTransmitter<DataLinkLayer>;
+    using AddressType   = typename DataLinkLayer::AddressType;
+    using RxType        = ::docan::declare::DoCanMessageReceiver<DataLinkLayer, MaxFrameSize>;
+    using TxType        = DoCanMessageTransmitter<DataLinkLayer>;
+    using RxIndexedType = ::docan::DoCanMessageReceiver<DataLinkLayer>;
     ::etl::generic_pool<sizeof(RxType), alignof(RxType), RxCount> _messageReceiverPool;
     ::etl::generic_pool<sizeof(TxType), alignof(TxType), TxCount> _messageTransmitterPool;
+    ::docan::declare::DoCanAddressIndex<AddressType, RxIndexedType, RxCount> _messageReceiverIndex;
+    ::docan::declare::DoCanAddressIndex<AddressType, TxType, TxCount> _messageTransmitterIndex;
 };
 } // namespace declare
 
@@ -90,6 +132,22 @@ inline DoCanTransportLayerConfig<DataLinkLayer>::DoCanTransportLayerConfig(
     DoCanParameters const& parameters)
 : _messageReceiverPool(messageReceiverPool)
 , _messageTransmitterPool(messageTransmitterPool)
+, _messageReceiverIndex(nullptr)
+, _messageTransmitterIndex(nullptr)
+, _parameters(parameters)
+{}
+
+template<class DataLinkLayer>
+inline DoCanTransportLayerConfig<DataLinkLayer>::DoCanTransportLayerConfig(
+    ::etl::ipool& messageReceiverPool,
+    ::etl::ipool& messageTransmitterPool,
+    MessageReceiverIndexType& messageReceiverIndex,
+    MessageTransmitterIndexType& messageTransmitterIndex,
+    DoCanParameters const& parameters)
+: _messageReceiverPool(messageReceiverPool)
+, _messageTransmitterPool(messageTransmitterPool)
+, _messageReceiverIndex(&messageReceiverIndex)
+, _messageTransmitterIndex(&messageTransmitterIndex)
 , _parameters(parameters)
 {}
 
@@ -105,6 +163,20 @@ inline ::etl::ipool& DoCanTransportLayerConfig<DataLinkLayer>::getMessageTransmi
     return _messageTransmitterPool;
 }
 
+template<class DataLinkLayer>
+inline typename DoCanTransportLayerConfig<DataLinkLayer>::MessageReceiverIndexType*
+DoCanTransportLayerConfig<DataLinkLayer>::getMessageReceiverIndex() const
+{
+    return _messageReceiverIndex;
+}
+
+template<class DataLinkLayer>
+inline typename DoCanTransportLayerConfig<DataLinkLayer>::MessageTransmitterIndexType*
+DoCanTransportLayerConfig<DataLinkLayer>::getMessageTransmitterIndex() const
+{
+    return _messageTransmitterIndex;
+}
+
 template<class DataLinkLayer>
 DoCanParameters const& DoCanTransportLayerConfig<DataLinkLayer>::getParameters() const
 {
@@ -122,9 +194,15 @@ template<
 DoCanTransportLayerConfig<DataLinkLayer, RxCount, TxCount, MaxFrameSize>::DoCanTransportLayerConfig(
     DoCanParameters const& parameters)
 : ::docan::DoCanTransportLayerConfig<DataLinkLayer>(
-    _messageReceiverPool, _messageTransmitterPool, parameters)
+    _messageReceiverPool,
+    _messageTransmitterPool,
+    _messageReceiverIndex,
+    _messageTransmitterIndex,
+    parameters)
 , _messageReceiverPool()
 , _messageTransmitterPool()
+, _messageReceiverIndex()
+, _messageTransmitterIndex()
 {}
 
 } // namespace declare
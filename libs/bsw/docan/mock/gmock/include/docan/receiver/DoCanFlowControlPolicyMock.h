@@ -0,0 +1,32 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include "docan/receiver/IDoCanFlowControlPolicy.h"
+
+#include <gmock/gmock.h>
+
+namespace docan
+{
+/**
+ * Mock for DoCan flow control policy.
+ */
+class DoCanFlowControlPolicyMock : public IDoCanFlowControlPolicy
+{
+public:
+    MOCK_METHOD(
+        void,
+        adaptFlowControl,
+        (DoCanTransportAddressPair const&, uint8_t, uint8_t&, uint8_t&),
+        (override));
+};
+
+} // namespace docan
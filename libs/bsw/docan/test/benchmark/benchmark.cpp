@@ -17,6 +17,7 @@
 #include "docan/datalink/DoCanFrameCodec.h"
 #include "docan/datalink/DoCanFrameCodecConfigPresets.h"
 #include "docan/datalink/IDoCanFrameReceiver.h"
+#include "docan/receiver/DoCanAdaptiveFlowControlPolicy.h"
 #include "docan/transmitter/IDoCanTickGenerator.h"
 #include "docan/transport/DoCanTransportLayerConfig.h"
 #include "docan/transport/DoCanTransportLayerContainer.h"
@@ -27,10 +28,12 @@
 #include <can/canframes/CanId.h>
 #include <can/transceiver/AbstractCANTransceiver.h>
 #include <can/transceiver/ICanTransceiver.h>
+#include <etl/deque.h>
 #include <etl/delegate.h>
 #include <etl/vector.h>
 #include <transport/BufferedTransportMessage.h>
 #include <transport/ITransportMessageProcessedListener.h>
+#include <transport/ITransportMessageSink.h>
 #include <transport/TransportMessage.h>
 
 #include <gtest/gtest.h>
@@ -109,6 +112,19 @@ static uint32_t nowUs = 0;
 alignas(::async::AsyncMock) uint8_t asyncMockMem[sizeof(::async::AsyncMock)];
 std::once_flag asyncMockInitialized;
 
+void constructAsyncMock()
+{
+    std::call_once(asyncMockInitialized, []() { new (asyncMockMem)::async::AsyncMock(); });
+}
+
+// Fixtures are constructed when the benchmarks are registered during static initialization, the
+// leak is therefore only allowed when a benchmark is set up.
+void initAsyncMock()
+{
+    constructAsyncMock();
+    ::testing::Mock::AllowLeak(&asyncMockMem);
+}
+
 uint32_t nowUsFunc() { return nowUs; }
 
 static uint16_t const ALLOCATE_TIMEOUT       = 800;
@@ -132,7 +148,7 @@ struct TransmissionBenchmark : public ::benchmark::Fixture
 {
     TransmissionBenchmark()
     {
-        std::call_once(asyncMockInitialized, []() { new (asyncMockMem)::async::AsyncMock(); });
+        constructAsyncMock();
     }
 
     AddressingCodec _doCanCodecClassic{};
@@ -167,7 +183,7 @@ struct TransmissionBenchmark : public ::benchmark::Fixture
     ::docan::DoCanNormalAddressingFilter<DataLinkLayerType> _doCanAddressingFilter{
         ::etl::span(doCanMappingEntries), ::etl::span(codecEntries)};
 
-    ::common::busid::internal::Id<uint8_t, 0U> id;
+    uint8_t const id = 0U;
 
     TickGeneratorAdapter _doCanTickGenerator;
 
@@ -176,7 +192,7 @@ struct TransmissionBenchmark : public ::benchmark::Fixture
 
     void SetUp(::benchmark::State&) override
     {
-        ::testing::Mock::AllowLeak(&asyncMockMem);
+        initAsyncMock();
         nowUs = 0;
         _context.handleExecute();
 
@@ -204,30 +220,32 @@ struct TransmissionBenchmark : public ::benchmark::Fixture
 
     void initializeStack()
     {
-        new (&_doCanConfig)::docan::declare::
-            DoCanTransportLayerConfig<DataLinkLayerType, 80U, 15U, 64U>(_doCanParameters);
-
         auto shutdownCallback = [](::transport::AbstractTransportLayer&) {};
 
         for (auto&& layer : _doCanIsoLayers)
         {
-            layer.shutdown(::etl::delegate(shutdownCallback));
+            layer.shutdown(::transport::AbstractTransportLayer::ShutdownDelegate(shutdownCallback));
             _context.execute();
         }
 
         _doCanIsoLayers.clear();
         _doCanPhysicalTransceivers.clear();
 
+        // the layers are shut down before, they must not release their transmitters to the new
+        // pools
+        new (&_doCanConfig)::docan::declare::
+            DoCanTransportLayerConfig<DataLinkLayerType, 80U, 15U, 64U>(_doCanParameters);
+
         ::docan::DoCanPhysicalCanTransceiver<AddressingCodec>& doCanTransceiver
-            = _doCanPhysicalTransceivers.emplace_back().construct(
-                ::etl::ref(canTransceiver),
-                ::etl::ref(_doCanAddressingFilter),
+            = _doCanPhysicalTransceivers.emplace_back(
+                canTransceiver,
+                _doCanAddressingFilter,
                 _doCanAddressingFilter,
                 _doCanCodecClassic);
 
         canFrameSentListener = &doCanTransceiver;
 
-        _doCanIsoLayers.emplace_back().construct(
+        _doCanIsoLayers.emplace_back(
             id,
             _context,
             _doCanAddressingFilter,
@@ -335,6 +353,7 @@ BENCHMARK_F(TransmissionBenchmark, SendFirstConsecutiveFrame)(benchmark::State&
 template<size_t MessageSize>
 void TransmissionFullSegmentedMessage(benchmark::State& state)
 {
+    initAsyncMock();
     nowUs = 0;
     ::async::TestContext _context{1};
 
@@ -382,22 +401,22 @@ void TransmissionFullSegmentedMessage(benchmark::State& state)
         vector<::docan::DoCanPhysicalCanTransceiver<AddressingCodec>, NUM_CAN_TRANSPORT_ISO_LAYER>
             _doCanPhysicalTransceivers;
 
-    ::common::busid::internal::Id<uint8_t, 0U> id;
+    uint8_t const id = 0U;
 
     CanTransceiver canTransceiver(id);
 
     TickGeneratorAdapter _doCanTickGenerator;
 
     ::docan::DoCanPhysicalCanTransceiver<AddressingCodec>& doCanTransceiver
-        = _doCanPhysicalTransceivers.emplace_back().construct(
-            ::etl::ref(canTransceiver),
-            ::etl::ref(_doCanAddressingFilter),
+        = _doCanPhysicalTransceivers.emplace_back(
+            canTransceiver,
+            _doCanAddressingFilter,
             _doCanAddressingFilter,
             _doCanCodecClassic);
 
     ::can::ICANFrameSentListener* canFrameSentListener(&doCanTransceiver);
 
-    _doCanIsoLayers.emplace_back().construct(
+    _doCanIsoLayers.emplace_back(
         id,
         _context,
         _doCanAddressingFilter,
@@ -456,6 +475,7 @@ BENCHMARK_TEMPLATE(TransmissionFullSegmentedMessage, 10000);
 template<size_t MessageSize, uint16_t NoOfMessages>
 void TransmissionMultipleTransportLayersFullSegmentedMessages(benchmark::State& state)
 {
+    initAsyncMock();
     nowUs = 0;
     ::async::TestContext _context{1};
 
@@ -484,7 +504,7 @@ void TransmissionMultipleTransportLayersFullSegmentedMessages(benchmark::State&
         doCanMappingEntries;
     for (uint16_t messageIndex = 0; messageIndex < NoOfMessages; ++messageIndex)
     {
-        doCanMappingEntries.emplace_back().construct(
+        doCanMappingEntries.emplace_back(
             ::docan::DoCanNormalAddressingFilterAddressEntry<DataLinkLayerType>(
                 {messageIndex,
                  static_cast<uint16_t>(messageIndex + 1U),
@@ -511,16 +531,16 @@ void TransmissionMultipleTransportLayersFullSegmentedMessages(benchmark::State&
     ::docan::IDoCanFrameReceiver<DataLinkLayerType>* canFrameReceiver[NoOfMessages];
     for (uint16_t messageIndex = 0; messageIndex < NoOfMessages; ++messageIndex)
     {
-        ::common::busid::internal::Id<uint8_t, 0U> id;
-        canTransceivers.emplace_back().construct(id);
+        uint8_t const id = 0U;
+        canTransceivers.emplace_back(id);
         ::docan::DoCanPhysicalCanTransceiver<AddressingCodec>& doCanTransceiver
-            = _doCanPhysicalTransceivers.emplace_back().construct(
-                ::etl::ref(canTransceivers[messageIndex]),
-                ::etl::ref(_doCanAddressingFilter),
+            = _doCanPhysicalTransceivers.emplace_back(
+                canTransceivers[messageIndex],
+                _doCanAddressingFilter,
                 _doCanAddressingFilter,
                 _doCanCodecClassic);
         canFrameSentListener[messageIndex] = &doCanTransceiver;
-        _doCanIsoLayers.emplace_back().construct(
+        _doCanIsoLayers.emplace_back(
             id,
             _context,
             _doCanAddressingFilter,
@@ -549,7 +569,7 @@ void TransmissionMultipleTransportLayersFullSegmentedMessages(benchmark::State&
         transportMessage[messageIndex].setPayloadLength(sizeof(data[messageIndex]));
 
         sending[messageIndex] = false;
-        tpMessageProcessedListeners.emplace_back().construct(nowUs, sending[messageIndex]);
+        tpMessageProcessedListeners.emplace_back(nowUs, sending[messageIndex]);
     }
 
     _context.handleExecute();
@@ -570,7 +590,7 @@ void TransmissionMultipleTransportLayersFullSegmentedMessages(benchmark::State&
             canFrameSentListener[messageIndex]->canFrameSent({});
             _context.execute();
             canFrameReceiver[messageIndex]->flowControlFrameReceived(
-                messageIndex, ::docan::DoCanConstants::FlowStatus::CTS, 0U, 0U);
+                messageIndex, ::docan::FlowStatus::CTS, 0U, 0U);
         }
         bool someSending = true;
         while (someSending)
@@ -597,6 +617,7 @@ BENCHMARK_TEMPLATE(TransmissionMultipleTransportLayersFullSegmentedMessages, 100
 template<size_t MessageSize, uint16_t NoOfMessages>
 void TransmissionMultipleFullSegmentedMessages(benchmark::State& state)
 {
+    initAsyncMock();
     nowUs = 0;
     ::async::TestContext _context{1};
 
@@ -625,7 +646,7 @@ void TransmissionMultipleFullSegmentedMessages(benchmark::State& state)
         doCanMappingEntries;
     for (uint16_t messageIndex = 0; messageIndex < NoOfMessages; ++messageIndex)
     {
-        doCanMappingEntries.emplace_back().construct(
+        doCanMappingEntries.emplace_back(
             ::docan::DoCanNormalAddressingFilterAddressEntry<DataLinkLayerType>(
                 {messageIndex,
                  static_cast<uint16_t>(messageIndex + 1U),
@@ -643,7 +664,7 @@ void TransmissionMultipleFullSegmentedMessages(benchmark::State& state)
     ::docan::DoCanTransportLayerContainer<DataLinkLayerType> _doCanIsoLayerContainer(
         _doCanIsoLayers);
 
-    ::common::busid::internal::Id<uint8_t, 0U> id;
+    uint8_t const id = 0U;
     CanTransceiver canTransceivers(id);
 
     TickGeneratorAdapter _doCanTickGenerator;
@@ -652,7 +673,7 @@ void TransmissionMultipleFullSegmentedMessages(benchmark::State& state)
     ::docan::DoCanPhysicalCanTransceiver<AddressingCodec> doCanTransceiver(
         canTransceivers, _doCanAddressingFilter, _doCanAddressingFilter, _doCanCodecClassic);
     canFrameSentListener = &doCanTransceiver;
-    _doCanIsoLayers.emplace_back().construct(
+    _doCanIsoLayers.emplace_back(
         id,
         _context,
         _doCanAddressingFilter,
@@ -680,7 +701,7 @@ void TransmissionMultipleFullSegmentedMessages(benchmark::State& state)
         transportMessage[messageIndex].setPayloadLength(sizeof(data[messageIndex]));
 
         sending[messageIndex] = false;
-        tpMessageProcessedListeners.emplace_back().construct(nowUs, sending[messageIndex]);
+        tpMessageProcessedListeners.emplace_back(nowUs, sending[messageIndex]);
     }
 
     _context.handleExecute();
@@ -704,7 +725,7 @@ void TransmissionMultipleFullSegmentedMessages(benchmark::State& state)
         for (size_t messageIndex = 0; messageIndex < NoOfMessages; ++messageIndex)
         {
             canFrameReceiver->flowControlFrameReceived(
-                messageIndex, ::docan::DoCanConstants::FlowStatus::CTS, 0U, 0U);
+                messageIndex, ::docan::FlowStatus::CTS, 0U, 0U);
             _context.execute();
         }
         bool someSending = true;
@@ -732,3 +753,723 @@ BENCHMARK_TEMPLATE(TransmissionMultipleFullSegmentedMessages, 10, 10);
 BENCHMARK_TEMPLATE(TransmissionMultipleFullSegmentedMessages, 100, 10);
 BENCHMARK_TEMPLATE(TransmissionMultipleFullSegmentedMessages, 10, 100);
 BENCHMARK_TEMPLATE(TransmissionMultipleFullSegmentedMessages, 100, 100);
+
+/**
+ * CAN transceiver that simulates the timing of a bus with a TX queue. Frames are put on the bus in
+ * the order they are written, each of them takes FRAME_TIME_US. The confirmation of a frame is
+ * delivered CONFIRMATION_LATENCY_US after the frame has left the bus, which models the interrupt
+ * and task latency of the TX confirmation path.
+ */
+struct SimulatedBusCanTransceiver : public CanTransceiver
+{
+    static uint32_t const FRAME_TIME_US           = 111U; // 8 byte frame at 1 MBit/s
+    static uint32_t const CONFIRMATION_LATENCY_US = 200U;
+    static size_t const TX_QUEUE_SIZE             = 8U;
+
+    explicit SimulatedBusCanTransceiver(uint8_t busId) : CanTransceiver(busId) {}
+
+    using CanTransceiver::write;
+
+    ErrorCode write(::can::CANFrame const& frame, ::can::ICANFrameSentListener& listener) override
+    {
+        if (txQueue.full())
+        {
+            return ::can::ICanTransceiver::ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL;
+        }
+        txQueue.push_back(&listener);
+        startFrame();
+        return ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK;
+    }
+
+    /**
+     * Advances the simulated time to the next event, i.e. the end of the current frame or the
+     * next confirmation, and returns the listener to confirm if any.
+     */
+    ::can::ICANFrameSentListener* step()
+    {
+        bool const onBus = !txQueue.empty();
+        if ((!confirmations.empty())
+            && ((!onBus) || (confirmations.front().timeUs <= frameEndUs)))
+        {
+            Confirmation const confirmation = confirmations.front();
+            confirmations.pop_front();
+            nowUs = confirmation.timeUs;
+            return confirmation.listener;
+        }
+        if (onBus)
+        {
+            nowUs = frameEndUs;
+            confirmations.push_back(
+                Confirmation{txQueue.front(), frameEndUs + CONFIRMATION_LATENCY_US});
+            txQueue.pop_front();
+            busy = false;
+            ++frameCount;
+            startFrame();
+        }
+        return nullptr;
+    }
+
+    bool idle() const { return txQueue.empty() && confirmations.empty(); }
+
+    struct Confirmation
+    {
+        ::can::ICANFrameSentListener* listener;
+        uint32_t timeUs;
+    };
+
+    ::etl::deque<::can::ICANFrameSentListener*, TX_QUEUE_SIZE> txQueue;
+    ::etl::deque<Confirmation, TX_QUEUE_SIZE> confirmations;
+    uint32_t frameEndUs = 0U;
+    uint32_t busyUs     = 0U;
+    uint32_t frameCount = 0U;
+    bool busy           = false;
+
+private:
+    void startFrame()
+    {
+        if ((!busy) && (!txQueue.empty()))
+        {
+            busy       = true;
+            frameEndUs = nowUs + FRAME_TIME_US;
+            busyUs += FRAME_TIME_US;
+        }
+    }
+};
+
+/**
+ * Sends segmented messages over a simulated bus with STmin 0 and no block size limit and reports
+ * the frames per second and the bus utilisation in simulated time. MaxPendingFrames 1 is the
+ * default of DoCanPhysicalCanTransceiver, i.e. one frame in flight.
+ */
+template<size_t MessageSize, uint8_t MaxPendingFrames>
+void TransmissionSimulatedBus(benchmark::State& state)
+{
+    initAsyncMock();
+    nowUs = 0;
+    ::async::TestContext _context{1};
+
+    AddressingCodec _doCanCodecClassic;
+    ::docan::DoCanParameters _doCanParameters{
+        ::etl::delegate<uint32_t()>::create<&nowUsFunc>(),
+        ALLOCATE_TIMEOUT,
+        RX_TIMEOUT,
+        TX_CALLBACK_TIMEOUT,
+        FLOW_CONTROL_TIMEOUT,
+        ALLOCATE_RETRY_COUNT,
+        FLOW_CONTROL_WAIT_COUNT,
+        MIN_SEPARATION_TIME,
+        BLOCK_SIZE};
+
+    constexpr ::docan::DoCanNormalAddressingFilterAddressEntry<DataLinkLayerType>
+        doCanMappingEntries[] = {
+            /*canReceptionId*/ /*canTransmissionId*/ /*transportSourceId*/ /*transportTargetId*/
+            {::can::CanId::Base<0x415>::value,
+             ::can::CanId::Base<0x414>::value,
+             0x11U,
+             0x10U,
+             0, // normal codec idx
+             0} // normal codec idx
+        };
+
+    MapperType const mapper;
+    FrameCodecType const codecClassic(
+        ::docan::DoCanFrameCodecConfigPresets::OPTIMIZED_CLASSIC, mapper);
+    FrameCodecType const codecFd(::docan::DoCanFrameCodecConfigPresets::OPTIMIZED_FD, mapper);
+    FrameCodecType const* codecEntries[2] = {&codecClassic, &codecFd};
+
+    ::docan::DoCanNormalAddressingFilter<DataLinkLayerType> _doCanAddressingFilter{
+        ::etl::span(doCanMappingEntries), ::etl::span(codecEntries)};
+
+    ::docan::declare::DoCanTransportLayerConfig<DataLinkLayerType, 80U, 15U, 64U> _doCanConfig(
+        _doCanParameters);
+    uint8_t const busId = 0U;
+    SimulatedBusCanTransceiver canTransceiver(busId);
+    TickGeneratorAdapter _doCanTickGenerator;
+
+    ::docan::DoCanPhysicalCanTransceiver<AddressingCodec, MaxPendingFrames> doCanTransceiver(
+        canTransceiver, _doCanAddressingFilter, _doCanAddressingFilter, _doCanCodecClassic);
+    DoCanIsoLayer doCanIsoLayer(
+        busId,
+        _context,
+        _doCanAddressingFilter,
+        doCanTransceiver,
+        _doCanTickGenerator,
+        _doCanConfig,
+        0U);
+    ::docan::IDoCanFrameReceiver<DataLinkLayerType>* canFrameReceiver(&doCanIsoLayer);
+
+    doCanIsoLayer.init();
+
+    ::transport::BufferedTransportMessage<MessageSize> transportMessage;
+    uint8_t data[MessageSize];
+    for (size_t idx = 0; idx < sizeof(data); ++idx)
+    {
+        data[idx] = idx % 256;
+    }
+    transportMessage.setSourceAddress(0x10U);
+    transportMessage.setTargetAddress(0x11U);
+    transportMessage.append(data, sizeof(data));
+    transportMessage.setPayloadLength(sizeof(data));
+
+    bool sending = false;
+    TransportMessageProcessedListener tpMessageProcessedListener(nowUs, sending);
+
+    _context.handleExecute();
+
+    uint64_t totalUs = 0U;
+    uint64_t busyUs  = 0U;
+    uint64_t frames  = 0U;
+    for (auto _ : state)
+    {
+        uint32_t const startUs        = nowUs;
+        canTransceiver.busyUs         = 0U;
+        canTransceiver.frameCount     = 0U;
+        sending                       = true;
+        bool flowControlFrameReceived = false;
+        ASSERT_EQ(
+            doCanIsoLayer.send(transportMessage, &tpMessageProcessedListener),
+            ::transport::AbstractTransportLayer::ErrorCode::TP_OK);
+        _context.execute();
+        while (sending)
+        {
+            ASSERT_FALSE(canTransceiver.idle());
+            ::can::ICANFrameSentListener* const listener = canTransceiver.step();
+            if (listener != nullptr)
+            {
+                listener->canFrameSent({});
+                _context.execute();
+            }
+            if ((!flowControlFrameReceived) && canTransceiver.idle())
+            {
+                // the first frame has been confirmed, the receiver answers immediately
+                flowControlFrameReceived = true;
+                canFrameReceiver->flowControlFrameReceived(
+                    0x415, ::docan::FlowStatus::CTS, 0U, 0U);
+                _context.execute();
+            }
+        }
+        totalUs += nowUs - startUs;
+        busyUs += canTransceiver.busyUs;
+        frames += canTransceiver.frameCount;
+    }
+    double const totalSeconds = static_cast<double>(totalUs) / 1000000.0;
+    state.counters["frames/s"] = static_cast<double>(frames) / totalSeconds;
+    state.counters["bus_util"] = static_cast<double>(busyUs) / static_cast<double>(totalUs);
+}
+
+BENCHMARK_TEMPLATE(TransmissionSimulatedBus, 4095, 1);
+BENCHMARK_TEMPLATE(TransmissionSimulatedBus, 4095, 4);
+BENCHMARK_TEMPLATE(TransmissionSimulatedBus, 4095, 8);
+
+/**
+ * Transport message provider and listener with one message per connection. The listener of a
+ * received message is kept to release the message later.
+ */
+template<size_t MessageSize, uint16_t NoOfConnections>
+struct ConnectionMessageProvider : public ::transport::ITransportMessageProvidingListener
+{
+    ErrorCode getTransportMessage(
+        uint8_t /* srcBusId */,
+        uint16_t const sourceAddress,
+        uint16_t /* targetAddress */,
+        uint16_t /* size */,
+        ::etl::span<uint8_t const> const& /* peek */,
+        ::transport::TransportMessage*& pTransportMessage) override
+    {
+        pTransportMessage = &messages[sourceAddress];
+        pTransportMessage->init(buffers[sourceAddress], sizeof(buffers[sourceAddress]));
+        return ErrorCode::TPMSG_OK;
+    }
+
+    void releaseTransportMessage(::transport::TransportMessage& /* transportMessage */) override {}
+
+    void dump() override {}
+
+    ReceiveResult messageReceived(
+        uint8_t /* sourceBusId */,
+        ::transport::TransportMessage& transportMessage,
+        ::transport::ITransportMessageProcessedListener* pNotificationListener) override
+    {
+        received        = &transportMessage;
+        processListener = pNotificationListener;
+        return ReceiveResult::RECEIVED_NO_ERROR;
+    }
+
+    ::transport::TransportMessage messages[NoOfConnections];
+    uint8_t buffers[NoOfConnections][MessageSize];
+    ::transport::TransportMessage* received                           = nullptr;
+    ::transport::ITransportMessageProcessedListener* processListener = nullptr;
+};
+
+/**
+ * Receives segmented messages on NoOfConnections connections at the same time. Each iteration
+ * delivers the next consecutive frame of every connection, a connection that has received its
+ * message starts over with a new first frame. Indexed selects whether the transport layer looks up
+ * its message receivers by reception address or searches their list.
+ */
+template<uint16_t NoOfConnections, bool Indexed>
+void ReceptionConcurrentConnections(benchmark::State& state)
+{
+    static size_t const MESSAGE_SIZE = 4095U;
+    static uint8_t const FIRST_FRAME_DATA_SIZE       = 6U;
+    static uint8_t const CONSECUTIVE_FRAME_DATA_SIZE = 7U;
+    static uint16_t const FRAME_COUNT
+        = 1U
+          + ((MESSAGE_SIZE - FIRST_FRAME_DATA_SIZE + CONSECUTIVE_FRAME_DATA_SIZE - 1U)
+             / CONSECUTIVE_FRAME_DATA_SIZE);
+
+    initAsyncMock();
+    nowUs = 0;
+    ::async::TestContext _context{1};
+
+    AddressingCodec _doCanCodecClassic;
+    ::docan::DoCanParameters _doCanParameters{
+        ::etl::delegate<uint32_t()>::create<&nowUsFunc>(),
+        ALLOCATE_TIMEOUT,
+        RX_TIMEOUT,
+        TX_CALLBACK_TIMEOUT,
+        FLOW_CONTROL_TIMEOUT,
+        ALLOCATE_RETRY_COUNT,
+        FLOW_CONTROL_WAIT_COUNT,
+        MIN_SEPARATION_TIME,
+        BLOCK_SIZE};
+
+    MapperType const mapper;
+    FrameCodecType const codecClassic(
+        ::docan::DoCanFrameCodecConfigPresets::OPTIMIZED_CLASSIC, mapper);
+    FrameCodecType const* codecEntries[1] = {&codecClassic};
+
+    ::etl::vector<
+        ::docan::DoCanNormalAddressingFilterAddressEntry<DataLinkLayerType>,
+        NoOfConnections>
+        doCanMappingEntries;
+    for (uint16_t connectionIndex = 0U; connectionIndex < NoOfConnections; ++connectionIndex)
+    {
+        doCanMappingEntries.push_back(
+            {static_cast<uint32_t>(0x600U + connectionIndex),
+             static_cast<uint32_t>(0x700U + connectionIndex),
+             connectionIndex,
+             0xF0U,
+             0,
+             0});
+    }
+
+    ::docan::DoCanNormalAddressingFilter<DataLinkLayerType> _doCanAddressingFilter{
+        doCanMappingEntries, ::etl::span(codecEntries)};
+
+    ::docan::declare::DoCanTransportLayerConfig<DataLinkLayerType, NoOfConnections, 1U, 64U>
+        _doCanIndexedConfig(_doCanParameters);
+    ::docan::DoCanTransportLayerConfig<DataLinkLayerType> _doCanUnindexedConfig(
+        _doCanIndexedConfig.getMessageReceiverPool(),
+        _doCanIndexedConfig.getMessageTransmitterPool(),
+        _doCanParameters);
+    uint8_t const busId = 0U;
+    CanTransceiver canTransceiver(busId);
+    TickGeneratorAdapter _doCanTickGenerator;
+
+    ::docan::DoCanPhysicalCanTransceiver<AddressingCodec> doCanTransceiver(
+        canTransceiver, _doCanAddressingFilter, _doCanAddressingFilter, _doCanCodecClassic);
+    DoCanIsoLayer doCanIsoLayer(
+        busId,
+        _context,
+        _doCanAddressingFilter,
+        doCanTransceiver,
+        _doCanTickGenerator,
+        Indexed ? static_cast<::docan::DoCanTransportLayerConfig<DataLinkLayerType>&>(
+            _doCanIndexedConfig)
+                : _doCanUnindexedConfig,
+        0U);
+    ConnectionMessageProvider<MESSAGE_SIZE, NoOfConnections> messageProvider;
+    doCanIsoLayer.fProvidingListenerHelper.fpMessageProvider = &messageProvider;
+    doCanIsoLayer.fProvidingListenerHelper.fpMessageListener = &messageProvider;
+    ::docan::IDoCanFrameReceiver<DataLinkLayerType>* canFrameReceiver(&doCanIsoLayer);
+
+    doCanIsoLayer.init();
+    _context.handleExecute();
+
+    uint8_t data[FIRST_FRAME_DATA_SIZE] = {};
+    uint16_t remainingFrames[NoOfConnections];
+    uint8_t sequenceNumbers[NoOfConnections];
+    auto const startReception = [&](uint16_t const connectionIndex)
+    {
+        ::docan::DoCanConnection<DataLinkLayerType> const connection(
+            codecClassic,
+            DataLinkLayerType::AddressPairType(0x600U + connectionIndex, 0x700U + connectionIndex),
+            ::docan::DoCanTransportAddressPair(connectionIndex, 0xF0U));
+        canFrameReceiver->firstDataFrameReceived(
+            connection,
+            MESSAGE_SIZE,
+            FRAME_COUNT,
+            CONSECUTIVE_FRAME_DATA_SIZE,
+            ::etl::span<uint8_t const>(data, FIRST_FRAME_DATA_SIZE));
+        remainingFrames[connectionIndex] = FRAME_COUNT - 1U;
+        sequenceNumbers[connectionIndex] = 1U;
+    };
+    for (uint16_t connectionIndex = 0U; connectionIndex < NoOfConnections; ++connectionIndex)
+    {
+        startReception(connectionIndex);
+    }
+
+    uint8_t const consecutiveFrameData[CONSECUTIVE_FRAME_DATA_SIZE] = {};
+    for (auto _ : state)
+    {
+        for (uint16_t connectionIndex = 0U; connectionIndex < NoOfConnections; ++connectionIndex)
+        {
+            canFrameReceiver->consecutiveDataFrameReceived(
+                0x600U + connectionIndex,
+                sequenceNumbers[connectionIndex],
+                ::etl::span<uint8_t const>(consecutiveFrameData));
+            sequenceNumbers[connectionIndex] = (sequenceNumbers[connectionIndex] + 1U) & 0xFU;
+            --remainingFrames[connectionIndex];
+            if (remainingFrames[connectionIndex] == 0U)
+            {
+                ASSERT_NE(messageProvider.processListener, nullptr);
+                messageProvider.processListener->transportMessageProcessed(
+                    *messageProvider.received,
+                    ::transport::ITransportMessageProcessedListener::ProcessingResult::
+                        PROCESSED_NO_ERROR);
+                messageProvider.processListener = nullptr;
+                _context.execute();
+                startReception(connectionIndex);
+            }
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * NoOfConnections));
+}
+
+BENCHMARK_TEMPLATE(ReceptionConcurrentConnections, 1, false);
+BENCHMARK_TEMPLATE(ReceptionConcurrentConnections, 1, true);
+BENCHMARK_TEMPLATE(ReceptionConcurrentConnections, 16, false);
+BENCHMARK_TEMPLATE(ReceptionConcurrentConnections, 16, true);
+BENCHMARK_TEMPLATE(ReceptionConcurrentConnections, 64, false);
+BENCHMARK_TEMPLATE(ReceptionConcurrentConnections, 64, true);
+
+/**
+ * Transport message provider handing out a single sink that counts the received payload.
+ */
+struct CountingSinkProvider
+: public ::transport::ITransportMessageProvidingListener
+, public ::transport::ITransportMessageSink
+{
+    ErrorCode getTransportMessage(
+        uint8_t /* srcBusId */,
+        uint16_t /* sourceAddress */,
+        uint16_t /* targetAddress */,
+        uint16_t /* size */,
+        ::etl::span<uint8_t const> const& /* peek */,
+        ::transport::TransportMessage*& pTransportMessage) override
+    {
+        pTransportMessage = nullptr;
+        return ErrorCode::TPMSG_NOT_RESPONSIBLE;
+    }
+
+    ErrorCode getTransportMessageSink(
+        uint8_t /* srcBusId */,
+        uint16_t /* sourceAddress */,
+        uint16_t /* targetAddress */,
+        uint32_t /* size */,
+        ::etl::span<uint8_t const> const& /* peek */,
+        ::transport::ITransportMessageSink*& pSink) override
+    {
+        pSink         = this;
+        receivedBytes = 0U;
+        return ErrorCode::TPMSG_OK;
+    }
+
+    void releaseTransportMessage(::transport::TransportMessage& /* transportMessage */) override {}
+
+    void dump() override {}
+
+    ReceiveResult messageReceived(
+        uint8_t /* sourceBusId */,
+        ::transport::TransportMessage& /* transportMessage */,
+        ::transport::ITransportMessageProcessedListener* /* pNotificationListener */) override
+    {
+        return ReceiveResult::RECEIVED_ERROR;
+    }
+
+    bool chunkReceived(uint32_t /* offset */, ::etl::span<uint8_t const> const& data) override
+    {
+        receivedBytes += static_cast<uint32_t>(data.size());
+        return true;
+    }
+
+    void receptionEnded(bool const complete) override { this->complete = complete; }
+
+    uint32_t receivedBytes = 0U;
+    bool complete          = false;
+};
+
+/**
+ * CAN transceiver that keeps the flow control parameters of the last written frame.
+ */
+struct FlowControlCapturingCanTransceiver : public CanTransceiver
+{
+    FlowControlCapturingCanTransceiver(uint8_t busId) : CanTransceiver(busId) {}
+
+    ErrorCode write(::can::CANFrame const& frame) override
+    {
+        uint8_t const* const payload = frame.getPayload();
+        flowStatus                   = payload[0] & 0x0FU;
+        blockSize                    = payload[1];
+        encodedMinSeparationTime     = payload[2];
+        flowControlWritten           = true;
+        return ::can::ICanTransceiver::ErrorCode::CAN_ERR_OK;
+    }
+
+    uint8_t flowStatus               = 0U;
+    uint8_t blockSize                = 0U;
+    uint8_t encodedMinSeparationTime = 0U;
+    bool flowControlWritten          = false;
+};
+
+enum class FlowControlMode : uint8_t
+{
+    FIXED_FAST,
+    FIXED_CONSERVATIVE,
+    ADAPTIVE
+};
+
+/**
+ * Simulates the reception of a 64KB message on a classic CAN bus while the receiving ECU is busy
+ * with BackgroundLoad percent of other work. The sender obeys the flow control frames written by
+ * the receiver. Received frames are queued in a receive queue that is drained by a cyclic task
+ * getting the CPU time left by the background load. A frame that doesn't fit into the queue is
+ * lost and the sender restarts the transfer after the flow control timeout, at most
+ * MAX_ATTEMPTS times. The counters report the simulated transfer time and the lost attempts:
+ * - FIXED_FAST advertises neither block size nor minimum separation time
+ * - FIXED_CONSERVATIVE always advertises the block size and separation time needed at full load
+ * - ADAPTIVE uses a DoCanAdaptiveFlowControlPolicy fed by the background load and the queue level
+ */
+template<FlowControlMode Mode, uint8_t BackgroundLoad>
+void ReceptionAdaptiveFlowControl(benchmark::State& state)
+{
+    static uint32_t const MESSAGE_SIZE               = 0xFFFFU;
+    static uint8_t const FIRST_FRAME_DATA_SIZE       = 6U;
+    static uint8_t const CONSECUTIVE_FRAME_DATA_SIZE = 7U;
+    static uint32_t const STEP_US                    = 10U;
+    static uint32_t const FRAME_US                   = 230U;
+    static uint32_t const TASK_PERIOD_US             = 1000U;
+    static uint32_t const FRAMES_PER_TASK_PERIOD     = 20U;
+    static uint32_t const FLOW_CONTROL_TIMEOUT_US    = 1000000U;
+    static uint8_t const MAX_ATTEMPTS                = 3U;
+    static size_t const RX_QUEUE_SIZE                = 16U;
+    static uint8_t const LOADED_BLOCK_SIZE           = 8U;
+    static uint32_t const LOADED_MIN_SEPARATION_TIME = 1000U;
+    static uint16_t const FRAME_COUNT
+        = 1U
+          + ((MESSAGE_SIZE - FIRST_FRAME_DATA_SIZE + CONSECUTIVE_FRAME_DATA_SIZE - 1U)
+             / CONSECUTIVE_FRAME_DATA_SIZE);
+
+    initAsyncMock();
+    nowUs = 0;
+    ::async::TestContext _context{1};
+
+    AddressingCodec _doCanCodecClassic;
+    ::docan::DoCanParameters _doCanParameters{
+        ::etl::delegate<uint32_t()>::create<&nowUsFunc>(),
+        ALLOCATE_TIMEOUT,
+        RX_TIMEOUT,
+        TX_CALLBACK_TIMEOUT,
+        FLOW_CONTROL_TIMEOUT,
+        ALLOCATE_RETRY_COUNT,
+        FLOW_CONTROL_WAIT_COUNT,
+        (Mode == FlowControlMode::FIXED_CONSERVATIVE) ? LOADED_MIN_SEPARATION_TIME : 0U,
+        (Mode == FlowControlMode::FIXED_CONSERVATIVE) ? LOADED_BLOCK_SIZE : 0U};
+
+    ::etl::deque<uint8_t, RX_QUEUE_SIZE> rxQueue;
+    struct LoadSources
+    {
+        uint8_t getBackgroundLoad() { return BackgroundLoad; }
+
+        uint8_t getRxQueueLoad()
+        {
+            return static_cast<uint8_t>((rxQueue.size() * 100U) / rxQueue.max_size());
+        }
+
+        ::etl::deque<uint8_t, RX_QUEUE_SIZE>& rxQueue;
+    } loadSources{rxQueue};
+    ::docan::DoCanAdaptiveFlowControlPolicy::LoadSourceType const loadSourceDelegates[] = {
+        ::docan::DoCanAdaptiveFlowControlPolicy::LoadSourceType::
+            create<LoadSources, &LoadSources::getBackgroundLoad>(loadSources),
+        ::docan::DoCanAdaptiveFlowControlPolicy::LoadSourceType::
+            create<LoadSources, &LoadSources::getRxQueueLoad>(loadSources)};
+    ::docan::DoCanAdaptiveFlowControlPolicy flowControlPolicy(
+        loadSourceDelegates, 30U, LOADED_BLOCK_SIZE, LOADED_MIN_SEPARATION_TIME);
+    if (Mode == FlowControlMode::ADAPTIVE)
+    {
+        _doCanParameters.setFlowControlPolicy(&flowControlPolicy);
+    }
+
+    MapperType const mapper;
+    FrameCodecType const codecClassic(
+        ::docan::DoCanFrameCodecConfigPresets::OPTIMIZED_CLASSIC, mapper);
+    FrameCodecType const* codecEntries[1] = {&codecClassic};
+    ::docan::DoCanNormalAddressingFilterAddressEntry<DataLinkLayerType> doCanMappingEntries[1]
+        = {{0x600U, 0x700U, 0x01U, 0xF0U, 0, 0}};
+    ::docan::DoCanNormalAddressingFilter<DataLinkLayerType> _doCanAddressingFilter{
+        doCanMappingEntries, ::etl::span(codecEntries)};
+
+    ::docan::declare::DoCanTransportLayerConfig<DataLinkLayerType, 4U, 1U, 64U> _doCanConfig(
+        _doCanParameters);
+    uint8_t const busId = 0U;
+    FlowControlCapturingCanTransceiver canTransceiver(busId);
+    TickGeneratorAdapter _doCanTickGenerator;
+
+    ::docan::DoCanPhysicalCanTransceiver<AddressingCodec> doCanTransceiver(
+        canTransceiver, _doCanAddressingFilter, _doCanAddressingFilter, _doCanCodecClassic);
+    DoCanIsoLayer doCanIsoLayer(
+        busId,
+        _context,
+        _doCanAddressingFilter,
+        doCanTransceiver,
+        _doCanTickGenerator,
+        _doCanConfig,
+        0U);
+    CountingSinkProvider sinkProvider;
+    doCanIsoLayer.fProvidingListenerHelper.fpMessageProvider = &sinkProvider;
+    doCanIsoLayer.fProvidingListenerHelper.fpMessageListener = &sinkProvider;
+    ::docan::IDoCanFrameReceiver<DataLinkLayerType>* canFrameReceiver(&doCanIsoLayer);
+
+    doCanIsoLayer.init();
+    _context.handleExecute();
+
+    ::docan::DoCanConnection<DataLinkLayerType> const connection(
+        codecClassic,
+        DataLinkLayerType::AddressPairType(0x600U, 0x700U),
+        ::docan::DoCanTransportAddressPair(0x01U, 0xF0U));
+    uint8_t const data[CONSECUTIVE_FRAME_DATA_SIZE] = {};
+    // sequence number 0xFF marks the first frame in the receive queue
+    uint8_t const FIRST_FRAME = 0xFFU;
+
+    uint64_t totalUs         = 0U;
+    uint64_t lostAttempts    = 0U;
+    uint64_t failedTransfers = 0U;
+    for (auto _ : state)
+    {
+        uint32_t const startUs = nowUs;
+        uint8_t attempts       = 0U;
+        bool done              = false;
+        while ((!done) && (attempts < MAX_ATTEMPTS))
+        {
+            ++attempts;
+            rxQueue.clear();
+            sinkProvider.complete             = false;
+            canTransceiver.flowControlWritten = false;
+            // sender state
+            uint16_t framesToSend        = FRAME_COUNT;
+            uint8_t sequenceNumber       = 0U;
+            uint32_t nextSendUs          = nowUs;
+            uint32_t flowControlUs       = 0U;
+            bool waitForFlowControl      = false;
+            uint8_t blockSize            = 0U;
+            uint8_t framesLeftInBlock    = 0U;
+            uint32_t minSeparationTimeUs = 0U;
+            bool lost                    = false;
+            uint32_t nextTaskUs          = nowUs + TASK_PERIOD_US;
+            while ((!lost) && (!sinkProvider.complete))
+            {
+                if (canTransceiver.flowControlWritten)
+                {
+                    // the flow control frame reaches the sender after its transmission time
+                    canTransceiver.flowControlWritten = false;
+                    flowControlUs                     = nowUs + FRAME_US;
+                }
+                if (waitForFlowControl && (flowControlUs != 0U) && (nowUs >= flowControlUs))
+                {
+                    flowControlUs = 0U;
+                    if (canTransceiver.flowStatus
+                        == static_cast<uint8_t>(::docan::FlowStatus::CTS))
+                    {
+                        waitForFlowControl  = false;
+                        blockSize           = canTransceiver.blockSize;
+                        framesLeftInBlock   = blockSize;
+                        minSeparationTimeUs = ::docan::DoCanParameters::decodeMinSeparationTime(
+                            canTransceiver.encodedMinSeparationTime);
+                        nextSendUs = nowUs;
+                    }
+                }
+                if ((framesToSend > 0U) && (!waitForFlowControl) && (nowUs >= nextSendUs))
+                {
+                    if (rxQueue.full())
+                    {
+                        lost = true;
+                        break;
+                    }
+                    rxQueue.push_back((framesToSend == FRAME_COUNT) ? FIRST_FRAME : sequenceNumber);
+                    sequenceNumber = (sequenceNumber + 1U) & 0x0FU;
+                    --framesToSend;
+                    nextSendUs = nowUs + ::etl::max(FRAME_US, minSeparationTimeUs);
+                    if (framesToSend == FRAME_COUNT - 1U)
+                    {
+                        waitForFlowControl = true;
+                    }
+                    else if ((blockSize != 0U) && (--framesLeftInBlock == 0U))
+                    {
+                        waitForFlowControl = true;
+                    }
+                }
+                if (nowUs >= nextTaskUs)
+                {
+                    // the receive task gets the CPU time left by the background load
+                    nextTaskUs += TASK_PERIOD_US;
+                    uint32_t budget = (FRAMES_PER_TASK_PERIOD * (100U - BackgroundLoad)) / 100U;
+                    while ((budget > 0U) && (!rxQueue.empty()))
+                    {
+                        --budget;
+                        uint8_t const frame = rxQueue.front();
+                        rxQueue.pop_front();
+                        if (frame == FIRST_FRAME)
+                        {
+                            canFrameReceiver->firstDataFrameReceived(
+                                connection,
+                                MESSAGE_SIZE,
+                                FRAME_COUNT,
+                                CONSECUTIVE_FRAME_DATA_SIZE,
+                                ::etl::span<uint8_t const>(data, FIRST_FRAME_DATA_SIZE));
+                        }
+                        else
+                        {
+                            canFrameReceiver->consecutiveDataFrameReceived(
+                                0x600U, frame, ::etl::span<uint8_t const>(data));
+                        }
+                        _context.execute();
+                    }
+                }
+                nowUs += STEP_US;
+            }
+            if (lost)
+            {
+                // the sender notices the loss when the flow control timeout expires
+                ++lostAttempts;
+                nowUs += FLOW_CONTROL_TIMEOUT_US;
+            }
+            else
+            {
+                done = (sinkProvider.receivedBytes == MESSAGE_SIZE);
+            }
+        }
+        if (!done)
+        {
+            ++failedTransfers;
+        }
+        totalUs += nowUs - startUs;
+    }
+    double const iterations         = static_cast<double>(state.iterations());
+    state.counters["transfer_ms"]   = static_cast<double>(totalUs) / 1000.0 / iterations;
+    state.counters["lost_attempts"] = static_cast<double>(lostAttempts) / iterations;
+    state.counters["failed"]        = static_cast<double>(failedTransfers) / iterations;
+}
+
+BENCHMARK_TEMPLATE(ReceptionAdaptiveFlowControl, FlowControlMode::FIXED_FAST, 0)->Iterations(3);
+BENCHMARK_TEMPLATE(ReceptionAdaptiveFlowControl, FlowControlMode::FIXED_FAST, 50)->Iterations(3);
+BENCHMARK_TEMPLATE(ReceptionAdaptiveFlowControl, FlowControlMode::FIXED_FAST, 90)->Iterations(3);
+BENCHMARK_TEMPLATE(ReceptionAdaptiveFlowControl, FlowControlMode::FIXED_CONSERVATIVE, 0)
+    ->Iterations(3);
+BENCHMARK_TEMPLATE(ReceptionAdaptiveFlowControl, FlowControlMode::FIXED_CONSERVATIVE, 50)
+    ->Iterations(3);
+BENCHMARK_TEMPLATE(ReceptionAdaptiveFlowControl, FlowControlMode::FIXED_CONSERVATIVE, 90)
+    ->Iterations(3);
+BENCHMARK_TEMPLATE(ReceptionAdaptiveFlowControl, FlowControlMode::ADAPTIVE, 0)->Iterations(3);
+BENCHMARK_TEMPLATE(ReceptionAdaptiveFlowControl, FlowControlMode::ADAPTIVE, 50)->Iterations(3);
+BENCHMARK_TEMPLATE(ReceptionAdaptiveFlowControl, FlowControlMode::ADAPTIVE, 90)->Iterations(3);
@@ -13,6 +13,7 @@
 #include "docan/addressing/IDoCanAddressConverter.h"
 #include "docan/can/DoCanPhysicalCanTransceiver.h"
 #include "docan/can/DoCanPhysicalCanTransceiverContainer.h"
+#include "docan/common/DoCanAddressIndex.h"
 #include "docan/common/DoCanConstants.h"
 #include "docan/common/DoCanLogger.h"
 #include "docan/common/DoCanParameters.h"
@@ -27,9 +28,11 @@
 #include "docan/datalink/IDoCanFlowControlFrameTransmitter.h"
 #include "docan/datalink/IDoCanFrameReceiver.h"
 #include "docan/datalink/IDoCanPhysicalTransceiver.h"
+#include "docan/receiver/DoCanAdaptiveFlowControlPolicy.h"
 #include "docan/receiver/DoCanMessageReceiveProtocolHandler.h"
 #include "docan/receiver/DoCanMessageReceiver.h"
 #include "docan/receiver/DoCanReceiver.h"
+#include "docan/receiver/IDoCanFlowControlPolicy.h"
 #include "docan/transmitter/DoCanMessageTransmitProtocolHandler.h"
 #include "docan/transmitter/DoCanMessageTransmitter.h"
 #include "docan/transmitter/DoCanTransmitter.h"
@@ -212,9 +212,12 @@ TEST_F(TestWithNormalAddressing, testTransceiverSendDataFrames)
             cut.startSendDataFrames(
                 _codec, _frameTransmitterCallbackMock, jobHandle2, 0x1234897U, 0U, 1U, 0U, data2));
         Mock::VerifyAndClearExpectations(&_canTransceiverMock);
+        // the confirmation of the cancelled frame is ignored
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
         EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle2, 1U, sizeof(data2)));
 
-        sentListener->canFrameSent(CANFrame());
+        sentListener2->canFrameSent(CANFrame());
         Mock::VerifyAndClearExpectations(&_canTransceiverMock);
     }
     {
@@ -250,6 +253,79 @@ TEST_F(TestWithNormalAddressing, testTransceiverSendDataFrames)
     }
 }
 
+TEST_F(TestWithNormalAddressing, testTransceiverSendDataFramesAfterDroppedCancelledFrame)
+{
+    DoCanPhysicalCanTransceiver<TestWithNormalAddressing::CodecType> cut(
+        _canTransceiverMock, _filterMock, _addressConverterMock, _addressing);
+    uint8_t const data[]                = {0x12U, 0x13U, 0x24U, 0x45U};
+    uint8_t const data2[]               = {0x91, 0x82, 0x71};
+    CANFrame writtenFrame;
+    ICANFrameSentListener* sentListener = 0L;
+    EXPECT_CALL(_canTransceiverMock, write(_, _))
+        .WillRepeatedly(DoAll(
+            SaveArg<0>(&writtenFrame),
+            WithArg<1>(SaveRef<0>(&sentListener)),
+            Return(ICanTransceiver::ErrorCode::CAN_ERR_OK)));
+    JobHandle jobHandle(0x1f, 0x12);
+    EXPECT_EQ(
+        SendResult::QUEUED_FULL,
+        cut.startSendDataFrames(
+            _codec, _frameTransmitterCallbackMock, jobHandle, 0x1234897U, 0U, 1U, 0U, data));
+    cut.cancelSendDataFrames(_frameTransmitterCallbackMock, jobHandle);
+
+    // the transceiver drops the frame of the cancelled send job without confirming it, the
+    // confirmation of the next frame is counted
+    JobHandle jobHandle2(0x2f, 0x13);
+    EXPECT_EQ(
+        SendResult::QUEUED_FULL,
+        cut.startSendDataFrames(
+            _codec, _frameTransmitterCallbackMock, jobHandle2, 0x1234897U, 0U, 1U, 0U, data2));
+    EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle2, 1U, sizeof(data2)));
+    sentListener->canFrameSent(writtenFrame);
+    Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+
+    // and the following send jobs aren't affected
+    JobHandle jobHandle3(0x3f, 0x14);
+    EXPECT_EQ(
+        SendResult::QUEUED_FULL,
+        cut.startSendDataFrames(
+            _codec, _frameTransmitterCallbackMock, jobHandle3, 0x1234897U, 0U, 1U, 0U, data));
+    EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle3, 1U, sizeof(data)));
+    sentListener->canFrameSent(CANFrame());
+}
+
+TEST_F(TestWithNormalAddressing, testShutdownForgetsCancelledFrames)
+{
+    DoCanPhysicalCanTransceiver<TestWithNormalAddressing::CodecType> cut(
+        _canTransceiverMock, _filterMock, _addressConverterMock, _addressing);
+    uint8_t const data[]                = {0x12U, 0x13U, 0x24U, 0x45U};
+    ICANFrameSentListener* sentListener = 0L;
+    EXPECT_CALL(_canTransceiverMock, addCANFrameListener(_)).Times(2);
+    EXPECT_CALL(_canTransceiverMock, removeCANFrameListener(_));
+    EXPECT_CALL(_canTransceiverMock, write(_, _))
+        .WillRepeatedly(DoAll(
+            WithArg<1>(SaveRef<0>(&sentListener)),
+            Return(ICanTransceiver::ErrorCode::CAN_ERR_OK)));
+    cut.init(_frameReceiverMock);
+    JobHandle jobHandle(0x1f, 0x12);
+    EXPECT_EQ(
+        SendResult::QUEUED_FULL,
+        cut.startSendDataFrames(
+            _codec, _frameTransmitterCallbackMock, jobHandle, 0x1234897U, 0U, 1U, 0U, data));
+    cut.cancelSendDataFrames(_frameTransmitterCallbackMock, jobHandle);
+    cut.shutdown();
+
+    // the frame of the cancelled send job is never confirmed
+    cut.init(_frameReceiverMock);
+    JobHandle jobHandle2(0x2f, 0x13);
+    EXPECT_EQ(
+        SendResult::QUEUED_FULL,
+        cut.startSendDataFrames(
+            _codec, _frameTransmitterCallbackMock, jobHandle2, 0x1234897U, 0U, 1U, 0U, data));
+    EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle2, 1U, sizeof(data)));
+    sentListener->canFrameSent(CANFrame());
+}
+
 TEST_F(TestWithNormalAddressing, testTransceiverSendDataFramesWithEscapeSequence)
 {
     DoCanPhysicalCanTransceiver<TestWithNormalAddressing::CodecType> cut(
@@ -287,6 +363,130 @@ TEST_F(TestWithNormalAddressing, testTransceiverSendDataFramesWithEscapeSequence
     }
 }
 
+TEST_F(TestWithNormalAddressing, testTransceiverSendsConsecutiveFramesPipelined)
+{
+    DoCanPhysicalCanTransceiver<TestWithNormalAddressing::CodecType, 3U> cut(
+        _canTransceiverMock, _filterMock, _addressConverterMock, _addressing);
+    // first frame with 6 bytes, 5 consecutive frames with 7 bytes
+    uint8_t data[41];
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+    std::vector<uint8_t> sequenceNumbers;
+    ICANFrameSentListener* sentListener = 0L;
+    ICanTransceiver::ErrorCode writeResult = ICanTransceiver::ErrorCode::CAN_ERR_OK;
+    EXPECT_CALL(_canTransceiverMock, write(_, _))
+        .WillRepeatedly(
+            Invoke([&](CANFrame const& frame, ICANFrameSentListener& listener)
+                   {
+                       sentListener = &listener;
+                       if (writeResult == ICanTransceiver::ErrorCode::CAN_ERR_OK)
+                       {
+                           sequenceNumbers.push_back(frame.getPayload()[0]);
+                       }
+                       return writeResult;
+                   }));
+    JobHandle jobHandle(0xaf, 0xea);
+    {
+        // consecutive frames 1 to 5, 3 of them are written at once
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x123U, 1U, 6U, 7U, data));
+        EXPECT_THAT(sequenceNumbers, ElementsAre(0x21U, 0x22U, 0x23U));
+        EXPECT_EQ(
+            SendResult::FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x123U, 1U, 6U, 7U, data));
+
+        // each confirmation writes the next frame
+        sentListener->canFrameSent(CANFrame());
+        EXPECT_THAT(sequenceNumbers, ElementsAre(0x21U, 0x22U, 0x23U, 0x24U));
+        // retried with the next confirmation if the queue is full
+        writeResult = ICanTransceiver::ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL;
+        sentListener->canFrameSent(CANFrame());
+        writeResult = ICanTransceiver::ErrorCode::CAN_ERR_OK;
+        sentListener->canFrameSent(CANFrame());
+        EXPECT_THAT(sequenceNumbers, ElementsAre(0x21U, 0x22U, 0x23U, 0x24U, 0x25U));
+        sentListener->canFrameSent(CANFrame());
+
+        // single callback once all frames are confirmed
+        EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle, 5U, 35U));
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+        sentListener->canFrameSent(CANFrame());
+    }
+    {
+        // the send job ends early if the queue stays full
+        sequenceNumbers.clear();
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x123U, 1U, 6U, 7U, data));
+        writeResult = ICanTransceiver::ErrorCode::CAN_ERR_TX_HW_QUEUE_FULL;
+        sentListener->canFrameSent(CANFrame());
+        sentListener->canFrameSent(CANFrame());
+        EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle, 3U, 21U));
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+        EXPECT_THAT(sequenceNumbers, ElementsAre(0x21U, 0x22U, 0x23U));
+    }
+    {
+        // and immediately on other errors
+        sequenceNumbers.clear();
+        writeResult = ICanTransceiver::ErrorCode::CAN_ERR_OK;
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x123U, 1U, 6U, 7U, data));
+        writeResult = ICanTransceiver::ErrorCode::CAN_ERR_TX_FAIL;
+        sentListener->canFrameSent(CANFrame());
+        writeResult = ICanTransceiver::ErrorCode::CAN_ERR_OK;
+        sentListener->canFrameSent(CANFrame());
+        EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle, 3U, 21U));
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+        EXPECT_THAT(sequenceNumbers, ElementsAre(0x21U, 0x22U, 0x23U));
+    }
+    {
+        // the first frame is sent alone
+        sequenceNumbers.clear();
+        writeResult = ICanTransceiver::ErrorCode::CAN_ERR_OK;
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x123U, 0U, 1U, 7U, data));
+        EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle, 1U, 6U));
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+        EXPECT_THAT(sequenceNumbers, ElementsAre(0x10U));
+    }
+    {
+        // confirmations of a cancelled send job are not counted for the next one
+        sequenceNumbers.clear();
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle, 0x123U, 1U, 6U, 7U, data));
+        cut.cancelSendDataFrames(_frameTransmitterCallbackMock, jobHandle);
+        JobHandle jobHandle2(0xaf, 0xeb);
+        EXPECT_EQ(
+            SendResult::QUEUED_FULL,
+            cut.startSendDataFrames(
+                _codec, _frameTransmitterCallbackMock, jobHandle2, 0x123U, 1U, 3U, 7U, data));
+        EXPECT_THAT(sequenceNumbers, ElementsAre(0x21U, 0x22U, 0x23U, 0x21U, 0x22U));
+        sentListener->canFrameSent(CANFrame());
+        sentListener->canFrameSent(CANFrame());
+        sentListener->canFrameSent(CANFrame());
+        sentListener->canFrameSent(CANFrame());
+        EXPECT_CALL(_frameTransmitterCallbackMock, dataFramesSent(jobHandle2, 2U, 14U));
+        sentListener->canFrameSent(CANFrame());
+        Mock::VerifyAndClearExpectations(&_frameTransmitterCallbackMock);
+        EXPECT_THAT(sequenceNumbers, ElementsAre(0x21U, 0x22U, 0x23U, 0x21U, 0x22U));
+    }
+}
+
 TEST_F(TestWithNormalAddressing, testTransceiverSendFlowControlFrame)
 {
     DoCanPhysicalCanTransceiver<TestWithNormalAddressing::CodecType> cut(
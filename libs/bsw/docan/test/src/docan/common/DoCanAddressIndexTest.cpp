@@ -0,0 +1,120 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "docan/common/DoCanAddressIndex.h"
+
+#include <gmock/gmock.h>
+
+#include <map>
+#include <utility>
+
+namespace
+{
+using namespace docan;
+
+struct Item
+{};
+
+using IndexType = DoCanAddressIndex<uint16_t, Item>;
+
+TEST(DoCanAddressIndexTest, testTableSize)
+{
+    EXPECT_EQ(1U, IndexType::getTableSize(0U));
+    EXPECT_EQ(2U, IndexType::getTableSize(1U));
+    EXPECT_EQ(8U, IndexType::getTableSize(3U));
+    EXPECT_EQ(8U, IndexType::getTableSize(4U));
+    EXPECT_EQ(16U, IndexType::getTableSize(5U));
+    declare::DoCanAddressIndex<uint16_t, Item, 5U> cut;
+    EXPECT_EQ(16U, cut.getCapacity());
+}
+
+TEST(DoCanAddressIndexTest, testAddFindAndRemove)
+{
+    declare::DoCanAddressIndex<uint16_t, Item, 4U> cut;
+    Item items[3];
+    int owner1;
+    int owner2;
+    EXPECT_EQ(nullptr, cut.find(&owner1, 0x123U));
+
+    cut.add(&owner1, 0x123U, items[0]);
+    cut.add(&owner2, 0x123U, items[1]);
+    IndexType::Entry* entry = cut.find(&owner1, 0x123U);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(&items[0], entry->value);
+    EXPECT_EQ(1U, entry->count);
+    entry = cut.find(&owner2, 0x123U);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(&items[1], entry->value);
+    EXPECT_EQ(nullptr, cut.find(&owner1, 0x124U));
+
+    // a second object with the same key is only counted
+    cut.add(&owner1, 0x123U, items[2]);
+    entry = cut.find(&owner1, 0x123U);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(nullptr, entry->value);
+    EXPECT_EQ(2U, entry->count);
+    cut.remove(&owner1, 0x123U);
+    entry = cut.find(&owner1, 0x123U);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(nullptr, entry->value);
+    EXPECT_EQ(1U, entry->count);
+    cut.remove(&owner1, 0x123U);
+    EXPECT_EQ(nullptr, cut.find(&owner1, 0x123U));
+    EXPECT_NE(nullptr, cut.find(&owner2, 0x123U));
+
+    // removing an unknown key is ignored
+    cut.remove(&owner1, 0x123U);
+    EXPECT_NE(nullptr, cut.find(&owner2, 0x123U));
+}
+
+/**
+ * Fill and drain the index in different orders, so that entries collide and are shifted back on
+ * removal. All remaining entries must still be found.
+ */
+TEST(DoCanAddressIndexTest, testCollidingEntries)
+{
+    static size_t const COUNT = 7U;
+    declare::DoCanAddressIndex<uint16_t, Item, COUNT> cut;
+    Item items[COUNT];
+    int owner;
+    uint32_t seed = 1U;
+    for (size_t round = 0U; round < 50U; ++round)
+    {
+        std::map<uint16_t, Item*> added;
+        while (added.size() < COUNT)
+        {
+            seed                   = (seed * 1103515245U) + 12345U;
+            uint16_t const address = static_cast<uint16_t>((seed >> 16U) & 0x3FU);
+            if (added.count(address) == 0U)
+            {
+                Item& item = items[added.size()];
+                cut.add(&owner, address, item);
+                added.insert(std::make_pair(address, &item));
+            }
+        }
+        while (!added.empty())
+        {
+            seed     = (seed * 1103515245U) + 12345U;
+            auto it  = added.begin();
+            std::advance(it, (seed >> 16U) % added.size());
+            cut.remove(&owner, it->first);
+            EXPECT_EQ(nullptr, cut.find(&owner, it->first));
+            added.erase(it);
+            for (auto const& item : added)
+            {
+                IndexType::Entry* const entry = cut.find(&owner, item.first);
+                ASSERT_NE(nullptr, entry);
+                EXPECT_EQ(item.second, entry->value);
+            }
+        }
+    }
+}
+
+} // anonymous namespace
@@ -10,6 +10,8 @@
 
 #include "docan/common/DoCanParameters.h"
 
+#include "docan/receiver/DoCanFlowControlPolicyMock.h"
+
 #include <etl/delegate.h>
 
 #include <gmock/gmock.h>
@@ -45,6 +47,12 @@ TEST(DoCanParametersTest, testConstructedParametersAndSetter)
     EXPECT_EQ(167, cut.getMaxBlockSize());
     cut.setEncodedMinSeparationTime(0x88);
     EXPECT_EQ(0x88, cut.getEncodedMinSeparationTime());
+    EXPECT_EQ(nullptr, cut.getFlowControlPolicy());
+    DoCanFlowControlPolicyMock flowControlPolicyMock;
+    cut.setFlowControlPolicy(&flowControlPolicyMock);
+    EXPECT_EQ(&flowControlPolicyMock, cut.getFlowControlPolicy());
+    cut.setFlowControlPolicy(nullptr);
+    EXPECT_EQ(nullptr, cut.getFlowControlPolicy());
 }
 
 TEST(DoCanParameters, testDecodeMinSeparationTime)
@@ -0,0 +1,137 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "docan/receiver/DoCanAdaptiveFlowControlPolicy.h"
+
+#include <etl/delegate.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace docan;
+
+class DoCanAdaptiveFlowControlPolicyTest : public ::testing::Test
+{
+public:
+    DoCanAdaptiveFlowControlPolicyTest()
+    : _bufferLoad(0U)
+    , _taskLoad(0U)
+    , _loadSources{
+          DoCanAdaptiveFlowControlPolicy::LoadSourceType::create<
+              DoCanAdaptiveFlowControlPolicyTest,
+              &DoCanAdaptiveFlowControlPolicyTest::getBufferLoad>(*this),
+          DoCanAdaptiveFlowControlPolicy::LoadSourceType::create<
+              DoCanAdaptiveFlowControlPolicyTest,
+              &DoCanAdaptiveFlowControlPolicyTest::getTaskLoad>(*this)}
+    , _transportAddressPair(0x12U, 0x34U)
+    {}
+
+protected:
+    uint8_t getBufferLoad() { return _bufferLoad; }
+
+    uint8_t getTaskLoad() { return _taskLoad; }
+
+    uint8_t _bufferLoad;
+    uint8_t _taskLoad;
+    DoCanAdaptiveFlowControlPolicy::LoadSourceType _loadSources[2];
+    DoCanTransportAddressPair _transportAddressPair;
+};
+
+TEST_F(DoCanAdaptiveFlowControlPolicyTest, testLoadIsMaximumOfAllSources)
+{
+    DoCanAdaptiveFlowControlPolicy cut(_loadSources, 50U, 8U, 10000U);
+    EXPECT_EQ(0U, cut.getLoad(0U));
+    EXPECT_EQ(20U, cut.getLoad(20U));
+    _bufferLoad = 30U;
+    EXPECT_EQ(30U, cut.getLoad(20U));
+    _taskLoad = 70U;
+    EXPECT_EQ(70U, cut.getLoad(20U));
+    EXPECT_EQ(90U, cut.getLoad(90U));
+    _taskLoad = 130U;
+    EXPECT_EQ(DoCanAdaptiveFlowControlPolicy::MAX_LOAD, cut.getLoad(20U));
+}
+
+TEST_F(DoCanAdaptiveFlowControlPolicyTest, testNoLimitsAreAdvertisedWhileIdle)
+{
+    DoCanAdaptiveFlowControlPolicy cut(_loadSources, 50U, 8U, 10000U);
+    _bufferLoad        = 49U;
+    uint8_t blockSize  = 15U;
+    uint8_t encodedMin = DoCanParameters::encodeMinSeparationTime(2000U);
+    cut.adaptFlowControl(_transportAddressPair, 10U, blockSize, encodedMin);
+    EXPECT_EQ(0U, blockSize);
+    EXPECT_EQ(0U, encodedMin);
+}
+
+TEST_F(DoCanAdaptiveFlowControlPolicyTest, testSenderIsThrottledWithIncreasingLoad)
+{
+    DoCanAdaptiveFlowControlPolicy cut(_loadSources, 50U, 8U, 10000U);
+    uint8_t blockSize  = 0U;
+    uint8_t encodedMin = 0U;
+    cut.adaptFlowControl(_transportAddressPair, 50U, blockSize, encodedMin);
+    EXPECT_EQ(8U, blockSize);
+    EXPECT_EQ(0U, encodedMin);
+
+    blockSize  = 0U;
+    encodedMin = 0U;
+    _taskLoad  = 51U;
+    cut.adaptFlowControl(_transportAddressPair, 0U, blockSize, encodedMin);
+    EXPECT_EQ(8U, blockSize);
+    EXPECT_EQ(DoCanParameters::encodeMinSeparationTime(200U), encodedMin);
+
+    blockSize  = 0U;
+    encodedMin = 0U;
+    _taskLoad  = 75U;
+    cut.adaptFlowControl(_transportAddressPair, 0U, blockSize, encodedMin);
+    EXPECT_EQ(8U, blockSize);
+    EXPECT_EQ(DoCanParameters::encodeMinSeparationTime(5000U), encodedMin);
+
+    blockSize   = 0U;
+    encodedMin  = 0U;
+    _bufferLoad = 100U;
+    cut.adaptFlowControl(_transportAddressPair, 0U, blockSize, encodedMin);
+    EXPECT_EQ(8U, blockSize);
+    EXPECT_EQ(DoCanParameters::encodeMinSeparationTime(10000U), encodedMin);
+}
+
+TEST_F(DoCanAdaptiveFlowControlPolicyTest, testMoreRestrictiveConfiguredParametersAreKept)
+{
+    DoCanAdaptiveFlowControlPolicy cut(_loadSources, 50U, 8U, 10000U);
+    _taskLoad          = 75U;
+    uint8_t blockSize  = 4U;
+    uint8_t encodedMin = DoCanParameters::encodeMinSeparationTime(20000U);
+    cut.adaptFlowControl(_transportAddressPair, 0U, blockSize, encodedMin);
+    EXPECT_EQ(4U, blockSize);
+    EXPECT_EQ(DoCanParameters::encodeMinSeparationTime(20000U), encodedMin);
+
+    blockSize  = 12U;
+    encodedMin = DoCanParameters::encodeMinSeparationTime(1000U);
+    cut.adaptFlowControl(_transportAddressPair, 0U, blockSize, encodedMin);
+    EXPECT_EQ(8U, blockSize);
+    EXPECT_EQ(DoCanParameters::encodeMinSeparationTime(5000U), encodedMin);
+}
+
+TEST_F(DoCanAdaptiveFlowControlPolicyTest, testConfiguredBlockSizeIsKeptWithoutLoadedBlockSize)
+{
+    DoCanAdaptiveFlowControlPolicy cut(
+        ::etl::span<DoCanAdaptiveFlowControlPolicy::LoadSourceType const>(), 0U, 0U, 1000U);
+    uint8_t blockSize  = 0U;
+    uint8_t encodedMin = 0U;
+    cut.adaptFlowControl(_transportAddressPair, 0U, blockSize, encodedMin);
+    EXPECT_EQ(0U, blockSize);
+    EXPECT_EQ(0U, encodedMin);
+
+    blockSize = 16U;
+    cut.adaptFlowControl(_transportAddressPair, 100U, blockSize, encodedMin);
+    EXPECT_EQ(16U, blockSize);
+    EXPECT_EQ(DoCanParameters::encodeMinSeparationTime(1000U), encodedMin);
+}
+
+} // namespace
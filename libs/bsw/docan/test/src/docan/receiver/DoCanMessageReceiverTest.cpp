@@ -17,6 +17,7 @@
 #include "docan/datalink/DoCanFrameCodecConfigPresets.h"
 
 #include <etl/span.h>
+#include <transport/TransportMessageSinkMock.h>
 
 #include <gmock/gmock.h>
 
@@ -24,6 +25,7 @@ namespace
 {
 using namespace docan;
 using namespace transport;
+using namespace ::testing;
 
 using ReceiveProtocolHandler = DoCanMessageReceiveProtocolHandler<uint16_t>;
 
@@ -372,6 +374,91 @@ TEST(DoCanMessageReceiverTest, testConsecutiveFrameWithBadSequenceNumberIsReceiv
     EXPECT_FALSE(cut.isAllocating());
 }
 
+TEST(DoCanMessageReceiverTest, testMultipleFramesAreStreamedToSink)
+{
+    DoCanDefaultFrameSizeMapper<uint8_t> const mapper;
+    CodecType codec(DoCanFrameCodecConfigPresets::OPTIMIZED_CLASSIC, mapper);
+    DoCanConnection<DataLinkLayer> connection(
+        codec, DataLinkLayer::AddressPairType(0x123, 0x456), DoCanTransportAddressPair(0x34, 0x45));
+    uint8_t const data[] = {
+        0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0, 0x13, 0x24, 0x35, 0x46, 0x57, 0x68, 0x79};
+    DoCanMessageReceiver<DataLinkLayer> cut(
+        connection, sizeof(data), 3U, 7U, 0U, 0x3fU, ::etl::span<uint8_t const>(data, 6U), false);
+    StrictMock<TransportMessageSinkMock> sink;
+    EXPECT_CALL(sink, chunkReceived(0U, ElementsAreArray(data, 6U))).WillOnce(Return(true));
+    EXPECT_EQ(ReceiveResult(true), cut.allocated(sink, 1U));
+    EXPECT_EQ(ReceiveState::SEND, cut.getState());
+    EXPECT_EQ(&sink, cut.getSink());
+    EXPECT_EQ(nullptr, cut.getMessage());
+    EXPECT_EQ(ReceiveResult(true), cut.frameSent(true));
+    EXPECT_TRUE(cut.isConsecutiveFrameExpected());
+    EXPECT_EQ(7U, cut.getExpectedConsecutiveFrameDataSize());
+    EXPECT_CALL(sink, chunkReceived(6U, ElementsAreArray(data + 6U, 7U))).WillOnce(Return(true));
+    EXPECT_EQ(
+        ReceiveResult(true),
+        cut.consecutiveFrameReceived(1U, 7U, ::etl::span<uint8_t const>(data + 6U, 7U)));
+    EXPECT_EQ(ReceiveState::WAIT, cut.getState());
+    EXPECT_EQ(2U, cut.getExpectedConsecutiveFrameDataSize());
+    // only the expected bytes of a padded frame are handed over
+    EXPECT_CALL(sink, chunkReceived(13U, ElementsAreArray(data + 13U, 2U))).WillOnce(Return(true));
+    EXPECT_EQ(
+        ReceiveResult(true),
+        cut.consecutiveFrameReceived(2U, 2U, ::etl::span<uint8_t const>(data + 13U, 2U)));
+    EXPECT_EQ(ReceiveState::PROCESSING, cut.getState());
+    EXPECT_EQ(&sink, cut.detachSink());
+    EXPECT_EQ(nullptr, cut.getSink());
+    EXPECT_FALSE(cut.isConsecutiveFrameExpected());
+}
+
+TEST(DoCanMessageReceiverTest, testSinkAbortsReception)
+{
+    DoCanDefaultFrameSizeMapper<uint8_t> const mapper;
+    CodecType codec(DoCanFrameCodecConfigPresets::OPTIMIZED_CLASSIC, mapper);
+    DoCanConnection<DataLinkLayer> connection(
+        codec, DataLinkLayer::AddressPairType(0x123, 0x456), DoCanTransportAddressPair(0x34, 0x45));
+    uint8_t const data[] = {
+        0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0, 0x13, 0x24, 0x35, 0x46, 0x57, 0x68, 0x79};
+    StrictMock<TransportMessageSinkMock> sink;
+    // reject first frame data
+    {
+        DoCanMessageReceiver<DataLinkLayer> cut(
+            connection,
+            sizeof(data),
+            3U,
+            7U,
+            0U,
+            0x3fU,
+            ::etl::span<uint8_t const>(data, 6U),
+            false);
+        EXPECT_CALL(sink, chunkReceived(0U, _)).WillOnce(Return(false));
+        EXPECT_EQ(
+            ReceiveResult(true).setMessage(ReceiveMessage::PROCESSING_FAILED),
+            cut.allocated(sink, 1U));
+        EXPECT_EQ(ReceiveState::DONE, cut.getState());
+        EXPECT_EQ(&sink, cut.getSink());
+    }
+    // reject consecutive frame data
+    {
+        DoCanMessageReceiver<DataLinkLayer> cut(
+            connection,
+            sizeof(data),
+            3U,
+            7U,
+            0U,
+            0x3fU,
+            ::etl::span<uint8_t const>(data, 6U),
+            false);
+        EXPECT_CALL(sink, chunkReceived(0U, _)).WillOnce(Return(true));
+        EXPECT_EQ(ReceiveResult(true), cut.allocated(sink, 1U));
+        EXPECT_EQ(ReceiveResult(true), cut.frameSent(true));
+        EXPECT_CALL(sink, chunkReceived(6U, _)).WillOnce(Return(false));
+        EXPECT_EQ(
+            ReceiveResult(true).setMessage(ReceiveMessage::PROCESSING_FAILED),
+            cut.consecutiveFrameReceived(1U, 7U, ::etl::span<uint8_t const>(data + 6U, 7U)));
+        EXPECT_EQ(ReceiveState::DONE, cut.getState());
+    }
+}
+
 TEST(DoCanMessageReceiverTest, testConsecutiveFrameIsReceivedDuringAllocation)
 {
     DoCanDefaultFrameSizeMapper<uint8_t> const mapper;
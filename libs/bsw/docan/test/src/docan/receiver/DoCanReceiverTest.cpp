@@ -17,6 +17,7 @@
 #include "docan/datalink/DoCanFlowControlFrameTransmitterMock.h"
 #include "docan/datalink/DoCanFrameCodec.h"
 #include "docan/datalink/DoCanFrameCodecConfigPresets.h"
+#include "docan/receiver/DoCanFlowControlPolicyMock.h"
 
 #include <async/AsyncMock.h>
 #include <async/TestContext.h>
@@ -25,6 +26,7 @@
 #include <etl/span.h>
 #include <transport/BufferedTransportMessage.h>
 #include <transport/TransportMessageProvidingListenerMock.h>
+#include <transport/TransportMessageSinkMock.h>
 #include <util/logger/ComponentMappingMock.h>
 #include <util/logger/LoggerOutputMock.h>
 
@@ -51,6 +53,22 @@ struct DataLinkLayer
 
 using CodecType = DoCanFrameCodec<DataLinkLayer>;
 
+struct SinkProvidingListenerMock : TransportMessageProvidingListenerMock
+{
+    SinkProvidingListenerMock() : TransportMessageProvidingListenerMock(false) {}
+
+    MOCK_METHOD(
+        ErrorCode,
+        getTransportMessageSink,
+        (uint8_t srcBusId,
+         uint16_t sourceAddress,
+         uint16_t targetAddress,
+         uint32_t size,
+         ::etl::span<uint8_t const> const& peek,
+         ITransportMessageSink*& pSink),
+        (override));
+};
+
 struct DoCanReceiverTest : ::testing::Test
 {
     DoCanReceiverTest() : _context(1), nowUs(0), _loggerComponent(8)
@@ -622,6 +640,216 @@ TEST_F(DoCanReceiverTest, testReceiveSegmentedMessageAndShutdown)
     ASSERT_TRUE(messageReceiverBlockPool.empty());
 }
 
+TEST_F(DoCanReceiverTest, testReceiveSegmentedMessageIntoSinkAndShutdown)
+{
+    using T = ::docan::declare::DoCanMessageReceiver<DataLinkLayer, 7U>;
+    ::etl::generic_pool<sizeof(T), alignof(T), 5U> messageReceiverBlockPool;
+    StrictMock<SinkProvidingListenerMock> messageProvidingListenerMock;
+    StrictMock<TransportMessageSinkMock> sink;
+    DoCanReceiver<DataLinkLayer> cut(
+        _busId,
+        _context,
+        messageProvidingListenerMock,
+        _flowControlFrameTransmitterMock,
+        messageReceiverBlockPool,
+        _addressConverterMock,
+        _parameters,
+        _loggerComponent);
+    cut.init();
+
+    uint8_t data[] = {
+        0xab, 0xcd, 0xef, 0x19, 0x28, 0x37, 0x46, 0x55, 0x64, 0x73, 0x82, 0x91, 0x11, 0x22, 0x33};
+    // receive the first frame, no transport message is requested
+    EXPECT_CALL(
+        messageProvidingListenerMock,
+        getTransportMessageSink(_busId, 0x14, 0x23, sizeof(data), ElementsAreArray(data, 6U), _))
+        .WillOnce(DoAll(
+            SetArgReferee<5>(&sink), Return(ITransportMessageProvider::ErrorCode::TPMSG_OK)));
+    EXPECT_CALL(sink, chunkReceived(0U, ElementsAreArray(data, 6U))).WillOnce(Return(true));
+    EXPECT_CALL(
+        _flowControlFrameTransmitterMock, sendFlowControl(_, 0x5678, FlowStatus::CTS, 0U, 0U))
+        .WillOnce(Return(true));
+    DoCanDefaultFrameSizeMapper<uint8_t> const mapper;
+    CodecType codec(DoCanFrameCodecConfigPresets::OPTIMIZED_CLASSIC, mapper);
+    cut.firstDataFrameReceived(
+        DoCanConnection<DataLinkLayer>(
+            codec,
+            DataLinkLayer::AddressPairType(0x1234, 0x5678),
+            DoCanTransportAddressPair(0x14, 0x23)),
+        sizeof(data),
+        3U,
+        7U,
+        ::etl::span<uint8_t const>(data, 6U));
+    Mock::VerifyAndClearExpectations(&sink);
+    // receive consecutive frames, they are handed over as they arrive
+    EXPECT_CALL(sink, chunkReceived(6U, ElementsAreArray(data + 6U, 7U))).WillOnce(Return(true));
+    cut.consecutiveDataFrameReceived(0x1234, 0x1U, ::etl::span<uint8_t const>(data + 6U, 7U));
+    Mock::VerifyAndClearExpectations(&sink);
+    EXPECT_CALL(sink, chunkReceived(13U, ElementsAreArray(data + 13U, 2U))).WillOnce(Return(true));
+    EXPECT_CALL(sink, receptionEnded(true));
+    cut.consecutiveDataFrameReceived(0x1234, 0x2U, ::etl::span<uint8_t const>(data + 13U, 7U));
+    Mock::VerifyAndClearExpectations(&sink);
+    ASSERT_TRUE(messageReceiverBlockPool.empty());
+
+    // shutdown
+    cut.shutdown();
+}
+
+TEST_F(DoCanReceiverTest, testReceiveSegmentedMessageIntoSinkWithTimeout)
+{
+    using T = ::docan::declare::DoCanMessageReceiver<DataLinkLayer, 7U>;
+    ::etl::generic_pool<sizeof(T), alignof(T), 5U> messageReceiverBlockPool;
+    StrictMock<SinkProvidingListenerMock> messageProvidingListenerMock;
+    StrictMock<TransportMessageSinkMock> sink;
+    DoCanReceiver<DataLinkLayer> cut(
+        _busId,
+        _context,
+        messageProvidingListenerMock,
+        _flowControlFrameTransmitterMock,
+        messageReceiverBlockPool,
+        _addressConverterMock,
+        _parameters,
+        _loggerComponent);
+    cut.init();
+
+    uint8_t data[] = {
+        0xab, 0xcd, 0xef, 0x19, 0x28, 0x37, 0x46, 0x55, 0x64, 0x73, 0x82, 0x91, 0x11, 0x22, 0x33};
+    EXPECT_CALL(
+        messageProvidingListenerMock,
+        getTransportMessageSink(_busId, 0x14, 0x23, sizeof(data), _, _))
+        .WillOnce(DoAll(
+            SetArgReferee<5>(&sink), Return(ITransportMessageProvider::ErrorCode::TPMSG_OK)));
+    EXPECT_CALL(sink, chunkReceived(0U, _)).WillOnce(Return(true));
+    EXPECT_CALL(
+        _flowControlFrameTransmitterMock, sendFlowControl(_, 0x5678, FlowStatus::CTS, 0U, 0U))
+        .WillOnce(Return(true));
+    DoCanDefaultFrameSizeMapper<uint8_t> const mapper;
+    CodecType codec(DoCanFrameCodecConfigPresets::OPTIMIZED_CLASSIC, mapper);
+    cut.firstDataFrameReceived(
+        DoCanConnection<DataLinkLayer>(
+            codec,
+            DataLinkLayer::AddressPairType(0x1234, 0x5678),
+            DoCanTransportAddressPair(0x14, 0x23)),
+        sizeof(data),
+        3U,
+        7U,
+        ::etl::span<uint8_t const>(data, 6U));
+    EXPECT_CALL(sink, chunkReceived(6U, _)).WillOnce(Return(true));
+    cut.consecutiveDataFrameReceived(0x1234, 0x1U, ::etl::span<uint8_t const>(data + 6U, 7U));
+    Mock::VerifyAndClearExpectations(&sink);
+
+    // the sink is told about the aborted reception
+    nowUs += waitRxTimeout * 1000U;
+    expectLog(LEVEL_WARN, 0x1234);
+    EXPECT_CALL(sink, receptionEnded(false));
+    cut.cyclicTask(nowUs);
+    ASSERT_TRUE(messageReceiverBlockPool.empty());
+
+    cut.shutdown();
+}
+
+TEST_F(DoCanReceiverTest, testAssertsOnTooSmallIndex)
+{
+    using T = ::docan::declare::DoCanMessageReceiver<DataLinkLayer, 7U>;
+    ::etl::generic_pool<sizeof(T), alignof(T), 4U> messageReceiverBlockPool;
+    DoCanReceiver<DataLinkLayer>::MessageReceiverIndexType::Entry entries[4U];
+    DoCanReceiver<DataLinkLayer>::MessageReceiverIndexType index(entries);
+    DoCanReceiver<DataLinkLayer> cut(
+        _busId,
+        _context,
+        _messageProvidingListenerMock,
+        _flowControlFrameTransmitterMock,
+        messageReceiverBlockPool,
+        _addressConverterMock,
+        _parameters,
+        _loggerComponent,
+        &index);
+    ASSERT_THROW(cut.init(), ::etl::exception);
+}
+
+TEST_F(DoCanReceiverTest, testReceiveInterleavedSegmentedMessagesWithIndex)
+{
+    using T = ::docan::declare::DoCanMessageReceiver<DataLinkLayer, 7U>;
+    ::etl::generic_pool<sizeof(T), alignof(T), 5U> messageReceiverBlockPool;
+    ::docan::declare::DoCanAddressIndex<uint32_t, DoCanMessageReceiver<DataLinkLayer>, 5U> index;
+    DoCanReceiver<DataLinkLayer> cut(
+        _busId,
+        _context,
+        _messageProvidingListenerMock,
+        _flowControlFrameTransmitterMock,
+        messageReceiverBlockPool,
+        _addressConverterMock,
+        _parameters,
+        _loggerComponent,
+        &index);
+    cut.init();
+
+    uint8_t data[] = {
+        0xab, 0xcd, 0xef, 0x19, 0x28, 0x37, 0x46, 0x55, 0x64, 0x73, 0x82, 0x91, 0x11, 0x22, 0x33};
+    // receive the first frames
+    EXPECT_CALL(
+        _messageProvidingListenerMock, getTransportMessage(_busId, 0x14, 0x23, sizeof(data), _, _))
+        .WillOnce(DoAll(
+            SetArgReferee<5>(&_transportMessage1),
+            Return(ITransportMessageProvider::ErrorCode::TPMSG_OK)));
+    EXPECT_CALL(
+        _messageProvidingListenerMock, getTransportMessage(_busId, 0x15, 0x23, sizeof(data), _, _))
+        .WillOnce(DoAll(
+            SetArgReferee<5>(&_transportMessage2),
+            Return(ITransportMessageProvider::ErrorCode::TPMSG_OK)));
+    EXPECT_CALL(
+        _flowControlFrameTransmitterMock, sendFlowControl(_, 0x5678, FlowStatus::CTS, 0U, 0U))
+        .WillOnce(Return(true));
+    EXPECT_CALL(
+        _flowControlFrameTransmitterMock, sendFlowControl(_, 0x5679, FlowStatus::CTS, 0U, 0U))
+        .WillOnce(Return(true));
+    DoCanDefaultFrameSizeMapper<uint8_t> const mapper;
+    CodecType codec(DoCanFrameCodecConfigPresets::OPTIMIZED_CLASSIC, mapper);
+    cut.firstDataFrameReceived(
+        DoCanConnection<DataLinkLayer>(
+            codec,
+            DataLinkLayer::AddressPairType(0x1234, 0x5678),
+            DoCanTransportAddressPair(0x14, 0x23)),
+        sizeof(data),
+        3U,
+        7U,
+        ::etl::span<uint8_t const>(data, 6U));
+    cut.firstDataFrameReceived(
+        DoCanConnection<DataLinkLayer>(
+            codec,
+            DataLinkLayer::AddressPairType(0x1235, 0x5679),
+            DoCanTransportAddressPair(0x15, 0x23)),
+        sizeof(data),
+        3U,
+        7U,
+        ::etl::span<uint8_t const>(data, 6U));
+    EXPECT_NE(nullptr, index.find(&cut, 0x1234));
+    EXPECT_NE(nullptr, index.find(&cut, 0x1235));
+    // receive consecutive frame of an unknown receiver
+    expectLog(LEVEL_WARN, 0x4455);
+    cut.consecutiveDataFrameReceived(0x4455, 0x1U, ::etl::span<uint8_t const>(data + 6U, 7U));
+    // receive interleaved consecutive frames
+    cut.consecutiveDataFrameReceived(0x1235, 0x1U, ::etl::span<uint8_t const>(data + 6U, 7U));
+    cut.consecutiveDataFrameReceived(0x1234, 0x1U, ::etl::span<uint8_t const>(data + 6U, 7U));
+    EXPECT_CALL(
+        _messageProvidingListenerMock, messageReceived(_busId, Ref(_transportMessage1), NotNull()))
+        .WillOnce(Return(ITransportMessageListener::ReceiveResult::RECEIVED_NO_ERROR));
+    cut.consecutiveDataFrameReceived(0x1234, 0x2U, ::etl::span<uint8_t const>(data + 13U, 2U));
+    EXPECT_CALL(
+        _messageProvidingListenerMock, messageReceived(_busId, Ref(_transportMessage2), NotNull()))
+        .WillOnce(Return(ITransportMessageListener::ReceiveResult::RECEIVED_NO_ERROR));
+    cut.consecutiveDataFrameReceived(0x1235, 0x2U, ::etl::span<uint8_t const>(data + 13U, 2U));
+    Mock::VerifyAndClearExpectations(&_messageProvidingListenerMock);
+    EXPECT_EQ(0x14U, _transportMessage1.getSourceId());
+    EXPECT_EQ(0x15U, _transportMessage2.getSourceId());
+
+    // shutdown
+    cut.shutdown();
+    ASSERT_TRUE(messageReceiverBlockPool.empty());
+    EXPECT_EQ(nullptr, index.find(&cut, 0x1234));
+    EXPECT_EQ(nullptr, index.find(&cut, 0x1235));
+}
+
 // Some timeout will show that the expiration and receiving right before works even when passing
 // uint wrap around.
 TEST_F(
@@ -1181,6 +1409,75 @@ TEST_F(DoCanReceiverTest, testReceiveSegmentedMessageWithBlockSizeAndShutdown)
     ASSERT_TRUE(messageReceiverBlockPool.empty());
 }
 
+TEST_F(DoCanReceiverTest, testReceiveSegmentedMessageWithFlowControlPolicyAndShutdown)
+{
+    using T = ::docan::declare::DoCanMessageReceiver<DataLinkLayer, 7U>;
+    ::etl::generic_pool<sizeof(T), alignof(T), 5U> messageReceiverBlockPool;
+    StrictMock<DoCanFlowControlPolicyMock> flowControlPolicyMock;
+    _parameters.setFlowControlPolicy(&flowControlPolicyMock);
+    DoCanReceiver<DataLinkLayer> cut(
+        _busId,
+        _context,
+        _messageProvidingListenerMock,
+        _flowControlFrameTransmitterMock,
+        messageReceiverBlockPool,
+        _addressConverterMock,
+        _parameters,
+        _loggerComponent);
+    cut.init();
+
+    uint8_t const data[] = {
+        0xab, 0xcd, 0xef, 0x19, 0x28, 0x37, 0x46, 0x55, 0x64, 0x73, 0x82, 0x91, 0x11, 0x22, 0x33};
+    EXPECT_CALL(
+        _messageProvidingListenerMock, getTransportMessage(_busId, 0x14, 0x23, sizeof(data), _, _))
+        .WillOnce(DoAll(
+            SetArgReferee<5>(&_transportMessage1),
+            Return(ITransportMessageProvider::ErrorCode::TPMSG_OK)));
+    // the policy throttles the first block
+    EXPECT_CALL(
+        flowControlPolicyMock,
+        adaptFlowControl(DoCanTransportAddressPair(0x14, 0x23), 20U, Eq(0U), Eq(0U)))
+        .WillOnce(DoAll(SetArgReferee<2>(1U), SetArgReferee<3>(0x05U)));
+    EXPECT_CALL(
+        _flowControlFrameTransmitterMock, sendFlowControl(_, 0x5678, FlowStatus::CTS, 1U, 0x05U))
+        .WillOnce(Return(true));
+    // receive the first frame
+    DoCanDefaultFrameSizeMapper<uint8_t> const mapper;
+    CodecType codec(DoCanFrameCodecConfigPresets::OPTIMIZED_CLASSIC, mapper);
+    cut.firstDataFrameReceived(
+        DoCanConnection<DataLinkLayer>(
+            codec,
+            DataLinkLayer::AddressPairType(0x1234, 0x5678),
+            DoCanTransportAddressPair(0x14, 0x23)),
+        sizeof(data),
+        3U,
+        7U,
+        ::etl::span<uint8_t const>(data, 6U));
+    Mock::VerifyAndClearExpectations(&flowControlPolicyMock);
+    Mock::VerifyAndClearExpectations(&_flowControlFrameTransmitterMock);
+    Mock::VerifyAndClearExpectations(&_messageProvidingListenerMock);
+    // the policy releases the sender for the remaining frames
+    EXPECT_CALL(
+        flowControlPolicyMock,
+        adaptFlowControl(DoCanTransportAddressPair(0x14, 0x23), 20U, Eq(0U), Eq(0U)));
+    EXPECT_CALL(
+        _flowControlFrameTransmitterMock, sendFlowControl(_, 0x5678, FlowStatus::CTS, 0U, 0U))
+        .WillOnce(Return(true));
+    cut.consecutiveDataFrameReceived(0x1234, 1U, ::etl::span<uint8_t const>(data + 6U, 7U));
+    Mock::VerifyAndClearExpectations(&flowControlPolicyMock);
+    Mock::VerifyAndClearExpectations(&_flowControlFrameTransmitterMock);
+    EXPECT_CALL(
+        _messageProvidingListenerMock, messageReceived(_busId, Ref(_transportMessage1), NotNull()))
+        .WillOnce(Return(ITransportMessageListener::ReceiveResult::RECEIVED_NO_ERROR));
+    cut.consecutiveDataFrameReceived(0x1234, 2U, ::etl::span<uint8_t const>(data + 13U, 2U));
+    Mock::VerifyAndClearExpectations(&_messageProvidingListenerMock);
+    EXPECT_TRUE(_transportMessage1.isComplete());
+
+    // shutdown
+    cut.shutdown();
+    ASSERT_TRUE(messageReceiverBlockPool.empty());
+}
+
 TEST_F(DoCanReceiverTest, testReceptionOfSegmentedMessageIsCancelledByNextFirstFrame)
 {
     using T = ::docan::declare::DoCanMessageReceiver<DataLinkLayer, 7U>;
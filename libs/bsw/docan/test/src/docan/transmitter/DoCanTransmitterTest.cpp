@@ -1721,6 +1721,57 @@ TEST_F(DoCanTransmitterTest, testSendSecondSegmentedMessageForSameTransportAddre
     ASSERT_TRUE(messageTransmitterBlockPool.empty());
 }
 
+TEST_F(DoCanTransmitterTest, testSendSecondSegmentedMessageForSameTransportAddressPairWithIndex)
+{
+    ::etl::generic_pool<sizeof(ItemT), alignof(ItemT), 5U> messageTransmitterBlockPool;
+    ::docan::declare::DoCanAddressIndex<uint32_t, ItemT, 5U> index;
+    DoCanTransmitter<DataLinkLayer> cut(
+        _busId,
+        _context,
+        _dataFrameTransmitterMock,
+        _tickGeneratorMock,
+        messageTransmitterBlockPool,
+        _addressConverterMock,
+        _parameters,
+        _loggerComponent,
+        &index);
+    cut.init();
+
+    // content
+    uint8_t data[] = {0xab, 0xcd, 0xef, 0x19, 0x28, 0x35, 0x89, 0x11};
+    // send first segmented message
+    TransportMessage message1;
+    auto const addrPair1      = DataLinkLayer::AddressPairType(0x1234, 0x5678);
+    auto const transportPair1 = DoCanTransportAddressPair(0x45, 0x54);
+    initMessage(message1, transportPair1, addrPair1, data);
+    _context.handleExecute();
+    ASSERT_EQ(
+        ::transport::AbstractTransportLayer::ErrorCode::TP_OK,
+        cut.send(message1, &_processedListenerMock));
+    EXPECT_NE(nullptr, index.find(&cut, 0x1234));
+    // sending second segmented message and expect error
+    TransportMessage message2;
+    auto const addrPair2      = DataLinkLayer::AddressPairType(0x1234, 0x5678);
+    auto const transportPair2 = DoCanTransportAddressPair(0x46, 0x64);
+    initMessage(message2, transportPair2, addrPair2, data);
+    expectLog(LEVEL_WARN);
+    EXPECT_EQ(
+        ::transport::AbstractTransportLayer::ErrorCode::TP_SEND_FAIL,
+        cut.send(message2, &_processedListenerMock));
+    // flow control for an unknown address
+    expectLog(LEVEL_WARN, 0x4455);
+    cut.flowControlFrameReceived(0x4455, FlowStatus::CTS, 0U, 0U);
+
+    // shut down => cancel sends
+    EXPECT_CALL(
+        _processedListenerMock,
+        transportMessageProcessed(
+            Ref(message1), ITransportMessageProcessedListener::ProcessingResult::PROCESSED_ERROR));
+    cut.shutdown();
+    ASSERT_TRUE(messageTransmitterBlockPool.empty());
+    EXPECT_EQ(nullptr, index.find(&cut, 0x1234));
+}
+
 TEST_F(DoCanTransmitterTest, testFillUpSendQueue)
 {
     ::etl::generic_pool<sizeof(ItemT), alignof(ItemT), 2U> messageTransmitterBlockPool;
@@ -42,6 +42,10 @@ TEST(DoCanTransportLayerConfigTest, testConstructedParametersAndSetter)
     EXPECT_EQ(
         sizeof(::docan::declare::DoCanMessageReceiver<DataLinkLayerType, 64U>),
         cut.getMessageReceiverPool().max_item_size());
+    ASSERT_NE(nullptr, cut.getMessageReceiverIndex());
+    EXPECT_EQ(4U, cut.getMessageReceiverIndex()->getCapacity());
+    ASSERT_NE(nullptr, cut.getMessageTransmitterIndex());
+    EXPECT_EQ(8U, cut.getMessageTransmitterIndex()->getCapacity());
     EXPECT_EQ(&parameters, &cut.getParameters());
 }
 
@@ -113,7 +113,9 @@ private:
         INIT,
         ACTIVE,
         INACTIVE,
-        ERROR
+        ERROR,
+        /// closed while the socket still references data of sent jobs
+        CLOSING
     };
 
     enum class ReadState : uint8_t
@@ -96,6 +96,7 @@ public:
     void release(bool success) override;
     ::etl::span<uint8_t const>
     getSendBuffer(::etl::span<uint8_t> staticBuffer, uint8_t bufferIndex) override;
+    bool isSendBufferPersistent(uint8_t bufferIndex) const override;
 
 private:
     enum class BufferIndex : uint8_t
@@ -63,6 +63,20 @@ public:
      */
     virtual ::etl::span<uint8_t const>
     getSendBuffer(::etl::span<uint8_t> staticBuffer, uint8_t index) = 0;
+
+    /**
+     * Called to check whether the n-th send buffer stays valid and unchanged until the send job
+     * is released. Such a buffer can be passed to the TCP stack without copying it. Buffers
+     * placed into the static buffer are always copied.
+     * \param index index (< getSendBufferCount()) of the buffer
+     * \return true if the buffer can be sent without copying it
+     */
+    virtual bool isSendBufferPersistent(uint8_t index) const;
 };
 
+/**
+ * Inline implementations.
+ */
+inline bool IDoIpSendJob::isSendBufferPersistent(uint8_t const /* index */) const { return false; }
+
 } // namespace doip
@@ -64,7 +64,8 @@ DoIpTcpConnection::DoIpTcpConnection(
 
 void DoIpTcpConnection::init(IDoIpConnectionHandler& handler)
 {
-    if (_connectionState != ConnectionState::ACTIVE)
+    if ((_connectionState != ConnectionState::ACTIVE)
+        && (_connectionState != ConnectionState::CLOSING))
     {
         Logger::debug(
             DOIP_COMMON,
@@ -217,6 +218,16 @@ void DoIpTcpConnection::connectionClosed(ErrorCode const status)
         _connectionState,
         _closeMode,
         status);
+    if (_connectionState == ConnectionState::CLOSING)
+    {
+        // the socket doesn't reference the data of the remaining sent jobs anymore
+        _connectionState                      = ConnectionState::INACTIVE;
+        IDoIpConnectionHandler* const handler = _handler;
+        _handler                              = nullptr;
+        releaseSendJobs(_sentJobs);
+        handler->connectionClosed(false);
+        return;
+    }
     closeConnection(
         ConnectionState::INACTIVE,
         status != IDataListener::ErrorCode::ERR_CONNECTION_TIMED_OUT,
@@ -272,10 +283,15 @@ bool DoIpTcpConnection::processCurrentSendBuffer(IDoIpSendJob& sendJob)
     auto const sendBuffer = sendJob.getSendBuffer(_writeBuffer, _sendBufferIndex);
     if (sendBuffer.size() > 0U)
     {
-        _recurseWrite                          = true;
-        _pendingSendDataLength                 = sendBuffer.size();
-        AbstractSocket::ErrorCode const result = _socket.send(sendBuffer);
-        _recurseWrite                          = false;
+        // send jobs are only released once all of their data has been acknowledged
+        bool const zeroCopy = sendJob.isSendBufferPersistent(_sendBufferIndex)
+                              && ((sendBuffer.data() < _writeBuffer.data())
+                                  || (sendBuffer.data() >= _writeBuffer.end()));
+        _recurseWrite          = true;
+        _pendingSendDataLength = sendBuffer.size();
+        AbstractSocket::ErrorCode const result
+            = zeroCopy ? _socket.sendZeroCopy(sendBuffer) : _socket.send(sendBuffer);
+        _recurseWrite = false;
         if (result == AbstractSocket::ErrorCode::SOCKET_ERR_NO_MORE_BUFFER)
         {
             (void)_socket.flush();
@@ -463,11 +479,7 @@ void DoIpTcpConnection::closeConnection(
         closeSocket);
     if (_connectionState == ConnectionState::ACTIVE)
     {
-        _connectionState                      = connectionState;
-        IDoIpConnectionHandler* const handler = _handler;
-        _handler                              = nullptr;
-        releaseSendJobs(_sentJobs);
-        releaseSendJobs(_pendingSendJobs);
+        _connectionState = connectionState;
         setReadBuffer(span<uint8_t>());
         if (_detachCallback.is_valid())
         {
@@ -486,6 +498,28 @@ void DoIpTcpConnection::closeConnection(
         }
         // This is an optimization only, preventing spam of the `execute` method.
         (void)_sendTimeout.cancel();
+        if (closeSocket && _socket.hasUnacknowledgedZeroCopyData())
+        {
+            // Jobs with data sent without copy are released once the socket doesn't reference
+            // it anymore, the handler is notified in connectionClosed() then.
+            {
+                // RAII usage
+                DoIpLock const lock;
+                if ((!_pendingSendJobs.empty()) && (_sendBufferIndex > 0U))
+                {
+                    IDoIpSendJob& sendJob = _pendingSendJobs.front();
+                    _pendingSendJobs.pop_front();
+                    _sentJobs.push_back(sendJob);
+                }
+            }
+            releaseSendJobs(_pendingSendJobs);
+            _connectionState = ConnectionState::CLOSING;
+            return;
+        }
+        IDoIpConnectionHandler* const handler = _handler;
+        _handler                              = nullptr;
+        releaseSendJobs(_sentJobs);
+        releaseSendJobs(_pendingSendJobs);
         handler->connectionClosed(closedByRemotePeer);
     }
 }
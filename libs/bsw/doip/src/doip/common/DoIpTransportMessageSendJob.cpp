@@ -120,4 +120,10 @@ void DoIpTransportMessageSendJob::release(bool const success)
     }
 }
 
+bool DoIpTransportMessageSendJob::isSendBufferPersistent(uint8_t const bufferIndex) const
+{
+    // the transport message is held until the send job is released
+    return static_cast<BufferIndex>(bufferIndex) == BufferIndex::DYNAMIC_PAYLOAD;
+}
+
 } // namespace doip
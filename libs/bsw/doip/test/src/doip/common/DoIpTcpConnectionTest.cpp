@@ -44,6 +44,17 @@ MATCHER_P2(Span, dataMatcher, sizeMatcher, "")
     return Matches(dataMatcher)(arg.data()) && Matches(sizeMatcher)(arg.size());
 }
 
+struct PersistentSendJobMock : DoIpSendJobMock
+{
+    MOCK_METHOD(bool, isSendBufferPersistent, (uint8_t), (const, override));
+};
+
+struct ZeroCopySocketMock : ::tcp::AbstractSocketMock
+{
+    MOCK_METHOD(ErrorCode, sendZeroCopy, (::etl::span<uint8_t const> const&), (override));
+    MOCK_METHOD(bool, hasUnacknowledgedZeroCopyData, (), (const, override));
+};
+
 struct DoIpTcpConnectionTest : Test
 {
     DoIpTcpConnectionTest()
@@ -547,6 +558,135 @@ TEST_F(DoIpTcpConnectionTest, SimpleLifecycleWithMessageTransmission)
     testContext.expireAndExecute();
 }
 
+TEST_F(DoIpTcpConnectionTest, PersistentSendBuffersAreSentWithoutCopy)
+{
+    ::etl::array<uint8_t, 10U> writeBuffer;
+    ZeroCopySocketMock socketMock;
+    StrictMock<PersistentSendJobMock> sendJobMock;
+    DoIpTcpConnection cut(asyncContext, socketMock, writeBuffer);
+    EXPECT_CALL(socketMock, isEstablished()).WillOnce(Return(true));
+    cut.init(fConnectionHandlerMock);
+    uint8_t const output[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99};
+    EXPECT_CALL(sendJobMock, getSendBufferCount()).WillRepeatedly(Return(3U));
+    EXPECT_CALL(sendJobMock, getTotalLength()).WillRepeatedly(Return(17U));
+    cut.sendMessage(sendJobMock);
+    Sequence seq;
+    // a buffer in the write buffer is always copied
+    EXPECT_CALL(sendJobMock, getSendBuffer(_, 0U))
+        .InSequence(seq)
+        .WillOnce(Return(::etl::span<uint8_t const>(writeBuffer.data(), 8U)));
+    EXPECT_CALL(sendJobMock, isSendBufferPersistent(0U)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(socketMock, send(Span(writeBuffer.data(), 8U)))
+        .InSequence(seq)
+        .WillOnce(Return(::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_OK));
+    // a buffer that isn't persistent is copied
+    EXPECT_CALL(sendJobMock, getSendBuffer(_, 1U))
+        .InSequence(seq)
+        .WillOnce(Return(::etl::span<uint8_t const>(output, 4U)));
+    EXPECT_CALL(sendJobMock, isSendBufferPersistent(1U)).InSequence(seq).WillOnce(Return(false));
+    EXPECT_CALL(socketMock, send(Span(output, 4U)))
+        .InSequence(seq)
+        .WillOnce(Return(::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_OK));
+    EXPECT_CALL(sendJobMock, getSendBuffer(_, 2U))
+        .InSequence(seq)
+        .WillOnce(Return(::etl::span<uint8_t const>(output + 4U, 5U)));
+    EXPECT_CALL(sendJobMock, isSendBufferPersistent(2U)).InSequence(seq).WillOnce(Return(true));
+    EXPECT_CALL(socketMock, sendZeroCopy(Span(output + 4U, 5U)))
+        .InSequence(seq)
+        .WillOnce(Return(::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_OK));
+    EXPECT_CALL(socketMock, flush())
+        .InSequence(seq)
+        .WillOnce(Return(::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_OK));
+    testContext.expireAndExecute();
+    // the send job holding the persistent buffer is released once everything is acknowledged
+    socketMock.getSendNotificationListener()->dataSent(
+        12U, ::tcp::IDataSendNotificationListener::SendResult::DATA_SENT);
+    EXPECT_CALL(sendJobMock, release(true));
+    socketMock.getSendNotificationListener()->dataSent(
+        5U, ::tcp::IDataSendNotificationListener::SendResult::DATA_SENT);
+    testContext.expireAndExecute();
+}
+
+TEST_F(DoIpTcpConnectionTest, CloseReleasesSendJobsSentWithoutCopyOnceAcknowledged)
+{
+    ::etl::array<uint8_t, 10U> writeBuffer;
+    ZeroCopySocketMock socketMock;
+    StrictMock<PersistentSendJobMock> sendJobMock;
+    StrictMock<DoIpSendJobMock> pendingSendJobMock;
+    DoIpTcpConnection cut(asyncContext, socketMock, writeBuffer);
+    EXPECT_CALL(socketMock, isEstablished()).WillOnce(Return(true));
+    cut.init(fConnectionHandlerMock);
+    uint8_t const output[] = {0x11, 0x22, 0x33, 0x44, 0x55};
+    EXPECT_CALL(sendJobMock, getSendBufferCount()).WillRepeatedly(Return(1U));
+    EXPECT_CALL(sendJobMock, getTotalLength()).WillRepeatedly(Return(5U));
+    EXPECT_CALL(sendJobMock, getSendBuffer(_, 0U))
+        .WillOnce(Return(::etl::span<uint8_t const>(output)));
+    EXPECT_CALL(sendJobMock, isSendBufferPersistent(0U)).WillOnce(Return(true));
+    EXPECT_CALL(socketMock, sendZeroCopy(Span(output, 5U)))
+        .WillOnce(Return(::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_OK));
+    EXPECT_CALL(socketMock, flush())
+        .WillOnce(Return(::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_OK));
+    cut.sendMessage(sendJobMock);
+    testContext.expireAndExecute();
+    cut.sendMessage(pendingSendJobMock);
+    // the socket still references the data of the sent job after closing
+    EXPECT_CALL(socketMock, close())
+        .WillOnce(Return(::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_OK));
+    EXPECT_CALL(socketMock, hasUnacknowledgedZeroCopyData()).WillOnce(Return(true));
+    EXPECT_CALL(pendingSendJobMock, release(false));
+    cut.close();
+    Mock::VerifyAndClearExpectations(&pendingSendJobMock);
+    EXPECT_FALSE(cut.sendMessage(pendingSendJobMock));
+    EXPECT_CALL(sendJobMock, release(true));
+    socketMock.getSendNotificationListener()->dataSent(
+        5U, ::tcp::IDataSendNotificationListener::SendResult::DATA_SENT);
+    Mock::VerifyAndClearExpectations(&sendJobMock);
+    EXPECT_CALL(fConnectionHandlerMock, connectionClosed(false));
+    socketMock.getDataListener()->connectionClosed(
+        ::tcp::IDataListener::ErrorCode::ERR_CONNECTION_CLOSED);
+    testContext.expireAndExecute();
+}
+
+TEST_F(DoIpTcpConnectionTest, CloseReleasesSendJobsSentWithoutCopyWhenSocketIsClosed)
+{
+    ::etl::array<uint8_t, 10U> writeBuffer;
+    ZeroCopySocketMock socketMock;
+    StrictMock<PersistentSendJobMock> sendJobMock;
+    DoIpTcpConnection cut(asyncContext, socketMock, writeBuffer);
+    EXPECT_CALL(socketMock, isEstablished()).WillOnce(Return(true));
+    cut.init(fConnectionHandlerMock);
+    uint8_t const output[] = {0x11, 0x22, 0x33, 0x44, 0x55};
+    EXPECT_CALL(sendJobMock, getSendBufferCount()).WillRepeatedly(Return(2U));
+    EXPECT_CALL(sendJobMock, getTotalLength()).WillRepeatedly(Return(10U));
+    EXPECT_CALL(sendJobMock, getSendBuffer(_, 0U))
+        .WillOnce(Return(::etl::span<uint8_t const>(output)));
+    EXPECT_CALL(sendJobMock, isSendBufferPersistent(0U)).WillOnce(Return(true));
+    // the socket doesn't accept the second buffer yet
+    EXPECT_CALL(sendJobMock, getSendBuffer(_, 1U))
+        .WillOnce(Return(::etl::span<uint8_t const>(output)));
+    EXPECT_CALL(sendJobMock, isSendBufferPersistent(1U)).WillOnce(Return(true));
+    EXPECT_CALL(socketMock, sendZeroCopy(Span(output, 5U)))
+        .WillOnce(Return(::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_OK))
+        .WillOnce(Return(::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK));
+    EXPECT_CALL(socketMock, flush())
+        .WillOnce(Return(::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_OK));
+    cut.sendMessage(sendJobMock);
+    testContext.expireAndExecute();
+    // the partially sent job is kept until the socket is closed
+    EXPECT_CALL(socketMock, close())
+        .WillOnce(Return(::tcp::AbstractSocket::ErrorCode::SOCKET_ERR_OK));
+    EXPECT_CALL(socketMock, hasUnacknowledgedZeroCopyData()).WillOnce(Return(true));
+    cut.close();
+    socketMock.getSendNotificationListener()->dataSent(
+        5U, ::tcp::IDataSendNotificationListener::SendResult::DATA_SENT);
+    Mock::VerifyAndClearExpectations(&sendJobMock);
+    EXPECT_CALL(sendJobMock, release(false));
+    EXPECT_CALL(fConnectionHandlerMock, connectionClosed(false));
+    socketMock.getDataListener()->connectionClosed(
+        ::tcp::IDataListener::ErrorCode::ERR_CONNECTION_RESET);
+    testContext.expireAndExecute();
+}
+
 TEST_F(DoIpTcpConnectionTest, CloseConnectionDuringSend)
 {
     ::etl::array<uint8_t, 10U> writeBuffer;
@@ -57,6 +57,11 @@ TEST(DoIpTransportMessageSendJobTest, TestConstructorWithAddressesFromMessage)
     EXPECT_EQ(data, sendBuffer.data());
     EXPECT_TRUE(is_equal(::etl::span<uint8_t const>(data), sendBuffer));
     EXPECT_TRUE(is_equal(::etl::span<uint8_t const>(), cut.getSendBuffer(staticBuffer, 3U)));
+    // only the payload of the message can be sent without copy
+    EXPECT_FALSE(cut.isSendBufferPersistent(0U));
+    EXPECT_FALSE(cut.isSendBufferPersistent(1U));
+    EXPECT_TRUE(cut.isSendBufferPersistent(2U));
+    EXPECT_FALSE(cut.isSendBufferPersistent(3U));
     // send processed without success
     EXPECT_CALL(
         processedListenerMock,
@@ -9,7 +9,16 @@
  ********************************************************************************/
 
 #include <benchmark/benchmark.h>
+#include <io/JoinReader.h>
 #include <io/MemoryQueue.h>
+#include <io/MpscMemoryQueue.h>
+#include <io/SharedBufferPool.h>
+#include <io/SplitWriter.h>
+
+#include <etl/unaligned_type.h>
+
+#include <atomic>
+#include <thread>
 
 namespace
 {
@@ -18,6 +27,14 @@ constexpr uint8_t SMALL_SIZE = 3;
 using Queue                  = ::io::MemoryQueue<1024 * 10, MAX_SIZE>;
 using Writer                 = ::io::MemoryQueueWriter<Queue>;
 using Reader                 = ::io::MemoryQueueReader<Queue>;
+
+constexpr size_t NUM_DESTINATIONS = 4;
+constexpr size_t PDU_SIZE         = 64;
+constexpr size_t DESCRIPTOR_SIZE  = 2 * sizeof(::etl::be_uint32_t);
+using FanOutQueue                 = ::io::MemoryQueue<1024, PDU_SIZE>;
+using FanOutWriter                = ::io::MemoryQueueWriter<FanOutQueue>;
+using FanOutReader                = ::io::MemoryQueueReader<FanOutQueue>;
+using Pool                        = ::io::SharedBufferPool<8, PDU_SIZE>;
 } // namespace
 
 /**
@@ -57,3 +74,204 @@ void BM_fill_empty_queue_reallocate(benchmark::State& state)
 }
 
 BENCHMARK(BM_fill_empty_queue_reallocate);
+
+/**
+ * Benchmarks routing one PDU to NUM_DESTINATIONS queues using a SplitWriter, which copies the
+ * payload into each destination.
+ */
+void BM_fan_out_copy(benchmark::State& state)
+{
+    ::etl::array<FanOutQueue, NUM_DESTINATIONS> queues;
+    ::etl::array<FanOutWriter, NUM_DESTINATIONS> writers{
+        FanOutWriter(queues[0]),
+        FanOutWriter(queues[1]),
+        FanOutWriter(queues[2]),
+        FanOutWriter(queues[3])};
+    ::etl::array<FanOutReader, NUM_DESTINATIONS> readers{
+        FanOutReader(queues[0]),
+        FanOutReader(queues[1]),
+        FanOutReader(queues[2]),
+        FanOutReader(queues[3])};
+    ::etl::array<::io::IWriter*, NUM_DESTINATIONS> destinations{
+        &writers[0], &writers[1], &writers[2], &writers[3]};
+    ::io::SplitWriter<NUM_DESTINATIONS> split(destinations);
+
+    while (state.KeepRunning())
+    {
+        auto s = split.allocate(PDU_SIZE);
+        s[0]   = 0xAAU;
+        split.commit();
+        for (auto& r : readers)
+        {
+            benchmark::DoNotOptimize(r.peek()[0]);
+            r.release();
+        }
+    }
+    state.counters["bytesCopiedPerPdu"] = static_cast<double>(NUM_DESTINATIONS * PDU_SIZE);
+}
+
+BENCHMARK(BM_fan_out_copy);
+
+/**
+ * Benchmarks routing one PDU to NUM_DESTINATIONS queues by storing the payload once in a
+ * SharedBufferPool and passing a descriptor to each destination.
+ */
+void BM_fan_out_shared(benchmark::State& state)
+{
+    ::etl::array<FanOutQueue, NUM_DESTINATIONS> queues;
+    ::etl::array<FanOutWriter, NUM_DESTINATIONS> writers{
+        FanOutWriter(queues[0]),
+        FanOutWriter(queues[1]),
+        FanOutWriter(queues[2]),
+        FanOutWriter(queues[3])};
+    ::etl::array<FanOutReader, NUM_DESTINATIONS> readers{
+        FanOutReader(queues[0]),
+        FanOutReader(queues[1]),
+        FanOutReader(queues[2]),
+        FanOutReader(queues[3])};
+    Pool pool;
+
+    while (state.KeepRunning())
+    {
+        auto const handle = pool.allocate(PDU_SIZE);
+        pool.data(handle)[0] = 0xAAU;
+        pool.commit(handle, NUM_DESTINATIONS);
+        for (auto& w : writers)
+        {
+            auto d = w.allocate(DESCRIPTOR_SIZE);
+            d.take<::etl::be_uint32_t>() = 0U;
+            d.take<::etl::be_uint32_t>() = static_cast<uint32_t>(handle);
+            w.commit();
+        }
+        for (auto& r : readers)
+        {
+            auto d = r.peek();
+            d.advance(sizeof(::etl::be_uint32_t));
+            uint32_t const h = d.take<::etl::be_uint32_t const>();
+            benchmark::DoNotOptimize(pool.data(h)[0]);
+            r.release();
+            pool.release(h);
+        }
+    }
+    state.counters["bytesCopiedPerPdu"]
+        = static_cast<double>(PDU_SIZE + (NUM_DESTINATIONS * DESCRIPTOR_SIZE));
+}
+
+BENCHMARK(BM_fan_out_shared);
+
+namespace
+{
+constexpr size_t MAX_PRODUCERS   = 8;
+constexpr size_t CONTENTION_SIZE = 8;
+using MpscQueue                  = ::io::MpscMemoryQueue<1024, CONTENTION_SIZE>;
+using SpscQueue                  = ::io::MemoryQueue<1024, CONTENTION_SIZE>;
+using JoinedReader               = ::io::JoinReader<MAX_PRODUCERS>;
+std::atomic<bool> consumerRunning{false};
+std::thread consumer;
+
+MpscQueue mpscQueue;
+::etl::array<SpscQueue, MAX_PRODUCERS> spscQueues;
+
+void drain(::io::IReader& reader)
+{
+    while (consumerRunning.load())
+    {
+        if (reader.peek().size() > 0U)
+        {
+            reader.release();
+        }
+    }
+    while (reader.peek().size() > 0U)
+    {
+        reader.release();
+    }
+}
+
+void write(::io::IWriter& writer, uint8_t const value)
+{
+    auto s = writer.allocate(CONTENTION_SIZE);
+    while (s.size() == 0U)
+    {
+        s = writer.allocate(CONTENTION_SIZE);
+    }
+    s[0] = value;
+    writer.commit();
+}
+} // namespace
+
+/**
+ * Benchmarks several producer threads writing into one MpscMemoryQueue, which is drained by a
+ * separate consumer thread.
+ */
+void BM_mpsc_contention(benchmark::State& state)
+{
+    static ::io::MemoryQueueReader<MpscQueue> reader(mpscQueue);
+    if (state.thread_index() == 0)
+    {
+        consumerRunning.store(true);
+        consumer = std::thread([] { drain(reader); });
+    }
+    ::io::MemoryQueueWriter<MpscQueue> writer(mpscQueue);
+
+    for (auto _ : state)
+    {
+        write(writer, static_cast<uint8_t>(state.thread_index()));
+    }
+
+    if (state.thread_index() == 0)
+    {
+        consumerRunning.store(false);
+        consumer.join();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_mpsc_contention)->Threads(2)->Threads(4)->Threads(8)->UseRealTime();
+
+/**
+ * Same as BM_mpsc_contention, but each producer thread writes into its own MemoryQueue and the
+ * consumer thread reads from all of them through a JoinReader.
+ */
+void BM_spsc_join_contention(benchmark::State& state)
+{
+    static ::etl::array<::io::MemoryQueueReader<SpscQueue>, MAX_PRODUCERS> readers{
+        ::io::MemoryQueueReader<SpscQueue>(spscQueues[0]),
+        ::io::MemoryQueueReader<SpscQueue>(spscQueues[1]),
+        ::io::MemoryQueueReader<SpscQueue>(spscQueues[2]),
+        ::io::MemoryQueueReader<SpscQueue>(spscQueues[3]),
+        ::io::MemoryQueueReader<SpscQueue>(spscQueues[4]),
+        ::io::MemoryQueueReader<SpscQueue>(spscQueues[5]),
+        ::io::MemoryQueueReader<SpscQueue>(spscQueues[6]),
+        ::io::MemoryQueueReader<SpscQueue>(spscQueues[7])};
+    static ::etl::array<::io::IReader*, MAX_PRODUCERS> sources{
+        &readers[0],
+        &readers[1],
+        &readers[2],
+        &readers[3],
+        &readers[4],
+        &readers[5],
+        &readers[6],
+        &readers[7]};
+    static JoinedReader reader(sources);
+    if (state.thread_index() == 0)
+    {
+        consumerRunning.store(true);
+        consumer = std::thread([] { drain(reader); });
+    }
+    ::io::MemoryQueueWriter<SpscQueue> writer(
+        spscQueues[static_cast<size_t>(state.thread_index())]);
+
+    for (auto _ : state)
+    {
+        write(writer, static_cast<uint8_t>(state.thread_index()));
+    }
+
+    if (state.thread_index() == 0)
+    {
+        consumerRunning.store(false);
+        consumer.join();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_spsc_join_contention)->Threads(2)->Threads(4)->Threads(8)->UseRealTime();
@@ -0,0 +1,44 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include "io/IReader.h"
+
+#include <etl/span.h>
+
+namespace io
+{
+/**
+ * Extension of IReader for readers which can provide and release several slices at once.
+ */
+class IBatchReader : public IReader
+{
+public:
+    // [PUBLICAPI_START]
+    /**
+     * Fills a given span with slices of the next pieces of available data, starting with the one
+     * peek() would return.
+     *
+     * \param slices  Span to store the slices in.
+     * \return Number of slices stored, 0 if no data is available.
+     */
+    virtual size_t peekMany(::etl::span<::etl::span<uint8_t>> slices) const = 0;
+
+    /**
+     * Releases the next count pieces of data, or all available ones if less are available.
+     *
+     * Like release(), calling releaseMany() makes a new call to peek() or peekMany() mandatory.
+     */
+    virtual void releaseMany(size_t count) = 0;
+    // [PUBLICAPI_END]
+};
+
+} // namespace io
@@ -0,0 +1,36 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include "io/IWriter.h"
+
+namespace io
+{
+/**
+ * Extension of IWriter for writers which can make several slices available to the reader at
+ * once.
+ */
+class IBatchWriter : public IWriter
+{
+public:
+    // [PUBLICAPI_START]
+    /**
+     * Commits the previously allocated slice without making it available for the reader.
+     *
+     * The slice becomes available with the next call to flush() or commit(), together with all
+     * other slices committed by commitDeferred() since then. Like commit(), calling
+     * commitDeferred() makes a new allocation mandatory.
+     */
+    virtual void commitDeferred() = 0;
+    // [PUBLICAPI_END]
+};
+
+} // namespace io
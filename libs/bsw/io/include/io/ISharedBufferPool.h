@@ -0,0 +1,71 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <etl/limits.h>
+#include <etl/span.h>
+
+namespace io
+{
+/**
+ * Interface for a pool of reference counted buffers.
+ *
+ * A producer writes data once into a buffer and hands out a small handle to each consumer
+ * instead of a copy of the data. The buffer is returned to the pool when the last consumer
+ * releases it.
+ */
+class ISharedBufferPool
+{
+public:
+    using Handle = size_t;
+
+    static constexpr Handle INVALID_HANDLE = ::etl::numeric_limits<Handle>::max();
+
+    virtual ~ISharedBufferPool() = default;
+
+    ISharedBufferPool& operator=(ISharedBufferPool const&) = delete;
+
+    // [PUBLICAPI_START]
+    /**
+     * Returns the maximum number of bytes that can be allocated in one buffer.
+     */
+    virtual size_t maxSize() const = 0;
+
+    /**
+     * Allocates a buffer of a given number of bytes for the producer. A buffer of 0 bytes can be
+     * allocated, e.g. for an empty PDU, and takes a slot like any other buffer.
+     * \return - Handle of the buffer if a buffer was free and size <= maxSize()
+     *         - INVALID_HANDLE otherwise
+     */
+    virtual Handle allocate(size_t size) = 0;
+
+    /**
+     * Returns the bytes of an allocated or committed buffer. For an invalid handle, the slice is
+     * empty and its data pointer is null, which distinguishes it from a buffer of 0 bytes.
+     */
+    virtual ::etl::span<uint8_t> data(Handle handle) = 0;
+
+    /**
+     * Hands the allocated buffer over to numConsumers consumers, each of which has to call
+     * release() once. The producer must not access the buffer after a call to commit(). Committing
+     * to 0 consumers returns the buffer to the pool immediately.
+     */
+    virtual void commit(Handle handle, size_t numConsumers) = 0;
+
+    /**
+     * Drops the reference of one consumer. The buffer is returned to the pool when the last
+     * consumer has released it.
+     */
+    virtual void release(Handle handle) = 0;
+    // [PUBLICAPI_END]
+};
+
+} // namespace io
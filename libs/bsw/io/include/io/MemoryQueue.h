@@ -10,8 +10,8 @@
 
 #pragma once
 
-#include "io/IReader.h"
-#include "io/IWriter.h"
+#include "io/IBatchReader.h"
+#include "io/IBatchWriter.h"
 
 #include <etl/algorithm.h>
 #include <etl/array.h>
@@ -44,6 +44,11 @@ namespace io
  * \section Concurrency
  * This MemoryQueue is designed as a lock free single producer single consumer queue.
  *
+ * \section Batching
+ * The Writer can commit several allocations with commitDeferred() and make all of them available
+ * to the Reader with a single update of the shared write index in flush(). The Reader can peek
+ * all available entries with peekAll() or peekMany() and release them with a single update of the
+ * shared read index.
  */
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE = uint16_t>
 class MemoryQueue
@@ -63,8 +68,10 @@ class MemoryQueue
         ::etl::array<uint8_t, CAPACITY> data;
         size_t allocated{0U};
         size_t minAvailable{CAPACITY};
+        // Write index including deferred commits, only used by the Writer.
+        size_t pending{0U};
 
-        size_t available(RxData const& rxData) const;
+        size_t available(size_t writeIndex, RxData const& rxData) const;
     };
 
     TxData tx;
@@ -133,10 +140,24 @@ public:
         ::etl::span<uint8_t> allocate(size_t size) const;
 
         /**
-         * Makes the previously allocated data available for the Reader.
+         * Makes the previously allocated data and all data committed with commitDeferred()
+         * available for the Reader.
          */
         void commit();
 
+        /**
+         * Commits the previously allocated data without making it available for the Reader.
+         * Subsequent allocations continue after it. The data is made available by the next call
+         * to flush() or commit().
+         */
+        void commitDeferred();
+
+        /**
+         * Makes all data committed with commitDeferred() available for the Reader with a single
+         * update of the shared write index.
+         */
+        void flush();
+
         /**
          * Returns the number of contiguous bytes that can be allocated next.
          *
@@ -180,6 +201,43 @@ public:
     class Reader
     {
     public:
+        /**
+         * Range of the entries which were available at the time of a call to peekAll().
+         */
+        class Slices
+        {
+        public:
+            class const_iterator
+            {
+            public:
+                ::etl::span<uint8_t> operator*() const;
+                const_iterator& operator++();
+                bool operator==(const_iterator const& other) const;
+                bool operator!=(const_iterator const& other) const;
+
+            private:
+                friend class Slices;
+
+                const_iterator(TxData& txData, size_t index);
+
+                TxData* _txData;
+                size_t _index;
+            };
+
+            const_iterator begin() const;
+            const_iterator end() const;
+            bool empty() const;
+
+        private:
+            friend class Reader;
+
+            Slices(TxData& txData, size_t begin, size_t end);
+
+            TxData* _txData;
+            size_t _begin;
+            size_t _end;
+        };
+
         // [PUBLIC_API_READER_BEGIN]
         /**
          * Constructs a Reader from a given queue.
@@ -210,6 +268,32 @@ public:
          */
         void clear() const;
 
+        /**
+         * Returns a range over all entries currently available. The entries stay valid until they
+         * are released.
+         */
+        Slices peekAll() const;
+
+        /**
+         * Releases all entries of a range returned by the last call to peekAll() with a single
+         * update of the shared read index. If entries have been released since that call, calling
+         * this function has no effect.
+         */
+        void releaseAll(Slices const& slices) const;
+
+        /**
+         * Fills a given span with the next available entries.
+         *
+         * \param slices  Span to store the entries in.
+         * \return Number of entries stored in slices.
+         */
+        size_t peekMany(::etl::span<::etl::span<uint8_t>> slices) const;
+
+        /**
+         * Releases up to count entries with a single update of the shared read index.
+         */
+        void releaseMany(size_t count) const;
+
         /**
          * Returns the maximum size of which a slice of bytes can be read.
          */
@@ -226,6 +310,8 @@ public:
         size_t available() const;
         // [PUBLIC_API_READER_END]
     private:
+        static ::etl::span<uint8_t> entryAt(TxData& txData, size_t index);
+
         TxData& _txData;
         RxData& _rxData;
     };
@@ -254,13 +340,20 @@ MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::allocate(size_t cons
     {
         return {};
     }
-    size_t const index = _txData.sent.load() % CAPACITY;
+    size_t const index = _txData.pending % CAPACITY;
     _txData.allocated  = size;
     return ::etl::span<uint8_t>(&_txData.data[index + sizeof(SIZE_TYPE)], size);
 }
 
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
-void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::commit()
+inline void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::commit()
+{
+    commitDeferred();
+    flush();
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::commitDeferred()
 {
     // Prevent accidentally committing random data if allocate has not been called or
     // previous allocation was unsuccessful.
@@ -268,22 +361,29 @@ void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::commit()
     {
         return;
     }
-    size_t writeIndex    = _txData.sent.load();
-    size_t const index   = writeIndex % CAPACITY;
+    size_t const index   = _txData.pending % CAPACITY;
     SIZE_TYPE const size = static_cast<SIZE_TYPE>(_txData.allocated);
     ::etl::unaligned_type_ext<SIZE_TYPE, etl::endian::big>{&_txData.data[index]}
     = static_cast<SIZE_TYPE>(size);
 
-    writeIndex        = advanceIndex(writeIndex, size);
+    _txData.pending   = advanceIndex(_txData.pending, size);
     _txData.allocated = 0U;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::flush()
+{
     // Store writeIndex last to ensure data consistency.
-    _txData.sent.store(writeIndex);
+    if (_txData.sent.load() != _txData.pending)
+    {
+        _txData.sent.store(_txData.pending);
+    }
 }
 
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
 inline size_t MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::available() const
 {
-    return _txData.available(_rxData);
+    return _txData.available(_txData.pending, _rxData);
 }
 
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
@@ -361,6 +461,57 @@ inline void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::clear()
     }
 }
 
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline typename MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices
+MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::peekAll() const
+{
+    return Slices(_txData, _rxData.received.load(), _txData.sent.load());
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline void
+MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::releaseAll(Slices const& slices) const
+{
+    if ((slices._txData == &_txData) && (slices._begin == _rxData.received.load()))
+    {
+        _rxData.received.store(slices._end);
+    }
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+size_t MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::peekMany(
+    ::etl::span<::etl::span<uint8_t>> const slices) const
+{
+    size_t const writeIndex = _txData.sent.load();
+    size_t readIndex        = _rxData.received.load();
+    size_t count            = 0U;
+    while ((count < slices.size()) && (readIndex != writeIndex))
+    {
+        slices[count] = entryAt(_txData, readIndex);
+        readIndex     = advanceIndex(readIndex, slices[count].size());
+        ++count;
+    }
+    return count;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+void MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::releaseMany(size_t count) const
+{
+    size_t const writeIndex = _txData.sent.load();
+    size_t readIndex        = _rxData.received.load();
+    size_t const oldIndex   = readIndex;
+    while ((count > 0U) && (readIndex != writeIndex))
+    {
+        readIndex = advanceIndex(readIndex, entryAt(_txData, readIndex).size());
+        --count;
+    }
+    if (readIndex != oldIndex)
+    {
+        // Store readIndex last to ensure data consistency.
+        _rxData.received.store(readIndex);
+    }
+}
+
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
 inline size_t MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::maxSize() const
 {
@@ -370,15 +521,88 @@ inline size_t MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::maxSiz
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
 inline size_t MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::available() const
 {
-    return _txData.available(_rxData);
+    return _txData.available(_txData.sent.load(), _rxData);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline ::etl::span<uint8_t>
+MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::entryAt(TxData& txData, size_t index)
+{
+    index = index % CAPACITY;
+    SIZE_TYPE const size
+        = ::etl::unaligned_type<SIZE_TYPE, ::etl::endian::big>(&txData.data[index]);
+    return ::etl::span<uint8_t>(&txData.data[index + sizeof(SIZE_TYPE)], size);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices::Slices(
+    TxData& txData, size_t const begin, size_t const end)
+: _txData(&txData), _begin(begin), _end(end)
+{}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline typename MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices::const_iterator
+MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices::begin() const
+{
+    return const_iterator(*_txData, _begin);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline typename MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices::const_iterator
+MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices::end() const
+{
+    return const_iterator(*_txData, _end);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline bool MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices::empty() const
+{
+    return _begin == _end;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices::const_iterator::
+    const_iterator(TxData& txData, size_t const index)
+: _txData(&txData), _index(index)
+{}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline ::etl::span<uint8_t>
+MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices::const_iterator::operator*()
+    const
+{
+    return entryAt(*_txData, _index);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline typename MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices::const_iterator&
+MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices::const_iterator::operator++()
+{
+    _index = advanceIndex(_index, entryAt(*_txData, _index).size());
+    return *this;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline bool
+MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices::const_iterator::operator==(
+    const_iterator const& other) const
+{
+    return _index == other._index;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline bool
+MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Slices::const_iterator::operator!=(
+    const_iterator const& other) const
+{
+    return _index != other._index;
 }
 
 template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
-size_t
-MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::TxData::available(RxData const& rxData) const
+size_t MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::TxData::available(
+    size_t const writeIndex, RxData const& rxData) const
 {
-    size_t const writeIndex = sent.load();
-    size_t const readIndex  = rxData.received.load();
+    size_t const readIndex = rxData.received.load();
 
     size_t usedBytes;
     if (writeIndex < readIndex)
@@ -399,13 +623,13 @@ MemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::TxData::available(RxData con
 }
 
 /**
- * Implementation of IWriter for MemoryQueue.
+ * Implementation of IBatchWriter for MemoryQueue.
  * [TPARAMS_MQW_BEGIN]
  * \tparam Queue Type of queue to write data to.
  * [TPARAMS_MQW_END]
  */
 template<class Queue>
-class MemoryQueueWriter : public IWriter
+class MemoryQueueWriter : public IBatchWriter
 {
 public:
     // [PUBLIC_API_MQW_BEGIN]
@@ -423,6 +647,9 @@ public:
     /** \see IWriter::commit() */
     void commit() override;
 
+    /** \see IBatchWriter::commitDeferred() */
+    void commitDeferred() override;
+
     /** \see IWriter::flush() */
     void flush() override;
 
@@ -461,9 +688,17 @@ inline void MemoryQueueWriter<Queue>::commit()
     _writer.commit();
 }
 
+template<class Queue>
+inline void MemoryQueueWriter<Queue>::commitDeferred()
+{
+    _writer.commitDeferred();
+}
+
 template<class Queue>
 inline void MemoryQueueWriter<Queue>::flush()
-{}
+{
+    _writer.flush();
+}
 
 template<class Queue>
 inline size_t MemoryQueueWriter<Queue>::available() const
@@ -484,13 +719,13 @@ inline void MemoryQueueWriter<Queue>::resetMinAvailable()
 }
 
 /**
- * Implementation of IReader for a MemoryQueue.
+ * Implementation of IBatchReader for a MemoryQueue.
  * [TPARAMS_MQR_BEGIN]
  * \tparam Queue Type of queue to read data from.
  * [TPARAMS_MQR_END]
  */
 template<class Queue>
-class MemoryQueueReader : public IReader
+class MemoryQueueReader : public IBatchReader
 {
 public:
     // [PUBLIC_API_MQR_BEGIN]
@@ -508,6 +743,12 @@ public:
     /** \see MemoryQueueReader::release() */
     void release() override;
 
+    /** \see IBatchReader::peekMany() */
+    size_t peekMany(::etl::span<::etl::span<uint8_t>> slices) const override;
+
+    /** \see IBatchReader::releaseMany() */
+    void releaseMany(size_t count) override;
+
     /** \see Queue::Reader::available() */
     size_t available() const;
     // [PUBLIC_API_MQR_END]
@@ -537,6 +778,19 @@ inline void MemoryQueueReader<Queue>::release()
     _reader.release();
 }
 
+template<class Queue>
+inline size_t MemoryQueueReader<Queue>::peekMany(
+    ::etl::span<::etl::span<uint8_t>> const slices) const
+{
+    return _reader.peekMany(slices);
+}
+
+template<class Queue>
+inline void MemoryQueueReader<Queue>::releaseMany(size_t const count)
+{
+    _reader.releaseMany(count);
+}
+
 template<class Queue>
 inline size_t MemoryQueueReader<Queue>::available() const
 {
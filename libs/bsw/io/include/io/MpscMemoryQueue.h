@@ -0,0 +1,597 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <etl/algorithm.h>
+#include <etl/array.h>
+#include <etl/atomic.h>
+#include <etl/span.h>
+#include <etl/unaligned_type.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace io
+{
+
+/**
+ * Lock free multi producer single consumer queue of variable size slices.
+ * [TPARAMS_BEGIN]
+ * \tparam CAPACITY Number of bytes that this MpscMemoryQueue shall provide.
+ * \tparam MAX_ELEMENT_SIZE Maximum size of one allocation
+ * \tparam SIZE_TYPE Type used to store size of allocation internally
+ * [TPARAMS_END]
+ *
+ * \section Memory overhead
+ * Each allocation is preceded by a header of 2 * sizeof(SIZE_TYPE) bytes and padded to a multiple
+ * of the header size. In addition, one commit flag bit per header size bytes of CAPACITY is used.
+ *
+ * \section Alignment
+ * The current implementation makes no assumptions about alignment. This is why the header of an
+ * allocation is serialized using ::etl::unaligned_type<>.
+ *
+ * \section Concurrency
+ * Each producer uses its own Writer. Memory is reserved with a compare and swap on the shared
+ * write index, so producers running in different tasks or ISRs can write into the same queue.
+ * A Writer must not be used concurrently from more than one context.
+ *
+ * Entries are read in the order of their reservation. commit() sets a per entry flag, the Reader
+ * only returns an entry after its flag has been set. A producer that is preempted between
+ * allocate() and commit() therefore delays all entries reserved after it, so the time between
+ * both calls should be kept short.
+ */
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE = uint16_t>
+class MpscMemoryQueue
+{
+    static constexpr size_t HEADER_SIZE = 2 * sizeof(SIZE_TYPE);
+
+    static constexpr size_t footprint(size_t const size)
+    {
+        return HEADER_SIZE + (((size + HEADER_SIZE) - 1U) / HEADER_SIZE) * HEADER_SIZE;
+    }
+
+    static constexpr size_t NUM_FLAGS      = CAPACITY / HEADER_SIZE;
+    static constexpr size_t FLAGS_PER_WORD = 32U;
+
+    static_assert((CAPACITY % HEADER_SIZE) == 0U, "");
+    static_assert(MAX_ELEMENT_SIZE > 0U, "");
+    static_assert(CAPACITY >= footprint(MAX_ELEMENT_SIZE), "");
+
+    ::etl::atomic<size_t> _reserved{0U};
+    ::etl::atomic<size_t> _received{0U};
+    ::etl::atomic<size_t> _minAvailable{CAPACITY};
+    ::etl::array<::etl::atomic<uint32_t>, (NUM_FLAGS + FLAGS_PER_WORD - 1U) / FLAGS_PER_WORD>
+        _committed{};
+    ::etl::array<uint8_t, CAPACITY> _data;
+
+    static size_t advanceIndex(size_t index, size_t const size)
+    {
+        index = (index + footprint(size)) % (2 * CAPACITY);
+
+        // Check if enough contiguous space is available at the end of the array and wrap
+        // otherwise skipping the too small piece of memory.
+        size_t const space = (((2 * CAPACITY) - index) % CAPACITY);
+        if (space < footprint(MAX_ELEMENT_SIZE))
+        {
+            index = (index + space) % (2 * CAPACITY);
+        }
+        return index;
+    }
+
+    bool getFreeBytes(size_t writeIndex, size_t& freeBytes) const;
+    size_t available() const;
+    void updateMinAvailable(size_t freeBytes);
+
+    bool isCommitted(size_t index) const;
+    void setCommitted(size_t index);
+    void clearCommitted(size_t index);
+
+    ::etl::unaligned_type_ext<SIZE_TYPE, ::etl::endian::big> reservedSizeAt(size_t index)
+    {
+        return ::etl::unaligned_type_ext<SIZE_TYPE, ::etl::endian::big>{&_data[index]};
+    }
+
+    ::etl::unaligned_type_ext<SIZE_TYPE, ::etl::endian::big> sizeAt(size_t index)
+    {
+        return ::etl::unaligned_type_ext<SIZE_TYPE, ::etl::endian::big>{
+            &_data[index + sizeof(SIZE_TYPE)]};
+    }
+
+public:
+    // [PUBLIC_TYPES_BEGIN]
+    /** Type of the size information stored for each entry. */
+    using size_type = SIZE_TYPE;
+
+    // [PUBLIC_TYPES_END]
+
+    // [PUBLIC_API_BEGIN]
+    /**
+     * Returns the capacity of the underlying array of data managed by this MpscMemoryQueue.
+     */
+    static constexpr size_t capacity() { return CAPACITY; }
+
+    /**
+     * Returns the maximum size of one allocation.
+     */
+    static constexpr size_t maxElementSize() { return MAX_ELEMENT_SIZE; }
+
+    /**
+     * Constructs an MpscMemoryQueue of CAPACITY bytes.
+     */
+    MpscMemoryQueue() = default;
+
+    // [PUBLIC_API_END]
+
+    /**
+     * The Writer side of an MpscMemoryQueue provides API to insert data in the queue. Each
+     * producer needs its own Writer.
+     */
+    class Writer
+    {
+    public:
+        // [PUBLIC_API_WRITER_BEGIN]
+        /**
+         * Constructs a Writer to a given queue.
+         */
+        explicit Writer(MpscMemoryQueue& queue);
+
+        /**
+         * Reserves a requested number of bytes and returns them as a slice. This function can be
+         * called multiple times before calling commit(). A reallocation which is not greater than
+         * the current reservation trims the reservation, a greater one discards the current
+         * reservation and reserves new memory.
+         *
+         * \param size  Number of bytes to allocate from this MpscMemoryQueue.
+         * \return  - Empty slice, if requested size was greater as MAX_ELEMENT_SIZE or no memory
+         *            is available
+         *          - Slice of size bytes otherwise.
+         */
+        ::etl::span<uint8_t> allocate(size_t size);
+
+        /**
+         * Makes the previously allocated data available for the Reader.
+         */
+        void commit();
+
+        /**
+         * Same as commit(). Each entry is published by its own commit flag, so deferring the
+         * publication would not save any atomic operation.
+         */
+        void commitDeferred();
+
+        /**
+         * Empty function, committed data is available for the Reader immediately.
+         */
+        void flush();
+
+        /**
+         * Returns the number of contiguous bytes that can be allocated next.
+         */
+        size_t available() const;
+
+        /**
+         * Returns the minimum number of available bytes at the time of an allocate call of any
+         * Writer since the last reset using resetMinAvailable().
+         */
+        size_t minAvailable() const;
+
+        /**
+         * Resets the minimum number of available bytes to the current number of available bytes.
+         */
+        void resetMinAvailable();
+
+        /**
+         * The MpscMemoryQueue is considered full if less than footprint(MAX_ELEMENT_SIZE) bytes
+         * are available as a contiguous piece of memory.
+         */
+        bool full() const;
+
+        /**
+         * Returns the maximum size of which a slice of bytes can be allocated.
+         */
+        size_t maxSize() const;
+        // [PUBLIC_API_WRITER_END]
+    private:
+        void discard();
+
+        MpscMemoryQueue& _queue;
+        size_t _index{0U};
+        size_t _reserved{0U};
+        size_t _allocated{0U};
+    };
+
+    /**
+     * The Reader side of an MpscMemoryQueue provides API to read data from the queue.
+     */
+    class Reader
+    {
+    public:
+        // [PUBLIC_API_READER_BEGIN]
+        /**
+         * Constructs a Reader from a given queue.
+         */
+        explicit Reader(MpscMemoryQueue& queue);
+
+        /**
+         * Returns true if no committed data is available.
+         *
+         * Calling peek() on an empty queue will return an empty slice.
+         */
+        bool empty() const;
+
+        /**
+         * Returns a slice of bytes pointing to the next committed memory chunk of the
+         * MpscMemoryQueue, if available. Calling peek on an empty MpscMemoryQueue will return an
+         * empty slice.
+         */
+        ::etl::span<uint8_t> peek() const;
+
+        /**
+         * Releases the first committed chunk of memory. If the Reader is empty, calling this
+         * function has no effect.
+         */
+        void release() const;
+
+        /**
+         * Releases all entries until empty() returns true.
+         */
+        void clear() const;
+
+        /**
+         * Fills a given span with the next committed entries.
+         *
+         * \param slices  Span to store the entries in.
+         * \return Number of entries stored in slices.
+         */
+        size_t peekMany(::etl::span<::etl::span<uint8_t>> slices) const;
+
+        /**
+         * Releases up to count committed entries with a single update of the shared read index.
+         */
+        void releaseMany(size_t count) const;
+
+        /**
+         * Returns the maximum size of which a slice of bytes can be read.
+         */
+        size_t maxSize() const;
+
+        /**
+         * Returns the number of contiguous bytes that can be allocated next.
+         */
+        size_t available() const;
+        // [PUBLIC_API_READER_END]
+    private:
+        void skipDiscarded() const;
+
+        MpscMemoryQueue& _queue;
+    };
+};
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::Writer(
+    MpscMemoryQueue& queue)
+: _queue(queue)
+{}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+::etl::span<uint8_t>
+MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::allocate(size_t const size)
+{
+    if ((size > MAX_ELEMENT_SIZE) || (size == 0))
+    {
+        discard();
+        return {};
+    }
+    if (size <= _reserved)
+    {
+        _allocated = size;
+        return ::etl::span<uint8_t>(&_queue._data[_index + HEADER_SIZE], size);
+    }
+    discard();
+
+    size_t writeIndex = _queue._reserved.load();
+    while (true)
+    {
+        size_t freeBytes;
+        if (!_queue.getFreeBytes(writeIndex, freeBytes))
+        {
+            // Other producers have reserved memory and the Reader has released it meanwhile.
+            writeIndex = _queue._reserved.load();
+        }
+        else if (freeBytes == 0U)
+        {
+            // The queue is only full if no other producer has reserved memory meanwhile.
+            size_t const currentIndex = _queue._reserved.load();
+            if (currentIndex == writeIndex)
+            {
+                _queue.updateMinAvailable(0U);
+                return {};
+            }
+            writeIndex = currentIndex;
+        }
+        else if (_queue._reserved.compare_exchange_weak(
+                     writeIndex, advanceIndex(writeIndex, size)))
+        {
+            _queue.updateMinAvailable(freeBytes);
+            break;
+        }
+    }
+
+    _index    = writeIndex % CAPACITY;
+    _reserved = size;
+    // The reserved size is needed by the Reader to advance, it doesn't change until commit.
+    _queue.reservedSizeAt(_index) = static_cast<SIZE_TYPE>(size);
+    _allocated                    = size;
+    return ::etl::span<uint8_t>(&_queue._data[_index + HEADER_SIZE], size);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::commit()
+{
+    // Prevent accidentally committing random data if allocate has not been called or
+    // previous allocation was unsuccessful.
+    if (_allocated == 0U)
+    {
+        return;
+    }
+    _queue.sizeAt(_index) = static_cast<SIZE_TYPE>(_allocated);
+    _allocated            = 0U;
+    _reserved             = 0U;
+    // Set the commit flag last to ensure data consistency.
+    _queue.setCommitted(_index);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::commitDeferred()
+{
+    commit();
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::flush()
+{}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::discard()
+{
+    // A reservation can't be given back as other producers may have reserved memory after it.
+    // It is committed with size zero instead, which makes the Reader skip it.
+    if (_reserved == 0U)
+    {
+        return;
+    }
+    _queue.sizeAt(_index) = 0U;
+    _allocated            = 0U;
+    _reserved             = 0U;
+    _queue.setCommitted(_index);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline size_t MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::available() const
+{
+    return _queue.available();
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline size_t MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::minAvailable() const
+{
+    return _queue._minAvailable.load();
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::resetMinAvailable()
+{
+    _queue._minAvailable.store(available());
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline bool MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::full() const
+{
+    return available() == 0;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline size_t MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Writer::maxSize() const
+{
+    return MAX_ELEMENT_SIZE;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::Reader(
+    MpscMemoryQueue& queue)
+: _queue(queue)
+{}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline bool MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::empty() const
+{
+    skipDiscarded();
+    return !_queue.isCommitted(_queue._received.load() % CAPACITY);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline ::etl::span<uint8_t>
+MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::peek() const
+{
+    if (empty())
+    {
+        return {};
+    }
+    size_t const index   = _queue._received.load() % CAPACITY;
+    SIZE_TYPE const size = _queue.sizeAt(index);
+    return ::etl::span<uint8_t>(&_queue._data[index + HEADER_SIZE], size);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::release() const
+{
+    if (empty())
+    {
+        return;
+    }
+    size_t readIndex     = _queue._received.load();
+    size_t const index   = readIndex % CAPACITY;
+    SIZE_TYPE const size = _queue.reservedSizeAt(index);
+    readIndex            = advanceIndex(readIndex, size);
+    // Clear the commit flag before giving the memory back to the producers.
+    _queue.clearCommitted(index);
+    _queue._received.store(readIndex);
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::clear() const
+{
+    while (!empty())
+    {
+        release();
+    }
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+size_t MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::peekMany(
+    ::etl::span<::etl::span<uint8_t>> const slices) const
+{
+    size_t readIndex = _queue._received.load();
+    size_t count     = 0U;
+    while ((count < slices.size()) && _queue.isCommitted(readIndex % CAPACITY))
+    {
+        size_t const index   = readIndex % CAPACITY;
+        SIZE_TYPE const size = _queue.sizeAt(index);
+        if (size > 0U)
+        {
+            slices[count] = ::etl::span<uint8_t>(&_queue._data[index + HEADER_SIZE], size);
+            ++count;
+        }
+        readIndex = advanceIndex(readIndex, _queue.reservedSizeAt(index));
+    }
+    return count;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::releaseMany(
+    size_t count) const
+{
+    skipDiscarded();
+    size_t readIndex      = _queue._received.load();
+    size_t const oldIndex = readIndex;
+    while ((count > 0U) && _queue.isCommitted(readIndex % CAPACITY))
+    {
+        size_t const index = readIndex % CAPACITY;
+        if (static_cast<SIZE_TYPE>(_queue.sizeAt(index)) > 0U)
+        {
+            --count;
+        }
+        readIndex = advanceIndex(readIndex, _queue.reservedSizeAt(index));
+        _queue.clearCommitted(index);
+    }
+    if (readIndex != oldIndex)
+    {
+        // Store readIndex last, all commit flags are cleared before giving the memory back.
+        _queue._received.store(readIndex);
+    }
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline size_t MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::maxSize() const
+{
+    return MAX_ELEMENT_SIZE;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline size_t MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::available() const
+{
+    return _queue.available();
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::Reader::skipDiscarded() const
+{
+    size_t readIndex = _queue._received.load();
+    size_t index     = readIndex % CAPACITY;
+    while (_queue.isCommitted(index) && (static_cast<SIZE_TYPE>(_queue.sizeAt(index)) == 0U))
+    {
+        SIZE_TYPE const size = _queue.reservedSizeAt(index);
+        readIndex            = advanceIndex(readIndex, size);
+        _queue.clearCommitted(index);
+        _queue._received.store(readIndex);
+        index = readIndex % CAPACITY;
+    }
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+bool MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::getFreeBytes(
+    size_t const writeIndex, size_t& freeBytes) const
+{
+    size_t const readIndex = _received.load();
+
+    size_t usedBytes;
+    if (writeIndex < readIndex)
+    {
+        usedBytes = (writeIndex + (2 * CAPACITY)) - readIndex;
+    }
+    else
+    {
+        usedBytes = writeIndex - readIndex;
+    }
+
+    // A stale writeIndex may lag behind the read index.
+    if (usedBytes > CAPACITY)
+    {
+        return false;
+    }
+    freeBytes = CAPACITY - usedBytes;
+    if (freeBytes < footprint(MAX_ELEMENT_SIZE))
+    {
+        freeBytes = 0;
+    }
+    return true;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+size_t MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::available() const
+{
+    size_t freeBytes;
+    while (!getFreeBytes(_reserved.load(), freeBytes)) {}
+    return freeBytes;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::updateMinAvailable(
+    size_t const freeBytes)
+{
+    size_t current = _minAvailable.load();
+    while ((freeBytes < current) && !_minAvailable.compare_exchange_weak(current, freeBytes)) {}
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline bool
+MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::isCommitted(size_t const index) const
+{
+    size_t const flag = index / HEADER_SIZE;
+    return (_committed[flag / FLAGS_PER_WORD].load() & (1U << (flag % FLAGS_PER_WORD))) != 0U;
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline void MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::setCommitted(size_t const index)
+{
+    size_t const flag = index / HEADER_SIZE;
+    (void)_committed[flag / FLAGS_PER_WORD].fetch_or(1U << (flag % FLAGS_PER_WORD));
+}
+
+template<size_t CAPACITY, size_t MAX_ELEMENT_SIZE, typename SIZE_TYPE>
+inline void
+MpscMemoryQueue<CAPACITY, MAX_ELEMENT_SIZE, SIZE_TYPE>::clearCommitted(size_t const index)
+{
+    size_t const flag = index / HEADER_SIZE;
+    (void)_committed[flag / FLAGS_PER_WORD].fetch_and(~(1U << (flag % FLAGS_PER_WORD)));
+}
+
+} // namespace io
@@ -0,0 +1,180 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include "io/ISharedBufferPool.h"
+
+#include <etl/array.h>
+#include <etl/atomic.h>
+#include <etl/limits.h>
+#include <etl/span.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace io
+{
+/**
+ * Lock free pool of reference counted slots of a fixed maximum size.
+ * [TPARAMS_BEGIN]
+ * \tparam NUM_SLOTS Number of slots that this SharedBufferPool shall provide.
+ * \tparam SLOT_SIZE Maximum size of one allocation
+ * [TPARAMS_END]
+ *
+ * \section Memory overhead
+ * Each slot stores an atomic reference count and its size in addition to SLOT_SIZE bytes of data.
+ *
+ * \section Concurrency
+ * A slot is claimed with a compare and swap on its reference count, so producers running in
+ * different contexts can share one pool. The reference count is decremented atomically, so
+ * consumers may call release() from any context.
+ */
+template<size_t NUM_SLOTS, size_t SLOT_SIZE>
+class SharedBufferPool : public ISharedBufferPool
+{
+    static_assert(NUM_SLOTS > 0U, "");
+    // a non-empty array also gives buffers of 0 bytes a data pointer
+    static_assert(SLOT_SIZE > 0U, "");
+
+    static constexpr size_t FREE     = 0U;
+    static constexpr size_t RESERVED = ::etl::numeric_limits<size_t>::max();
+
+    struct Slot
+    {
+        ::etl::atomic<size_t> refCount{FREE};
+        size_t size{0U};
+        ::etl::array<uint8_t, SLOT_SIZE> data;
+    };
+
+public:
+    // [PUBLIC_API_BEGIN]
+    /**
+     * Returns the number of slots managed by this SharedBufferPool.
+     */
+    static constexpr size_t numSlots() { return NUM_SLOTS; }
+
+    /**
+     * Constructs a SharedBufferPool with all slots free.
+     */
+    SharedBufferPool() = default;
+
+    /** \see ISharedBufferPool::maxSize() */
+    size_t maxSize() const override;
+
+    /** \see ISharedBufferPool::allocate() */
+    Handle allocate(size_t size) override;
+
+    /** \see ISharedBufferPool::data() */
+    ::etl::span<uint8_t> data(Handle handle) override;
+
+    /** \see ISharedBufferPool::commit() */
+    void commit(Handle handle, size_t numConsumers) override;
+
+    /** \see ISharedBufferPool::release() */
+    void release(Handle handle) override;
+
+    /**
+     * Returns the number of free slots.
+     */
+    size_t available() const;
+    // [PUBLIC_API_END]
+
+private:
+    ::etl::array<Slot, NUM_SLOTS> _slots;
+    ::etl::atomic<size_t> _nextSlot{0U};
+};
+
+template<size_t NUM_SLOTS, size_t SLOT_SIZE>
+inline size_t SharedBufferPool<NUM_SLOTS, SLOT_SIZE>::maxSize() const
+{
+    return SLOT_SIZE;
+}
+
+template<size_t NUM_SLOTS, size_t SLOT_SIZE>
+typename SharedBufferPool<NUM_SLOTS, SLOT_SIZE>::Handle
+SharedBufferPool<NUM_SLOTS, SLOT_SIZE>::allocate(size_t const size)
+{
+    if (size > SLOT_SIZE)
+    {
+        return INVALID_HANDLE;
+    }
+    // Start searching after the last allocated slot, which is most likely free by now.
+    size_t const first = _nextSlot.load();
+    for (size_t i = 0U; i < NUM_SLOTS; ++i)
+    {
+        size_t const index = (first + i) % NUM_SLOTS;
+        size_t expected    = FREE;
+        if (_slots[index].refCount.compare_exchange_strong(expected, RESERVED))
+        {
+            _slots[index].size = size;
+            _nextSlot.store((index + 1U) % NUM_SLOTS);
+            return index;
+        }
+    }
+    return INVALID_HANDLE;
+}
+
+template<size_t NUM_SLOTS, size_t SLOT_SIZE>
+::etl::span<uint8_t> SharedBufferPool<NUM_SLOTS, SLOT_SIZE>::data(Handle const handle)
+{
+    if ((handle >= NUM_SLOTS) || (_slots[handle].refCount.load() == FREE))
+    {
+        return {};
+    }
+    return ::etl::span<uint8_t>(_slots[handle].data.data(), _slots[handle].size);
+}
+
+template<size_t NUM_SLOTS, size_t SLOT_SIZE>
+void SharedBufferPool<NUM_SLOTS, SLOT_SIZE>::commit(Handle const handle, size_t const numConsumers)
+{
+    // Only a slot reserved by allocate() can be handed over, and only once.
+    if ((handle >= NUM_SLOTS) || (_slots[handle].refCount.load() != RESERVED)
+        || (numConsumers == RESERVED))
+    {
+        return;
+    }
+    _slots[handle].refCount.store(numConsumers);
+}
+
+template<size_t NUM_SLOTS, size_t SLOT_SIZE>
+void SharedBufferPool<NUM_SLOTS, SLOT_SIZE>::release(Handle const handle)
+{
+    if (handle >= NUM_SLOTS)
+    {
+        return;
+    }
+    auto& refCount = _slots[handle].refCount;
+    size_t current = refCount.load();
+    // Ignore releasing a free slot or a slot which hasn't been committed yet.
+    while ((current != FREE) && (current != RESERVED))
+    {
+        if (refCount.compare_exchange_strong(current, current - 1U))
+        {
+            return;
+        }
+    }
+}
+
+template<size_t NUM_SLOTS, size_t SLOT_SIZE>
+size_t SharedBufferPool<NUM_SLOTS, SLOT_SIZE>::available() const
+{
+    size_t count = 0U;
+    for (auto const& slot : _slots)
+    {
+        if (slot.refCount.load() == FREE)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+} // namespace io
@@ -868,4 +868,123 @@ TEST_F(MemoryQueueTest, Example1)
     // [example1]
 }
 
+/**
+ * \desc
+ * Data committed with commitDeferred() is made available to the Reader with the next flush() or
+ * commit(). Subsequent allocations continue after deferred data.
+ */
+TEST_F(MemoryQueueTest, commit_deferred_is_published_by_flush)
+{
+    auto b = _w.allocate(1);
+    ASSERT_EQ(1U, b.size());
+    b[0] = 0x1U;
+    _w.commitDeferred();
+    b = _w.allocate(2);
+    ASSERT_EQ(2U, b.size());
+    b[0] = 0x2U;
+    _w.commitDeferred();
+    EXPECT_TRUE(_r.empty());
+    EXPECT_EQ(QUEUE_SIZE, _r.available());
+    EXPECT_EQ(QUEUE_SIZE - 7U, _w.available());
+
+    _w.flush();
+    ASSERT_FALSE(_r.empty());
+    EXPECT_EQ(1U, _r.peek().size());
+    EXPECT_EQ(0x1U, _r.peek()[0]);
+    _r.release();
+    EXPECT_EQ(2U, _r.peek().size());
+    EXPECT_EQ(0x2U, _r.peek()[0]);
+
+    // commit() publishes deferred data, too
+    _w.allocate(1);
+    _w.commitDeferred();
+    _w.allocate(1);
+    _w.commit();
+    _r.release();
+    EXPECT_EQ(1U, _r.peek().size());
+    _r.release();
+    EXPECT_EQ(1U, _r.peek().size());
+    _r.release();
+    EXPECT_TRUE(_r.empty());
+
+    // commitDeferred() without allocation has no effect
+    _w.commitDeferred();
+    _w.flush();
+    EXPECT_TRUE(_r.empty());
+}
+
+/**
+ * \desc
+ * peekAll() returns all entries available at the time of the call, releaseAll() releases them at
+ * once unless they have been released before.
+ */
+TEST_F(MemoryQueueTest, peek_all_and_release_all)
+{
+    EXPECT_TRUE(_r.peekAll().empty());
+
+    for (uint8_t i = 1U; i <= 3U; ++i)
+    {
+        _w.allocate(1)[0] = i;
+        _w.commit();
+    }
+
+    auto const slices = _r.peekAll();
+    EXPECT_FALSE(slices.empty());
+    // Data committed after peekAll() is not part of the range
+    _w.allocate(1);
+    _w.commit();
+
+    uint8_t expected = 1U;
+    for (auto const slice : slices)
+    {
+        EXPECT_THAT(slice, ElementsAre(expected));
+        ++expected;
+    }
+    EXPECT_EQ(4U, expected);
+
+    _r.releaseAll(slices);
+    EXPECT_EQ(1U, _r.peek().size());
+    // Releasing the same range again has no effect
+    _r.releaseAll(slices);
+    EXPECT_EQ(1U, _r.peek().size());
+    _r.release();
+    EXPECT_TRUE(_r.empty());
+}
+
+/**
+ * \desc
+ * peekMany() fills a span with the next available entries, releaseMany() releases them at once.
+ */
+TEST_F(MemoryQueueTest, peek_many_and_release_many)
+{
+    ::io::MemoryQueueWriter<Q> mqw(_q);
+    ::io::MemoryQueueReader<Q> mqr(_q);
+    ::io::IBatchWriter& w = mqw;
+    ::io::IBatchReader& r = mqr;
+    ::etl::span<uint8_t> slices[2];
+
+    EXPECT_EQ(0U, r.peekMany(slices));
+    for (uint8_t i = 1U; i <= 3U; ++i)
+    {
+        w.allocate(i)[0] = i;
+        w.commitDeferred();
+    }
+    EXPECT_EQ(0U, r.peekMany(slices));
+    w.flush();
+
+    ASSERT_EQ(2U, r.peekMany(slices));
+    EXPECT_EQ(1U, slices[0].size());
+    EXPECT_EQ(2U, slices[1].size());
+    EXPECT_EQ(0x2U, slices[1][0]);
+    r.releaseMany(2U);
+
+    ASSERT_EQ(1U, r.peekMany(slices));
+    EXPECT_EQ(3U, slices[0].size());
+    EXPECT_EQ(r.peek().data(), slices[0].data());
+    // Releasing more entries than available releases all of them
+    r.releaseMany(5U);
+    EXPECT_EQ(0U, r.peekMany(slices));
+    EXPECT_EQ(QUEUE_SIZE, mqw.available());
+}
+
 } // namespace
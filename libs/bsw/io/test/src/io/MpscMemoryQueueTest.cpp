@@ -0,0 +1,358 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "io/MpscMemoryQueue.h"
+
+#include "io/MemoryQueue.h"
+
+#include <etl/memory.h>
+#include <etl/span.h>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+
+namespace
+{
+struct MpscMemoryQueueTest : ::testing::Test
+{
+    static size_t const QUEUE_SIZE       = 32;
+    static size_t const MAX_ELEMENT_SIZE = 8;
+
+    using Q = ::io::MpscMemoryQueue<QUEUE_SIZE, MAX_ELEMENT_SIZE>;
+
+    MpscMemoryQueueTest() : _q(), _w1(_q), _w2(_q), _r(_q) {}
+
+    Q _q;
+    Q::Writer _w1;
+    Q::Writer _w2;
+    Q::Reader _r;
+};
+
+size_t const MpscMemoryQueueTest::QUEUE_SIZE;
+size_t const MpscMemoryQueueTest::MAX_ELEMENT_SIZE;
+
+/**
+ * \desc
+ * A new queue is empty and allocations of invalid size fail.
+ */
+TEST_F(MpscMemoryQueueTest, initial_state_and_invalid_sizes)
+{
+    EXPECT_EQ(QUEUE_SIZE, Q::capacity());
+    EXPECT_EQ(MAX_ELEMENT_SIZE, Q::maxElementSize());
+    EXPECT_EQ(MAX_ELEMENT_SIZE, _w1.maxSize());
+    EXPECT_EQ(MAX_ELEMENT_SIZE, _r.maxSize());
+    EXPECT_TRUE(_r.empty());
+    EXPECT_EQ(0U, _r.peek().size());
+    EXPECT_FALSE(_w1.full());
+    EXPECT_EQ(QUEUE_SIZE, _w1.available());
+    EXPECT_EQ(QUEUE_SIZE, _r.available());
+
+    EXPECT_EQ(0U, _w1.allocate(0).size());
+    EXPECT_EQ(0U, _w1.allocate(MAX_ELEMENT_SIZE + 1).size());
+    _w1.commit();
+    EXPECT_TRUE(_r.empty());
+    // Releasing an empty queue has no effect
+    _r.release();
+    EXPECT_EQ(QUEUE_SIZE, _r.available());
+}
+
+/**
+ * \desc
+ * Entries are read in the order of their reservation. An entry which was reserved first blocks
+ * entries of other writers until it is committed.
+ */
+TEST_F(MpscMemoryQueueTest, entries_are_read_in_reservation_order)
+{
+    auto b1 = _w1.allocate(3);
+    ASSERT_EQ(3U, b1.size());
+    auto b2 = _w2.allocate(5);
+    ASSERT_EQ(5U, b2.size());
+    ::etl::mem_set(b1.begin(), b1.size(), uint8_t(0x11));
+    ::etl::mem_set(b2.begin(), b2.size(), uint8_t(0x22));
+
+    _w2.commit();
+    EXPECT_TRUE(_r.empty());
+    EXPECT_EQ(0U, _r.peek().size());
+
+    _w1.commit();
+    ASSERT_FALSE(_r.empty());
+    EXPECT_THAT(_r.peek(), ElementsAre(0x11, 0x11, 0x11));
+    _r.release();
+    EXPECT_THAT(_r.peek(), ElementsAre(0x22, 0x22, 0x22, 0x22, 0x22));
+    _r.release();
+    EXPECT_TRUE(_r.empty());
+    EXPECT_EQ(QUEUE_SIZE, _w1.available());
+}
+
+/**
+ * \desc
+ * A smaller reallocation trims the reservation, a greater one or an invalid one discards it.
+ * Discarded reservations are skipped by the Reader.
+ */
+TEST_F(MpscMemoryQueueTest, reallocation_trims_or_discards_reservation)
+{
+    ASSERT_EQ(8U, _w1.allocate(8).size());
+    auto b = _w1.allocate(2);
+    ASSERT_EQ(2U, b.size());
+    b[0] = 0xAAU;
+    b[1] = 0xBBU;
+    _w1.commit();
+
+    ASSERT_EQ(2U, _w2.allocate(2).size());
+    b = _w2.allocate(4);
+    ASSERT_EQ(4U, b.size());
+    ::etl::mem_set(b.begin(), b.size(), uint8_t(0xCC));
+    _w2.commit();
+
+    EXPECT_THAT(_r.peek(), ElementsAre(0xAA, 0xBB));
+    _r.release();
+    EXPECT_THAT(_r.peek(), ElementsAre(0xCC, 0xCC, 0xCC, 0xCC));
+    _r.release();
+    EXPECT_TRUE(_r.empty());
+
+    ASSERT_EQ(2U, _w1.allocate(2).size());
+    EXPECT_EQ(0U, _w1.allocate(0).size());
+    _w1.commit();
+    EXPECT_TRUE(_r.empty());
+    EXPECT_EQ(QUEUE_SIZE, _r.available());
+}
+
+/**
+ * \desc
+ * Allocations fail if the queue is full and succeed again after entries have been released.
+ * minAvailable() tracks the allocations of all writers.
+ */
+TEST_F(MpscMemoryQueueTest, full_queue_and_min_available)
+{
+    // Each entry of MAX_ELEMENT_SIZE occupies 4 header and 8 data bytes, the tail is skipped if
+    // less than 12 bytes are left.
+    ASSERT_EQ(MAX_ELEMENT_SIZE, _w1.allocate(MAX_ELEMENT_SIZE).size());
+    _w1.commit();
+    ASSERT_EQ(MAX_ELEMENT_SIZE, _w2.allocate(MAX_ELEMENT_SIZE).size());
+    _w2.commit();
+    EXPECT_TRUE(_w1.full());
+    EXPECT_EQ(0U, _w1.allocate(1).size());
+    EXPECT_EQ(0U, _w2.minAvailable());
+
+    _r.release();
+    EXPECT_FALSE(_w2.full());
+    EXPECT_EQ(12U, _w2.available());
+    _w2.resetMinAvailable();
+    EXPECT_EQ(12U, _w1.minAvailable());
+    ASSERT_EQ(1U, _w2.allocate(1).size());
+    _w2.commit();
+
+    _r.clear();
+    EXPECT_TRUE(_r.empty());
+    EXPECT_EQ(QUEUE_SIZE, _w1.available());
+}
+
+/**
+ * \desc
+ * Entries of different sizes of two writers are written repeatedly, wrapping around the end of
+ * the queue many times.
+ */
+TEST_F(MpscMemoryQueueTest, stress_test_with_different_sizes)
+{
+    for (size_t s = 1U; s <= MAX_ELEMENT_SIZE; ++s)
+    {
+        for (uint8_t i = 0U; i < 255; ++i)
+        {
+            auto const b1 = _w1.allocate(s);
+            ASSERT_EQ(s, b1.size()) << "at: " << static_cast<int>(i);
+            auto const b2 = _w2.allocate(MAX_ELEMENT_SIZE + 1U - s);
+            ASSERT_EQ(MAX_ELEMENT_SIZE + 1U - s, b2.size()) << "at: " << static_cast<int>(i);
+            ::etl::mem_set(b1.begin(), b1.size(), i);
+            ::etl::mem_set(b2.begin(), b2.size(), static_cast<uint8_t>(~i));
+            _w2.commit();
+            _w1.commit();
+
+            auto b = _r.peek();
+            EXPECT_EQ(s, b.size());
+            EXPECT_THAT(b, Each(Eq(i)));
+            _r.release();
+            b = _r.peek();
+            EXPECT_EQ(MAX_ELEMENT_SIZE + 1U - s, b.size());
+            EXPECT_THAT(b, Each(Eq(static_cast<uint8_t>(~i))));
+            _r.release();
+            ASSERT_TRUE(_r.empty());
+        }
+    }
+}
+
+/**
+ * \desc
+ * MpscMemoryQueue can be used with MemoryQueueWriter and MemoryQueueReader.
+ */
+TEST_F(MpscMemoryQueueTest, WriterReader_use_cases)
+{
+    ::io::MemoryQueueWriter<Q> mqw1(_q);
+    ::io::MemoryQueueWriter<Q> mqw2(_q);
+    ::io::MemoryQueueReader<Q> mqr(_q);
+    ::io::IWriter& w1 = mqw1;
+    ::io::IWriter& w2 = mqw2;
+    ::io::IReader& r  = mqr;
+
+    EXPECT_EQ(MAX_ELEMENT_SIZE, w1.maxSize());
+    EXPECT_EQ(MAX_ELEMENT_SIZE, r.maxSize());
+    w1.allocate(1)[0] = 1U;
+    w2.allocate(1)[0] = 2U;
+    w1.commit();
+    w2.commit();
+    w1.flush();
+    EXPECT_THAT(r.peek(), ElementsAre(1U));
+    r.release();
+    EXPECT_THAT(r.peek(), ElementsAre(2U));
+    r.release();
+    EXPECT_EQ(0U, r.peek().size());
+    EXPECT_EQ(QUEUE_SIZE, mqw1.available());
+    EXPECT_EQ(QUEUE_SIZE, mqr.available());
+}
+
+/**
+ * \desc
+ * peekMany() and releaseMany() stop at the first entry which is not committed and skip
+ * discarded reservations.
+ */
+TEST_F(MpscMemoryQueueTest, peek_many_and_release_many)
+{
+    using LargeQ = ::io::MpscMemoryQueue<64, MAX_ELEMENT_SIZE>;
+    LargeQ q;
+    LargeQ::Writer w1(q);
+    LargeQ::Writer w2(q);
+    ::io::MemoryQueueWriter<LargeQ> mqw(q);
+    ::io::MemoryQueueReader<LargeQ> mqr(q);
+    ::io::IBatchReader& r = mqr;
+    ::etl::span<uint8_t> slices[3];
+
+    w1.allocate(1)[0] = 1U;
+    w1.commit();
+    ASSERT_EQ(2U, w2.allocate(2).size());
+    EXPECT_EQ(0U, w2.allocate(0).size());
+    mqw.allocate(3)[0] = 3U;
+    mqw.commitDeferred();
+    mqw.flush();
+    ASSERT_EQ(1U, w2.allocate(1).size());
+
+    ASSERT_EQ(2U, r.peekMany(slices));
+    EXPECT_EQ(1U, slices[0].size());
+    EXPECT_EQ(3U, slices[1].size());
+    EXPECT_EQ(0x3U, slices[1][0]);
+    r.releaseMany(3U);
+    EXPECT_EQ(0U, r.peekMany(slices));
+
+    w2.commit();
+    ASSERT_EQ(1U, r.peekMany(slices));
+    r.releaseMany(1U);
+    EXPECT_EQ(0U, r.peek().size());
+    EXPECT_EQ(64U, mqr.available());
+}
+
+/**
+ * \desc
+ * Several producer threads write entries of different sizes while the reader releases them. Each
+ * producer keeps at most IN_FLIGHT entries unread, so there is always enough space and no
+ * allocation must fail, even if a producer retries with a write index that the reader has passed.
+ */
+TEST(MpscMemoryQueueThreadTest, concurrent_producers_and_reader)
+{
+    static size_t const PRODUCER_COUNT       = 4U;
+    static size_t const IN_FLIGHT            = 2U;
+    static size_t const ENTRIES_PER_PRODUCER = 20000U;
+    static size_t const MIN_SIZE             = 5U;
+    static size_t const MAX_SIZE             = 16U;
+
+    // An entry of MAX_SIZE occupies 20 bytes, the skipped tail and the available threshold need
+    // less than 2 more entries.
+    using Queue = ::io::MpscMemoryQueue<(PRODUCER_COUNT * IN_FLIGHT + 2U) * 20U + 16U, MAX_SIZE>;
+    Queue q;
+    Queue::Reader reader(q);
+    std::array<std::atomic<size_t>, PRODUCER_COUNT> read{};
+    std::atomic<size_t> failedAllocations{0U};
+    std::atomic<size_t> minAvailable{Queue::capacity()};
+
+    std::vector<std::thread> producers;
+    for (size_t producer = 0U; producer < PRODUCER_COUNT; ++producer)
+    {
+        producers.emplace_back(
+            [&, producer]()
+            {
+                Queue::Writer writer(q);
+                for (uint32_t sequence = 0U; sequence < ENTRIES_PER_PRODUCER; ++sequence)
+                {
+                    while ((sequence - read[producer].load()) >= IN_FLIGHT)
+                    {
+                        std::this_thread::yield();
+                    }
+                    size_t const size = MIN_SIZE + (sequence % (MAX_SIZE - MIN_SIZE + 1U));
+                    ::etl::span<uint8_t> entry = writer.allocate(size);
+                    while (entry.size() != size)
+                    {
+                        ++failedAllocations;
+                        entry = writer.allocate(size);
+                    }
+                    entry[0] = static_cast<uint8_t>(producer);
+                    ::etl::mem_copy(
+                        reinterpret_cast<uint8_t const*>(&sequence), sizeof(sequence), &entry[1]);
+                    ::etl::mem_set(&entry[5], size - 5U, static_cast<uint8_t>(sequence));
+                    writer.commit();
+                }
+                size_t current = minAvailable.load();
+                while ((writer.minAvailable() < current)
+                       && !minAvailable.compare_exchange_weak(current, writer.minAvailable()))
+                {}
+            });
+    }
+
+    size_t received = 0U;
+    bool valid      = true;
+    while (received < (PRODUCER_COUNT * ENTRIES_PER_PRODUCER))
+    {
+        ::etl::span<uint8_t> const entry = reader.peek();
+        if (entry.size() == 0U)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        size_t const producer = entry[0] % PRODUCER_COUNT;
+        uint32_t sequence;
+        ::etl::mem_copy(&entry[1], sizeof(sequence), reinterpret_cast<uint8_t*>(&sequence));
+        size_t const size = MIN_SIZE + (sequence % (MAX_SIZE - MIN_SIZE + 1U));
+        valid = valid && (entry[0] < PRODUCER_COUNT) && (sequence == read[producer].load()) && (entry.size() == size)
+                && ::std::all_of(
+                    &entry[5],
+                    entry.end(),
+                    [sequence](uint8_t const b) { return b == static_cast<uint8_t>(sequence); });
+        reader.release();
+        read[producer].store(sequence + 1U);
+        ++received;
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_TRUE(valid);
+    EXPECT_EQ(PRODUCER_COUNT * ENTRIES_PER_PRODUCER, received);
+    EXPECT_EQ(0U, failedAllocations.load());
+    EXPECT_LT(0U, minAvailable.load());
+    EXPECT_TRUE(reader.empty());
+}
+
+} // namespace
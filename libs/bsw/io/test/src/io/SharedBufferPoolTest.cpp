@@ -0,0 +1,155 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "io/SharedBufferPool.h"
+
+#include <gmock/gmock.h>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace ::testing;
+
+namespace
+{
+constexpr size_t NUM_SLOTS = 3;
+constexpr size_t SLOT_SIZE = 16;
+
+using Pool = ::io::SharedBufferPool<NUM_SLOTS, SLOT_SIZE>;
+
+/**
+ * \refs:   SMD_io_SharedBufferPool
+ * \desc
+ * A new pool has all slots available and reports the slot size as maximum size.
+ */
+TEST(SharedBufferPoolTest, initial_state)
+{
+    Pool pool;
+    EXPECT_EQ(NUM_SLOTS, pool.available());
+    EXPECT_EQ(NUM_SLOTS, Pool::numSlots());
+    EXPECT_EQ(SLOT_SIZE, pool.maxSize());
+}
+
+/**
+ * \refs:   SMD_io_SharedBufferPool
+ * \desc
+ * Allocations bigger than the slot size fail.
+ */
+TEST(SharedBufferPoolTest, allocate_invalid_size)
+{
+    Pool pool;
+    EXPECT_EQ(::io::ISharedBufferPool::INVALID_HANDLE, pool.allocate(SLOT_SIZE + 1U));
+    EXPECT_EQ(NUM_SLOTS, pool.available());
+}
+
+/**
+ * \refs:   SMD_io_SharedBufferPool
+ * \desc
+ * A buffer of 0 bytes takes a slot and can be told apart from an invalid handle by its data
+ * pointer.
+ */
+TEST(SharedBufferPoolTest, allocate_empty_buffer)
+{
+    Pool pool;
+    auto const handle = pool.allocate(0U);
+    ASSERT_NE(::io::ISharedBufferPool::INVALID_HANDLE, handle);
+    EXPECT_EQ(NUM_SLOTS - 1U, pool.available());
+    EXPECT_EQ(0U, pool.data(handle).size());
+    EXPECT_NE(nullptr, pool.data(handle).data());
+    EXPECT_EQ(nullptr, pool.data(::io::ISharedBufferPool::INVALID_HANDLE).data());
+
+    pool.commit(handle, 1U);
+    pool.release(handle);
+    EXPECT_EQ(NUM_SLOTS, pool.available());
+}
+
+/**
+ * \refs:   SMD_io_SharedBufferPool
+ * \desc
+ * Allocating all slots exhausts the pool, releasing a slot makes it available again.
+ */
+TEST(SharedBufferPoolTest, allocate_until_exhausted)
+{
+    Pool pool;
+    ::io::ISharedBufferPool::Handle handles[NUM_SLOTS];
+    for (size_t i = 0; i < NUM_SLOTS; ++i)
+    {
+        handles[i] = pool.allocate(SLOT_SIZE);
+        ASSERT_NE(::io::ISharedBufferPool::INVALID_HANDLE, handles[i]);
+        EXPECT_EQ(SLOT_SIZE, pool.data(handles[i]).size());
+    }
+    EXPECT_EQ(0U, pool.available());
+    EXPECT_EQ(::io::ISharedBufferPool::INVALID_HANDLE, pool.allocate(1U));
+
+    pool.commit(handles[1], 1U);
+    pool.release(handles[1]);
+    EXPECT_EQ(1U, pool.available());
+    EXPECT_EQ(handles[1], pool.allocate(4U));
+    EXPECT_EQ(4U, pool.data(handles[1]).size());
+}
+
+/**
+ * \refs:   SMD_io_SharedBufferPool
+ * \desc
+ * A committed slot keeps its data until the last consumer has released it.
+ */
+TEST(SharedBufferPoolTest, release_by_last_consumer)
+{
+    Pool pool;
+    auto const handle = pool.allocate(3U);
+    auto data         = pool.data(handle);
+    data[0]           = 0x11U;
+    data[1]           = 0x22U;
+    data[2]           = 0x33U;
+    pool.commit(handle, 3U);
+    EXPECT_EQ(NUM_SLOTS - 1U, pool.available());
+
+    pool.release(handle);
+    pool.release(handle);
+    EXPECT_THAT(pool.data(handle), ElementsAre(0x11U, 0x22U, 0x33U));
+    EXPECT_EQ(NUM_SLOTS - 1U, pool.available());
+
+    pool.release(handle);
+    EXPECT_EQ(NUM_SLOTS, pool.available());
+    EXPECT_EQ(0U, pool.data(handle).size());
+
+    // Releasing a free slot has no effect
+    pool.release(handle);
+    EXPECT_EQ(NUM_SLOTS, pool.available());
+}
+
+/**
+ * \refs:   SMD_io_SharedBufferPool
+ * \desc
+ * Committing to no consumer returns the slot to the pool. Releasing or committing a slot which
+ * is not reserved has no effect.
+ */
+TEST(SharedBufferPoolTest, commit_and_release_edge_cases)
+{
+    Pool pool;
+    auto const handle = pool.allocate(SLOT_SIZE);
+    // Not committed yet
+    pool.release(handle);
+    EXPECT_EQ(NUM_SLOTS - 1U, pool.available());
+
+    pool.commit(handle, 0U);
+    EXPECT_EQ(NUM_SLOTS, pool.available());
+
+    // Not allocated anymore
+    pool.commit(handle, 2U);
+    EXPECT_EQ(NUM_SLOTS, pool.available());
+
+    pool.commit(::io::ISharedBufferPool::INVALID_HANDLE, 1U);
+    pool.release(::io::ISharedBufferPool::INVALID_HANDLE);
+    EXPECT_EQ(0U, pool.data(::io::ISharedBufferPool::INVALID_HANDLE).size());
+    EXPECT_EQ(NUM_SLOTS, pool.available());
+}
+
+} // namespace
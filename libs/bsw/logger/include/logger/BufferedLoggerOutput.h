@@ -58,6 +58,26 @@ public:
         char const* str,
         va_list ap) override;
 
+    bool logTypedOutput(
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& levelInfo,
+        char const* str,
+        ::etl::span<::util::logger::LogArgument const> const& arguments) override;
+
+protected:
+    /**
+     * Adds a serialized entry to the entry buffer and notifies the listeners.
+     */
+    void addEntry(::etl::span<uint8_t const> const& entry);
+
+    /**
+     * Adds a serialized entry to the entry buffer without notifying the listeners. This allows
+     * adding several entries and notifying the listeners once with notifyListeners().
+     */
+    void appendEntry(::etl::span<uint8_t const> const& entry);
+
+    void notifyListeners();
+
 private:
     class EntryOutputAdapter : public IEntrySerializerCallback<Timestamp>
     {
@@ -256,10 +276,67 @@ void BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate
     Timestamp const timestamp = _timestamp.getTimestamp();
     T const size              = _entrySerializer.serialize(
         entryBuffer, timestamp, componentInfo.getIndex(), levelInfo.getLevel(), str, ap);
-    {
-        Lock const lock;
-        _entryBuffer.addEntry(::etl::span<uint8_t>(entryBuffer).first(size));
-    }
+    addEntry(::etl::span<uint8_t>(entryBuffer).first(size));
+}
+
+template<
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+bool BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate>::logTypedOutput(
+    ::util::logger::ComponentInfo const& componentInfo,
+    ::util::logger::LevelInfo const& levelInfo,
+    char const* const str,
+    ::etl::span<::util::logger::LogArgument const> const& arguments)
+{
+    uint8_t entryBuffer[MaxEntrySize];
+    Timestamp const timestamp = _timestamp.getTimestamp();
+    T const size              = _entrySerializer.serialize(
+        entryBuffer, timestamp, componentInfo.getIndex(), levelInfo.getLevel(), str, arguments);
+    addEntry(::etl::span<uint8_t>(entryBuffer).first(size));
+    return true;
+}
+
+template<
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+void BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate>::addEntry(
+    ::etl::span<uint8_t const> const& entry)
+{
+    appendEntry(entry);
+    notifyListeners();
+}
+
+template<
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+void BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate>::appendEntry(
+    ::etl::span<uint8_t const> const& entry)
+{
+    Lock const lock;
+    _entryBuffer.addEntry(entry);
+}
+
+template<
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+void BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate>::notifyListeners()
+{
     for (auto& it : _listeners)
     {
         it.logAvailable();
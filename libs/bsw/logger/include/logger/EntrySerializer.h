@@ -16,6 +16,7 @@
 #include <util/format/IPrintfArgumentReader.h>
 #include <util/format/PrintfArgumentReader.h>
 #include <util/format/PrintfFormatScanner.h>
+#include <util/logger/LogArgument.h>
 #include <util/logger/Logger.h>
 
 #include <cstring>
@@ -52,6 +53,13 @@ public:
         ::util::logger::Level level,
         char const* formatString,
         va_list ap) const;
+    T serialize(
+        ::etl::span<uint8_t> const& destBuffer,
+        Timestamp timestamp,
+        uint8_t componentIndex,
+        ::util::logger::Level level,
+        char const* formatString,
+        ::etl::span<::util::logger::LogArgument const> const& arguments) const;
     static void deserialize(
         ::etl::span<uint8_t const> const& srcBuffer, IEntrySerializerCallback<Timestamp>& callback);
 
@@ -117,6 +125,13 @@ private:
         ::util::string::PlainSizedString _plainSizedString;
     };
 
+    void writeHeader(
+        EntryWriter& writer,
+        Timestamp timestamp,
+        uint8_t componentIndex,
+        ::util::logger::Level level,
+        char const* formatString) const;
+
     ReadOnlyPredicate _readOnlyPredicate;
 };
 
@@ -152,11 +167,7 @@ T EntrySerializer<T, Timestamp, ReadOnlyPredicate>::serialize(
     uint8_t* const dest = destBuffer.data();
 
     EntryWriter writer(dest, dest + destBuffer.size(), _readOnlyPredicate);
-    writer.writeBytes(&timestamp, static_cast<T>(sizeof(timestamp)));
-    writer.writeBytes(&componentIndex, static_cast<T>(sizeof(componentIndex)));
-    uint8_t const levelByte = static_cast<uint8_t>(level);
-    writer.writeBytes(&levelByte, static_cast<T>(sizeof(levelByte)));
-    writer.writeString(formatString);
+    writeHeader(writer, timestamp, componentIndex, level, formatString);
     PrintfArgumentReader argReader(ap);
 
     for (PrintfFormatScanner scanner(formatString); scanner.hasToken(); scanner.nextToken())
@@ -178,6 +189,41 @@ T EntrySerializer<T, Timestamp, ReadOnlyPredicate>::serialize(
     return writer.getSize();
 }
 
+template<class T, class Timestamp, class ReadOnlyPredicate>
+T EntrySerializer<T, Timestamp, ReadOnlyPredicate>::serialize(
+    ::etl::span<uint8_t> const& destBuffer,
+    Timestamp const timestamp,
+    uint8_t const componentIndex,
+    ::util::logger::Level const level,
+    char const* const formatString,
+    ::etl::span<::util::logger::LogArgument const> const& arguments) const
+{
+    uint8_t* const dest = destBuffer.data();
+
+    EntryWriter writer(dest, dest + destBuffer.size(), _readOnlyPredicate);
+    writeHeader(writer, timestamp, componentIndex, level, formatString);
+    for (auto const& argument : arguments)
+    {
+        writer.writeParamVariant(argument._datatype, argument._value);
+    }
+    return writer.getSize();
+}
+
+template<class T, class Timestamp, class ReadOnlyPredicate>
+void EntrySerializer<T, Timestamp, ReadOnlyPredicate>::writeHeader(
+    EntryWriter& writer,
+    Timestamp const timestamp,
+    uint8_t const componentIndex,
+    ::util::logger::Level const level,
+    char const* const formatString) const
+{
+    writer.writeBytes(&timestamp, static_cast<T>(sizeof(timestamp)));
+    writer.writeBytes(&componentIndex, static_cast<T>(sizeof(componentIndex)));
+    uint8_t const levelByte = static_cast<uint8_t>(level);
+    writer.writeBytes(&levelByte, static_cast<T>(sizeof(levelByte)));
+    writer.writeString(formatString);
+}
+
 template<class T, class Timestamp, class ReadOnlyPredicate>
 void EntrySerializer<T, Timestamp, ReadOnlyPredicate>::deserialize(
     ::etl::span<uint8_t const> const& srcBuffer, IEntrySerializerCallback<Timestamp>& callback)
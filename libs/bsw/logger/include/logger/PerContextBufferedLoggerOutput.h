@@ -0,0 +1,520 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include "logger/BufferedLoggerOutput.h"
+
+#include <etl/algorithm.h>
+#include <etl/array.h>
+#include <etl/atomic.h>
+#include <etl/span.h>
+#include <etl/type_traits.h>
+#include <io/MemoryQueue.h>
+
+#include <cstring>
+
+namespace logger
+{
+/**
+ * A BufferedLoggerOutput with a ring for each context. A log call serializes its entry directly
+ * into the ring of the calling context without taking the lock, so it neither waits for nor
+ * depends on logging in other contexts. merge() moves the entries of all rings into the entry
+ * buffer ordered by their timestamps, from where they are read with outputEntry() as before.
+ *
+ * Each ring has a single producer, the context it belongs to, and merge() is its single consumer.
+ * Log calls from contexts without a ring, e.g. from interrupts, are added to the entry buffer
+ * under the lock like with BufferedLoggerOutput. They are appended immediately, i.e. ahead of
+ * older entries of the rings that haven't been merged yet. If the ring of a context is full, the
+ * entry is dropped and counted, see getDroppedEntryCount().
+ *
+ * \tparam ContextIndex type with a static function ``size_t get()`` returning the index of the
+ * ring of the calling context, any value >= ContextCount for contexts without a ring. It must
+ * detect all interrupts that log, e.g. with ``xPortIsInsideInterrupt()``: the task context of
+ * the async adapters is only invalid in interrupts bracketed with ``enterIsr()``/``leaveIsr()``,
+ * an interrupt that isn't detected writes into the ring of the task it interrupted.
+ * \tparam ContextCount number of rings
+ * \tparam RingSize size of each ring in bytes
+ */
+template<
+    class ContextIndex,
+    size_t ContextCount,
+    size_t RingSize,
+    class Lock,
+    uint8_t MaxEntrySize    = 64,
+    class T                 = uint16_t,
+    class E                 = uint32_t,
+    class Timestamp         = uint32_t,
+    class ReadOnlyPredicate = SectionPredicate>
+class PerContextBufferedLoggerOutput
+: public BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate>
+{
+    static_assert(
+        ::etl::is_integral<Timestamp>::value && ::etl::is_unsigned<Timestamp>::value,
+        "timestamps are compared modulo their range");
+
+    using Base = BufferedLoggerOutput<Lock, MaxEntrySize, T, E, Timestamp, ReadOnlyPredicate>;
+
+public:
+    PerContextBufferedLoggerOutput(
+        ::util::logger::IComponentMapping& componentMapping,
+        ILoggerTime<Timestamp>& timestamp,
+        ::etl::span<uint8_t> outputBuffer);
+    PerContextBufferedLoggerOutput(
+        ::util::logger::IComponentMapping& componentMapping,
+        ILoggerTime<Timestamp>& timestamp,
+        ::etl::span<uint8_t> outputBuffer,
+        ReadOnlyPredicate const& readOnlyPredicate);
+
+    /**
+     * Moves all entries of the rings into the entry buffer, the one with the oldest timestamp
+     * first, and notifies the listeners once. Must only be called from a single context, e.g.
+     * the one that drains the entries with outputEntry(). Entries committed to a ring while
+     * merging are merged by the next call.
+     * \return number of merged entries
+     */
+    size_t merge();
+
+    /**
+     * Returns the number of entries that have been dropped because the ring of their context
+     * was full.
+     */
+    uint32_t getDroppedEntryCount() const;
+
+    /**
+     * Serializes the entry into the ring of the calling context. For a context without a ring,
+     * see ContextIndex, the entry is appended to the entry buffer under the lock, ahead of the
+     * older entries that are still waiting in the rings for merge().
+     */
+    void logOutput(
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& levelInfo,
+        char const* str,
+        va_list ap) override;
+
+    bool logTypedOutput(
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& levelInfo,
+        char const* str,
+        ::etl::span<::util::logger::LogArgument const> const& arguments) override;
+
+private:
+    static constexpr size_t RING_ENTRY_SIZE = sizeof(Timestamp) + MaxEntrySize;
+
+    using RingType = ::io::MemoryQueue<RingSize, RING_ENTRY_SIZE>;
+
+    struct Ring
+    {
+        RingType _queue;
+        ::etl::atomic<uint32_t> _droppedEntryCount{0U};
+    };
+
+    /**
+     * Allocates a worst case entry in the ring of the calling context and writes the timestamp.
+     * \return slice for the serialized entry, empty if the ring is full
+     */
+    ::etl::span<uint8_t> allocate(Ring& ring, Timestamp timestamp);
+
+    static void commit(Ring& ring, T size);
+
+    static Timestamp getTimestamp(::etl::span<uint8_t const> const& ringEntry);
+
+    ILoggerTime<Timestamp>& _timestamp;
+    EntrySerializer<T, Timestamp, ReadOnlyPredicate> _entrySerializer;
+    ::etl::array<Ring, ContextCount> _rings;
+};
+
+namespace declare
+{
+
+template<
+    uint32_t BufferSize,
+    class ContextIndex,
+    size_t ContextCount,
+    size_t RingSize,
+    class Lock,
+    uint8_t MaxEntrySize    = 64,
+    class T                 = uint16_t,
+    class E                 = uint32_t,
+    class Timestamp         = uint32_t,
+    class ReadOnlyPredicate = SectionPredicate>
+class PerContextBufferedLoggerOutput
+: public ::logger::PerContextBufferedLoggerOutput<
+      ContextIndex,
+      ContextCount,
+      RingSize,
+      Lock,
+      MaxEntrySize,
+      T,
+      E,
+      Timestamp,
+      ReadOnlyPredicate>
+{
+    using Base = ::logger::PerContextBufferedLoggerOutput<
+        ContextIndex,
+        ContextCount,
+        RingSize,
+        Lock,
+        MaxEntrySize,
+        T,
+        E,
+        Timestamp,
+        ReadOnlyPredicate>;
+
+public:
+    PerContextBufferedLoggerOutput(
+        ::util::logger::IComponentMapping& componentMapping, ILoggerTime<Timestamp>& timestamp)
+    : Base(componentMapping, timestamp, _buffer), _buffer()
+    {}
+
+    PerContextBufferedLoggerOutput(
+        ::util::logger::IComponentMapping& componentMapping,
+        ILoggerTime<Timestamp>& timestamp,
+        ReadOnlyPredicate const readOnlyPredicate)
+    : Base(componentMapping, timestamp, _buffer, readOnlyPredicate), _buffer()
+    {}
+
+private:
+    uint8_t _buffer[BufferSize];
+};
+
+} // namespace declare
+
+template<
+    class ContextIndex,
+    size_t ContextCount,
+    size_t RingSize,
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+PerContextBufferedLoggerOutput<
+    ContextIndex,
+    ContextCount,
+    RingSize,
+    Lock,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::
+    PerContextBufferedLoggerOutput(
+        ::util::logger::IComponentMapping& componentMapping,
+        ILoggerTime<Timestamp>& timestamp,
+        ::etl::span<uint8_t> const outputBuffer)
+: Base(componentMapping, timestamp, outputBuffer)
+, _timestamp(timestamp)
+, _entrySerializer(ReadOnlyPredicate())
+, _rings()
+{}
+
+template<
+    class ContextIndex,
+    size_t ContextCount,
+    size_t RingSize,
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+PerContextBufferedLoggerOutput<
+    ContextIndex,
+    ContextCount,
+    RingSize,
+    Lock,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::
+    PerContextBufferedLoggerOutput(
+        ::util::logger::IComponentMapping& componentMapping,
+        ILoggerTime<Timestamp>& timestamp,
+        ::etl::span<uint8_t> const outputBuffer,
+        ReadOnlyPredicate const& readOnlyPredicate)
+: Base(componentMapping, timestamp, outputBuffer, readOnlyPredicate)
+, _timestamp(timestamp)
+, _entrySerializer(readOnlyPredicate)
+, _rings()
+{}
+
+template<
+    class ContextIndex,
+    size_t ContextCount,
+    size_t RingSize,
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+size_t PerContextBufferedLoggerOutput<
+    ContextIndex,
+    ContextCount,
+    RingSize,
+    Lock,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::merge()
+{
+    using SignedTimestamp = typename ::etl::make_signed<Timestamp>::type;
+
+    size_t count = 0U;
+    while (true)
+    {
+        Ring* oldestRing = nullptr;
+        Timestamp oldestTimestamp{};
+        for (Ring& ring : _rings)
+        {
+            ::etl::span<uint8_t const> const ringEntry
+                = typename RingType::Reader(ring._queue).peek();
+            if (ringEntry.empty())
+            {
+                continue;
+            }
+            Timestamp const timestamp = getTimestamp(ringEntry);
+            // the timestamps may wrap around
+            if ((oldestRing == nullptr)
+                || (static_cast<SignedTimestamp>(timestamp - oldestTimestamp) < 0))
+            {
+                oldestRing      = &ring;
+                oldestTimestamp = timestamp;
+            }
+        }
+        if (oldestRing == nullptr)
+        {
+            break;
+        }
+        typename RingType::Reader const reader(oldestRing->_queue);
+        Base::appendEntry(reader.peek().subspan(sizeof(Timestamp)));
+        reader.release();
+        ++count;
+    }
+    if (count > 0U)
+    {
+        Base::notifyListeners();
+    }
+    return count;
+}
+
+template<
+    class ContextIndex,
+    size_t ContextCount,
+    size_t RingSize,
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+uint32_t PerContextBufferedLoggerOutput<
+    ContextIndex,
+    ContextCount,
+    RingSize,
+    Lock,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::getDroppedEntryCount() const
+{
+    uint32_t count = 0U;
+    for (Ring const& ring : _rings)
+    {
+        count += ring._droppedEntryCount.load(::etl::memory_order_relaxed);
+    }
+    return count;
+}
+
+template<
+    class ContextIndex,
+    size_t ContextCount,
+    size_t RingSize,
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+void PerContextBufferedLoggerOutput<
+    ContextIndex,
+    ContextCount,
+    RingSize,
+    Lock,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::
+    logOutput(
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& levelInfo,
+        char const* const str,
+        va_list ap)
+{
+    size_t const contextIndex = ContextIndex::get();
+    if (contextIndex >= ContextCount)
+    {
+        Base::logOutput(componentInfo, levelInfo, str, ap);
+        return;
+    }
+    Ring& ring                       = _rings[contextIndex];
+    Timestamp const timestamp        = _timestamp.getTimestamp();
+    ::etl::span<uint8_t> const entry = allocate(ring, timestamp);
+    if (!entry.empty())
+    {
+        commit(
+            ring,
+            _entrySerializer.serialize(
+                entry, timestamp, componentInfo.getIndex(), levelInfo.getLevel(), str, ap));
+    }
+}
+
+template<
+    class ContextIndex,
+    size_t ContextCount,
+    size_t RingSize,
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+bool PerContextBufferedLoggerOutput<
+    ContextIndex,
+    ContextCount,
+    RingSize,
+    Lock,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::
+    logTypedOutput(
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& levelInfo,
+        char const* const str,
+        ::etl::span<::util::logger::LogArgument const> const& arguments)
+{
+    size_t const contextIndex = ContextIndex::get();
+    if (contextIndex >= ContextCount)
+    {
+        return Base::logTypedOutput(componentInfo, levelInfo, str, arguments);
+    }
+    Ring& ring                       = _rings[contextIndex];
+    Timestamp const timestamp        = _timestamp.getTimestamp();
+    ::etl::span<uint8_t> const entry = allocate(ring, timestamp);
+    if (!entry.empty())
+    {
+        commit(
+            ring,
+            _entrySerializer.serialize(
+                entry, timestamp, componentInfo.getIndex(), levelInfo.getLevel(), str, arguments));
+    }
+    return true;
+}
+
+template<
+    class ContextIndex,
+    size_t ContextCount,
+    size_t RingSize,
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+::etl::span<uint8_t> PerContextBufferedLoggerOutput<
+    ContextIndex,
+    ContextCount,
+    RingSize,
+    Lock,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::allocate(Ring& ring, Timestamp const timestamp)
+{
+    ::etl::span<uint8_t> const ringEntry
+        = typename RingType::Writer(ring._queue).allocate(RING_ENTRY_SIZE);
+    if (ringEntry.empty())
+    {
+        // only the context of the ring writes its counter
+        ring._droppedEntryCount.store(
+            ring._droppedEntryCount.load(::etl::memory_order_relaxed) + 1U,
+            ::etl::memory_order_relaxed);
+        return {};
+    }
+    (void)memcpy(ringEntry.data(), &timestamp, sizeof(Timestamp));
+    return ringEntry.subspan(sizeof(Timestamp));
+}
+
+template<
+    class ContextIndex,
+    size_t ContextCount,
+    size_t RingSize,
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+void PerContextBufferedLoggerOutput<
+    ContextIndex,
+    ContextCount,
+    RingSize,
+    Lock,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::commit(Ring& ring, T const size)
+{
+    typename RingType::Writer writer(ring._queue);
+    // trim the worst case allocation to the serialized size, which exceeds MaxEntrySize for
+    // truncated entries like with EntryBuffer::addEntry()
+    size_t const entrySize
+        = ::etl::min(static_cast<size_t>(size), static_cast<size_t>(MaxEntrySize));
+    (void)writer.allocate(sizeof(Timestamp) + entrySize);
+    writer.commit();
+}
+
+template<
+    class ContextIndex,
+    size_t ContextCount,
+    size_t RingSize,
+    class Lock,
+    uint8_t MaxEntrySize,
+    class T,
+    class E,
+    class Timestamp,
+    class ReadOnlyPredicate>
+Timestamp PerContextBufferedLoggerOutput<
+    ContextIndex,
+    ContextCount,
+    RingSize,
+    Lock,
+    MaxEntrySize,
+    T,
+    E,
+    Timestamp,
+    ReadOnlyPredicate>::getTimestamp(::etl::span<uint8_t const> const& ringEntry)
+{
+    Timestamp timestamp;
+    (void)memcpy(&timestamp, ringEntry.data(), sizeof(Timestamp));
+    return timestamp;
+}
+
+} /* namespace logger */
@@ -165,6 +165,26 @@ TEST_F(BufferedLoggerOutputTest, testConstructorWithPredicate)
     ASSERT_TRUE(checkAndResetEntry("1 2348 1 0 ver<?>"));
 }
 
+TEST_F(BufferedLoggerOutputTest, testTypedOutput)
+{
+    declare::BufferedLoggerOutput<4096, TestLock> cut(testMapping, *this);
+    cut.addListener(*this);
+    setTimestamp(2349);
+    ::util::logger::LogArgument const arguments[]
+        = {::util::logger::makeLogArgument(17), ::util::logger::makeLogArgument("218439")};
+    ASSERT_TRUE(cut.logTypedOutput(
+        testMapping.getComponentInfo(1),
+        testMapping.getLevelInfo(::util::logger::LEVEL_DEBUG),
+        "format string %d %s",
+        arguments));
+    ASSERT_EQ(1U, _totalLockCount);
+    ASSERT_EQ(1U, _availableLogCount);
+    BufferedLoggerOutput<TestLock>::EntryRefType entryRef;
+    cut.outputEntry(*this, entryRef);
+    ASSERT_TRUE(checkAndResetEntry("1 2349 1 0 format string 17 218439"));
+    cut.removeListener(*this);
+}
+
 // NOLINTEND(cppcoreguidelines-pro-type-vararg)
 
 } // namespace
@@ -15,6 +15,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 using namespace ::logger;
 
 using namespace ::util::logger;
@@ -52,6 +54,36 @@ struct EntrySerializerTest
         return _entry;
     }
 
+    template<class... Args>
+    std::string const& serializeTypedAndDeserialize(
+        uint32_t bufferSize,
+        uint32_t timestamp,
+        uint8_t componentIdx,
+        uint8_t level,
+        char const* formatString,
+        Args const... args)
+    {
+        EntrySerializer<> serializer(
+            SectionPredicate(_constStrings, _constStrings + sizeof(_constStrings)));
+        memset(_buffer, 0xaf, sizeof(_buffer));
+        LogArgument const arguments[] = {makeLogArgument(args)..., {}};
+        ::etl::span<uint8_t> entryBuffer
+            = ::etl::span<uint8_t>(_buffer, sizeof(_buffer)).subspan(1, bufferSize);
+        _usedBufferSize = serializer.serialize(
+            entryBuffer,
+            timestamp,
+            componentIdx,
+            static_cast<Level>(level),
+            formatString,
+            ::etl::span<LogArgument const>(arguments, sizeof...(Args)));
+        _usedBufferSize = _usedBufferSize < bufferSize ? _usedBufferSize : bufferSize;
+        _entry.clear();
+        EXPECT_EQ(0xaf, _buffer[0]);
+        EXPECT_EQ(0xaf, _buffer[bufferSize + 1]);
+        serializer.deserialize(entryBuffer.first(_usedBufferSize), *this);
+        return _entry;
+    }
+
     char const* addConstString(char const* string)
     {
         size_t const maxSize = sizeof(_constStrings) - _nextConstStringOffset;
@@ -218,4 +250,66 @@ TEST_F(EntrySerializerTest, testPrintfDatatypes)
     ASSERT_EQ("124:2:3:    0017", serializeAndDeserialize(300, 124, 2, 3, "%*.*d", 8, 4, 17));
 }
 
+TEST_F(EntrySerializerTest, testTypedLogWithArguments)
+{
+    ASSERT_EQ(
+        "123:1:2:simpleArgLog(arg-value, 123, f)",
+        serializeTypedAndDeserialize(
+            300, 123, 1, 2, "simpleArgLog(%s, %d, %c)", "arg-value", 123, 'f'));
+    ASSERT_EQ(
+        "123:1:2:simpleArgLog(arg-value, 123, <?>)",
+        serializeTypedAndDeserialize(
+            _usedBufferSize - 1, 123, 1, 2, "simpleArgLog(%s, %d, %c)", "arg-value", 123, 'f'));
+    ASSERT_EQ(
+        "123:1:2:simpleArgLog(arg-value)",
+        serializeTypedAndDeserialize(
+            300, 123, 1, 2, "simpleArgLog(%s)", addConstString("arg-value")));
+}
+
+TEST_F(EntrySerializerTest, testTypedPrintfDatatypes)
+{
+    ASSERT_EQ(
+        "124:2:3:17 18 19",
+        serializeTypedAndDeserialize(
+            300, 124, 2, 3, "%d %hd %ld", 17, static_cast<int16_t>(18), 19LL));
+    ASSERT_EQ(
+        "124:2:3:17 18 19 -1",
+        serializeTypedAndDeserialize(
+            300,
+            124,
+            2,
+            3,
+            "%u %hu %lu %d",
+            17U,
+            static_cast<uint16_t>(18U),
+            19ULL,
+            static_cast<int8_t>(-1)));
+    ::util::string::ConstString sizedString("arg-value334", 9U);
+    ASSERT_EQ(
+        "124:2:3:String arg-value <NULL>",
+        serializeTypedAndDeserialize(
+            300,
+            124,
+            2,
+            3,
+            "%s %S %s",
+            "String",
+            sizedString.plain_str(),
+            static_cast<char const*>(nullptr)));
+    ASSERT_EQ(
+        "124:2:3:12345678",
+        serializeTypedAndDeserialize(
+            300, 124, 2, 3, "%p", reinterpret_cast<void const*>(0x12345678)));
+    ASSERT_EQ("124:2:3:    0017", serializeTypedAndDeserialize(300, 124, 2, 3, "%*.*d", 8, 4, 17));
+}
+
+TEST_F(EntrySerializerTest, testTypedEntryEqualsVariadicEntry)
+{
+    (void)serializeAndDeserialize(300, 123, 1, 2, "%s %d %u %lld", "abc", -12, 13U, 14LL);
+    std::vector<uint8_t> const variadicEntry(_buffer + 1, _buffer + 1 + _usedBufferSize);
+    (void)serializeTypedAndDeserialize(300, 123, 1, 2, "%s %d %u %lld", "abc", -12, 13U, 14LL);
+    std::vector<uint8_t> const typedEntry(_buffer + 1, _buffer + 1 + _usedBufferSize);
+    EXPECT_EQ(variadicEntry, typedEntry);
+}
+
 // NOLINTEND(cppcoreguidelines-pro-type-vararg)
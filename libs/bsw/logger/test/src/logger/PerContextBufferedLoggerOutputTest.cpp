@@ -0,0 +1,274 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "logger/PerContextBufferedLoggerOutput.h"
+
+#include "logger/ComponentMapping.h"
+#include "logger/ILoggerTime.h"
+
+#include <util/format/StringWriter.h>
+#include <util/stream/StringBufferOutputStream.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace util
+{
+namespace logger
+{
+static uint8_t PERCONTEXT1 = COMPONENT_NONE;
+static uint8_t PERCONTEXT2 = COMPONENT_NONE;
+} // namespace logger
+} // namespace util
+
+namespace
+{
+using namespace logger;
+using namespace ::util;
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-vararg)
+uint32_t _lockCount;
+size_t _contextIndex;
+
+struct TestLock
+{
+    TestLock() { ++_lockCount; }
+};
+
+struct TestContextIndex
+{
+    static size_t get() { return _contextIndex; }
+};
+
+using CutType = declare::PerContextBufferedLoggerOutput<4096, TestContextIndex, 2U, 256U, TestLock>;
+
+START_LOGGER_COMPONENT_MAPPING_INFO_TABLE(perContextComponentInfoTable)
+LOGGER_COMPONENT_MAPPING_INFO(LEVEL_DEBUG, PERCONTEXT1)
+LOGGER_COMPONENT_MAPPING_INFO(LEVEL_DEBUG, PERCONTEXT2)
+END_LOGGER_COMPONENT_MAPPING_INFO_TABLE();
+
+// NOLINTBEGIN(cert-err58-cpp): Instantiation of variable is done by macro.
+DEFINE_LOGGER_COMPONENT_MAPPING(
+    PerContextTestMappingType,
+    perContextTestMapping,
+    perContextComponentInfoTable,
+    ::util::logger::LevelInfo::getDefaultTable(),
+    PERCONTEXT1);
+
+// NOLINTEND(cert-err58-cpp)
+
+struct PerContextBufferedLoggerOutputTest
+: ::testing::Test
+, ILoggerListener
+, IEntryOutput<uint32_t, uint32_t>
+, ILoggerTime<uint32_t>
+{
+    PerContextBufferedLoggerOutputTest()
+    {
+        _lockCount    = 0U;
+        _contextIndex = 0U;
+    }
+
+    void logAvailable() override { ++_availableLogCount; }
+
+    void outputEntry(
+        uint32_t /* entryIndex */,
+        uint32_t timestamp,
+        ::util::logger::ComponentInfo const& componentInfo,
+        ::util::logger::LevelInfo const& /* levelInfo */,
+        char const* str,
+        format::IPrintfArgumentReader& argReader) override
+    {
+        stream::declare::StringBufferOutputStream<300> outputStream;
+        format::StringWriter writer(outputStream);
+        writer.printf("%d %d ", timestamp, componentInfo.getIndex());
+        writer.vprintf(str, argReader);
+        _entries.push_back(outputStream.getString());
+    }
+
+    uint32_t getTimestamp() const override { return _timestamp; }
+
+    void formatTimestamp(
+        stream::IOutputStream& /* outputStream */, uint32_t const& /* timestamp */) const override
+    {}
+
+    // NOLINTBEGIN(cert-dcl50-cpp): va_list usage only for this test file.
+    void log(CutType& cut, size_t contextIndex, uint32_t timestamp, char const* str, ...)
+    {
+        _contextIndex = contextIndex;
+        _timestamp    = timestamp;
+        va_list ap;
+        va_start(ap, str);
+        cut.logOutput(
+            perContextTestMapping.getComponentInfo(1),
+            perContextTestMapping.getLevelInfo(::util::logger::LEVEL_DEBUG),
+            str,
+            ap);
+        va_end(ap);
+    }
+
+    // NOLINTEND(cert-dcl50-cpp)
+
+    void outputAll(CutType& cut)
+    {
+        while (cut.outputEntry(*this, _entryRef)) {}
+    }
+
+    uint32_t _timestamp         = 0U;
+    uint32_t _availableLogCount = 0U;
+    CutType::EntryRefType _entryRef;
+    std::vector<std::string> _entries;
+};
+
+TEST_F(PerContextBufferedLoggerOutputTest, testLogCallOfContextWithRingDoesNotLock)
+{
+    CutType cut(perContextTestMapping, *this);
+    cut.addListener(*this);
+    log(cut, 1U, 17U, "value %d", 5);
+    EXPECT_EQ(0U, _lockCount);
+    EXPECT_EQ(0U, _availableLogCount);
+    outputAll(cut);
+    EXPECT_TRUE(_entries.empty());
+
+    EXPECT_EQ(1U, cut.merge());
+    EXPECT_EQ(1U, _availableLogCount);
+    outputAll(cut);
+    ASSERT_EQ(1U, _entries.size());
+    EXPECT_EQ("17 1 value 5", _entries[0]);
+    EXPECT_EQ(0U, cut.merge());
+    EXPECT_EQ(1U, _availableLogCount);
+    cut.removeListener(*this);
+}
+
+TEST_F(PerContextBufferedLoggerOutputTest, testMergeOrdersEntriesByTimestamp)
+{
+    CutType cut(perContextTestMapping, *this);
+    cut.addListener(*this);
+    log(cut, 0U, 10U, "a");
+    log(cut, 1U, 11U, "b");
+    log(cut, 1U, 13U, "c");
+    log(cut, 0U, 12U, "d");
+    log(cut, 0U, 15U, "e");
+    log(cut, 1U, 14U, "f");
+
+    EXPECT_EQ(6U, cut.merge());
+    EXPECT_EQ(1U, _availableLogCount);
+    outputAll(cut);
+    std::vector<std::string> const expected{
+        "10 1 a", "11 1 b", "12 1 d", "13 1 c", "14 1 f", "15 1 e"};
+    EXPECT_EQ(expected, _entries);
+    cut.removeListener(*this);
+}
+
+TEST_F(PerContextBufferedLoggerOutputTest, testMergeOrdersWrappedTimestamps)
+{
+    CutType cut(perContextTestMapping, *this);
+    log(cut, 0U, 2U, "after wrap");
+    log(cut, 1U, 0xFFFFFFFEU, "before wrap");
+
+    EXPECT_EQ(2U, cut.merge());
+    outputAll(cut);
+    std::vector<std::string> const expected{"-2 1 before wrap", "2 1 after wrap"};
+    EXPECT_EQ(expected, _entries);
+}
+
+TEST_F(PerContextBufferedLoggerOutputTest, testLogCallOfContextWithoutRingLocks)
+{
+    CutType cut(perContextTestMapping, *this);
+    cut.addListener(*this);
+    log(cut, 0U, 20U, "ring");
+    log(cut, 2U, 21U, "locked");
+    EXPECT_EQ(1U, _lockCount);
+    EXPECT_EQ(1U, _availableLogCount);
+
+    EXPECT_EQ(1U, cut.merge());
+    outputAll(cut);
+    std::vector<std::string> const expected{"21 1 locked", "20 1 ring"};
+    EXPECT_EQ(expected, _entries);
+    cut.removeListener(*this);
+}
+
+TEST_F(PerContextBufferedLoggerOutputTest, testTypedOutput)
+{
+    CutType cut(perContextTestMapping, *this);
+    ::util::logger::LogArgument const arguments[]
+        = {::util::logger::makeLogArgument(17), ::util::logger::makeLogArgument("218439")};
+    _timestamp = 30U;
+    EXPECT_TRUE(cut.logTypedOutput(
+        perContextTestMapping.getComponentInfo(1),
+        perContextTestMapping.getLevelInfo(::util::logger::LEVEL_DEBUG),
+        "typed %d %s",
+        arguments));
+    _contextIndex = 5U;
+    EXPECT_TRUE(cut.logTypedOutput(
+        perContextTestMapping.getComponentInfo(1),
+        perContextTestMapping.getLevelInfo(::util::logger::LEVEL_DEBUG),
+        "locked %d %s",
+        arguments));
+    EXPECT_EQ(1U, _lockCount);
+
+    EXPECT_EQ(1U, cut.merge());
+    outputAll(cut);
+    std::vector<std::string> const expected{"30 1 locked 17 218439", "30 1 typed 17 218439"};
+    EXPECT_EQ(expected, _entries);
+}
+
+TEST_F(PerContextBufferedLoggerOutputTest, testFullRingDropsEntries)
+{
+    CutType cut(perContextTestMapping, *this);
+    size_t logged = 0U;
+    while (cut.getDroppedEntryCount() == 0U)
+    {
+        log(cut, 0U, static_cast<uint32_t>(logged), "entry %d", static_cast<int>(logged));
+        ++logged;
+    }
+    log(cut, 0U, 1000U, "dropped");
+    EXPECT_EQ(2U, cut.getDroppedEntryCount());
+    // other contexts are not affected
+    log(cut, 1U, 1001U, "other");
+    EXPECT_EQ(2U, cut.getDroppedEntryCount());
+
+    EXPECT_EQ(logged, cut.merge());
+    outputAll(cut);
+    ASSERT_EQ(logged, _entries.size());
+    EXPECT_EQ("0 1 entry 0", _entries.front());
+    EXPECT_EQ("1001 1 other", _entries.back());
+
+    // the ring can be used again after merging
+    log(cut, 0U, 1002U, "again");
+    EXPECT_EQ(1U, cut.merge());
+    outputAll(cut);
+    EXPECT_EQ("1002 1 again", _entries.back());
+    EXPECT_EQ(2U, cut.getDroppedEntryCount());
+}
+
+TEST_F(PerContextBufferedLoggerOutputTest, testConstructorWithPredicate)
+{
+    declare::PerContextBufferedLoggerOutput<64, TestContextIndex, 1U, 64U, TestLock, 16> cut(
+        perContextTestMapping, *this, SectionPredicate(nullptr, nullptr));
+    _timestamp = 2348U;
+    ::util::logger::LogArgument const arguments[] = {::util::logger::makeLogArgument(1)};
+    EXPECT_TRUE(cut.logTypedOutput(
+        perContextTestMapping.getComponentInfo(1),
+        perContextTestMapping.getLevelInfo(::util::logger::LEVEL_DEBUG),
+        "very long format string that cannot fit into a 16 bytes entry",
+        arguments));
+    EXPECT_EQ(1U, cut.merge());
+    BufferedLoggerOutput<TestLock, 16>::EntryRefType entryRef;
+    EXPECT_TRUE(cut.outputEntry(*this, entryRef));
+    ASSERT_EQ(1U, _entries.size());
+    EXPECT_EQ("2348 1 ver<?>", _entries[0]);
+}
+
+// NOLINTEND(cppcoreguidelines-pro-type-vararg)
+
+} // namespace
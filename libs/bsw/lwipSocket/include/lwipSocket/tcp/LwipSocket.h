@@ -56,6 +56,11 @@ public:
 
     virtual ErrorCode shutdown(int32_t shut_rx, int32_t shut_tx);
 
+    /**
+     * Closes the connection. If data sent without copy hasn't been acknowledged yet, the sent and
+     * error callbacks stay registered until lwip doesn't reference the data anymore, then
+     * IDataListener::connectionClosed() is called.
+     */
     ErrorCode close() override;
 
     void abort() override;
@@ -70,6 +75,14 @@ public:
 
     ErrorCode send(::etl::span<uint8_t const> const& data) override;
 
+    /**
+     * Passes the data to lwip without copying it. The data is copied anyway if lwip has no
+     * reference pbufs left (see MEMP_NUM_PBUF).
+     */
+    ErrorCode sendZeroCopy(::etl::span<uint8_t const> const& data) override;
+
+    bool hasUnacknowledgedZeroCopyData() const override;
+
     size_t available() override;
 
     bool isClosed() const override;
@@ -99,6 +112,8 @@ private:
 
     void resetSocket();
 
+    ErrorCode sendData(::etl::span<uint8_t const> const& data, bool copy);
+
     err_t sendPendingData(tcp_pcb* pcb);
 
     err_t sentCallback(tcp_pcb* pcb, uint16_t len);
@@ -130,10 +145,14 @@ private:
     ::ip::IPEndpoint fBindEndpoint;
     size_t fOffsetInCurrentPBuf;
     ::etl::span<uint8_t const> fPendingTcpData;
+    size_t fUnackedLength;
+    size_t fZeroCopyUnackedLength;
     ConnectedDelegate fDelegate;
+    bool fCopyPendingTcpData;
     bool fConnecting;
     bool fIsAborted;
     bool fForceCopy;
+    bool fClosing;
 
 #if LWIP_TCP_KEEPALIVE
     static constexpr uint32_t KEEPALIVE_IDLE_DEFAULT     = 7200000U;
@@ -46,10 +46,14 @@ LwipSocket::LwipSocket()
 , fBindEndpoint()
 , fOffsetInCurrentPBuf(0)
 , fPendingTcpData()
+, fUnackedLength(0U)
+, fZeroCopyUnackedLength(0U)
 , fDelegate()
+, fCopyPendingTcpData(true)
 , fConnecting(false)
 , fIsAborted(false)
 , fForceCopy(false)
+, fClosing(false)
 #if LWIP_TCP_KEEPALIVE
 , fKeepAliveEnabled(false)
 , fKeepAliveIdle(KEEPALIVE_IDLE_DEFAULT)
@@ -62,6 +66,22 @@ void LwipSocket::setForceCopy(bool const forceCopy) { fForceCopy = forceCopy; }
 
 // NOLINTBEGIN(cppcoreguidelines-pro-type-vararg): Logger API is variadic by design.
 AbstractSocket::ErrorCode LwipSocket::send(::etl::span<uint8_t const> const& data)
+{
+    return sendData(data, true);
+}
+
+AbstractSocket::ErrorCode LwipSocket::sendZeroCopy(::etl::span<uint8_t const> const& data)
+{
+    return sendData(data, false);
+}
+
+bool LwipSocket::hasUnacknowledgedZeroCopyData() const
+{
+    return (fpHandle != nullptr) && (fZeroCopyUnackedLength > 0U);
+}
+
+AbstractSocket::ErrorCode
+LwipSocket::sendData(::etl::span<uint8_t const> const& data, bool const copy)
 {
     lwiputils::TASK_ASSERT_HOOK();
 
@@ -77,7 +97,8 @@ AbstractSocket::ErrorCode LwipSocket::send(::etl::span<uint8_t const> const& dat
             logger::TCP, "LwipSocket::send(%x, %u) no data is pending!", data.data(), data.size());
         if (available() > 0)
         {
-            fPendingTcpData = data;
+            fPendingTcpData     = data;
+            fCopyPendingTcpData = copy;
 
             err_t const e = sendPendingData(fpHandle);
             if (e == ERR_OK)
@@ -124,6 +145,9 @@ err_t LwipSocket::sentCallback(tcp_pcb* const pcb, uint16_t const len)
 {
     if (len > 0)
     {
+        fUnackedLength = (len < fUnackedLength) ? (fUnackedLength - len) : 0U;
+        fZeroCopyUnackedLength
+            = (len < fZeroCopyUnackedLength) ? (fZeroCopyUnackedLength - len) : 0U;
         if (_sendNotificationListener != nullptr)
         {
             _sendNotificationListener->dataSent(
@@ -131,6 +155,20 @@ err_t LwipSocket::sentCallback(tcp_pcb* const pcb, uint16_t const len)
         }
     }
 
+    if (fClosing)
+    {
+        if (fZeroCopyUnackedLength == 0U)
+        {
+            // lwip doesn't reference data sent without copy anymore
+            resetSocket();
+            if (_dataListener != nullptr)
+            {
+                _dataListener->connectionClosed(IDataListener::ErrorCode::ERR_CONNECTION_CLOSED);
+            }
+        }
+        return ERR_OK;
+    }
+
     // now there might be space left for sending the next stuff
     return sendPendingData(pcb);
 }
@@ -168,9 +206,24 @@ err_t LwipSocket::sendPendingData(tcp_pcb* const pcb)
     ETL_ASSERT(
         bytesToWrite <= UINT16_MAX, ETL_ERROR_GENERIC("number of bytes must fit in 16 bits"));
 
-    err_t result = tcp_write(pcb, fPendingTcpData.data(), static_cast<uint16_t>(bytesToWrite), 1);
+    uint8_t const apiFlags = fCopyPendingTcpData ? TCP_WRITE_FLAG_COPY : 0U;
+    err_t result
+        = tcp_write(pcb, fPendingTcpData.data(), static_cast<uint16_t>(bytesToWrite), apiFlags);
+    if ((result == ERR_MEM) && (!fCopyPendingTcpData))
+    {
+        // no reference pbufs left (see MEMP_NUM_PBUF), fall back to copying the data
+        fCopyPendingTcpData = true;
+        result              = tcp_write(
+            pcb, fPendingTcpData.data(), static_cast<uint16_t>(bytesToWrite), TCP_WRITE_FLAG_COPY);
+    }
     if (result == ERR_OK)
     {
+        fUnackedLength += bytesToWrite;
+        if (!fCopyPendingTcpData)
+        {
+            // lwip references the data until everything written so far is acknowledged
+            fZeroCopyUnackedLength = fUnackedLength;
+        }
         if (sendAll)
         {
             fPendingTcpData = {};
@@ -212,10 +265,20 @@ err_t LwipSocket::receiveCallback(tcp_pcb const* const pcb, pbuf* const p, err_t
     {
         logger::Logger::info(
             logger::TCP, "LwipSocket: connection at port %d closed", pcb->local_port);
-        if (fpHandle != nullptr)
+        if ((fpHandle != nullptr) && (fZeroCopyUnackedLength > 0U)
+            && (close() == AbstractSocket::ErrorCode::SOCKET_ERR_OK) && fClosing)
+        {
+            // Lingers like a local close(): lwip sends the queued data before its FIN, and the
+            // sent and error callbacks report the closed connection once data sent without copy
+            // is released.
+            return checkResult(ERR_OK);
+        }
+
+        tcp_pcb* const handle = fpHandle;
+        if (handle != nullptr)
         {
-            (void)tcp_close(fpHandle);
             resetSocket();
+            (void)tcp_close(handle);
         }
 
         if (_dataListener != nullptr)
@@ -309,11 +372,14 @@ LwipSocket::connect(IPAddress const& ipAddr, uint16_t const port, ConnectedDeleg
     }
 
     fPendingTcpData           = {};
+    fUnackedLength            = 0U;
+    fZeroCopyUnackedLength    = 0U;
     ip_addr_t const connectIp = lwiputils::to_lwipIp(ipAddr);
 
     fDelegate   = delegate;
     fConnecting = true;
     fIsAborted  = false;
+    fClosing    = false;
     tcp_arg(fpHandle, this);
     tcp_sent(fpHandle, &tcpSentListener);
     tcp_recv(fpHandle, &tcpReceiveListener);
@@ -388,11 +454,14 @@ void LwipSocket::open(tcp_pcb* const handle)
 
     if (isClosed())
     {
-        fpHandle             = handle;
-        fIsAborted           = false;
-        fpPBufHead           = nullptr;
-        fOffsetInCurrentPBuf = 0;
-        fPendingTcpData      = {};
+        fpHandle               = handle;
+        fIsAborted             = false;
+        fClosing               = false;
+        fpPBufHead             = nullptr;
+        fOffsetInCurrentPBuf   = 0;
+        fPendingTcpData        = {};
+        fUnackedLength         = 0U;
+        fZeroCopyUnackedLength = 0U;
 #if LWIP_TCP_KEEPALIVE
         setKeepAlive();
 #endif
@@ -427,25 +496,44 @@ AbstractSocket::ErrorCode LwipSocket::close()
 {
     lwiputils::TASK_ASSERT_HOOK();
 
-    if (fpHandle == nullptr)
+    if ((fpHandle == nullptr) || fClosing)
     {
         return AbstractSocket::ErrorCode::SOCKET_ERR_OK;
     }
 
     discardData();
 
-    // From this point the socket PCB is handled internally by the TCP stack
-    tcp_err(fpHandle, nullptr);
+    // tcp_close() resets the connection and frees the pcb without any callback if received data
+    // hasn't been read, lwip doesn't reference data sent without copy afterwards
+    bool const linger = (fZeroCopyUnackedLength > 0U)
+                        && ((fpHandle->state == ESTABLISHED) || (fpHandle->state == CLOSE_WAIT))
+                        && (fpHandle->refused_data == nullptr)
+                        && (fpHandle->rcv_wnd == TCP_WND_MAX(fpHandle));
+
+    // From this point the socket PCB is handled internally by the TCP stack, unless data sent
+    // without copy is still referenced: the sent and error callbacks report when it is released
     tcp_recv(fpHandle, nullptr);
-    tcp_sent(fpHandle, nullptr);
     tcp_poll(fpHandle, nullptr, 0U);
+    if (!linger)
+    {
+        tcp_err(fpHandle, nullptr);
+        tcp_sent(fpHandle, nullptr);
+    }
+    fPendingTcpData = {};
 
     if (tcp_close(fpHandle) != ERR_OK)
     {
+        tcp_err(fpHandle, nullptr);
         abort();
         return AbstractSocket::ErrorCode::SOCKET_ERR_NOT_OK;
     }
 
+    if (linger)
+    {
+        fClosing = true;
+        return AbstractSocket::ErrorCode::SOCKET_ERR_OK;
+    }
+
     resetSocket();
     return AbstractSocket::ErrorCode::SOCKET_ERR_OK;
 }
@@ -701,6 +789,9 @@ void LwipSocket::resetSocket()
         tcp_poll(fpHandle, nullptr, 0U);
         fpHandle = nullptr;
     }
+    fUnackedLength         = 0U;
+    fZeroCopyUnackedLength = 0U;
+    fClosing               = false;
 }
 
 err_t LwipSocket::checkResult(err_t const error) const
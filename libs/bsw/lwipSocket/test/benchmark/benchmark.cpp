@@ -0,0 +1,189 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "lwipSocket/tcp/LwipServerSocket.h"
+#include "lwipSocket/tcp/LwipSocket.h"
+
+#include <benchmark/benchmark.h>
+#include <etl/array.h>
+#include <etl/span.h>
+#include <ip/IPAddress.h>
+#include <tcp/IDataSendNotificationListener.h>
+#include <tcp/util/BandwidthTestSocket.h>
+
+extern "C"
+{
+#include "lwip/init.h"
+#include "lwip/ip.h"
+#include "lwip/netif.h"
+#include "lwip/pbuf.h"
+#include "lwip/priv/tcp_priv.h"
+}
+
+// Zero-copy sends need reference pbufs, i.e. lwip built with MEMP_NUM_PBUF > 0. Otherwise
+// LwipSocket falls back to copying the data.
+namespace
+{
+// Payload of a DoIP diagnostic message carrying a maximum sized ISO-TP transfer.
+size_t const MESSAGE_SIZE        = 4095U;
+size_t const BYTES_PER_ITERATION = 1024U * 1024U;
+uint16_t const PORT              = 13400U;
+uint32_t const LOCAL_IP          = 0xC0A80001U;
+
+/**
+ * Network interface that copies each outgoing packet into a frame buffer and later feeds it back
+ * into the stack, like a TAP device driver does.
+ */
+class TapLoopback
+{
+public:
+    TapLoopback()
+    {
+        ip4_addr_t address;
+        ip4_addr_t netmask;
+        ip4_addr_t gateway;
+        IP4_ADDR(&address, 192, 168, 0, 1);
+        IP4_ADDR(&netmask, 255, 255, 255, 0);
+        IP4_ADDR(&gateway, 0, 0, 0, 0);
+        (void)netif_add(&_netif, &address, &netmask, &gateway, this, &init, &ip_input);
+        netif_set_default(&_netif);
+        netif_set_up(&_netif);
+        netif_set_link_up(&_netif);
+    }
+
+    ~TapLoopback() { netif_remove(&_netif); }
+
+    /** Delivers all queued frames, returns false if there were none. */
+    bool poll()
+    {
+        bool const delivered = (_count > 0U);
+        while (_count > 0U)
+        {
+            Frame const& frame = _frames[_head];
+            pbuf* const p      = pbuf_alloc(PBUF_RAW, frame.length, PBUF_RAM);
+            (void)pbuf_take(p, frame.data.data(), frame.length);
+            _head = (_head + 1U) % _frames.size();
+            --_count;
+            if (_netif.input(p, &_netif) != ERR_OK)
+            {
+                (void)pbuf_free(p);
+            }
+        }
+        return delivered;
+    }
+
+private:
+    struct Frame
+    {
+        ::etl::array<uint8_t, 1500U> data;
+        uint16_t length;
+    };
+
+    static err_t init(netif* const n)
+    {
+        n->output = &output;
+        n->mtu    = 1500U;
+        return ERR_OK;
+    }
+
+    static err_t output(netif* const n, pbuf* const p, ip4_addr_t const* const /* ipaddr */)
+    {
+        TapLoopback& self = *static_cast<TapLoopback*>(n->state);
+        if (self._count == self._frames.size())
+        {
+            return ERR_MEM;
+        }
+        Frame& frame = self._frames[(self._head + self._count) % self._frames.size()];
+        frame.length = pbuf_copy_partial(p, frame.data.data(), p->tot_len, 0U);
+        ++self._count;
+        return ERR_OK;
+    }
+
+    netif _netif{};
+    ::etl::array<Frame, 64U> _frames{};
+    size_t _head  = 0U;
+    size_t _count = 0U;
+};
+
+class AckCounter : public ::tcp::IDataSendNotificationListener
+{
+public:
+    void dataSent(uint16_t const length, SendResult const result) override
+    {
+        if (result == SendResult::DATA_SENT)
+        {
+            _acknowledged += length;
+        }
+    }
+
+    size_t _acknowledged = 0U;
+};
+
+void connectionEstablished(::tcp::AbstractSocket::ErrorCode) {}
+
+void initLwip()
+{
+    static bool const initialized = (lwip_init(), true);
+    (void)initialized;
+}
+
+template<bool ZeroCopy>
+void DoIpSizedMessageThroughput(benchmark::State& state)
+{
+    initLwip();
+
+    TapLoopback tap;
+    ::tcp::LwipSocket serverSideSocket;
+    ::tcp::BandwidthTestSocket sink(serverSideSocket);
+    ::tcp::LwipServerSocket server(PORT, sink);
+    (void)server.bind(::ip::make_ip4(LOCAL_IP), PORT);
+    (void)server.accept();
+
+    ::tcp::LwipSocket client;
+    AckCounter ackCounter;
+    client.setSendNotificationListener(&ackCounter);
+    (void)client.connect(
+        ::ip::make_ip4(LOCAL_IP),
+        PORT,
+        ::tcp::AbstractSocket::ConnectedDelegate::create<&connectionEstablished>());
+    while (tap.poll()) {}
+    client.disableNagleAlgorithm();
+
+    static ::etl::array<uint8_t, MESSAGE_SIZE> message{};
+    ::etl::span<uint8_t const> const data(message);
+
+    for (auto _ : state)
+    {
+        ackCounter._acknowledged = 0U;
+        while (ackCounter._acknowledged < BYTES_PER_ITERATION)
+        {
+            // The message buffer is never modified, so it remains valid for lwip until acked.
+            ::tcp::AbstractSocket::ErrorCode const result
+                = ZeroCopy ? client.sendZeroCopy(data) : client.send(data);
+            (void)client.flush();
+            if (!tap.poll())
+            {
+                // flushes delayed acks
+                tcp_fasttmr();
+            }
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * BYTES_PER_ITERATION));
+
+    (void)client.close();
+    while (tap.poll()) {}
+    server.close();
+    serverSideSocket.abort();
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(DoIpSizedMessageThroughput, false)->Name("TcpSendCopy");
+BENCHMARK_TEMPLATE(DoIpSizedMessageThroughput, true)->Name("TcpSendZeroCopy");
@@ -7,3 +7,333 @@
  *
  * SPDX-License-Identifier: Apache-2.0
  ********************************************************************************/
+
+#include "lwipSocket/tcp/LwipSocket.h"
+
+#include "bsp/timer/SystemTimerMock.h"
+
+#include <ip/IPAddress.h>
+#include <tcp/DataListenerMock.h>
+
+extern "C"
+{
+#include "lwip/init.h"
+#include "lwip/ip4.h"
+#include "lwip/netif.h"
+#include "lwip/pbuf.h"
+#include "lwip/priv/tcp_priv.h"
+#include "lwip/tcp.h"
+}
+
+#include <etl/array.h>
+
+#include <gmock/gmock.h>
+
+#include <deque>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using ::tcp::AbstractSocket;
+using ::tcp::DataListenerMock;
+using ::tcp::IDataListener;
+using ::tcp::LwipSocket;
+
+size_t const IP_HEADER_LENGTH    = 20U;
+size_t const DESTINATION_PORT    = 2U;
+size_t const RESPONSE_LENGTH     = 2000U;
+uint32_t const LOCAL_IP_ADDRESS  = 0x0A000001U;
+uint16_t const FIRST_PEER_PORT   = 13400U;
+size_t const MAX_PUMP_ITERATIONS = 100U;
+
+/**
+ * Peer of the socket under test, a raw lwip pcb listening on the same network interface.
+ */
+struct Peer
+{
+    tcp_pcb* listener  = nullptr;
+    tcp_pcb* pcb       = nullptr;
+    bool finReceived   = false;
+    bool resetReceived = false;
+    std::vector<uint8_t> received;
+
+    static err_t accept(void* const arg, tcp_pcb* const pcb, err_t const /* result */)
+    {
+        Peer& peer = *static_cast<Peer*>(arg);
+        peer.pcb   = pcb;
+        tcp_arg(pcb, &peer);
+        tcp_recv(pcb, &Peer::receive);
+        tcp_err(pcb, &Peer::error);
+        return ERR_OK;
+    }
+
+    static err_t receive(void* const arg, tcp_pcb* const pcb, pbuf* const p, err_t const result)
+    {
+        Peer& peer = *static_cast<Peer*>(arg);
+        if (p == nullptr)
+        {
+            peer.finReceived = true;
+            return ERR_OK;
+        }
+        size_t const offset = peer.received.size();
+        peer.received.resize(offset + p->tot_len);
+        (void)pbuf_copy_partial(p, &peer.received[offset], p->tot_len, 0U);
+        tcp_recved(pcb, p->tot_len);
+        (void)pbuf_free(p);
+        return result;
+    }
+
+    static void error(void* const arg, err_t const result)
+    {
+        Peer& peer = *static_cast<Peer*>(arg);
+        peer.pcb   = nullptr;
+        if (result == ERR_RST)
+        {
+            peer.resetReceived = true;
+        }
+    }
+};
+
+class LwipSocketTest : public Test
+{
+public:
+    LwipSocketTest() : _peerPort(nextPeerPort())
+    {
+        static bool const initialized = (lwip_init(), true);
+        (void)initialized;
+        ON_CALL(_systemTimerMock, getSystemTimeMs32Bit()).WillByDefault(Return(0U));
+
+        ip4_addr_t address;
+        ip4_addr_t netmask;
+        ip4_addr_set_u32(&address, PP_HTONL(LOCAL_IP_ADDRESS));
+        ip4_addr_set_u32(&netmask, PP_HTONL(0xFFFFFF00U));
+        (void)netif_add(
+            &_netif, &address, &netmask, IP4_ADDR_ANY4, this, &LwipSocketTest::initNetif, nullptr);
+        netif_set_up(&_netif);
+        netif_set_link_up(&_netif);
+
+        for (size_t idx = 0U; idx < _response.size(); ++idx)
+        {
+            _response[idx] = static_cast<uint8_t>(idx);
+        }
+
+        tcp_pcb* const listener = tcp_new_ip_type(IPADDR_TYPE_V4);
+        (void)tcp_bind(listener, IP4_ADDR_ANY, _peerPort);
+        _peer.listener = tcp_listen(listener);
+        tcp_arg(_peer.listener, &_peer);
+        tcp_accept(_peer.listener, &Peer::accept);
+
+        _socket.setDataListener(&_dataListener);
+    }
+
+    ~LwipSocketTest() override
+    {
+        _socket.setDataListener(nullptr);
+        _socket.abort();
+        if (_peer.pcb != nullptr)
+        {
+            tcp_arg(_peer.pcb, nullptr);
+            tcp_err(_peer.pcb, nullptr);
+            tcp_abort(_peer.pcb);
+        }
+        (void)tcp_close(_peer.listener);
+        for (pbuf* const p : _packets)
+        {
+            (void)pbuf_free(p);
+        }
+        netif_remove(&_netif);
+    }
+
+    static uint16_t nextPeerPort()
+    {
+        static uint16_t port = FIRST_PEER_PORT;
+        return port++;
+    }
+
+    static err_t initNetif(netif* const netif)
+    {
+        netif->output = &LwipSocketTest::output;
+        netif->mtu    = 1500U;
+        return ERR_OK;
+    }
+
+    /// Queues a copy of each packet instead of sending it, see deliver().
+    static err_t output(netif* const netif, pbuf* const p, ip4_addr_t const* const /* ipAddr */)
+    {
+        LwipSocketTest& test = *static_cast<LwipSocketTest*>(netif->state);
+        pbuf* const copy     = pbuf_alloc(PBUF_RAW, p->tot_len, PBUF_RAM);
+        (void)pbuf_copy(copy, p);
+        test._packets.push_back(copy);
+        return ERR_OK;
+    }
+
+    static uint16_t getDestinationPort(pbuf const* const p)
+    {
+        uint8_t const* const data = static_cast<uint8_t const*>(p->payload);
+        return static_cast<uint16_t>(
+            (data[IP_HEADER_LENGTH + DESTINATION_PORT] << 8U)
+            | data[IP_HEADER_LENGTH + DESTINATION_PORT + 1U]);
+    }
+
+    /// Delivers up to maxCount queued packets addressed to the given port and keeps all others.
+    void deliver(uint16_t const port, size_t maxCount = SIZE_MAX)
+    {
+        std::deque<pbuf*> packets;
+        packets.swap(_packets);
+        for (pbuf* const p : packets)
+        {
+            if ((maxCount > 0U) && (getDestinationPort(p) == port))
+            {
+                --maxCount;
+                (void)ip4_input(p, &_netif);
+            }
+            else
+            {
+                _packets.push_back(p);
+            }
+        }
+    }
+
+    /// Exchanges packets including delayed acknowledgements until the network is idle.
+    void pump()
+    {
+        for (size_t idx = 0U; idx < MAX_PUMP_ITERATIONS; ++idx)
+        {
+            tcp_fasttmr();
+            if (_packets.empty())
+            {
+                return;
+            }
+            while (!_packets.empty())
+            {
+                pbuf* const p = _packets.front();
+                _packets.pop_front();
+                (void)ip4_input(p, &_netif);
+            }
+        }
+    }
+
+    void connect()
+    {
+        ip::IPAddress const address = ip::make_ip4(LOCAL_IP_ADDRESS);
+        ASSERT_EQ(
+            AbstractSocket::ErrorCode::SOCKET_ERR_OK,
+            _socket.connect(
+                address,
+                _peerPort,
+                AbstractSocket::ConnectedDelegate::
+                    create<LwipSocketTest, &LwipSocketTest::connected>(*this)));
+        pump();
+        ASSERT_TRUE(_connected);
+        ASSERT_NE(nullptr, _peer.pcb);
+    }
+
+    void connected(AbstractSocket::ErrorCode const result)
+    {
+        _connected = (result == AbstractSocket::ErrorCode::SOCKET_ERR_OK);
+    }
+
+    void sendResponse()
+    {
+        ASSERT_EQ(AbstractSocket::ErrorCode::SOCKET_ERR_OK, _socket.sendZeroCopy(_response));
+        ASSERT_EQ(AbstractSocket::ErrorCode::SOCKET_ERR_OK, _socket.flush());
+        ASSERT_TRUE(_socket.hasUnacknowledgedZeroCopyData());
+    }
+
+protected:
+    NiceMock<SystemTimerMock> _systemTimerMock;
+    StrictMock<DataListenerMock> _dataListener;
+    netif _netif{};
+    std::deque<pbuf*> _packets;
+    Peer _peer;
+    uint16_t _peerPort;
+    ::etl::array<uint8_t, RESPONSE_LENGTH> _response{};
+    LwipSocket _socket;
+    bool _connected = false;
+};
+
+/**
+ * \desc
+ * Data sent without copy stays unacknowledged until the last segment has been acknowledged.
+ */
+TEST_F(LwipSocketTest, testPartiallyAcknowledgedZeroCopyData)
+{
+    connect();
+    sendResponse();
+
+    deliver(_peerPort, 1U);
+    tcp_fasttmr();
+    deliver(_socket.getLocalPort());
+    EXPECT_EQ(TCP_MSS, _peer.received.size());
+    EXPECT_TRUE(_socket.hasUnacknowledgedZeroCopyData());
+
+    pump();
+    EXPECT_FALSE(_socket.hasUnacknowledgedZeroCopyData());
+    EXPECT_THAT(_peer.received, ElementsAreArray(_response));
+}
+
+/**
+ * \desc
+ * A socket closed with unacknowledged zero-copy data sends the data before its FIN and reports
+ * the closed connection once the data is released.
+ */
+TEST_F(LwipSocketTest, testCloseLingersUntilZeroCopyDataIsAcknowledged)
+{
+    connect();
+    sendResponse();
+
+    EXPECT_EQ(AbstractSocket::ErrorCode::SOCKET_ERR_OK, _socket.close());
+    Mock::VerifyAndClearExpectations(&_dataListener);
+
+    EXPECT_CALL(_dataListener, connectionClosed(IDataListener::ErrorCode::ERR_CONNECTION_CLOSED));
+    pump();
+    EXPECT_THAT(_peer.received, ElementsAreArray(_response));
+    EXPECT_TRUE(_peer.finReceived);
+    EXPECT_FALSE(_peer.resetReceived);
+    EXPECT_FALSE(_socket.hasUnacknowledgedZeroCopyData());
+}
+
+/**
+ * \desc
+ * A FIN received while zero-copy data is unacknowledged doesn't reset the connection, the
+ * socket lingers like a local close.
+ */
+TEST_F(LwipSocketTest, testRemoteCloseLingersUntilZeroCopyDataIsAcknowledged)
+{
+    connect();
+    sendResponse();
+
+    ASSERT_EQ(ERR_OK, tcp_shutdown(_peer.pcb, 0, 1));
+    deliver(_socket.getLocalPort());
+    Mock::VerifyAndClearExpectations(&_dataListener);
+    EXPECT_TRUE(_socket.hasUnacknowledgedZeroCopyData());
+
+    EXPECT_CALL(_dataListener, connectionClosed(IDataListener::ErrorCode::ERR_CONNECTION_CLOSED));
+    pump();
+    EXPECT_THAT(_peer.received, ElementsAreArray(_response));
+    EXPECT_TRUE(_peer.finReceived);
+    EXPECT_FALSE(_peer.resetReceived);
+    EXPECT_FALSE(_socket.hasUnacknowledgedZeroCopyData());
+}
+
+/**
+ * \desc
+ * A FIN received without unacknowledged data closes the socket immediately.
+ */
+TEST_F(LwipSocketTest, testRemoteCloseWithoutPendingData)
+{
+    connect();
+
+    EXPECT_CALL(_dataListener, connectionClosed(IDataListener::ErrorCode::ERR_CONNECTION_CLOSED));
+    ASSERT_EQ(ERR_OK, tcp_shutdown(_peer.pcb, 0, 1));
+    deliver(_socket.getLocalPort());
+    Mock::VerifyAndClearExpectations(&_dataListener);
+    EXPECT_TRUE(_socket.isClosed());
+
+    pump();
+    EXPECT_TRUE(_peer.finReceived);
+    EXPECT_FALSE(_peer.resetReceived);
+}
+
+} // namespace
@@ -449,6 +449,21 @@ public:
         return _router.run();
     }
 
+    typename Router<MAX_NUM_CHANNELS>::BatchResult routeBatch(size_t const budget)
+    {
+        if (!_initialized)
+        {
+            return {};
+        }
+
+        return _router.runBatch(budget);
+    }
+
+    void setChannelWeight(uint8_t const channelId, uint8_t const weight)
+    {
+        _router.setWeight(channelId, weight);
+    }
+
     ::etl::span<PduTransportChannelAdapter const> pduTransportChannelAdapters() const
     {
         if (!_initialized)
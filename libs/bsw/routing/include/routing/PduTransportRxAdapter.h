@@ -15,9 +15,7 @@
 #include "routing/RxAdapterTable.h"
 #include "routing/util.h"
 
-#include <etl/algorithm.h>
 #include <etl/array.h>
-#include <etl/iterator.h>
 #include <etl/span.h>
 #include <io/IReader.h>
 
@@ -217,8 +215,8 @@ ErrorHandler::StatusCode
 PduTransportRxAdapter<MAX_ELEMENT_SIZE>::lookup(::etl::span<uint8_t const> message) const
 {
     auto const messageId = message.take<::etl::be_uint32_t const>();
-    auto const pos = ::etl::find(_table.messageIds.begin(), _table.messageIds.end(), messageId);
-    if (pos == _table.messageIds.end())
+    auto const index     = findMessageIndex(_table, messageId);
+    if (index == _table.messageIds.size())
     {
         ++_unknownMessagePdus;
 
@@ -227,7 +225,6 @@ PduTransportRxAdapter<MAX_ELEMENT_SIZE>::lookup(::etl::span<uint8_t const> messa
 
     uint32_t const parsedPayloadLength = message.take<::etl::be_uint32_t const>();
 
-    auto const index = static_cast<size_t>(::etl::distance(_table.messageIds.begin(), pos));
     uint32_t const messageLength = (!_table.messageLengths.empty())
                                        ? static_cast<uint32_t>(_table.messageLengths[index])
                                        : 0U;
@@ -15,8 +15,11 @@
 #include "routing/pduRouting.h"
 
 #include <etl/algorithm.h>
+#include <etl/array.h>
+#include <etl/bitset.h>
 #include <etl/span.h>
 #include <io/IReader.h>
+#include <io/ISharedBufferPool.h>
 #include <io/IWriter.h>
 
 #include <platform/estdint.h>
@@ -34,6 +37,19 @@ template<uint8_t MAX_NUM_CHANNELS>
 class Router
 {
 public:
+    /**
+     * Outcome of a runBatch() call.
+     */
+    struct BatchResult
+    {
+        // The number of PDUs routed.
+        size_t routed = 0U;
+        // The channels which still have PDUs to read.
+        ::etl::bitset<MAX_NUM_CHANNELS> backlog;
+
+        bool hasBacklog() const { return backlog.any(); }
+    };
+
     // [PUBLIC_API_BEGIN]
     /**
      * Construct an uninitialized Router.
@@ -71,13 +87,51 @@ public:
      */
     bool run();
 
+    /**
+     * Route up to budget PDUs.
+     *
+     * Channels are served round robin. Each channel routes up to its weight in PDUs per turn
+     * before the next channel is served, so a busy channel cannot starve the others. A turn that
+     * is interrupted because the budget is exhausted is resumed by the next call.
+     *
+     * It returns the number of PDUs routed and the channels which still have PDUs to read, so the
+     * caller can decide whether to run again.
+     */
+    BatchResult runBatch(size_t budget);
+
+    /**
+     * Set the number of PDUs channelId may route per turn in runBatch(). A weight of 0 skips the
+     * channel. All channels have a weight of 1 unless set otherwise, before or after init(). After
+     * init(), channelId must be one of the configured channels.
+     */
+    void setWeight(uint8_t channelId, uint8_t weight);
+
+    /**
+     * Enable the shared buffer mode: PDUs are routed with routeShared(), i.e. their payload is
+     * stored once in pool and the writers receive SharedPduDescriptors. Passing nullptr switches
+     * back to writing a copy of the PDU to each writer.
+     */
+    void setSharedBufferPool(::io::ISharedBufferPool* pool);
+
     // [PUBLIC_API_END]
 private:
+    bool routeFrom(uint8_t channelId, ::io::IReader& reader);
+
+    static ::etl::array<uint8_t, MAX_NUM_CHANNELS> defaultWeights()
+    {
+        ::etl::array<uint8_t, MAX_NUM_CHANNELS> weights;
+        weights.fill(1U);
+        return weights;
+    }
+
     ::routing::PduRoutingTable _table;
     ::etl::span<::io::IReader*> _readers;
     ::etl::span<::io::IWriter*> _writers;
-    bool _initialized         = false;
-    uint8_t _currentChannelId = 0;
+    ::etl::array<uint8_t, MAX_NUM_CHANNELS> _weights = defaultWeights();
+    ::io::ISharedBufferPool* _sharedBufferPool = nullptr;
+    bool _initialized                          = false;
+    uint8_t _currentChannelId                  = 0;
+    uint8_t _remainingQuota                    = 0;
 };
 
 template<uint8_t MAX_NUM_CHANNELS>
@@ -160,8 +214,7 @@ bool Router<MAX_NUM_CHANNELS>::run()
     for (size_t i = 0; i < _readers.size(); ++i)
     {
         auto const reader = _readers[_currentChannelId];
-        bool const pduRouted
-            = reader != nullptr ? route(_currentChannelId, _table, *reader, _writers) : false;
+        bool const pduRouted = reader != nullptr ? routeFrom(_currentChannelId, *reader) : false;
         _currentChannelId = static_cast<size_t>(_currentChannelId) + 1U < _readers.size()
                                 ? _currentChannelId + 1U
                                 : 0U;
@@ -174,4 +227,93 @@ bool Router<MAX_NUM_CHANNELS>::run()
     return false;
 }
 
+template<uint8_t MAX_NUM_CHANNELS>
+typename Router<MAX_NUM_CHANNELS>::BatchResult
+Router<MAX_NUM_CHANNELS>::runBatch(size_t const budget)
+{
+    BatchResult result;
+    if (!_initialized)
+    {
+        ::util::logger::Logger::error(::util::logger::ROUTING, "Router uninitialized");
+        return result;
+    }
+
+    // A full round without any PDU read from any channel means there is nothing left to route.
+    size_t idleChannels = 0U;
+    while ((result.routed < budget) && (idleChannels < _readers.size()))
+    {
+        if (_remainingQuota == 0U)
+        {
+            _remainingQuota = _weights[_currentChannelId];
+        }
+
+        auto const reader = _readers[_currentChannelId];
+        bool pduRead      = false;
+        while ((reader != nullptr) && (_remainingQuota > 0U) && (result.routed < budget))
+        {
+            if (reader->peek().empty())
+            {
+                break;
+            }
+            // A PDU which can't be routed is discarded and still uses up the channel's quota.
+            pduRead = true;
+            --_remainingQuota;
+            if (routeFrom(_currentChannelId, *reader))
+            {
+                ++result.routed;
+            }
+        }
+
+        if ((result.routed == budget) && (_remainingQuota > 0U))
+        {
+            break;
+        }
+
+        idleChannels      = pduRead ? 0U : (idleChannels + 1U);
+        _remainingQuota   = 0U;
+        _currentChannelId = static_cast<size_t>(_currentChannelId) + 1U < _readers.size()
+                                ? _currentChannelId + 1U
+                                : 0U;
+    }
+
+    for (size_t i = 0; i < _readers.size(); ++i)
+    {
+        auto const reader = _readers[i];
+        (void)result.backlog.set(i, (reader != nullptr) && (!reader->peek().empty()));
+    }
+
+    return result;
+}
+
+template<uint8_t MAX_NUM_CHANNELS>
+void Router<MAX_NUM_CHANNELS>::setWeight(uint8_t const channelId, uint8_t const weight)
+{
+    size_t const numberOfChannels
+        = _initialized ? _readers.size() : static_cast<size_t>(MAX_NUM_CHANNELS);
+    if (channelId >= numberOfChannels)
+    {
+        ::util::logger::Logger::warn(
+            ::util::logger::ROUTING, "Invalid channel ID for weight [%u]", channelId);
+        return;
+    }
+
+    _weights[channelId] = weight;
+}
+
+template<uint8_t MAX_NUM_CHANNELS>
+void Router<MAX_NUM_CHANNELS>::setSharedBufferPool(::io::ISharedBufferPool* const pool)
+{
+    _sharedBufferPool = pool;
+}
+
+template<uint8_t MAX_NUM_CHANNELS>
+bool Router<MAX_NUM_CHANNELS>::routeFrom(uint8_t const channelId, ::io::IReader& reader)
+{
+    if (_sharedBufferPool != nullptr)
+    {
+        return routeShared(channelId, _table, reader, _writers, *_sharedBufferPool);
+    }
+    return route(channelId, _table, reader, _writers);
+}
+
 } // namespace routing
@@ -44,6 +44,10 @@ struct RxAdapterTable
     // The offset in each frame of each PDU.
     // size: N
     ::etl::span<::etl::be_uint32_t const> pduOffsets;
+    // The messageIndex values ordered by ascending message ID, used to look up a message ID with
+    // a binary search. If empty, messageIds is searched linearly.
+    // size: P
+    ::etl::span<::etl::be_uint32_t const> messageIdIndex;
 };
 
 // [RX_ADAPTER_TABLE_END]
@@ -54,4 +58,10 @@ struct RxAdapterTable
  */
 bool load(::etl::span<uint8_t const> mem, RxAdapterTable& table);
 
+/**
+ * Returns the messageIndex of messageId in table, or table.messageIds.size() if the message ID
+ * is unknown. Uses the messageIdIndex column if present, so the lookup is O(log P).
+ */
+size_t findMessageIndex(RxAdapterTable const& table, uint32_t messageId);
+
 } // namespace routing
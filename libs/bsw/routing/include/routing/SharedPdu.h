@@ -0,0 +1,80 @@
+/********************************************************************************
+ * Copyright (c) 2026 BMW AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <etl/span.h>
+#include <etl/unaligned_type.h>
+#include <io/IReader.h>
+#include <io/ISharedBufferPool.h>
+
+#include <platform/estdint.h>
+
+namespace routing
+{
+// [SHARED_PDU_DESCRIPTOR_BEGIN]
+/**
+ * In shared buffer mode, the Router writes a descriptor to the destination writers instead of a
+ * copy of the PDU:
+ *  - 4 bytes: output message ID (big endian)
+ *  - 4 bytes: handle of the ::io::ISharedBufferPool buffer holding the payload (big endian)
+ */
+struct SharedPduDescriptor
+{
+    static constexpr size_t SIZE = 2U * sizeof(::etl::be_uint32_t);
+};
+
+// [SHARED_PDU_DESCRIPTOR_END]
+
+/**
+ * A PDU referenced by a SharedPduDescriptor.
+ */
+struct SharedPdu
+{
+    uint32_t outputMessageId = 0U;
+    // The payload in the shared buffer, may be empty for a valid PDU.
+    ::etl::span<uint8_t const> payload;
+    // false if no PDU is available.
+    bool valid = false;
+};
+
+/**
+ * Reads the SharedPduDescriptors written by routeShared() to one destination and resolves them to
+ * the payloads stored in the pool.
+ */
+class SharedPduReader
+{
+public:
+    // [PUBLIC_API_BEGIN]
+    /**
+     * Construct a SharedPduReader reading descriptors from descriptorReader.
+     */
+    SharedPduReader(::io::IReader& descriptorReader, ::io::ISharedBufferPool& pool);
+
+    /**
+     * Return the next PDU. The PDU isn't valid if no PDU is available.
+     *
+     * Invalid descriptors in front of the next PDU are released from the descriptor reader, so
+     * this isn't const. Calling it again without release() returns the same PDU.
+     */
+    SharedPdu peek();
+
+    /**
+     * Release the current descriptor and this destination's reference to its buffer.
+     */
+    void release();
+    // [PUBLIC_API_END]
+
+private:
+    ::io::IReader& _descriptorReader;
+    ::io::ISharedBufferPool& _pool;
+};
+
+} // namespace routing
@@ -15,6 +15,7 @@
 #include <etl/span.h>
 #include <etl/unaligned_type.h>
 #include <io/IReader.h>
+#include <io/ISharedBufferPool.h>
 #include <io/IWriter.h>
 
 #include <platform/estdint.h>
@@ -27,10 +28,30 @@ bool route(
     ::io::IReader& reader,
     ::etl::span<::io::IWriter*> writers);
 
+/**
+ * Routes the next PDU of reader like route(), but copies its payload only once into a buffer of
+ * pool. Each destination writer receives a SharedPduDescriptor referencing the buffer, which is
+ * returned to the pool when the last destination has released it (see SharedPduReader).
+ */
+bool routeShared(
+    uint8_t srcChannelId,
+    PduRoutingTable const& table,
+    ::io::IReader& reader,
+    ::etl::span<::io::IWriter*> writers,
+    ::io::ISharedBufferPool& pool);
+
 void outputPdu(
     ::etl::be_uint32_t outputMessageId,
     uint8_t dstChannelId,
     ::etl::span<uint8_t const> const payload,
     ::io::IWriter& writer);
 
+/**
+ * Writes a SharedPduDescriptor to writer. Returns false if the writer is full.
+ */
+bool outputSharedPdu(
+    ::etl::be_uint32_t outputMessageId,
+    ::io::ISharedBufferPool::Handle handle,
+    ::io::IWriter& writer);
+
 } // namespace routing
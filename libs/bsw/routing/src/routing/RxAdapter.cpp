@@ -13,7 +13,6 @@
 #include "routing/Logger.h"
 
 #include <etl/algorithm.h>
-#include <etl/iterator.h>
 #include <etl/span.h>
 #include <etl/unaligned_type.h>
 #include <util/logger/Logger.h>
@@ -64,16 +63,15 @@ ErrorHandler::StatusCode RxAdapter::lookup(::etl::span<uint8_t const> message) c
         return ErrorHandler::StatusCode::INVALID_PARSED_LENGTH;
     }
 
-    auto const* const pos
-        = ::etl::find(_table.messageIds.begin(), _table.messageIds.end(), messageId);
-    if (pos == _table.messageIds.end())
+    auto const index = findMessageIndex(_table, messageId);
+    if (index == _table.messageIds.size())
     {
         ++_unknownMessagePdus;
 
         return ErrorHandler::StatusCode::UNKNOWN_MESSAGE_ID;
     }
 
-    _currentMessageIndex = static_cast<size_t>(::etl::distance(_table.messageIds.begin(), pos));
+    _currentMessageIndex = index;
 
     return ErrorHandler::StatusCode::OK;
 }
@@ -15,6 +15,8 @@
 
 #include <blob/Config.h>
 #include <blob/util.h>
+#include <etl/algorithm.h>
+#include <etl/iterator.h>
 
 namespace routing
 {
@@ -48,8 +50,41 @@ bool load(::etl::span<uint8_t const> mem, RxAdapterTable& table)
     mem           = ::blob::loadColumn(table.pduLengthsOffsets, mem);
     mem           = ::blob::loadColumn(table.pduLengths, mem);
     mem           = ::blob::loadColumn(table.pduOffsets, mem);
+    mem           = ::blob::loadColumn(table.messageIdIndex, mem);
+
+    // The index is optional. Blobs generated without it fall back to a linear search.
+    if (table.messageIdIndex.size() != table.messageIds.size())
+    {
+        table.messageIdIndex = {};
+    }
 
     return true;
 }
 
+size_t findMessageIndex(RxAdapterTable const& table, uint32_t const messageId)
+{
+    auto const& messageIds = table.messageIds;
+    if (table.messageIdIndex.empty())
+    {
+        auto const* const pos = ::etl::find(messageIds.begin(), messageIds.end(), messageId);
+        return static_cast<size_t>(::etl::distance(messageIds.begin(), pos));
+    }
+
+    auto const* const pos = ::etl::lower_bound(
+        table.messageIdIndex.begin(),
+        table.messageIdIndex.end(),
+        messageId,
+        [&messageIds](::etl::be_uint32_t const index, uint32_t const id)
+        {
+            return (index < messageIds.size()) && (messageIds[index] < id);
+        });
+    if ((pos == table.messageIdIndex.end()) || (*pos >= messageIds.size())
+        || (messageIds[*pos] != messageId))
+    {
+        return messageIds.size();
+    }
+
+    return *pos;
+}
+
 } // namespace routing
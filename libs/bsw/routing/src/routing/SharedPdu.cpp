@@ -0,0 +1,73 @@
+/********************************************************************************
+ * Copyright (c) 2026 BMW AG
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "routing/SharedPdu.h"
+
+#include "routing/Logger.h"
+
+#include <util/logger/Logger.h>
+
+namespace routing
+{
+namespace logger = ::util::logger;
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-vararg): Logger API uses C-style varargs.
+SharedPduReader::SharedPduReader(::io::IReader& descriptorReader, ::io::ISharedBufferPool& pool)
+: _descriptorReader(descriptorReader), _pool(pool)
+{}
+
+SharedPdu SharedPduReader::peek()
+{
+    auto descriptor = _descriptorReader.peek();
+    while (!descriptor.empty())
+    {
+        if (descriptor.size() == SharedPduDescriptor::SIZE)
+        {
+            SharedPdu pdu;
+            pdu.outputMessageId   = descriptor.take<::etl::be_uint32_t const>();
+            uint32_t const handle = descriptor.take<::etl::be_uint32_t const>();
+            pdu.payload           = _pool.data(handle);
+            // a buffer of 0 bytes holds an empty PDU, an invalid handle has no data
+            if (pdu.payload.data() != nullptr)
+            {
+                pdu.valid = true;
+                return pdu;
+            }
+        }
+
+        logger::Logger::error(
+            logger::ROUTING,
+            "Invalid shared PDU descriptor [size: %u]",
+            static_cast<uint32_t>(descriptor.size()));
+        _descriptorReader.release();
+        descriptor = _descriptorReader.peek();
+    }
+    return {};
+}
+
+void SharedPduReader::release()
+{
+    auto descriptor = _descriptorReader.peek();
+    if (descriptor.empty())
+    {
+        return;
+    }
+
+    if (descriptor.size() == SharedPduDescriptor::SIZE)
+    {
+        descriptor.advance(sizeof(::etl::be_uint32_t));
+        uint32_t const handle = descriptor.take<::etl::be_uint32_t const>();
+        _pool.release(handle);
+    }
+    _descriptorReader.release();
+}
+
+// NOLINTEND(cppcoreguidelines-pro-type-vararg)
+} // namespace routing
@@ -11,9 +11,11 @@
 #include "routing/pduRouting.h"
 
 #include "routing/Logger.h"
+#include "routing/SharedPdu.h"
 
 #include <blob/Config.h>
 #include <blob/util.h>
+#include <etl/algorithm.h>
 #include <etl/span.h>
 #include <util/logger/Logger.h>
 
@@ -43,11 +45,19 @@ bool load(::etl::span<uint8_t const> mem, ::routing::PduRoutingTable& table)
     return true;
 }
 
-bool route(
+namespace
+{
+/**
+ * Peeks the next PDU from reader and looks up its destinations. Invalid PDUs are released.
+ * Returns false if there is no PDU to route.
+ */
+bool peekRoutablePdu(
     uint8_t const srcChannelId,
     PduRoutingTable const& table,
     ::io::IReader& reader,
-    ::etl::span<::io::IWriter*> const writers)
+    ::etl::span<uint8_t const>& payload,
+    ::etl::span<uint8_t const>& dsts,
+    ::etl::span<::etl::be_uint32_t const>& outputMessageIds)
 {
     auto const pdu = reader.peek();
 
@@ -88,10 +98,29 @@ bool route(
     uint32_t const start = table.destinationOffsets[internalPduId];
     uint32_t const end   = table.destinationOffsets[static_cast<size_t>(internalPduId) + 1U];
 
-    auto const dsts             = table.destinations.subspan(start, end - start);
-    auto const outputMessageIds = table.outputMessageIds.subspan(start, end - start);
+    dsts             = table.destinations.subspan(start, end - start);
+    outputMessageIds = table.outputMessageIds.subspan(start, end - start);
+    payload          = pdu.subspan(sizeof(::etl::be_uint32_t));
+
+    return true;
+}
+
+} // namespace
+
+bool route(
+    uint8_t const srcChannelId,
+    PduRoutingTable const& table,
+    ::io::IReader& reader,
+    ::etl::span<::io::IWriter*> const writers)
+{
+    ::etl::span<uint8_t const> payload;
+    ::etl::span<uint8_t const> dsts;
+    ::etl::span<::etl::be_uint32_t const> outputMessageIds;
+    if (!peekRoutablePdu(srcChannelId, table, reader, payload, dsts, outputMessageIds))
+    {
+        return false;
+    }
 
-    auto const payload = pdu.subspan(sizeof(::etl::be_uint32_t));
     for (size_t i = 0; i < dsts.size(); i++)
     {
         auto const dst = dsts[i];
@@ -109,6 +138,55 @@ bool route(
     return true;
 }
 
+bool routeShared(
+    uint8_t const srcChannelId,
+    PduRoutingTable const& table,
+    ::io::IReader& reader,
+    ::etl::span<::io::IWriter*> const writers,
+    ::io::ISharedBufferPool& pool)
+{
+    ::etl::span<uint8_t const> payload;
+    ::etl::span<uint8_t const> dsts;
+    ::etl::span<::etl::be_uint32_t const> outputMessageIds;
+    if (!peekRoutablePdu(srcChannelId, table, reader, payload, dsts, outputMessageIds))
+    {
+        return false;
+    }
+
+    auto const handle = pool.allocate(payload.size());
+    if (handle == ::io::ISharedBufferPool::INVALID_HANDLE)
+    {
+        reader.release();
+        logger::Logger::error(
+            logger::ROUTING,
+            "No shared buffer for PDU (src-channel-index: %u, payload-size: %u)",
+            srcChannelId,
+            static_cast<uint32_t>(payload.size()));
+        return false;
+    }
+
+    // The payload is copied once, each destination only gets a descriptor referencing it.
+    (void)::etl::copy(payload, pool.data(handle));
+    reader.release();
+
+    // Hand out one reference per destination before the first descriptor becomes visible, as a
+    // consumer may release it right away. References of skipped destinations are dropped.
+    pool.commit(handle, dsts.size());
+    for (size_t i = 0; i < dsts.size(); i++)
+    {
+        auto const dst = dsts[i];
+        logger::Logger::debug(logger::ROUTING, "Routing shared PDU to destination [%u]", dst);
+        auto* const writer = dst < writers.size() ? writers[dst] : nullptr;
+        if ((writer == nullptr)
+            || (!::routing::outputSharedPdu(outputMessageIds[i], handle, *writer)))
+        {
+            pool.release(handle);
+        }
+    }
+
+    return true;
+}
+
 void outputPdu(
     ::etl::be_uint32_t const outputMessageId,
     uint8_t const dstChannelId,
@@ -134,5 +212,23 @@ void outputPdu(
         static_cast<uint32_t>(payload.size()));
 }
 
+bool outputSharedPdu(
+    ::etl::be_uint32_t const outputMessageId,
+    ::io::ISharedBufferPool::Handle const handle,
+    ::io::IWriter& writer)
+{
+    auto descriptor = writer.allocate(SharedPduDescriptor::SIZE);
+    if (descriptor.size() != SharedPduDescriptor::SIZE)
+    {
+        return false;
+    }
+
+    descriptor.take<::etl::be_uint32_t>() = outputMessageId;
+    descriptor.take<::etl::be_uint32_t>() = static_cast<uint32_t>(handle);
+    writer.commit();
+
+    return true;
+}
+
 // NOLINTEND(cppcoreguidelines-pro-type-vararg)
 } // namespace routing
@@ -13,12 +13,14 @@
 #include "routing/definition.h"
 
 #include "routing/PduRoutingTable.h"
+#include "routing/SharedPdu.h"
 
 #include <blob/Blob.h>
 #include <etl/array.h>
 #include <etl/span.h>
 #include <etl/vector.h>
 #include <io/MemoryQueue.h>
+#include <io/SharedBufferPool.h>
 
 #include <gmock/gmock.h>
 
@@ -86,6 +88,17 @@ struct RouterWithDefinitions
     ::routing::PduRoutingTable pduRoutingTable;
 };
 
+size_t drain(::io::IReader& reader)
+{
+    size_t count = 0U;
+    while (!reader.peek().empty())
+    {
+        reader.release();
+        ++count;
+    }
+    return count;
+}
+
 void writePdu(uint32_t const id, size_t const size, ::io::IWriter& writer)
 {
     auto pdu = writer.allocate(size);
@@ -703,4 +716,271 @@ TEST(RouterTest, different_number_of_destinations_and_message_ids)
     ASSERT_FALSE(router.run());
 }
 
+/**
+ * \desc
+ * runBatch() routes PDUs round robin until the budget is used up and reports the channels with
+ * a backlog.
+ */
+TEST(RouterTest, run_batch_within_budget)
+{
+    constexpr size_t MAX_NUM_CHANNELS = 3;
+    ::routing::Definition defs[]
+        = {::routing::Definition().in(0, 0, 0, 4).out(1, 10, 0, 4),
+           ::routing::Definition().in(1, 1, 0, 4).out(2, 11, 0, 4),
+           ::routing::Definition().in(2, 2, 0, 4).out(0, 12, 0, 4)};
+    RouterWithDefinitions<MAX_NUM_CHANNELS> router;
+    router.init(defs);
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        writePdu(0, 12, router.rxWriters[0]);
+        writePdu(1, 12, router.rxWriters[1]);
+    }
+    writePdu(2, 12, router.rxWriters[2]);
+
+    auto result = router.router.runBatch(5U);
+    EXPECT_EQ(5U, result.routed);
+    EXPECT_TRUE(result.hasBacklog());
+    EXPECT_TRUE(result.backlog.test(0));
+    EXPECT_TRUE(result.backlog.test(1));
+    EXPECT_FALSE(result.backlog.test(2));
+    EXPECT_EQ(2U, drain(router.txReaders[1]));
+    EXPECT_EQ(2U, drain(router.txReaders[2]));
+    EXPECT_EQ(1U, drain(router.txReaders[0]));
+
+    result = router.router.runBatch(5U);
+    EXPECT_EQ(2U, result.routed);
+    EXPECT_FALSE(result.hasBacklog());
+    EXPECT_EQ(1U, drain(router.txReaders[1]));
+    EXPECT_EQ(1U, drain(router.txReaders[2]));
+
+    result = router.router.runBatch(5U);
+    EXPECT_EQ(0U, result.routed);
+    EXPECT_FALSE(result.hasBacklog());
+}
+
+/**
+ * \desc
+ * runBatch() routes up to the weight of a channel per turn, resumes an interrupted turn and skips
+ * channels with a weight of 0.
+ */
+TEST(RouterTest, run_batch_with_weights)
+{
+    constexpr size_t MAX_NUM_CHANNELS = 3;
+    ::routing::Definition defs[]
+        = {::routing::Definition().in(0, 0, 0, 4).out(1, 10, 0, 4),
+           ::routing::Definition().in(1, 1, 0, 4).out(2, 11, 0, 4),
+           ::routing::Definition().in(2, 2, 0, 4).out(0, 12, 0, 4)};
+    RouterWithDefinitions<MAX_NUM_CHANNELS> router;
+    router.init(defs);
+    router.router.setWeight(0, 3U);
+    router.router.setWeight(2, 0U);
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        writePdu(0, 12, router.rxWriters[0]);
+        writePdu(1, 12, router.rxWriters[1]);
+        writePdu(2, 12, router.rxWriters[2]);
+    }
+
+    // The turn of channel 0 is interrupted after 2 PDUs
+    auto result = router.router.runBatch(2U);
+    EXPECT_EQ(2U, result.routed);
+    EXPECT_EQ(2U, drain(router.txReaders[1]));
+    EXPECT_EQ(0U, drain(router.txReaders[2]));
+
+    // and resumed for 1 PDU before channel 1 is served, channel 2 is skipped
+    result = router.router.runBatch(3U);
+    EXPECT_EQ(3U, result.routed);
+    EXPECT_EQ(2U, drain(router.txReaders[1]));
+    EXPECT_EQ(1U, drain(router.txReaders[2]));
+    EXPECT_EQ(0U, drain(router.txReaders[0]));
+
+    result = router.router.runBatch(100U);
+    EXPECT_EQ(3U, result.routed);
+    EXPECT_EQ(0U, drain(router.txReaders[1]));
+    EXPECT_EQ(3U, drain(router.txReaders[2]));
+    EXPECT_EQ(0U, drain(router.txReaders[0]));
+    EXPECT_TRUE(result.hasBacklog());
+    EXPECT_TRUE(result.backlog.test(2));
+    EXPECT_EQ(1U, result.backlog.count());
+}
+
+/**
+ * \desc
+ * Weights set before init() are kept.
+ */
+TEST(RouterTest, run_batch_with_weights_set_before_init)
+{
+    constexpr size_t MAX_NUM_CHANNELS = 3;
+    ::routing::Definition defs[]
+        = {::routing::Definition().in(0, 0, 0, 4).out(1, 10, 0, 4),
+           ::routing::Definition().in(1, 1, 0, 4).out(0, 11, 0, 4)};
+    RouterWithDefinitions<MAX_NUM_CHANNELS> router;
+    router.router.setWeight(0, 3U);
+    router.init(defs);
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        writePdu(0, 12, router.rxWriters[0]);
+        writePdu(1, 12, router.rxWriters[1]);
+    }
+
+    auto result = router.router.runBatch(4U);
+    EXPECT_EQ(4U, result.routed);
+    EXPECT_EQ(3U, drain(router.txReaders[1]));
+    EXPECT_EQ(1U, drain(router.txReaders[0]));
+}
+
+/**
+ * \desc
+ * runBatch() doesn't route anything if the router is uninitialized.
+ */
+TEST(RouterTest, run_batch_uninitialized)
+{
+    ::routing::Router<2> router;
+    auto const result = router.runBatch(10U);
+    EXPECT_EQ(0U, result.routed);
+    EXPECT_FALSE(result.hasBacklog());
+}
+
+/**
+ * \desc
+ * In shared buffer mode, the payload of a PDU is stored once and each destination receives a
+ * descriptor to it. The buffer is returned to the pool when the last destination releases it.
+ */
+TEST(RouterTest, route_shared_to_multiple_channels)
+{
+    constexpr size_t MAX_NUM_CHANNELS = 4;
+    ::routing::Definition defs[]      = {::routing::Definition()
+                                             .in(0, 0x34, 0, 4)
+                                             .out(1, 0x01, 0, 4)
+                                             .out(2, 0x02, 0, 4)
+                                             .out(3, 0x03, 0, 4)};
+    RouterWithDefinitions<MAX_NUM_CHANNELS> router;
+    router.init(defs);
+    ::io::SharedBufferPool<2, 64> pool;
+    router.router.setSharedBufferPool(&pool);
+
+    writePdu(0, 12, router.rxWriters[0]);
+    ASSERT_TRUE(router.run());
+    EXPECT_EQ(0, router.rxReaders[0].peek().size());
+    EXPECT_EQ(1U, pool.available());
+
+    for (size_t i = 1; i < MAX_NUM_CHANNELS; i++)
+    {
+        ASSERT_EQ(::routing::SharedPduDescriptor::SIZE, router.txReaders[i].peek().size());
+
+        ::routing::SharedPduReader reader(router.txReaders[i], pool);
+        auto pdu = reader.peek();
+        EXPECT_EQ(i, pdu.outputMessageId);
+        // payload: length + data
+        ASSERT_EQ(8U, pdu.payload.size());
+        EXPECT_EQ(4U, pdu.payload.take<::etl::be_uint32_t const>());
+
+        reader.release();
+        EXPECT_EQ(0U, reader.peek().payload.size());
+        EXPECT_EQ(i < (MAX_NUM_CHANNELS - 1) ? 1U : 2U, pool.available());
+    }
+}
+
+/**
+ * \desc
+ * In shared buffer mode, a PDU without payload is routed like with the copying path.
+ */
+TEST(RouterTest, route_shared_empty_pdu)
+{
+    constexpr size_t MAX_NUM_CHANNELS = 3;
+    ::routing::Definition defs[]
+        = {::routing::Definition().in(0, 0x34, 0, 4).out(1, 0x01, 0, 4).out(2, 0x02, 0, 4)};
+    RouterWithDefinitions<MAX_NUM_CHANNELS> router;
+    router.init(defs);
+    ::io::SharedBufferPool<1, 64> pool;
+    router.router.setSharedBufferPool(&pool);
+
+    auto pdu = router.rxWriters[0].allocate(sizeof(::etl::be_uint32_t));
+    ASSERT_EQ(sizeof(::etl::be_uint32_t), pdu.size());
+    pdu.take<::etl::be_uint32_t>() = 0U;
+    router.rxWriters[0].commit();
+    ASSERT_TRUE(router.run());
+    EXPECT_EQ(0U, pool.available());
+
+    for (size_t i = 1; i < MAX_NUM_CHANNELS; i++)
+    {
+        ::routing::SharedPduReader reader(router.txReaders[i], pool);
+        auto const sharedPdu = reader.peek();
+        EXPECT_TRUE(sharedPdu.valid);
+        EXPECT_EQ(i, sharedPdu.outputMessageId);
+        EXPECT_EQ(0U, sharedPdu.payload.size());
+        reader.release();
+        EXPECT_FALSE(reader.peek().valid);
+    }
+    EXPECT_EQ(1U, pool.available());
+}
+
+/**
+ * \desc
+ * In shared buffer mode, references of destinations which can't take the descriptor are dropped
+ * and PDUs are discarded if the pool is exhausted.
+ */
+TEST(RouterTest, route_shared_with_missing_destination_and_exhausted_pool)
+{
+    constexpr size_t MAX_NUM_CHANNELS = 3;
+    ::routing::Definition defs[]
+        = {::routing::Definition().in(0, 0x34, 0, 4).out(1, 0x01, 0, 4).out(2, 0x02, 0, 4)};
+    RouterWithDefinitions<MAX_NUM_CHANNELS> router;
+    router.writers[2] = nullptr;
+    router.init(defs);
+    ::io::SharedBufferPool<1, 64> pool;
+    router.router.setSharedBufferPool(&pool);
+
+    writePdu(0, 12, router.rxWriters[0]);
+    writePdu(0, 12, router.rxWriters[0]);
+    ASSERT_TRUE(router.run());
+    EXPECT_EQ(0U, pool.available());
+
+    // The only buffer is in use by channel 1, so the second PDU is discarded
+    ASSERT_FALSE(router.run());
+    EXPECT_EQ(0, router.rxReaders[0].peek().size());
+
+    ::routing::SharedPduReader reader(router.txReaders[1], pool);
+    EXPECT_EQ(0x01U, reader.peek().outputMessageId);
+    reader.release();
+    EXPECT_EQ(0U, reader.peek().payload.size());
+    EXPECT_EQ(1U, pool.available());
+}
+
+/**
+ * \desc
+ * A SharedPduReader discards descriptors which are malformed or reference an invalid buffer.
+ */
+TEST(RouterTest, shared_pdu_reader_discards_invalid_descriptors)
+{
+    using Queue = ::io::MemoryQueue<128, 16>;
+    Queue queue;
+    ::io::MemoryQueueWriter<Queue> writer(queue);
+    ::io::MemoryQueueReader<Queue> descriptorReader(queue);
+    ::io::SharedBufferPool<1, 8> pool;
+
+    writer.allocate(3U);
+    writer.commit();
+    EXPECT_TRUE(::routing::outputSharedPdu(::etl::be_uint32_t(0x10U), 5U, writer));
+
+    auto const handle = pool.allocate(2U);
+    pool.commit(handle, 1U);
+    EXPECT_TRUE(::routing::outputSharedPdu(::etl::be_uint32_t(0x11U), handle, writer));
+
+    ::routing::SharedPduReader reader(descriptorReader, pool);
+    EXPECT_EQ(0x11U, reader.peek().outputMessageId);
+    // the invalid descriptors have been released, peeking again returns the same PDU
+    EXPECT_EQ(::routing::SharedPduDescriptor::SIZE, descriptorReader.peek().size());
+    EXPECT_EQ(0x11U, reader.peek().outputMessageId);
+    EXPECT_EQ(2U, reader.peek().payload.size());
+    reader.release();
+    EXPECT_EQ(1U, pool.available());
+    EXPECT_EQ(0U, reader.peek().payload.size());
+    // Releasing an empty reader has no effect
+    reader.release();
+}
+
 } // namespace
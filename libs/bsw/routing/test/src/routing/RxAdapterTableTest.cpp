@@ -119,9 +119,61 @@ TEST(RxAdapterTableTest, rx_adapter_config)
 
         EXPECT_EQ(pduOffsets[i].size(), table.pduOffsets.size());
         EXPECT_THAT(table.pduOffsets, ElementsAreArray(pduOffsets[i]));
+
+        // The generated message IDs are sorted, so the index is the identity.
+        EXPECT_EQ(messageIds[i].size(), table.messageIdIndex.size());
+        for (size_t j = 0; j < table.messageIdIndex.size(); ++j)
+        {
+            EXPECT_EQ(j, table.messageIdIndex[j]);
+        }
     }
 }
 
+/**
+ * \desc
+ * findMessageIndex() returns the index of a known message ID using the message ID index, and the
+ * number of message IDs for an unknown one.
+ */
+TEST(RxAdapterTableTest, find_message_index_with_index)
+{
+    ::etl::be_uint32_t const messageIds[]     = {300U, 7U, 0xFFFFFFFFU, 42U, 0U};
+    ::etl::be_uint32_t const messageIdIndex[] = {4U, 1U, 3U, 0U, 2U};
+
+    ::routing::RxAdapterTable table;
+    table.messageIds     = messageIds;
+    table.messageIdIndex = messageIdIndex;
+
+    EXPECT_EQ(0U, ::routing::findMessageIndex(table, 300U));
+    EXPECT_EQ(1U, ::routing::findMessageIndex(table, 7U));
+    EXPECT_EQ(2U, ::routing::findMessageIndex(table, 0xFFFFFFFFU));
+    EXPECT_EQ(3U, ::routing::findMessageIndex(table, 42U));
+    EXPECT_EQ(4U, ::routing::findMessageIndex(table, 0U));
+
+    EXPECT_EQ(5U, ::routing::findMessageIndex(table, 1U));
+    EXPECT_EQ(5U, ::routing::findMessageIndex(table, 43U));
+    EXPECT_EQ(5U, ::routing::findMessageIndex(table, 0xFFFFFFFEU));
+}
+
+/**
+ * \desc
+ * findMessageIndex() falls back to a linear search if the table has no message ID index.
+ */
+TEST(RxAdapterTableTest, find_message_index_without_index)
+{
+    ::etl::be_uint32_t const messageIds[] = {300U, 7U, 42U};
+
+    ::routing::RxAdapterTable table;
+    table.messageIds = messageIds;
+
+    EXPECT_EQ(0U, ::routing::findMessageIndex(table, 300U));
+    EXPECT_EQ(1U, ::routing::findMessageIndex(table, 7U));
+    EXPECT_EQ(2U, ::routing::findMessageIndex(table, 42U));
+    EXPECT_EQ(3U, ::routing::findMessageIndex(table, 8U));
+
+    table.messageIds = {};
+    EXPECT_EQ(0U, ::routing::findMessageIndex(table, 300U));
+}
+
 /**
  * \desc
  * Loading from a corrupted config returns a default-constructed table.
@@ -0,0 +1,70 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/**
+ * \ingroup runtime
+ */
+#pragma once
+
+#include "runtime/RuntimeHistogram.h"
+
+#include <cstdint>
+
+namespace runtime
+{
+/**
+ * Extends runtime statistics, e.g. RuntimeStatistics or FunctionRuntimeStatistics, with a
+ * histogram of the runtimes, which gives their percentiles.
+ *
+ * The statistics are reset with each measurement period, the histogram only with every
+ * \p HistogramWindow th period. With a window of several periods, rare long runtimes stay visible
+ * in the percentiles of the following periods.
+ *
+ * \tparam Statistics statistics to extend
+ * \tparam HistogramWindow number of calls to reset() after which the histogram is reset
+ */
+template<class Statistics, uint32_t HistogramWindow = 1U>
+class HistogramRuntimeStatistics : public Statistics
+{
+    static_assert(HistogramWindow > 0U, "histogram window must contain at least one period");
+
+public:
+    HistogramRuntimeStatistics() = default;
+
+    void addRun(uint32_t const startTimestamp, uint32_t const runtime, uint32_t const suspendedTime)
+    {
+        Statistics::addRun(startTimestamp, runtime, suspendedTime);
+        _histogram.addValue(runtime);
+    }
+
+    void reset()
+    {
+        Statistics::reset();
+        ++_periodCount;
+        if (_periodCount >= HistogramWindow)
+        {
+            _histogram.reset();
+            _periodCount = 0U;
+        }
+    }
+
+    RuntimeHistogram const& getHistogram() const { return _histogram; }
+
+    uint32_t getPercentile(uint32_t const perMille) const
+    {
+        return _histogram.getPercentile(perMille);
+    }
+
+private:
+    RuntimeHistogram _histogram;
+    uint32_t _periodCount = 0U;
+};
+
+} // namespace runtime
@@ -0,0 +1,106 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/**
+ * \ingroup runtime
+ */
+#pragma once
+
+#include <etl/algorithm.h>
+#include <etl/array.h>
+#include <etl/bit.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace runtime
+{
+/**
+ * Histogram of runtimes with fixed memory. The buckets are log-linear: each power of two range
+ * is divided into SUB_BUCKET_COUNT buckets of equal width, so a value is known with a relative
+ * error of at most 1 / SUB_BUCKET_COUNT. Values below SUB_BUCKET_COUNT are counted exactly.
+ */
+class RuntimeHistogram
+{
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS  = 3U;
+    static constexpr uint32_t SUB_BUCKET_COUNT = 1U << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKET_COUNT       = (32U - SUB_BUCKET_BITS + 1U) * SUB_BUCKET_COUNT;
+
+    RuntimeHistogram() = default;
+
+    void addValue(uint32_t const value)
+    {
+        ++_counts[getBucketIndex(value)];
+        ++_count;
+        _maxValue = ::etl::max(_maxValue, value);
+    }
+
+    void reset()
+    {
+        _counts.fill(0U);
+        _count    = 0U;
+        _maxValue = 0U;
+    }
+
+    uint32_t getCount() const { return _count; }
+
+    /**
+     * Returns the value below or at which \p perMille of the values are, e.g. 999 for the 99.9th
+     * percentile. The value is the highest value of its bucket, limited to the maximum value.
+     * \return value of the percentile, 0 if no value has been added
+     */
+    uint32_t getPercentile(uint32_t const perMille) const
+    {
+        uint64_t const rank = ((static_cast<uint64_t>(_count) * perMille) + 999U) / 1000U;
+        uint64_t count      = 0U;
+        for (size_t idx = 0U; idx < BUCKET_COUNT; ++idx)
+        {
+            count += _counts[idx];
+            if ((count >= rank) && (count > 0U))
+            {
+                return ::etl::min(getHighestValue(idx), _maxValue);
+            }
+        }
+        return _maxValue;
+    }
+
+    static size_t getBucketIndex(uint32_t const value)
+    {
+        if (value < SUB_BUCKET_COUNT)
+        {
+            return value;
+        }
+        uint32_t const shift
+            = 31U - static_cast<uint32_t>(::etl::countl_zero(value)) - SUB_BUCKET_BITS;
+        return static_cast<size_t>(
+            ((shift + 1U) << SUB_BUCKET_BITS) + ((value >> shift) & (SUB_BUCKET_COUNT - 1U)));
+    }
+
+    static uint32_t getHighestValue(size_t const bucketIndex)
+    {
+        if (bucketIndex < SUB_BUCKET_COUNT)
+        {
+            return static_cast<uint32_t>(bucketIndex);
+        }
+        uint32_t const shift = static_cast<uint32_t>(bucketIndex >> SUB_BUCKET_BITS) - 1U;
+        uint32_t const lowestValue
+            = (SUB_BUCKET_COUNT + (static_cast<uint32_t>(bucketIndex) & (SUB_BUCKET_COUNT - 1U)))
+              << shift;
+        return lowestValue + ((1U << shift) - 1U);
+    }
+
+private:
+    ::etl::array<uint32_t, BUCKET_COUNT> _counts{};
+    uint32_t _count    = 0U;
+    uint32_t _maxValue = 0U;
+};
+
+} // namespace runtime
@@ -13,6 +13,7 @@
  */
 #pragma once
 
+#include "runtime/RuntimeHistogram.h"
 #include "util/format/StringWriter.h"
 
 #include <etl/delegate.h>
@@ -52,6 +53,10 @@ public:
     void writeRuntimeMS(char const* const title, uint32_t minWidth, uint32_t runtime);
     void writeRuntimePercentage(char const* const title, uint32_t runtime);
     void writePercentage(char const* const title, uint32_t const value, uint32_t const total);
+    /**
+     * Writes the 50th, 90th, 99th and 99.9th percentile of the runtimes in \p histogram.
+     */
+    void writeRuntimePercentiles(uint32_t minWidth, RuntimeHistogram const& histogram);
 
     template<class Statistics>
     void formatStatisticsLine(
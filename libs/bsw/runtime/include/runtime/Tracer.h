@@ -10,8 +10,8 @@
 
 #pragma once
 
-#include "FreeRTOSConfig.h"
-
+#include <etl/atomic.h>
+#include <etl/span.h>
 #include <platform/estdint.h>
 
 namespace runtime
@@ -20,12 +20,27 @@ namespace runtime
 #define TRACING_BUFFER_SIZE 4096
 #endif
 
+#ifndef TRACING_BLOCK_SIZE
+#define TRACING_BLOCK_SIZE 256
+#endif
+
 class Tracer
 {
 public:
+    enum class Mode : uint8_t
+    {
+        /** Traces until the buffer is full. */
+        LINEAR,
+        /**
+         * Traces into blocks that can be decoded on their own. When all blocks are used, the
+         * oldest one is overwritten. Complete blocks can be streamed out with drain().
+         */
+        RING
+    };
+
     Tracer();
 
-    static void init();
+    static void init(Mode mode = Mode::LINEAR);
     static void start();
     static void stop();
 
@@ -37,6 +52,18 @@ public:
 
     static bool bufferFull();
 
+    /**
+     * Copies the complete blocks that haven't been drained yet into \p words, oldest first, e.g.
+     * for writing them to a file, UART or UDP socket. Can be called while tracing in ring mode.
+     * Blocks that have been overwritten before being drained are lost, which shows as a gap in
+     * the sequence numbers of the blocks. After stop(), the block being written is drained too.
+     *
+     * \return number of copied words, a multiple of BLOCK_WORD_SIZE
+     */
+    static size_t drain(::etl::span<uint32_t> words);
+
+    static constexpr uint32_t BLOCK_WORD_SIZE = TRACING_BLOCK_SIZE / sizeof(uint32_t);
+
 private:
     enum Event
     {
@@ -52,13 +79,31 @@ private:
     static constexpr uint32_t RELATIVE_CYCLES_WIDTH = 20;
     static constexpr uint32_t RELATIVE_CYCLES_MAX   = (1 << RELATIVE_CYCLES_WIDTH) - 1;
 
+    // the first word of the buffer holds the ticks per second in both modes
+    static constexpr uint32_t BLOCK_COUNT = (TRACING_BUFFER_WORD_SIZE - 1U) / BLOCK_WORD_SIZE;
+    static constexpr uint32_t BLOCK_HEADER_WORD_SIZE = 3U;
+    static constexpr uint32_t BLOCK_MARKER           = 0xFF000000U;
+
+    static_assert(BLOCK_COUNT >= 2U, "TRACING_BUFFER_SIZE must hold at least two blocks");
+    static_assert(
+        (BLOCK_WORD_SIZE > (BLOCK_HEADER_WORD_SIZE + 2U)) && (BLOCK_WORD_SIZE < 0x1000U),
+        "TRACING_BLOCK_SIZE doesn't fit into the block header");
+
     static void traceEvent(Event const& event, uint8_t const& id);
 
+    static uint32_t getBlockStart(uint32_t sequence);
+    static void beginBlock(uint32_t sequence);
+    static void endBlock();
+
 private:
     static uint32_t _ramTraces[TRACING_BUFFER_WORD_SIZE];
+    static Mode _mode;
     static bool _running;
     static uint32_t _pos;
     static uint32_t _prevCycles;
+    static uint32_t _blockEnd;
+    static ::etl::atomic<uint32_t> _blockSequence;
+    static uint32_t _drainSequence;
 };
 
 } // namespace runtime
@@ -106,6 +106,15 @@ void StatisticsWriter::writePercentage(
     }
 }
 
+void StatisticsWriter::writeRuntimePercentiles(
+    uint32_t const minWidth, RuntimeHistogram const& histogram)
+{
+    writeRuntime("p50 ", minWidth, histogram.getPercentile(500U));
+    writeRuntime("p90 ", minWidth, histogram.getPercentile(900U));
+    writeRuntime("p99 ", minWidth, histogram.getPercentile(990U));
+    writeRuntime("p99.9 ", minWidth, histogram.getPercentile(999U));
+}
+
 bool StatisticsWriter::handleDefaultMode(
     char const* const title,
     uint32_t const minWidth,
@@ -12,16 +12,23 @@
 
 #include "bsp/timer/SystemTimer.h"
 
+#include <atomic>
+
 namespace runtime
 {
 
 uint32_t Tracer::_ramTraces[TRACING_BUFFER_WORD_SIZE];
+Tracer::Mode Tracer::_mode   = Tracer::Mode::LINEAR;
 bool Tracer::_running        = false;
 uint32_t Tracer::_pos        = 0;
 uint32_t Tracer::_prevCycles = 0;
+uint32_t Tracer::_blockEnd   = 0;
+::etl::atomic<uint32_t> Tracer::_blockSequence(0U);
+uint32_t Tracer::_drainSequence = 0;
 
-void Tracer::init()
+void Tracer::init(Mode const mode)
 {
+    _mode       = mode;
     _running    = false;
     _pos        = 0;
     _prevCycles = 0;
@@ -31,6 +38,11 @@ void Tracer::init()
     }
     // write ticks per second to first trace buffer word
     _ramTraces[_pos++] = getFastTicksPerSecond();
+    _drainSequence     = 0;
+    if (_mode == Mode::RING)
+    {
+        beginBlock(0U);
+    }
 }
 
 void Tracer::start() { _running = true; }
@@ -56,7 +68,96 @@ void Tracer::traceUser(uint8_t const usrIdx) { traceEvent(EVENT_USER, usrIdx); }
 inline bool Tracer::bufferFull()
 {
     // buffer is full if we can't store another extended frame (2 words)
-    return _pos >= TRACING_BUFFER_WORD_SIZE - 1;
+    return (_mode == Mode::LINEAR) && (_pos >= TRACING_BUFFER_WORD_SIZE - 1);
+}
+
+size_t Tracer::drain(::etl::span<uint32_t> const words)
+{
+    if (_mode != Mode::RING)
+    {
+        return 0U;
+    }
+    size_t count = 0U;
+    while ((count + BLOCK_WORD_SIZE) <= words.size())
+    {
+        // pairs with the release store of beginBlock(), the blocks before sequence are complete
+        uint32_t const sequence = _blockSequence.load(::etl::memory_order_acquire);
+        if ((sequence - _drainSequence) >= BLOCK_COUNT)
+        {
+            // skip the overwritten blocks, only the block being written is newer
+            _drainSequence = sequence - (BLOCK_COUNT - 1U);
+        }
+        if (_drainSequence == sequence)
+        {
+            if (_running || (_pos == (getBlockStart(sequence) + BLOCK_HEADER_WORD_SIZE)))
+            {
+                break;
+            }
+            // tracing is stopped, complete the current block to drain it as well
+            endBlock();
+            continue;
+        }
+        uint32_t const start = getBlockStart(_drainSequence);
+        for (uint32_t i = 0U; i < BLOCK_WORD_SIZE; ++i)
+        {
+            words[count + i] = _ramTraces[start + i];
+        }
+        // the copy is only valid if the writer hasn't started to overwrite the block meanwhile
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ((_blockSequence.load(::etl::memory_order_relaxed) - _drainSequence) < BLOCK_COUNT)
+        {
+            count += BLOCK_WORD_SIZE;
+        }
+        ++_drainSequence;
+    }
+    return count;
+}
+
+inline uint32_t Tracer::getBlockStart(uint32_t const sequence)
+{
+    return 1U + ((sequence % BLOCK_COUNT) * BLOCK_WORD_SIZE);
+}
+
+/**
+ *  Start the block with the given sequence number in ring mode.
+ *
+ *  A block starts with a header of three words, followed by frames. The first frame of a block
+ *  is always an extended frame, so each block can be decoded on its own.
+ *
+ *  .     .     .     .     .     .     .     .     .
+ *  | 0xff|   block size    |    used size    |           header word (4 bytes)
+ *  |        sequence number                        |       (4 bytes)
+ *  |        ticks per second                       |       (4 bytes)
+ *
+ *  block size: size of the block in words
+ *  used size: number of words used by header and frames, 0 while the block is written
+ *  sequence number: incremented with each block
+ */
+void Tracer::beginBlock(uint32_t const sequence)
+{
+    uint32_t const start = getBlockStart(sequence);
+    // publish the completed previous block, and the sequence number before overwriting the
+    // block, see drain()
+    _blockSequence.store(sequence, ::etl::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_release);
+    _ramTraces[start]      = BLOCK_MARKER | (BLOCK_WORD_SIZE << 12U);
+    _ramTraces[start + 1U] = sequence;
+    _ramTraces[start + 2U] = _ramTraces[0];
+    _pos                   = start + BLOCK_HEADER_WORD_SIZE;
+    _blockEnd              = start + BLOCK_WORD_SIZE;
+    _prevCycles            = 0;
+    // the frames of the block being written end with the first zero word, like in linear mode
+    for (uint32_t i = _pos; i < _blockEnd; ++i)
+    {
+        _ramTraces[i] = 0;
+    }
+}
+
+void Tracer::endBlock()
+{
+    uint32_t const start = _blockEnd - BLOCK_WORD_SIZE;
+    _ramTraces[start] |= _pos - start;
+    beginBlock(_blockSequence.load(::etl::memory_order_relaxed) + 1U);
 }
 
 /**
@@ -91,7 +192,6 @@ void Tracer::traceEvent(Event const& event, uint8_t const& id)
     {
         return;
     }
-
     uint32_t cycles = getFastTicks();
     uint32_t diff;
 
@@ -107,7 +207,15 @@ void Tracer::traceEvent(Event const& event, uint8_t const& id)
         diff = 0xffffffff - _prevCycles + cycles + 1;
     }
 
-    if (_prevCycles != 0 && diff <= RELATIVE_CYCLES_MAX)
+    bool isNormalFrame = (_prevCycles != 0 && diff <= RELATIVE_CYCLES_MAX);
+    if ((_mode == Mode::RING) && ((_pos + (isNormalFrame ? 1U : 2U)) > _blockEnd))
+    {
+        // the next block starts with an extended frame
+        endBlock();
+        isNormalFrame = false;
+    }
+
+    if (isNormalFrame)
     {
         // normal frame
         uint8_t ctrl = (event << 4) & 0x70;
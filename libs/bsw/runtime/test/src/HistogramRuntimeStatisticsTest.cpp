@@ -0,0 +1,81 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "runtime/HistogramRuntimeStatistics.h"
+
+#include "runtime/FunctionRuntimeStatistics.h"
+#include "runtime/RuntimeStatistics.h"
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace ::runtime;
+
+TEST(HistogramRuntimeStatisticsTest, testAddRun)
+{
+    HistogramRuntimeStatistics<RuntimeStatistics> cut;
+    cut.addRun(0U, 4U, 0U);
+    cut.addRun(10U, 6U, 2U);
+    cut.addRun(20U, 2U, 0U);
+    EXPECT_EQ(3U, cut.getTotalRunCount());
+    EXPECT_EQ(12U, cut.getTotalRuntime());
+    EXPECT_EQ(2U, cut.getMinRuntime());
+    EXPECT_EQ(6U, cut.getMaxRuntime());
+    EXPECT_EQ(3U, cut.getHistogram().getCount());
+    EXPECT_EQ(4U, cut.getPercentile(500U));
+    EXPECT_EQ(6U, cut.getPercentile(999U));
+}
+
+TEST(HistogramRuntimeStatisticsTest, testFunctionRuntimeStatistics)
+{
+    HistogramRuntimeStatistics<FunctionRuntimeStatistics> cut;
+    cut.addRun(10U, 4U, 0U);
+    cut.addRun(30U, 5U, 0U);
+    EXPECT_EQ(20U, cut.getMinJitter());
+    EXPECT_EQ(20U, cut.getMaxJitter());
+    EXPECT_EQ(2U, cut.getHistogram().getCount());
+    cut.reset();
+    EXPECT_EQ(0U, cut.getTotalRunCount());
+    EXPECT_EQ(0U, cut.getMaxJitter());
+    EXPECT_EQ(0U, cut.getHistogram().getCount());
+}
+
+TEST(HistogramRuntimeStatisticsTest, testHistogramWindow)
+{
+    HistogramRuntimeStatistics<RuntimeStatistics, 3U> cut;
+    cut.addRun(0U, 1000U, 0U);
+    cut.reset();
+    cut.addRun(0U, 10U, 0U);
+    cut.reset();
+    // the statistics only cover the current period, the histogram the whole window
+    EXPECT_EQ(0U, cut.getTotalRunCount());
+    EXPECT_EQ(2U, cut.getHistogram().getCount());
+    EXPECT_EQ(1000U, cut.getPercentile(999U));
+    cut.reset();
+    EXPECT_EQ(0U, cut.getHistogram().getCount());
+    cut.addRun(0U, 10U, 0U);
+    cut.reset();
+    EXPECT_EQ(1U, cut.getHistogram().getCount());
+}
+
+TEST(HistogramRuntimeStatisticsTest, testCopyToStatistics)
+{
+    HistogramRuntimeStatistics<RuntimeStatistics> cut;
+    cut.addRun(0U, 7U, 0U);
+    HistogramRuntimeStatistics<RuntimeStatistics> copy;
+    copy = cut;
+    cut.reset();
+    EXPECT_EQ(1U, copy.getTotalRunCount());
+    EXPECT_EQ(7U, copy.getPercentile(500U));
+}
+
+} // namespace
@@ -0,0 +1,98 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "runtime/RuntimeHistogram.h"
+
+#include <gmock/gmock.h>
+
+namespace
+{
+using namespace ::testing;
+using namespace ::runtime;
+
+TEST(RuntimeHistogramTest, testConstructor)
+{
+    RuntimeHistogram cut;
+    EXPECT_EQ(0U, cut.getCount());
+    EXPECT_EQ(0U, cut.getPercentile(500U));
+    EXPECT_EQ(0U, cut.getPercentile(999U));
+}
+
+TEST(RuntimeHistogramTest, testBucketIndex)
+{
+    EXPECT_EQ(0U, RuntimeHistogram::getBucketIndex(0U));
+    EXPECT_EQ(7U, RuntimeHistogram::getBucketIndex(7U));
+    EXPECT_EQ(8U, RuntimeHistogram::getBucketIndex(8U));
+    EXPECT_EQ(15U, RuntimeHistogram::getBucketIndex(15U));
+    EXPECT_EQ(16U, RuntimeHistogram::getBucketIndex(16U));
+    EXPECT_EQ(16U, RuntimeHistogram::getBucketIndex(17U));
+    EXPECT_EQ(23U, RuntimeHistogram::getBucketIndex(31U));
+    EXPECT_EQ(24U, RuntimeHistogram::getBucketIndex(32U));
+    EXPECT_EQ(RuntimeHistogram::BUCKET_COUNT - 1U, RuntimeHistogram::getBucketIndex(0xFFFFFFFFU));
+}
+
+TEST(RuntimeHistogramTest, testBucketsAreContiguous)
+{
+    for (size_t idx = 0U; idx < (RuntimeHistogram::BUCKET_COUNT - 1U); ++idx)
+    {
+        uint32_t const highestValue = RuntimeHistogram::getHighestValue(idx);
+        EXPECT_EQ(idx, RuntimeHistogram::getBucketIndex(highestValue));
+        EXPECT_EQ(idx + 1U, RuntimeHistogram::getBucketIndex(highestValue + 1U));
+    }
+    EXPECT_EQ(0xFFFFFFFFU, RuntimeHistogram::getHighestValue(RuntimeHistogram::BUCKET_COUNT - 1U));
+}
+
+TEST(RuntimeHistogramTest, testPercentiles)
+{
+    RuntimeHistogram cut;
+    // 1..1000, each value once
+    for (uint32_t value = 1U; value <= 1000U; ++value)
+    {
+        cut.addValue(value);
+    }
+    EXPECT_EQ(1000U, cut.getCount());
+    // the relative error is at most one sub bucket
+    EXPECT_THAT(cut.getPercentile(500U), AllOf(Ge(500U), Le(500U + 500U / 8U)));
+    EXPECT_THAT(cut.getPercentile(900U), AllOf(Ge(900U), Le(900U + 900U / 8U)));
+    EXPECT_THAT(cut.getPercentile(990U), AllOf(Ge(990U), Le(1000U)));
+    // limited to the maximum value
+    EXPECT_EQ(1000U, cut.getPercentile(999U));
+    EXPECT_EQ(1000U, cut.getPercentile(1000U));
+    EXPECT_EQ(1U, cut.getPercentile(0U));
+}
+
+TEST(RuntimeHistogramTest, testTail)
+{
+    RuntimeHistogram cut;
+    for (uint32_t i = 0U; i < 999U; ++i)
+    {
+        cut.addValue(5U);
+    }
+    cut.addValue(100000U);
+    EXPECT_EQ(5U, cut.getPercentile(500U));
+    EXPECT_EQ(5U, cut.getPercentile(990U));
+    EXPECT_EQ(5U, cut.getPercentile(999U));
+    EXPECT_EQ(100000U, cut.getPercentile(1000U));
+    cut.addValue(100000U);
+    EXPECT_EQ(100000U, cut.getPercentile(999U));
+}
+
+TEST(RuntimeHistogramTest, testReset)
+{
+    RuntimeHistogram cut;
+    cut.addValue(17U);
+    cut.reset();
+    EXPECT_EQ(0U, cut.getCount());
+    EXPECT_EQ(0U, cut.getPercentile(500U));
+    cut.addValue(3U);
+    EXPECT_EQ(3U, cut.getPercentile(500U));
+}
+
+} // namespace
@@ -0,0 +1,112 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "runtime/RuntimeMonitor.h"
+
+#include "async/LockMock.h"
+#include "bsp/timer/SystemTimerMock.h"
+
+#include <etl/array.h>
+
+#include <gmock/gmock.h>
+
+#include <vector>
+
+namespace
+{
+bool locked             = false;
+uint32_t unlockedEvents = 0U;
+} // namespace
+
+extern "C"
+{
+// called by the Tracer once per recorded event
+uint32_t getFastTicks(void)
+{
+    if (!locked)
+    {
+        ++unlockedEvents;
+    }
+    return 0U;
+}
+
+uint32_t getFastTicksPerSecond() { return 1000000U; }
+}
+
+namespace
+{
+using namespace ::testing;
+using namespace ::runtime;
+
+class TestStatistics
+{
+public:
+    void addRun(uint32_t, uint32_t, uint32_t) {}
+
+    void reset() {}
+};
+
+class RuntimeMonitorTracingTest : public Test
+{
+public:
+    RuntimeMonitorTracingTest()
+    {
+        locked         = false;
+        unlockedEvents = 0U;
+        ON_CALL(_lockMock, lock()).WillByDefault(Assign(&locked, true));
+        ON_CALL(_lockMock, unlock()).WillByDefault(Assign(&locked, false));
+        ON_CALL(_systemTimerMock, getSystemTicks32Bit()).WillByDefault(Return(0U));
+    }
+
+    ~RuntimeMonitorTracingTest() override { Tracer::stop(); }
+
+    MOCK_METHOD(char const*, getTaskName, (size_t));
+
+protected:
+    NiceMock<::async::LockMock> _lockMock;
+    NiceMock<SystemTimerMock> _systemTimerMock;
+};
+
+TEST_F(RuntimeMonitorTracingTest, testContextSwitchesAreTracedOnceWithinLock)
+{
+    using CutType = declare::RuntimeMonitor<TestStatistics, TestStatistics, 3U, 2U>;
+    char const* const isrGroupNames[] = {"group0", "group1"};
+    CutType cut(
+        CutType::ContextStatisticsContainerType::GetNameType::
+            create<RuntimeMonitorTracingTest, &RuntimeMonitorTracingTest::getTaskName>(*this),
+        isrGroupNames);
+    cut.start();
+
+    Tracer::init(Tracer::Mode::RING);
+    Tracer::start();
+    cut.enterTask(2U);
+    cut.enterIsrGroup(1U);
+    cut.leaveIsrGroup(1U);
+    cut.leaveTask(2U);
+    Tracer::stop();
+
+    EXPECT_EQ(0U, unlockedEvents);
+    ::etl::array<uint32_t, Tracer::BLOCK_WORD_SIZE> words{};
+    ASSERT_EQ(Tracer::BLOCK_WORD_SIZE, Tracer::drain(words));
+    // event and argument of the frames after the block header
+    std::vector<uint32_t> frames;
+    for (size_t idx = 3U; (idx < (words[0] & 0xFFFU)); ++idx)
+    {
+        frames.push_back((words[idx] >> 16U) & 0x70FFU);
+        if ((words[idx] & 0x80000000U) != 0U)
+        {
+            // skip the absolute time of an extended frame
+            ++idx;
+        }
+    }
+    EXPECT_THAT(frames, ElementsAre(0x1002U, 0x2001U, 0x3001U, 0x0002U));
+}
+
+} // namespace
@@ -173,6 +173,31 @@ TEST_F(StatisticsWriterTest, testFormatGroup)
     EXPECT_STREQ(expected, stream.getString());
 }
 
+TEST_F(StatisticsWriterTest, testRuntimePercentiles)
+{
+    RuntimeHistogram histogram;
+    for (uint32_t i = 0U; i < 1000U; ++i)
+    {
+        histogram.addValue((i < 900U) ? 500U : 5000U);
+    }
+    histogram.addValue(50000U);
+    {
+        ::util::stream::declare::StringBufferOutputStream<300U> stream;
+        ::util::format::StringWriter writer(stream);
+        StatisticsWriter cut(writer, 0U, 50U);
+        cut.setMode(StatisticsWriter::Mode::Type::HEADER);
+        cut.writeRuntimePercentiles(5U, histogram);
+        EXPECT_STREQ("    p50      p90      p99    p99.9 ", stream.getString());
+    }
+    {
+        ::util::stream::declare::StringBufferOutputStream<300U> stream;
+        ::util::format::StringWriter writer(stream);
+        StatisticsWriter cut(writer, 0U, 50U);
+        cut.writeRuntimePercentiles(5U, histogram);
+        EXPECT_STREQ("   10 us   102 us   102 us   102 us", stream.getString());
+    }
+}
+
 TEST_F(StatisticsWriterTest, testBuiltinTicksConverter)
 {
     {
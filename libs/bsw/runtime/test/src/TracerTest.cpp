@@ -0,0 +1,156 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "runtime/Tracer.h"
+
+#include "bsp/timer/SystemTimer.h"
+
+#include <etl/array.h>
+
+#include <gmock/gmock.h>
+
+namespace
+{
+uint32_t fastTicks = 0U;
+} // namespace
+
+extern "C"
+{
+uint32_t getFastTicks(void) { return fastTicks; }
+
+uint32_t getFastTicksPerSecond() { return 1000000U; }
+}
+
+namespace
+{
+using namespace ::testing;
+using namespace ::runtime;
+
+constexpr uint32_t BLOCK_WORD_SIZE = Tracer::BLOCK_WORD_SIZE;
+// see TRACING_BUFFER_SIZE and TRACING_BLOCK_SIZE of the test
+constexpr uint32_t BLOCK_COUNT     = 3U;
+constexpr uint32_t HEADER_WORDS    = 3U;
+
+class TracerTest : public Test
+{
+protected:
+    TracerTest() { fastTicks = 1000U; }
+
+    ~TracerTest() override { Tracer::stop(); }
+
+    static void traceEvents(uint32_t const count)
+    {
+        for (uint32_t i = 0U; i < count; ++i)
+        {
+            fastTicks += 10U;
+            Tracer::traceUser(static_cast<uint8_t>(i));
+        }
+    }
+
+    static uint32_t getSequence(uint32_t const* const block) { return block[1]; }
+
+    static uint32_t getUsedSize(uint32_t const* const block) { return block[0] & 0xFFFU; }
+
+    ::etl::array<uint32_t, BLOCK_WORD_SIZE * 8U> _words{};
+};
+
+TEST_F(TracerTest, testLinearModeStopsWhenFull)
+{
+    Tracer::init();
+    Tracer::start();
+    EXPECT_FALSE(Tracer::bufferFull());
+    traceEvents(TRACING_BUFFER_SIZE / sizeof(uint32_t));
+    EXPECT_TRUE(Tracer::bufferFull());
+    // nothing to drain in linear mode
+    EXPECT_EQ(0U, Tracer::drain(_words));
+}
+
+TEST_F(TracerTest, testRingModeDrainsCompleteBlocks)
+{
+    Tracer::init(Tracer::Mode::RING);
+    Tracer::start();
+    EXPECT_EQ(0U, Tracer::drain(_words));
+    // first block: extended frame + normal frames
+    uint32_t const framesPerBlock = BLOCK_WORD_SIZE - HEADER_WORDS - 1U;
+    traceEvents(framesPerBlock);
+    EXPECT_EQ(0U, Tracer::drain(_words));
+    traceEvents(1U);
+    ASSERT_EQ(BLOCK_WORD_SIZE, Tracer::drain(_words));
+    EXPECT_FALSE(Tracer::bufferFull());
+
+    uint32_t const* const block = _words.data();
+    EXPECT_EQ(0xFF000000U | (BLOCK_WORD_SIZE << 12U) | BLOCK_WORD_SIZE, block[0]);
+    EXPECT_EQ(0U, getSequence(block));
+    EXPECT_EQ(1000000U, block[2]);
+    // extended frame of user event 0 with absolute time
+    EXPECT_EQ(0xC0000000U, block[3]);
+    EXPECT_EQ(1010U, block[4]);
+    // normal frame of user event 1, 10 ticks later
+    EXPECT_EQ(0x4001000AU, block[5]);
+
+    // already drained
+    EXPECT_EQ(0U, Tracer::drain(_words));
+}
+
+TEST_F(TracerTest, testRingModeOverwritesOldestBlocks)
+{
+    Tracer::init(Tracer::Mode::RING);
+    Tracer::start();
+    // fill 10 blocks and start the 11th one
+    traceEvents((BLOCK_WORD_SIZE - HEADER_WORDS - 1U) * 10U + 1U);
+    size_t const count = Tracer::drain(_words);
+    // only the blocks before the one being written are kept
+    ASSERT_EQ((BLOCK_COUNT - 1U) * BLOCK_WORD_SIZE, count);
+    EXPECT_EQ(8U, getSequence(&_words[0]));
+    EXPECT_EQ(9U, getSequence(&_words[BLOCK_WORD_SIZE]));
+    // each block starts with an extended frame
+    EXPECT_EQ(0x80U, _words[HEADER_WORDS] >> 24U & 0x80U);
+    EXPECT_EQ(0x80U, _words[BLOCK_WORD_SIZE + HEADER_WORDS] >> 24U & 0x80U);
+}
+
+TEST_F(TracerTest, testDrainInSmallChunks)
+{
+    Tracer::init(Tracer::Mode::RING);
+    Tracer::start();
+    traceEvents((BLOCK_WORD_SIZE - HEADER_WORDS - 1U) * 2U + 1U);
+    // a block is only drained if it fits completely
+    EXPECT_EQ(0U, Tracer::drain(::etl::span<uint32_t>(_words.data(), BLOCK_WORD_SIZE - 1U)));
+    EXPECT_EQ(
+        BLOCK_WORD_SIZE, Tracer::drain(::etl::span<uint32_t>(_words.data(), BLOCK_WORD_SIZE)));
+    EXPECT_EQ(0U, getSequence(_words.data()));
+    EXPECT_EQ(
+        BLOCK_WORD_SIZE, Tracer::drain(::etl::span<uint32_t>(_words.data(), BLOCK_WORD_SIZE)));
+    EXPECT_EQ(1U, getSequence(_words.data()));
+    EXPECT_EQ(0U, Tracer::drain(_words));
+}
+
+TEST_F(TracerTest, testDrainAfterStop)
+{
+    Tracer::init(Tracer::Mode::RING);
+    Tracer::start();
+    traceEvents(3U);
+    EXPECT_EQ(0U, Tracer::drain(_words));
+    Tracer::stop();
+    ASSERT_EQ(BLOCK_WORD_SIZE, Tracer::drain(_words));
+    // header, extended frame and two normal frames
+    EXPECT_EQ(HEADER_WORDS + 4U, getUsedSize(_words.data()));
+    EXPECT_EQ(0U, _words[HEADER_WORDS + 4U]);
+    // the empty block started by the drain isn't drained
+    EXPECT_EQ(0U, Tracer::drain(_words));
+    // tracing continues in the next block
+    Tracer::start();
+    traceEvents(1U);
+    Tracer::stop();
+    ASSERT_EQ(BLOCK_WORD_SIZE, Tracer::drain(_words));
+    EXPECT_EQ(1U, getSequence(_words.data()));
+    EXPECT_EQ(HEADER_WORDS + 2U, getUsedSize(_words.data()));
+}
+
+} // namespace
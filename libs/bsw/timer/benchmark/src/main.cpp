@@ -0,0 +1,102 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <timer/Timeout.h>
+#include <timer/Timer.h>
+#include <timer/TimingWheelTimer.h>
+
+#include <vector>
+
+namespace
+{
+struct NoLock
+{};
+
+struct CountingTimeout : public ::timer::Timeout
+{
+    void expired() override { ++_count; }
+
+    uint32_t _count = 0U;
+};
+
+using ListTimer  = ::timer::Timer<NoLock>;
+using WheelTimer = ::timer::TimingWheelTimer<NoLock>;
+
+uint32_t nextRandom(uint32_t& seed)
+{
+    seed = (seed * 1103515245U) + 12345U;
+    return seed >> 8U;
+}
+
+/**
+ * Sets state.range(0) cyclic timeouts with periods between 1 ms and 1 s in microseconds.
+ */
+template<class T>
+void setBackground(T& timer, std::vector<CountingTimeout>& timeouts, uint32_t const now)
+{
+    uint32_t seed = 42U;
+    for (auto& timeout : timeouts)
+    {
+        timer.setCyclic(timeout, 1000U + (nextRandom(seed) % 999000U), now);
+    }
+}
+} // namespace
+
+/**
+ * Benchmarks setting and canceling a timeout while state.range(0) other timeouts are active.
+ */
+template<class T>
+void BM_set_cancel(benchmark::State& state)
+{
+    // Timeouts must outlive the timer they are linked into.
+    std::vector<CountingTimeout> timeouts(static_cast<size_t>(state.range(0)));
+    T timer;
+    setBackground(timer, timeouts, 0U);
+    CountingTimeout timeout;
+    uint32_t seed = 7U;
+
+    for (auto _ : state)
+    {
+        timer.set(timeout, nextRandom(seed) % 1000000U, 0U);
+        timer.cancel(timeout);
+    }
+}
+
+/**
+ * Benchmarks processing state.range(0) cyclic timeouts while time advances in steps of 100 us,
+ * the way a TaskContext drives its timer.
+ */
+template<class T>
+void BM_process_cyclic(benchmark::State& state)
+{
+    // Timeouts must outlive the timer they are linked into.
+    std::vector<CountingTimeout> timeouts(static_cast<size_t>(state.range(0)));
+    T timer;
+    setBackground(timer, timeouts, 0U);
+    uint32_t now = 0U;
+
+    for (auto _ : state)
+    {
+        now += 100U;
+        uint32_t nextDelta = 0U;
+        // processNextTimeout() returns false for overdue timeouts, process until none is due.
+        do
+        {
+            while (timer.processNextTimeout(now)) {}
+        } while (timer.getNextDelta(now, nextDelta) && (nextDelta == 0U));
+        benchmark::DoNotOptimize(nextDelta);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_set_cancel, ListTimer)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_set_cancel, WheelTimer)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_process_cyclic, ListTimer)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_process_cyclic, WheelTimer)->Arg(1000)->Arg(10000);
@@ -0,0 +1,409 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include "timer/Timeout.h"
+
+#include <etl/array.h>
+#include <etl/binary.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace timer
+{
+
+/**
+ * A collection of timeouts with the same interface and semantics as Timer, backed by a
+ * hierarchical timing wheel.
+ *
+ * Timeouts are sorted into LEVELS wheels of NUM_SLOTS slots each. A slot of level 0 covers one
+ * tick of 2^RESOLUTION_BITS time units, a slot of level n covers NUM_SLOTS^n ticks. A timeout is
+ * stored in the level of the most significant slot index in which its expiry tick differs from the
+ * current tick, so set() and cancel() don't depend on the number of active timeouts. When time
+ * advances, the timeouts of the slots that have been reached are moved down to the lower levels.
+ * Timeouts within a slot of level 0 and elapsed timeouts are kept sorted, so timeouts are processed
+ * in the same order as with Timer. Only timeouts with the same expiry time which have been set
+ * into different levels may be processed in a different order.
+ *
+ * Compared to Timer, each instance needs LEVELS * NUM_SLOTS list heads and an occupancy bitmap per
+ * level in addition.
+ *
+ * \tparam LockGuard is the type that implements RAII-based lock for secure section.
+ * \tparam RESOLUTION_BITS log2 of the number of time units covered by a slot of level 0.
+ */
+template<class LockGuard, uint8_t RESOLUTION_BITS = 8U>
+class TimingWheelTimer
+{
+public:
+    using TimeoutList = ::etl::intrusive_forward_list<Timeout, ::etl::forward_link<0>>;
+
+    static constexpr size_t SLOT_BITS = 6U;
+    static constexpr size_t NUM_SLOTS = 1U << SLOT_BITS;
+    static constexpr size_t TICK_BITS = 32U - RESOLUTION_BITS;
+    static constexpr size_t LEVELS    = TICK_BITS / SLOT_BITS;
+
+    static_assert((TICK_BITS % SLOT_BITS) == 0U, "RESOLUTION_BITS must leave full levels");
+
+    /** \see Timer::processNextTimeout() */
+    bool processNextTimeout(uint32_t now);
+
+    /** \see Timer::getNextDelta() */
+    bool getNextDelta(uint32_t now, uint32_t& nextDelta) const;
+
+    /** \see Timer::isActive() */
+    bool isActive(Timeout const& timeout) const;
+
+    /** \see Timer::set() */
+    bool set(Timeout& timeout, uint32_t delay, uint32_t now);
+
+    /** \see Timer::setCyclic() */
+    bool setCyclic(Timeout& timeout, uint32_t period, uint32_t now);
+
+    /** \see Timer::cancel() */
+    void cancel(Timeout& timeout);
+
+private:
+    static constexpr uint32_t TICK_MASK = static_cast<uint32_t>((1ULL << TICK_BITS) - 1U);
+    static constexpr uint32_t SLOT_MASK = static_cast<uint32_t>(NUM_SLOTS - 1U);
+
+    void rescheduleCyclicTimeout(Timeout& timeout, uint32_t now);
+
+    bool addTimeout(Timeout& timeout, uint32_t absoluteTimeout, uint32_t cycleTime, uint32_t now);
+
+    bool empty() const;
+    void advance(uint32_t now);
+    void redistribute(size_t level, size_t slot);
+    void insert(Timeout& timeout);
+    bool locate(Timeout const& timeout, size_t& level, size_t& slot) const;
+    Timeout const* front() const;
+
+    static void insertSorted(TimeoutList& list, Timeout& timeout, uint32_t now);
+
+    static int32_t diff(uint32_t a, uint32_t const b);
+
+    static uint32_t tick(uint32_t const time) { return (time >> RESOLUTION_BITS) & TICK_MASK; }
+
+    /// Timeouts which have elapsed relative to _now, sorted by expiry.
+    TimeoutList _elapsed;
+    ::etl::array<::etl::array<TimeoutList, NUM_SLOTS>, LEVELS> _slots;
+    ::etl::array<uint64_t, LEVELS> _occupied{};
+    /// The time up to which the wheel has been advanced.
+    uint32_t _now = 0U;
+};
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+bool TimingWheelTimer<LockGuard, RESOLUTION_BITS>::processNextTimeout(uint32_t const now)
+{
+    Timeout* timeout    = nullptr;
+    int32_t diffTimeout = 0;
+    {
+        LockGuard const scopedLock;
+        advance(now);
+        if (_elapsed.empty())
+        {
+            return false;
+        }
+        diffTimeout = diff(_elapsed.front()._time, now);
+        if (diffTimeout > 0)
+        {
+            return false;
+        }
+        timeout = &_elapsed.front();
+        _elapsed.pop_front();
+    }
+
+    rescheduleCyclicTimeout(*timeout, now);
+    timeout->expired();
+    return diffTimeout == 0U;
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+bool TimingWheelTimer<LockGuard, RESOLUTION_BITS>::getNextDelta(
+    uint32_t const now, uint32_t& nextDelta) const
+{
+    LockGuard const scopedLock;
+    Timeout const* const timeout = front();
+    if (timeout != nullptr)
+    {
+        if (diff(timeout->_time, now) < 0)
+        {
+            nextDelta = 0U;
+        }
+        else
+        {
+            nextDelta = timeout->_time - now;
+        }
+        return true;
+    }
+
+    nextDelta = 0U;
+    return false;
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+bool TimingWheelTimer<LockGuard, RESOLUTION_BITS>::isActive(Timeout const& timeout) const
+{
+    return timeout.is_linked();
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+bool TimingWheelTimer<LockGuard, RESOLUTION_BITS>::set(
+    Timeout& timeout, uint32_t const delay, uint32_t const now)
+{
+    return addTimeout(timeout, delay + now, 0U, now);
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+bool TimingWheelTimer<LockGuard, RESOLUTION_BITS>::setCyclic(
+    Timeout& timeout, uint32_t const period, uint32_t const now)
+{
+    return addTimeout(timeout, period + now, period, now);
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+void TimingWheelTimer<LockGuard, RESOLUTION_BITS>::cancel(Timeout& timeout)
+{
+    if (timeout.is_linked())
+    {
+        LockGuard const scopedLock;
+        size_t level = 0U;
+        size_t slot  = 0U;
+        if (!locate(timeout, level, slot))
+        {
+            _elapsed.erase(timeout);
+            return;
+        }
+        TimeoutList& list = _slots[level][slot];
+        list.erase(timeout);
+        if (list.empty())
+        {
+            _occupied[level] &= ~(1ULL << slot);
+        }
+    }
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+void TimingWheelTimer<LockGuard, RESOLUTION_BITS>::rescheduleCyclicTimeout(
+    Timeout& timeout, uint32_t const now)
+{
+    if (timeout._cycleTime > 0U)
+    {
+        (void)addTimeout(timeout, timeout._cycleTime + timeout._time, timeout._cycleTime, now);
+    }
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+bool TimingWheelTimer<LockGuard, RESOLUTION_BITS>::addTimeout(
+    Timeout& timeout, uint32_t const absoluteTimeout, uint32_t const cycleTime, uint32_t const now)
+{
+    if (timeout.is_linked())
+    {
+        return false;
+    }
+
+    timeout._time      = absoluteTimeout;
+    timeout._cycleTime = cycleTime;
+
+    LockGuard const lock;
+
+    advance(now);
+    // Same condition as in Timer: the new timeout expires before all others.
+    Timeout const* const first = front();
+    bool const isFirst
+        = (first == nullptr) || (diff(first->_time, now) > diff(timeout._time, now));
+    insert(timeout);
+    return isFirst;
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+bool TimingWheelTimer<LockGuard, RESOLUTION_BITS>::empty() const
+{
+    if (!_elapsed.empty())
+    {
+        return false;
+    }
+    for (auto const occupied : _occupied)
+    {
+        if (occupied != 0U)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+void TimingWheelTimer<LockGuard, RESOLUTION_BITS>::advance(uint32_t const now)
+{
+    // An empty wheel can't have fallen behind, which also keeps _now within the range of diff()
+    // after long idle periods.
+    if (empty())
+    {
+        _now = now;
+        return;
+    }
+    if (diff(now, _now) <= 0)
+    {
+        return;
+    }
+    uint32_t const oldTick = tick(_now);
+    uint32_t const newTick = tick(now);
+    _now                   = now;
+
+    // Level 0 includes the current slot, which may contain timeouts that just elapsed. Higher
+    // levels never contain timeouts in their current slot.
+    for (size_t level = 0U; level < LEVELS; ++level)
+    {
+        size_t const shift   = level * SLOT_BITS;
+        uint32_t const steps = ((newTick >> shift) - (oldTick >> shift)) & (TICK_MASK >> shift);
+        size_t const first   = (level == 0U) ? 0U : 1U;
+        size_t const count   = (steps + first >= NUM_SLOTS) ? NUM_SLOTS : (steps + 1U - first);
+        for (size_t i = 0U; i < count; ++i)
+        {
+            size_t const slot = ((oldTick >> shift) + first + i) & SLOT_MASK;
+            redistribute(level, slot);
+        }
+    }
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+void TimingWheelTimer<LockGuard, RESOLUTION_BITS>::redistribute(
+    size_t const level, size_t const slot)
+{
+    if ((_occupied[level] & (1ULL << slot)) == 0U)
+    {
+        return;
+    }
+    _occupied[level] &= ~(1ULL << slot);
+
+    // Detach the slot first, timeouts of the current slot of level 0 may be inserted into it again.
+    TimeoutList& list = _slots[level][slot];
+    TimeoutList pending;
+    while (!list.empty())
+    {
+        Timeout& timeout = list.front();
+        list.pop_front();
+        pending.push_front(timeout);
+    }
+    if (level == 0U)
+    {
+        // Slots of level 0 are sorted, slots of higher levels are filled at the front. Restore the
+        // order of insertion so that timeouts with the same expiry time keep their order.
+        pending.reverse();
+    }
+    while (!pending.empty())
+    {
+        Timeout& timeout = pending.front();
+        pending.pop_front();
+        insert(timeout);
+    }
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+void TimingWheelTimer<LockGuard, RESOLUTION_BITS>::insert(Timeout& timeout)
+{
+    size_t level = 0U;
+    size_t slot  = 0U;
+    if (!locate(timeout, level, slot))
+    {
+        insertSorted(_elapsed, timeout, _now);
+        return;
+    }
+    if (level == 0U)
+    {
+        insertSorted(_slots[level][slot], timeout, _now);
+    }
+    else
+    {
+        _slots[level][slot].push_front(timeout);
+    }
+    _occupied[level] |= (1ULL << slot);
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+bool TimingWheelTimer<LockGuard, RESOLUTION_BITS>::locate(
+    Timeout const& timeout, size_t& level, size_t& slot) const
+{
+    if (diff(timeout._time, _now) <= 0)
+    {
+        return false;
+    }
+    uint32_t const expiryTick = tick(timeout._time);
+    uint32_t const changed    = expiryTick ^ tick(_now);
+    level = (changed == 0U) ? 0U : ((31U - ::etl::count_leading_zeros(changed)) / SLOT_BITS);
+    slot  = (expiryTick >> (level * SLOT_BITS)) & SLOT_MASK;
+    return true;
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+Timeout const* TimingWheelTimer<LockGuard, RESOLUTION_BITS>::front() const
+{
+    if (!_elapsed.empty())
+    {
+        return &_elapsed.front();
+    }
+    // All timeouts of a level expire before those of the next level. Within a level, the slots
+    // are ordered starting from the current one.
+    for (size_t level = 0U; level < LEVELS; ++level)
+    {
+        uint64_t const occupied = _occupied[level];
+        if (occupied == 0U)
+        {
+            continue;
+        }
+        size_t const current = (tick(_now) >> (level * SLOT_BITS)) & SLOT_MASK;
+        size_t const slot
+            = (current + ::etl::count_trailing_zeros(::etl::rotate_right(occupied, current)))
+              & SLOT_MASK;
+        TimeoutList const& list = _slots[level][slot];
+        if (level == 0U)
+        {
+            return &list.front();
+        }
+        Timeout const* first = nullptr;
+        for (auto const& timeout : list)
+        {
+            if ((first == nullptr) || (diff(timeout._time, first->_time) < 0))
+            {
+                first = &timeout;
+            }
+        }
+        return first;
+    }
+    return nullptr;
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+void TimingWheelTimer<LockGuard, RESOLUTION_BITS>::insertSorted(
+    TimeoutList& list, Timeout& timeout, uint32_t const now)
+{
+    int32_t const timeoutDiff           = diff(timeout._time, now);
+    typename TimeoutList::iterator prev = list.before_begin();
+
+    for (typename TimeoutList::iterator current = list.begin(); current != list.end(); ++current)
+    {
+        if (diff(current->_time, now) > timeoutDiff)
+        {
+            break;
+        }
+        prev = current;
+    }
+    (void)list.insert_after(prev, timeout);
+}
+
+template<class LockGuard, uint8_t RESOLUTION_BITS>
+int32_t TimingWheelTimer<LockGuard, RESOLUTION_BITS>::diff(uint32_t const a, uint32_t const b)
+{
+    return static_cast<int32_t>(a - b);
+}
+
+} // namespace timer
@@ -0,0 +1,236 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "timer/TimingWheelTimer.h"
+
+#include "timer/Timeout.h"
+#include "timer/Timer.h"
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+using ::timer::Timeout;
+using namespace ::testing;
+
+struct NoLock
+{};
+
+struct RecordingTimeout : public Timeout
+{
+    void expired() override { _log->push_back(_id); }
+
+    size_t _id                = 0U;
+    std::vector<size_t>* _log = nullptr;
+};
+
+/**
+ * Drives a timer the same way as a TaskContext does and records the expired timeouts.
+ */
+template<class T>
+struct TimerDriver
+{
+    static constexpr size_t NUM_TIMEOUTS = 64U;
+
+    TimerDriver()
+    {
+        for (size_t i = 0U; i < NUM_TIMEOUTS; ++i)
+        {
+            _timeouts[i]._id  = i;
+            _timeouts[i]._log = &_log;
+        }
+    }
+
+    // Returns the sorted ids of the expired timeouts and the next delta, or 0xFFFFFFFF if there is
+    // no next timeout.
+    std::vector<size_t> update(uint32_t const now, uint32_t& nextDelta)
+    {
+        _log.clear();
+        bool hasDelta = false;
+        do
+        {
+            while (_timer.processNextTimeout(now)) {}
+            hasDelta = _timer.getNextDelta(now, nextDelta);
+        } while (hasDelta && (nextDelta == 0U));
+        if (!hasDelta)
+        {
+            nextDelta = 0xFFFFFFFFU;
+        }
+        std::sort(_log.begin(), _log.end());
+        return _log;
+    }
+
+    T _timer;
+    RecordingTimeout _timeouts[NUM_TIMEOUTS];
+    std::vector<size_t> _log;
+};
+
+template<class WheelTimer>
+struct TimingWheelTimerTest : public ::testing::Test
+{
+    using Reference = TimerDriver<::timer::Timer<NoLock>>;
+    using Wheel     = TimerDriver<WheelTimer>;
+
+    uint32_t random()
+    {
+        _seed = (_seed * 1103515245U) + 12345U;
+        return _seed >> 8U;
+    }
+
+    void expectSameState(uint32_t const now)
+    {
+        uint32_t referenceDelta = 0U;
+        uint32_t wheelDelta     = 0U;
+        auto const referenceExpired = _reference.update(now, referenceDelta);
+        auto const wheelExpired     = _wheel.update(now, wheelDelta);
+        EXPECT_EQ(referenceExpired, wheelExpired) << "now: " << now;
+        EXPECT_EQ(referenceDelta, wheelDelta) << "now: " << now;
+        std::vector<bool> referenceActive;
+        std::vector<bool> wheelActive;
+        for (size_t i = 0U; i < Reference::NUM_TIMEOUTS; ++i)
+        {
+            referenceActive.push_back(_reference._timer.isActive(_reference._timeouts[i]));
+            wheelActive.push_back(_wheel._timer.isActive(_wheel._timeouts[i]));
+        }
+        EXPECT_EQ(referenceActive, wheelActive) << "now: " << now;
+    }
+
+    uint32_t _seed = 42U;
+    Reference _reference;
+    Wheel _wheel;
+};
+
+using WheelTimerTypes = ::testing::Types<
+    ::timer::TimingWheelTimer<NoLock>,
+    ::timer::TimingWheelTimer<NoLock, 2U>,
+    ::timer::TimingWheelTimer<NoLock, 14U>>;
+
+TYPED_TEST_SUITE(TimingWheelTimerTest, WheelTimerTypes);
+
+/**
+ * \desc
+ * Random sequences of set, setCyclic, cancel and processing of timeouts with small and large
+ * delays, crossing the 32 bit overflow, result in the same expired timeouts, the same return
+ * values and the same next deltas as with Timer.
+ */
+TYPED_TEST(TimingWheelTimerTest, behaves_like_timer_for_random_operations)
+{
+    uint32_t now = 0xFF000000U;
+    for (size_t step = 0U; step < 3000U; ++step)
+    {
+        size_t const id = this->random() % TestFixture::Reference::NUM_TIMEOUTS;
+        auto& referenceTimeout = this->_reference._timeouts[id];
+        auto& wheelTimeout     = this->_wheel._timeouts[id];
+        uint32_t const kind    = this->random() % 8U;
+        uint32_t delay         = this->random() % 5000U;
+        if (kind == 0U)
+        {
+            delay = this->random() % 0x01000000U;
+        }
+        switch (this->random() % 4U)
+        {
+            case 0U:
+            {
+                EXPECT_EQ(
+                    this->_reference._timer.set(referenceTimeout, delay, now),
+                    this->_wheel._timer.set(wheelTimeout, delay, now));
+                break;
+            }
+            case 1U:
+            {
+                EXPECT_EQ(
+                    this->_reference._timer.setCyclic(referenceTimeout, delay + 1U, now),
+                    this->_wheel._timer.setCyclic(wheelTimeout, delay + 1U, now));
+                break;
+            }
+            case 2U:
+            {
+                this->_reference._timer.cancel(referenceTimeout);
+                this->_wheel._timer.cancel(wheelTimeout);
+                break;
+            }
+            default:
+            {
+                uint32_t const elapsed = (kind == 1U) ? (this->random() % 0x00100000U)
+                                                      : (this->random() % 3000U);
+                now += elapsed;
+                break;
+            }
+        }
+        this->expectSameState(now);
+        if (this->HasFailure())
+        {
+            FAIL() << "step: " << step;
+        }
+    }
+}
+
+/**
+ * \desc
+ * Timeouts set after a long idle period which exceeds the range of the 32 bit time difference are
+ * processed like with Timer.
+ */
+TYPED_TEST(TimingWheelTimerTest, handles_long_idle_periods)
+{
+    uint32_t now = 100U;
+    EXPECT_TRUE(this->_wheel._timer.set(this->_wheel._timeouts[0], 10U, now));
+    EXPECT_TRUE(this->_reference._timer.set(this->_reference._timeouts[0], 10U, now));
+    this->expectSameState(now + 10U);
+
+    now = 0x90000000U;
+    EXPECT_TRUE(this->_wheel._timer.set(this->_wheel._timeouts[1], 0x100U, now));
+    EXPECT_TRUE(this->_reference._timer.set(this->_reference._timeouts[1], 0x100U, now));
+    this->expectSameState(now);
+    this->expectSameState(now + 0x100U);
+}
+
+/**
+ * \desc
+ * Timeouts can be canceled in any level of the wheel and after they have elapsed.
+ */
+TYPED_TEST(TimingWheelTimerTest, cancel_in_all_levels)
+{
+    auto& timer    = this->_wheel._timer;
+    auto& timeouts = this->_wheel._timeouts;
+    uint32_t delta = 0U;
+
+    uint32_t delay = 1U;
+    for (size_t i = 0U; i < 31U; ++i)
+    {
+        timer.set(timeouts[i], delay, 0U);
+        EXPECT_TRUE(timer.isActive(timeouts[i]));
+        delay <<= 1U;
+    }
+    for (size_t i = 0U; i < 31U; i += 2U)
+    {
+        timer.cancel(timeouts[i]);
+        EXPECT_FALSE(timer.isActive(timeouts[i]));
+    }
+    EXPECT_TRUE(timer.getNextDelta(0U, delta));
+    EXPECT_EQ(2U, delta);
+
+    // Timeouts 1 and 3 have elapsed, but haven't been processed yet
+    EXPECT_EQ(std::vector<size_t>{}, this->_wheel.update(1U, delta));
+    timer.cancel(timeouts[1]);
+    EXPECT_EQ(std::vector<size_t>{3U}, this->_wheel.update(8U, delta));
+    EXPECT_EQ(24U, delta);
+
+    for (size_t i = 5U; i < 31U; i += 2U)
+    {
+        timer.cancel(timeouts[i]);
+    }
+    EXPECT_FALSE(timer.getNextDelta(8U, delta));
+    timer.cancel(timeouts[0]);
+}
+
+} // namespace
@@ -138,6 +138,17 @@ public:
          */
         void releaseTransportMessage(TransportMessage& transportMessage) override;
 
+        /**
+         * \see ITransportMessageProvidingListener::getTransportMessageSink()
+         */
+        ITransportMessageProvidingListener::ErrorCode getTransportMessageSink(
+            uint8_t srcBusId,
+            uint16_t sourceAddress,
+            uint16_t targetAddress,
+            uint32_t size,
+            ::etl::span<uint8_t const> const& peek,
+            ITransportMessageSink*& pSink) override;
+
         /**
          * \see ITransportMessageProvidingListener::messageReceived()
          */
@@ -19,6 +19,7 @@
 
 namespace transport
 {
+class ITransportMessageSink;
 class TransportMessage;
 
 /**
@@ -88,6 +89,42 @@ public:
      */
     virtual void releaseTransportMessage(TransportMessage& transportMessage) = 0;
 
+    /**
+     * returns a sink for streaming the payload of a received message instead of
+     * a TransportMessage holding the complete payload. The size is not limited
+     * by a buffer of the provider.
+     * \param srcBusId          id of bus message is received from
+     * \param sourceAddress     id of message's source
+     * \param targetAddress     id of message's target
+     * \param size              payload size of the message
+     * \param peek              slice to the first payload bytes of the message
+     * \param pSink             a pointer to the sink (0L if no sink was
+     *          available) is written to this pointer.
+     * \return
+     *          - TPMSG_OK: pSink has been set
+     *          - TPMSG_INVALID_SRC_ADDRESS: sourceAddress is not allowed from srcBusId
+     *          - TPMSG_INVALID_TGT_ADDRESS: requested targetAddress is invalid
+     *          - TPMSG_NO_MSG_AVAILABLE: all params are valid but all
+     *          sinks are currently in use
+     *          - TPMSG_NOT_RESPONSIBLE: the message should be received by
+     *          getTransportMessage(), this is the default
+     *
+     * \note
+     * The sink is returned by a call to ITransportMessageSink::receptionEnded()
+     * before it can be returned again by this method.
+     */
+    virtual ErrorCode getTransportMessageSink(
+        uint8_t /* srcBusId */,
+        uint16_t /* sourceAddress */,
+        uint16_t /* targetAddress */,
+        uint32_t /* size */,
+        ::etl::span<uint8_t const> const& /* peek */,
+        ITransportMessageSink*& pSink)
+    {
+        pSink = nullptr;
+        return ErrorCode::TPMSG_NOT_RESPONSIBLE;
+    }
+
     /**
      * dumps internal buffer state to output
      */
@@ -0,0 +1,54 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/**
+ * \ingroup transport
+ */
+#pragma once
+
+#include <etl/span.h>
+
+#include <platform/estdint.h>
+
+namespace transport
+{
+/**
+ * Interface for consumers that take the payload of a received message in chunks as it arrives
+ * instead of providing a TransportMessage that holds the complete payload.
+ *
+ * \see ITransportMessageProvider::getTransportMessageSink()
+ * \par
+ * A typical streaming transaction has the following steps:
+ * - a transport layer calls getTransportMessageSink to get a sink to receive to
+ * - chunkReceived gets called for each chunk of payload in order of reception
+ * - once the reception has ended receptionEnded gets called and the sink may be used again
+ */
+class ITransportMessageSink
+{
+public:
+    ITransportMessageSink& operator=(ITransportMessageSink const&) = delete;
+
+    /**
+     * Called for each chunk of payload in order of reception.
+     * \param offset position of the chunk within the payload
+     * \param data payload bytes, only valid during the call
+     * \return true if the chunk has been taken, false to abort the reception
+     */
+    virtual bool chunkReceived(uint32_t offset, ::etl::span<uint8_t const> const& data) = 0;
+
+    /**
+     * Called once when the reception has ended. The transport layer doesn't use the sink anymore.
+     * \param complete true if all payload has been handed over, false if the reception has been
+     * aborted
+     */
+    virtual void receptionEnded(bool complete) = 0;
+};
+
+} // namespace transport
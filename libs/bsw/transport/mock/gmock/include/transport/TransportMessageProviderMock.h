@@ -39,6 +39,16 @@ public:
 
     MOCK_METHOD(void, releaseTransportMessage, (TransportMessage&));
 
+    MOCK_METHOD(
+        ErrorCode,
+        getTransportMessageSink,
+        (uint8_t,
+         uint16_t,
+         uint16_t,
+         uint32_t,
+         ::etl::span<uint8_t const> const&,
+         ITransportMessageSink*&));
+
     MOCK_METHOD(void, dump, ());
 };
 
@@ -0,0 +1,29 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include "transport/ITransportMessageSink.h"
+
+#include <etl/span.h>
+
+#include <gmock/gmock.h>
+
+namespace transport
+{
+class TransportMessageSinkMock : public ITransportMessageSink
+{
+public:
+    MOCK_METHOD(bool, chunkReceived, (uint32_t offset, ::etl::span<uint8_t const> const& data));
+
+    MOCK_METHOD(void, receptionEnded, (bool complete));
+};
+
+} // namespace transport
@@ -76,6 +76,25 @@ void AbstractTransportLayer::TransportMessageProvidingListenerHelper::releaseTra
     }
 }
 
+// virtual
+ITransportMessageProvidingListener::ErrorCode
+AbstractTransportLayer::TransportMessageProvidingListenerHelper::getTransportMessageSink(
+    uint8_t const srcBusId,
+    uint16_t const sourceAddress,
+    uint16_t const targetAddress,
+    uint32_t const size,
+    ::etl::span<uint8_t const> const& peek,
+    ITransportMessageSink*& pSink)
+{
+    if (fpMessageProvider != nullptr)
+    {
+        return fpMessageProvider->getTransportMessageSink(
+            srcBusId, sourceAddress, targetAddress, size, peek, pSink);
+    }
+    pSink = nullptr;
+    return ITransportMessageProvidingListener::ErrorCode::TPMSG_NOT_RESPONSIBLE;
+}
+
 // virtual
 ITransportMessageListener::ReceiveResult
 AbstractTransportLayer::TransportMessageProvidingListenerHelper::messageReceived(
@@ -19,6 +19,7 @@
 #include "transport/TransportMessage.h"
 #include "transport/TransportMessageListenerMock.h"
 #include "transport/TransportMessageProviderMock.h"
+#include "transport/TransportMessageSinkMock.h"
 
 #include <memory>
 
@@ -97,6 +98,35 @@ TEST_F(AbstractTransportLayerTest, TestHelperMethods)
         listenerHelper.messageReceived(0, tmp, nullptr));
 }
 
+/**
+ * This test verifies whether
+ * TransportMessageProvidingListenerHelper::getTransportMessageSink() triggers
+ * ITransportMessageProvider::getTransportMessageSink() and returns
+ * NOT_RESPONSIBLE without a provider.
+ */
+TEST_F(AbstractTransportLayerTest, TestHelperGetTransportMessageSink)
+{
+    TransportMessageSinkMock sink;
+    EXPECT_CALL(provider, getTransportMessageSink(_, Eq(1U), Eq(2U), Eq(70000U), _, _))
+        .WillOnce(DoAll(
+            SetArgReferee<5>(&sink),
+            Return(ITransportMessageProvidingListener::ErrorCode::TPMSG_OK)));
+
+    ITransportMessageProvidingListener& listenerHelper = impl->getProvidingListenerHelper_impl();
+
+    ITransportMessageSink* pSink = nullptr;
+    ASSERT_EQ(
+        ITransportMessageProvidingListener::ErrorCode::TPMSG_OK,
+        listenerHelper.getTransportMessageSink(0, 1, 2, 70000U, {}, pSink));
+    EXPECT_EQ(&sink, pSink);
+
+    impl->fProvidingListenerHelper.fpMessageProvider = nullptr;
+    ASSERT_EQ(
+        ITransportMessageProvidingListener::ErrorCode::TPMSG_NOT_RESPONSIBLE,
+        listenerHelper.getTransportMessageSink(0, 1, 2, 70000U, {}, pSink));
+    EXPECT_EQ(nullptr, pSink);
+}
+
 /**
  * This test checks that when ITransportMessageProvider and
  * ITransportMessageListener are unset in AbstractTransportLayer it's underlying
@@ -23,6 +23,7 @@
 #include "transport/ITransportMessageProcessedListener.h"
 #include "transport/ITransportMessageProvider.h"
 #include "transport/ITransportMessageProvidingListener.h"
+#include "transport/ITransportMessageSink.h"
 #include "transport/TransportMessage.h"
 #include "transport/TransportMessageSendJob.h"
 // IWYU pragma: end_keep
@@ -35,6 +35,7 @@ class IDiagSessionManager;
 class DiagSubSession;
 class Service;
 class DiagJobRoot;
+class DiagJobIndex;
 
 /**
  * Common base class for diagnosis jobs
@@ -107,6 +108,7 @@ public:
     : fpImplementedRequest(implementedRequest)
     , fpFirstChild(nullptr)
     , fpNextJob(nullptr)
+    , fpDispatchIndex(nullptr)
     , fAllowedSessions(sessionMask)
     , fResponseLength(VARIABLE_RESPONSE_LENGTH)
     , fRequestLength(requestLength)
@@ -114,6 +116,7 @@ public:
     , fRequestPayloadLength(VARIABLE_REQUEST_LENGTH)
     , fDefaultDiagReturnCode(DiagReturnCode::ISO_GENERAL_REJECT)
     , fSuppressPositiveResponseBitEnabled(false)
+    , fIndexed(false)
     {
         if (requestLength > 0U)
         {
@@ -150,6 +153,7 @@ public:
     : fpImplementedRequest(implementedRequest)
     , fpFirstChild(nullptr)
     , fpNextJob(nullptr)
+    , fpDispatchIndex(nullptr)
     , fAllowedSessions(sessionMask)
     , fResponseLength(responseLength)
     , fRequestLength(requestLength)
@@ -157,6 +161,7 @@ public:
     , fRequestPayloadLength(requestPayloadLength)
     , fDefaultDiagReturnCode(DiagReturnCode::ISO_GENERAL_REJECT)
     , fSuppressPositiveResponseBitEnabled(false)
+    , fIndexed(false)
     {
         if (requestLength > 0U)
         {
@@ -213,6 +218,21 @@ public:
      */
     void removeAbstractDiagJob(AbstractDiagJob& job);
 
+    /**
+     * Sets an index that is used by process() to look up the child job
+     * responsible for a request instead of asking all child jobs in turn.
+     * \param   index   DiagJobIndex that is filled with the child jobs
+     *
+     * \section Behaviour
+     * Child jobs added before are indexed immediately, child jobs added later
+     * in addAbstractDiagJob(). An indexed child job is only asked for requests
+     * that start with its implemented request following the prefix, so the
+     * index must only be set if this holds for verify() of all child jobs, as
+     * e.g. for DataIdentifierJob and RoutineControlJob. Child jobs that are
+     * not indexed are asked afterwards in the order they have been added.
+     */
+    void setDispatchIndex(DiagJobIndex& index);
+
     /**
      * Callback that gets invoked when a response on a IncomingDiagConnection
      * has been sent
@@ -262,6 +282,7 @@ protected:
     : fpImplementedRequest(pJob->fpImplementedRequest)
     , fpFirstChild(nullptr)
     , fpNextJob(nullptr)
+    , fpDispatchIndex(nullptr)
     , fAllowedSessions(pJob->fAllowedSessions)
     , fResponseLength(pJob->fResponseLength)
     , fRequestLength(pJob->fRequestLength)
@@ -269,6 +290,7 @@ protected:
     , fRequestPayloadLength(pJob->fRequestPayloadLength)
     , fDefaultDiagReturnCode(DiagReturnCode::ISO_GENERAL_REJECT)
     , fSuppressPositiveResponseBitEnabled(false)
+    , fIndexed(false)
     {}
 
     /**
@@ -402,6 +424,7 @@ private:
     friend class Service;
     friend class ServiceWithAuthentication;
     friend class DiagJobRoot;
+    friend class DiagJobIndex;
     friend class ::http::html::UdsController;
 
     /** Mask with suppress positive response bit set */
@@ -419,12 +442,16 @@ private:
     void checkSuppressPositiveResponseBit(
         IncomingDiagConnection& connection, uint8_t const request[]) const;
 
+    bool isChildJob(AbstractDiagJob const& job) const;
+
     /** Array containing the request implemented by this job */
     uint8_t const* const fpImplementedRequest;
     /** Pointer to first child. A child has fpImplementedRequest as its prefix */
     AbstractDiagJob* fpFirstChild;
     /** Pointer to next job that has the same prefix */
     AbstractDiagJob* fpNextJob;
+    /** Optional index of the child jobs */
+    DiagJobIndex* fpDispatchIndex;
     /** Mask with bits set for session in which this job may be executed */
     DiagSession::DiagSessionMask const fAllowedSessions;
     /** Required length of response */
@@ -440,6 +467,8 @@ private:
     DiagReturnCode::Type fDefaultDiagReturnCode;
     /** Indication if positive response bit handling is enabled */
     bool fSuppressPositiveResponseBitEnabled;
+    /** Indication if this job is contained in the dispatch index of its parent */
+    bool fIndexed;
 };
 
 /**
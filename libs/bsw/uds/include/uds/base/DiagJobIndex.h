@@ -0,0 +1,138 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <etl/uncopyable.h>
+#include <etl/vector.h>
+
+#include <platform/estdint.h>
+
+namespace uds
+{
+class AbstractDiagJob;
+
+/**
+ * Dispatch index of the child jobs of an AbstractDiagJob
+ *
+ * \section Design
+ * The index is a table of the child jobs sorted by the bytes of their
+ * implemented request that follow the prefix, e.g. the data identifier of the
+ * jobs below ReadDataByIdentifier. All keys of one index have the same length,
+ * which is taken from the first job added. Jobs with a different key length,
+ * with a key longer than MAX_KEY_LENGTH or with the same key as an indexed job
+ * are not indexed and only counted.
+ *
+ * \see AbstractDiagJob::setDispatchIndex()
+ */
+class DiagJobIndex : public ::etl::uncopyable
+{
+public:
+    static uint8_t const MAX_KEY_LENGTH = 4U;
+
+    struct Entry
+    {
+        uint32_t key;
+        AbstractDiagJob* job;
+    };
+
+    using EntryVector = ::etl::ivector<Entry>;
+
+    explicit DiagJobIndex(EntryVector& entries);
+
+    /**
+     * Adds a child job to the index.
+     * \param   job Child job to add
+     * \return
+     *          - true: job has been indexed
+     *          - false: job is only counted as unindexed job
+     */
+    bool add(AbstractDiagJob& job);
+
+    /**
+     * Removes a child job, which has been added before, from the index.
+     * \param   job Child job to remove
+     */
+    void remove(AbstractDiagJob& job);
+
+    /**
+     * Removes all jobs from the index.
+     */
+    void clear();
+
+    /**
+     * Looks up the indexed job that is responsible for a request.
+     * \param   request Array containing the request without the prefix
+     * \param   requestLength   Length of request, must not be less than the key length
+     * \return  Pointer to indexed job or nullptr if none of the indexed jobs matches
+     */
+    AbstractDiagJob* find(uint8_t const request[], uint16_t requestLength) const;
+
+    /**
+     * \return  true if a request of the given length can be looked up in the index
+     */
+    bool covers(uint16_t requestLength) const;
+
+    /**
+     * \return  Number of child jobs that have been added but are not indexed
+     */
+    uint16_t getUnindexedJobCount() const;
+
+    /**
+     * \return  Length of the keys in bytes or 0 if no job has been indexed yet
+     */
+    uint8_t getKeyLength() const;
+
+private:
+    static uint32_t makeKey(uint8_t const data[], uint8_t length);
+
+    EntryVector& fEntries;
+    uint16_t fUnindexedJobCount;
+    uint8_t fKeyLength;
+};
+
+namespace declare
+{
+/**
+ * Dispatch index for up to a specified number of child jobs.
+ * \tparam N Maximum number of indexed jobs
+ */
+template<size_t N>
+class DiagJobIndex : public ::uds::DiagJobIndex
+{
+public:
+    DiagJobIndex();
+
+private:
+    ::etl::vector<Entry, N> fEntries;
+};
+} // namespace declare
+
+/**
+ * Inline implementation.
+ */
+inline bool DiagJobIndex::covers(uint16_t const requestLength) const
+{
+    return (fKeyLength > 0U) && (requestLength >= fKeyLength);
+}
+
+inline uint16_t DiagJobIndex::getUnindexedJobCount() const { return fUnindexedJobCount; }
+
+inline uint8_t DiagJobIndex::getKeyLength() const { return fKeyLength; }
+
+namespace declare
+{
+template<size_t N>
+inline DiagJobIndex<N>::DiagJobIndex() : ::uds::DiagJobIndex(fEntries), fEntries()
+{}
+
+} // namespace declare
+
+} // namespace uds
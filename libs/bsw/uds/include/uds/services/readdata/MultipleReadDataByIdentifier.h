@@ -43,6 +43,13 @@ public:
      * combined response will be sent if none of the DIDs is valid
      */
     using CheckResponseType = ::etl::delegate<bool(DiagReturnCode::Type, DiagReturnCode::Type&)>;
+    /**
+     * Function that starts acquiring the data of a single DID, e.g. by requesting a sensor value
+     * from another context. It receives the identifier and the generation of the request. The
+     * function returns true if the acquisition has been started, in this case prefetchDone() has
+     * to be called with the generation once the data is available.
+     */
+    using PrefetchType      = ::etl::delegate<bool(uint16_t, uint8_t)>;
 
     /**
      * constructor.
@@ -72,6 +79,28 @@ public:
      */
     void setCheckResponse(CheckResponseType checkResponse);
 
+    /**
+     * Set a prefetch function. If set, the data of the requested DIDs is prefetched before the
+     * DID jobs are processed, with at most maxParallelPrefetches acquisitions running at the
+     * same time. The DID jobs are processed one after another in request order once all
+     * prefetches are done, so the latency of a request is dominated by the slowest acquisition
+     * instead of the sum of all. If the prefetches aren't done within timeoutMs, the request is
+     * answered with ISO_CONDITIONS_NOT_CORRECT.
+     * \param prefetch function that starts the acquisition of a single DID, an invalid
+     *        function disables prefetching
+     * \param maxParallelPrefetches maximum number of acquisitions running at the same time
+     * \param timeoutMs time in ms to wait for the prefetches of a request, 0 waits forever
+     */
+    void setPrefetch(PrefetchType prefetch, uint8_t maxParallelPrefetches, uint32_t timeoutMs);
+
+    /**
+     * Report that an acquisition started by the prefetch function has finished. This function
+     * may be called from any context. Acquisitions of a request that has already been answered
+     * or dropped are ignored.
+     * \param generation generation of the request passed to the prefetch function
+     */
+    void prefetchDone(uint8_t generation);
+
 protected:
     /**
      * \see AbstractDiagJob::verify();
@@ -115,13 +144,48 @@ private:
     bool
     defaultCheckResponse(DiagReturnCode::Type responseCode, DiagReturnCode::Type& combinedResponse);
 
+    /**
+     * Start prefetches until the maximum number of parallel prefetches is reached
+     */
+    void startPrefetches();
+
+    /**
+     * Account finished prefetches and start the nested request once all are done, executed in
+     * the diag context
+     */
+    void handlePrefetchesDone();
+
+    /**
+     * Answer the request with a negative response if its prefetches aren't done in time
+     */
+    void handlePrefetchTimeout();
+
+    /**
+     * Stop waiting for the prefetches of the current request, late reports are ignored
+     */
+    void endPrefetches();
+
 private:
+    IAsyncDiagHelper& fAsyncHelper;
     AsyncDiagJobHelper fAsyncJobHelper;
     AbstractDiagJob& fFirstJob;
     GetDidLimitType fGetDidLimit;
     CheckResponseType fCheckResponse;
     ::etl::array<uint8_t, 3U> fBuffer;
     DiagReturnCode::Type fCombinedResponseCode;
+    PrefetchType fPrefetch;
+    ::async::Function fPrefetchesDone;
+    ::async::Function fPrefetchTimeoutExpired;
+    ::async::TimeoutType fPrefetchTimeout;
+    uint32_t fPrefetchTimeoutMs;
+    IncomingDiagConnection* fPrefetchConnection;
+    uint8_t const* fPrefetchRequest;
+    uint16_t fPrefetchRequestLength;
+    uint16_t fNextPrefetchOffset;
+    uint8_t fMaxParallelPrefetches;
+    uint8_t fRunningPrefetches;
+    uint8_t fFinishedPrefetches;
+    uint8_t fPrefetchGeneration;
 };
 
 } // namespace uds
@@ -13,6 +13,7 @@
 #include "uds/UdsLogger.h"
 #include "uds/authentication/DefaultDiagAuthenticator.h"
 #include "uds/authentication/IDiagAuthenticator.h"
+#include "uds/base/DiagJobIndex.h"
 #include "uds/base/DiagJobRoot.h"
 #include "uds/connection/IncomingDiagConnection.h"
 #include "uds/session/IDiagSessionManager.h"
@@ -195,6 +196,15 @@ AbstractDiagJob::ErrorCode AbstractDiagJob::addAbstractDiagJob(AbstractDiagJob&
         }
         job.fpNextJob    = nullptr;
         job.fpFirstChild = nullptr;
+        if (job.fpDispatchIndex != nullptr)
+        {
+            job.fpDispatchIndex->clear();
+        }
+        job.fIndexed = false;
+        if (fpDispatchIndex != nullptr)
+        {
+            (void)fpDispatchIndex->add(job);
+        }
 
         Logger::debug(UDS, "Add diag job successfully 0x%X", job.getRequestId());
 
@@ -223,6 +233,10 @@ void AbstractDiagJob::removeAbstractDiagJob(AbstractDiagJob& job)
     { // we cannot remove us from ourself
         return;
     }
+    if ((fpDispatchIndex != nullptr) && isChildJob(job))
+    {
+        fpDispatchIndex->remove(job);
+    }
     if (&job == fpFirstChild)
     { // we remove our first child
         fpFirstChild = job.getNextJob();
@@ -248,6 +262,36 @@ void AbstractDiagJob::removeAbstractDiagJob(AbstractDiagJob& job)
     }
 }
 
+void AbstractDiagJob::setDispatchIndex(DiagJobIndex& index)
+{
+    if (fpDispatchIndex != nullptr)
+    {
+        fpDispatchIndex->clear();
+    }
+    fpDispatchIndex = &index;
+    index.clear();
+    AbstractDiagJob* pCurrentJob = fpFirstChild;
+    while (pCurrentJob != nullptr)
+    {
+        (void)index.add(*pCurrentJob);
+        pCurrentJob = pCurrentJob->fpNextJob;
+    }
+}
+
+bool AbstractDiagJob::isChildJob(AbstractDiagJob const& job) const
+{
+    AbstractDiagJob const* pCurrentJob = fpFirstChild;
+    while (pCurrentJob != nullptr)
+    {
+        if (pCurrentJob == &job)
+        {
+            return true;
+        }
+        pCurrentJob = pCurrentJob->fpNextJob;
+    }
+    return false;
+}
+
 IDiagSessionManager& AbstractDiagJob::getDiagSessionManager()
 {
     ETL_ASSERT(sfpSessionManager != nullptr, ETL_ERROR_GENERIC("session manager must not be null"));
@@ -309,9 +353,26 @@ DiagReturnCode::Type AbstractDiagJob::process(
     DiagReturnCode::Type result  = DiagReturnCode::NOT_RESPONSIBLE;
     AbstractDiagJob* pCurrentJob = fpFirstChild;
 
+    bool const useIndex = (fpDispatchIndex != nullptr) && fpDispatchIndex->covers(requestLength);
+    if (useIndex)
+    {
+        AbstractDiagJob* const pIndexedJob = fpDispatchIndex->find(request, requestLength);
+        if (pIndexedJob != nullptr)
+        {
+            result = pIndexedJob->execute(connection, request, requestLength);
+        }
+        if (fpDispatchIndex->getUnindexedJobCount() == 0U)
+        {
+            // all other child jobs are indexed and not responsible
+            pCurrentJob = nullptr;
+        }
+    }
     while ((result == DiagReturnCode::NOT_RESPONSIBLE) && (pCurrentJob != nullptr))
     {
-        result      = pCurrentJob->execute(connection, request, requestLength);
+        if (!(useIndex && pCurrentJob->fIndexed))
+        {
+            result = pCurrentJob->execute(connection, request, requestLength);
+        }
         pCurrentJob = pCurrentJob->fpNextJob;
     }
     if (result == DiagReturnCode::NOT_RESPONSIBLE)
@@ -0,0 +1,110 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "uds/base/DiagJobIndex.h"
+
+#include "uds/base/AbstractDiagJob.h"
+
+#include <etl/algorithm.h>
+
+namespace uds
+{
+namespace
+{
+bool isLess(DiagJobIndex::Entry const& entry, uint32_t const key) { return entry.key < key; }
+} // namespace
+
+DiagJobIndex::DiagJobIndex(EntryVector& entries)
+: fEntries(entries), fUnindexedJobCount(0U), fKeyLength(0U)
+{}
+
+bool DiagJobIndex::add(AbstractDiagJob& job)
+{
+    uint8_t const keyLength
+        = (job.fpImplementedRequest != nullptr) ? (job.fRequestLength - job.fPrefixLength) : 0U;
+    if (fEntries.empty() && (keyLength > 0U) && (keyLength <= MAX_KEY_LENGTH))
+    {
+        fKeyLength = keyLength;
+    }
+    if ((fKeyLength > 0U) && (keyLength == fKeyLength) && (!fEntries.full()))
+    {
+        uint32_t const key = makeKey(job.fpImplementedRequest + job.fPrefixLength, keyLength);
+        auto const it      = ::etl::lower_bound(fEntries.begin(), fEntries.end(), key, &isLess);
+        if ((it == fEntries.end()) || (it->key != key))
+        {
+            (void)fEntries.insert(it, Entry{key, &job});
+            job.fIndexed = true;
+            return true;
+        }
+    }
+    ++fUnindexedJobCount;
+    return false;
+}
+
+void DiagJobIndex::remove(AbstractDiagJob& job)
+{
+    if (!job.fIndexed)
+    {
+        if (fUnindexedJobCount > 0U)
+        {
+            --fUnindexedJobCount;
+        }
+        return;
+    }
+    uint32_t const key = makeKey(job.fpImplementedRequest + job.fPrefixLength, fKeyLength);
+    auto const it      = ::etl::lower_bound(fEntries.begin(), fEntries.end(), key, &isLess);
+    if ((it != fEntries.end()) && (it->job == &job))
+    {
+        (void)fEntries.erase(it);
+    }
+    job.fIndexed = false;
+    if (fEntries.empty())
+    {
+        fKeyLength = 0U;
+    }
+}
+
+void DiagJobIndex::clear()
+{
+    for (Entry const& entry : fEntries)
+    {
+        entry.job->fIndexed = false;
+    }
+    fEntries.clear();
+    fUnindexedJobCount = 0U;
+    fKeyLength         = 0U;
+}
+
+AbstractDiagJob* DiagJobIndex::find(uint8_t const request[], uint16_t const requestLength) const
+{
+    if (!covers(requestLength))
+    {
+        return nullptr;
+    }
+    uint32_t const key = makeKey(request, fKeyLength);
+    auto const it      = ::etl::lower_bound(fEntries.begin(), fEntries.end(), key, &isLess);
+    if ((it != fEntries.end()) && (it->key == key))
+    {
+        return it->job;
+    }
+    return nullptr;
+}
+
+uint32_t DiagJobIndex::makeKey(uint8_t const data[], uint8_t const length)
+{
+    uint32_t key = 0U;
+    for (uint8_t i = 0U; i < length; ++i)
+    {
+        key = (key << 8U) | data[i];
+    }
+    return key;
+}
+
+} // namespace uds
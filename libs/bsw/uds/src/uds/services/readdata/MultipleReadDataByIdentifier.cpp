@@ -14,6 +14,7 @@
 #include "uds/connection/IncomingDiagConnection.h"
 #include "uds/session/DiagSession.h"
 
+#include <async/Async.h>
 #include <etl/memory.h>
 #include <transport/TransportMessage.h>
 
@@ -25,12 +26,30 @@ uint8_t const thisimplementedRequest[] = {ServiceId::READ_DATA_BY_IDENTIFIER};
 MultipleReadDataByIdentifier::MultipleReadDataByIdentifier(IAsyncDiagHelper& asyncHelper)
 : AbstractDiagJob(&thisimplementedRequest[0], 1U, 0U, DiagSession::ALL_SESSIONS())
 , NestedDiagRequest(1U)
+, fAsyncHelper(asyncHelper)
 , fAsyncJobHelper(asyncHelper, *this)
 , fFirstJob(*this)
 , fGetDidLimit()
 , fCheckResponse()
 , fBuffer()
 , fCombinedResponseCode(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE)
+, fPrefetch()
+, fPrefetchesDone(::async::Function::CallType::create<
+                  MultipleReadDataByIdentifier,
+                  &MultipleReadDataByIdentifier::handlePrefetchesDone>(*this))
+, fPrefetchTimeoutExpired(::async::Function::CallType::create<
+                          MultipleReadDataByIdentifier,
+                          &MultipleReadDataByIdentifier::handlePrefetchTimeout>(*this))
+, fPrefetchTimeout()
+, fPrefetchTimeoutMs(0U)
+, fPrefetchConnection(nullptr)
+, fPrefetchRequest(nullptr)
+, fPrefetchRequestLength(0U)
+, fNextPrefetchOffset(0U)
+, fMaxParallelPrefetches(0U)
+, fRunningPrefetches(0U)
+, fFinishedPrefetches(0U)
+, fPrefetchGeneration(0U)
 {
     fBuffer[0U] = ServiceId::READ_DATA_BY_IDENTIFIER;
     setDefaultDiagReturnCode(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE);
@@ -41,12 +60,30 @@ MultipleReadDataByIdentifier::MultipleReadDataByIdentifier(
     IAsyncDiagHelper& asyncHelper, AbstractDiagJob& firstJob)
 : AbstractDiagJob(&thisimplementedRequest[0], 1U, 0U, DiagSession::ALL_SESSIONS())
 , NestedDiagRequest(1U)
+, fAsyncHelper(asyncHelper)
 , fAsyncJobHelper(asyncHelper, *this)
 , fFirstJob(firstJob)
 , fGetDidLimit()
 , fCheckResponse()
 , fBuffer()
 , fCombinedResponseCode(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE)
+, fPrefetch()
+, fPrefetchesDone(::async::Function::CallType::create<
+                  MultipleReadDataByIdentifier,
+                  &MultipleReadDataByIdentifier::handlePrefetchesDone>(*this))
+, fPrefetchTimeoutExpired(::async::Function::CallType::create<
+                          MultipleReadDataByIdentifier,
+                          &MultipleReadDataByIdentifier::handlePrefetchTimeout>(*this))
+, fPrefetchTimeout()
+, fPrefetchTimeoutMs(0U)
+, fPrefetchConnection(nullptr)
+, fPrefetchRequest(nullptr)
+, fPrefetchRequestLength(0U)
+, fNextPrefetchOffset(0U)
+, fMaxParallelPrefetches(0U)
+, fRunningPrefetches(0U)
+, fFinishedPrefetches(0U)
+, fPrefetchGeneration(0U)
 {
     fBuffer[0U] = ServiceId::READ_DATA_BY_IDENTIFIER;
     setDefaultDiagReturnCode(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE);
@@ -72,6 +109,27 @@ void MultipleReadDataByIdentifier::setCheckResponse(CheckResponseType const chec
     }
 }
 
+void MultipleReadDataByIdentifier::setPrefetch(
+    PrefetchType const prefetch, uint8_t const maxParallelPrefetches, uint32_t const timeoutMs)
+{
+    fPrefetch              = prefetch;
+    fMaxParallelPrefetches = maxParallelPrefetches;
+    fPrefetchTimeoutMs     = timeoutMs;
+}
+
+void MultipleReadDataByIdentifier::prefetchDone(uint8_t const generation)
+{
+    {
+        ::async::LockType const lock;
+        if (generation != fPrefetchGeneration)
+        {
+            return;
+        }
+        ++fFinishedPrefetches;
+    }
+    ::async::execute(fAsyncHelper.getDiagContext(), fPrefetchesDone);
+}
+
 DiagReturnCode::Type
 MultipleReadDataByIdentifier::verify(uint8_t const* const request, uint16_t const requestLength)
 {
@@ -112,9 +170,113 @@ DiagReturnCode::Type MultipleReadDataByIdentifier::process(
 
     fCombinedResponseCode = DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE;
     fAsyncJobHelper.startAsyncRequest(connection);
+    if (fPrefetch.is_valid() && (fMaxParallelPrefetches > 0U))
+    {
+        {
+            ::async::LockType const lock;
+            ++fPrefetchGeneration;
+            fFinishedPrefetches = 0U;
+        }
+        fPrefetchConnection    = &connection;
+        fPrefetchRequest       = request;
+        fPrefetchRequestLength = requestLength;
+        fNextPrefetchOffset    = 0U;
+        fRunningPrefetches     = 0U;
+        startPrefetches();
+        if (fRunningPrefetches > 0U)
+        {
+            // the nested request is started by handlePrefetchesDone()
+            if (fPrefetchTimeoutMs > 0U)
+            {
+                ::async::schedule(
+                    fAsyncHelper.getDiagContext(),
+                    fPrefetchTimeoutExpired,
+                    fPrefetchTimeout,
+                    fPrefetchTimeoutMs,
+                    ::async::TimeUnit::MILLISECONDS);
+            }
+            return DiagReturnCode::OK;
+        }
+        endPrefetches();
+    }
     return connection.startNestedRequest(*this, *this, request, requestLength);
 }
 
+void MultipleReadDataByIdentifier::startPrefetches()
+{
+    while ((fRunningPrefetches < fMaxParallelPrefetches)
+           && ((fNextPrefetchOffset + 1U) < fPrefetchRequestLength))
+    {
+        uint16_t const identifier = static_cast<uint16_t>(
+            (static_cast<uint16_t>(fPrefetchRequest[fNextPrefetchOffset]) << 8U)
+            | static_cast<uint16_t>(fPrefetchRequest[fNextPrefetchOffset + 1U]));
+        fNextPrefetchOffset += 2U;
+        if (fPrefetch(identifier, fPrefetchGeneration))
+        {
+            ++fRunningPrefetches;
+        }
+    }
+}
+
+void MultipleReadDataByIdentifier::handlePrefetchesDone()
+{
+    uint8_t finishedPrefetches = 0U;
+    {
+        ::async::LockType const lock;
+        finishedPrefetches  = fFinishedPrefetches;
+        fFinishedPrefetches = 0U;
+    }
+    if (fPrefetchConnection == nullptr)
+    {
+        return;
+    }
+    IncomingDiagConnection& connection = *fPrefetchConnection;
+    if (!connection.isOpen)
+    {
+        // the connection has been terminated while waiting for the prefetches
+        endPrefetches();
+        fAsyncJobHelper.endAsyncRequest();
+        return;
+    }
+    fRunningPrefetches = (finishedPrefetches < fRunningPrefetches)
+                             ? static_cast<uint8_t>(fRunningPrefetches - finishedPrefetches)
+                             : 0U;
+    startPrefetches();
+    if (fRunningPrefetches == 0U)
+    {
+        endPrefetches();
+        (void)connection.startNestedRequest(*this, *this, fPrefetchRequest, fPrefetchRequestLength);
+    }
+}
+
+void MultipleReadDataByIdentifier::handlePrefetchTimeout()
+{
+    if (fPrefetchConnection == nullptr)
+    {
+        return;
+    }
+    IncomingDiagConnection& connection = *fPrefetchConnection;
+    endPrefetches();
+    if (connection.sendNegativeResponse(
+            static_cast<uint8_t>(DiagReturnCode::ISO_CONDITIONS_NOT_CORRECT), *this)
+        != ::uds::ErrorCode::OK)
+    {
+        // no response will be sent, e.g. because the connection has been terminated
+        fAsyncJobHelper.endAsyncRequest();
+    }
+}
+
+void MultipleReadDataByIdentifier::endPrefetches()
+{
+    {
+        ::async::LockType const lock;
+        ++fPrefetchGeneration;
+        fFinishedPrefetches = 0U;
+    }
+    fPrefetchConnection = nullptr;
+    (void)fPrefetchTimeout.cancel();
+}
+
 void MultipleReadDataByIdentifier::responseSent(
     IncomingDiagConnection& connection, ResponseSendResult const result)
 {
@@ -0,0 +1,230 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "uds/DiagDispatcher.h"
+#include "uds/DiagnosisConfiguration.h"
+#include "uds/base/DiagJobIndex.h"
+#include "uds/base/DiagJobRoot.h"
+#include "uds/connection/IncomingDiagConnection.h"
+#include "uds/jobs/ReadIdentifierFromMemory.h"
+#include "uds/services/readdata/ReadDataByIdentifier.h"
+#include "uds/session/ApplicationDefaultSession.h"
+#include "uds/session/IDiagSessionManager.h"
+
+#include <async/AsyncMock.h>
+#include <async/TestContext.h>
+#include <benchmark/benchmark.h>
+#include <etl/array.h>
+#include <etl/pool.h>
+#include <etl/queue.h>
+#include <etl/vector.h>
+#include <transport/ITransportMessageListener.h>
+#include <transport/ITransportMessageProcessedListener.h>
+#include <transport/ITransportMessageProvider.h>
+#include <transport/TransportConfiguration.h>
+#include <transport/TransportMessage.h>
+
+#include <mutex>
+
+namespace
+{
+using namespace ::uds;
+using ::transport::ITransportMessageListener;
+using ::transport::ITransportMessageProcessedListener;
+using ::transport::ITransportMessageProvider;
+using ::transport::TransportMessage;
+
+size_t const NUM_DIDS           = 500U;
+uint16_t const FIRST_DID        = 0x1000U;
+uint8_t const ECU_ADDRESS       = 0x10U;
+uint8_t const TESTER_ADDRESS    = 0xF1U;
+::async::ContextType const DIAG = 1U;
+
+class SessionManager : public IDiagSessionManager
+{
+public:
+    DiagSession const& getActiveSession() const override
+    {
+        return DiagSession::APPLICATION_DEFAULT_SESSION();
+    }
+
+    void startSessionTimeout() override {}
+
+    void stopSessionTimeout() override {}
+
+    bool isSessionTimeoutActive() override { return false; }
+
+    void resetToDefaultSession() override {}
+
+    DiagReturnCode::Type acceptedJob(
+        IncomingDiagConnection& /* connection */,
+        AbstractDiagJob const& /* job */,
+        uint8_t const /* request */[],
+        uint16_t /* requestLength */) override
+    {
+        return DiagReturnCode::OK;
+    }
+
+    void responseSent(
+        IncomingDiagConnection& /* connection */,
+        DiagReturnCode::Type /* result */,
+        uint8_t const /* response */[],
+        uint16_t /* responseLength */) override
+    {}
+
+    void addDiagSessionListener(IDiagSessionChangedListener&) override {}
+
+    void removeDiagSessionListener(IDiagSessionChangedListener&) override {}
+};
+
+/**
+ * Provides the response message and confirms each response immediately, like a tester on an
+ * ideal bus.
+ */
+class Tester
+: public ITransportMessageProvider
+, public ITransportMessageListener
+, public ITransportMessageProcessedListener
+{
+public:
+    Tester() { _response.init(_responseBuffer.data(), _responseBuffer.size()); }
+
+    ErrorCode getTransportMessage(
+        uint8_t /* srcBusId */,
+        uint16_t /* sourceAddress */,
+        uint16_t /* targetAddress */,
+        uint16_t /* size */,
+        ::etl::span<uint8_t const> const& /* peek */,
+        TransportMessage*& pTransportMessage) override
+    {
+        _response.resetValidBytes();
+        pTransportMessage = &_response;
+        return ErrorCode::TPMSG_OK;
+    }
+
+    void releaseTransportMessage(TransportMessage& /* transportMessage */) override {}
+
+    void dump() override {}
+
+    ReceiveResult messageReceived(
+        uint8_t /* sourceBusId */,
+        TransportMessage& transportMessage,
+        ITransportMessageProcessedListener* pNotificationListener) override
+    {
+        _positiveResponses += (transportMessage.getServiceId() == 0x62U) ? 1U : 0U;
+        if (pNotificationListener != nullptr)
+        {
+            pNotificationListener->transportMessageProcessed(
+                transportMessage, ProcessingResult::PROCESSED_NO_ERROR);
+        }
+        return ReceiveResult::RECEIVED_NO_ERROR;
+    }
+
+    void transportMessageProcessed(
+        TransportMessage& /* transportMessage */, ProcessingResult /* result */) override
+    {
+        ++_processedRequests;
+    }
+
+    size_t _positiveResponses = 0U;
+    size_t _processedRequests = 0U;
+
+private:
+    ::etl::array<uint8_t, 64U> _responseBuffer{};
+    TransportMessage _response;
+};
+
+// AsyncMock must only be constructed once, google benchmark keeps several fixtures alive.
+alignas(::async::AsyncMock) uint8_t asyncMockMem[sizeof(::async::AsyncMock)];
+std::once_flag asyncMockInitialized;
+
+template<bool UseIndex>
+void ReadDataByIdentifierDispatch(benchmark::State& state)
+{
+    std::call_once(asyncMockInitialized, []() { new (asyncMockMem)::async::AsyncMock(); });
+    ::async::TestContext context(DIAG);
+    context.handleAll();
+
+    SessionManager sessionManager;
+    AbstractDiagJob::setDefaultDiagSessionManager(sessionManager);
+    DiagJobRoot jobRoot;
+    ReadDataByIdentifier readDataByIdentifier;
+    declare::DiagJobIndex<NUM_DIDS> index;
+    if (UseIndex)
+    {
+        readDataByIdentifier.setDispatchIndex(index);
+    }
+    (void)jobRoot.addAbstractDiagJob(readDataByIdentifier);
+
+    static uint8_t const data[] = {0x01U, 0x02U, 0x03U, 0x04U};
+    ::etl::vector<ReadIdentifierFromMemory, NUM_DIDS> dids;
+    for (size_t i = 0U; i < NUM_DIDS; ++i)
+    {
+        dids.emplace_back(static_cast<uint16_t>(FIRST_DID + i), data, sizeof(data));
+        (void)jobRoot.addAbstractDiagJob(dids.back());
+    }
+
+    DiagnosisConfiguration configuration{
+        ECU_ADDRESS,
+        ::transport::TransportConfiguration::FUNCTIONAL_ALL_ISO14229,
+        ::transport::TransportConfiguration::DIAG_PAYLOAD_SIZE,
+        0U,
+        false,
+        false,
+        true,
+        DIAG};
+    ::etl::pool<IncomingDiagConnection, 1> connectionPool;
+    ::etl::queue<TransportJob, 1> sendJobQueue;
+    DiagDispatcher dispatcher(
+        connectionPool, sendJobQueue, configuration, sessionManager, jobRoot);
+    Tester tester;
+    dispatcher.fProvidingListenerHelper.fpMessageProvider = &tester;
+    dispatcher.fProvidingListenerHelper.fpMessageListener = &tester;
+    (void)dispatcher.init();
+
+    ::etl::array<uint8_t, 3U> requestBuffer{};
+    TransportMessage request(requestBuffer.data(), requestBuffer.size());
+    request.setSourceAddress(TESTER_ADDRESS);
+    request.setTargetAddress(ECU_ADDRESS);
+
+    size_t next = 0U;
+    for (auto _ : state)
+    {
+        // spread the requests over all data identifiers
+        uint16_t const did = static_cast<uint16_t>(FIRST_DID + next);
+        next               = (next + 97U) % NUM_DIDS;
+        requestBuffer[0]   = 0x22U;
+        requestBuffer[1]   = static_cast<uint8_t>(did >> 8U);
+        requestBuffer[2]   = static_cast<uint8_t>(did);
+        request.resetValidBytes();
+        (void)request.increaseValidBytes(requestBuffer.size());
+        request.setPayloadLength(requestBuffer.size());
+        request.setServiceId(0x22U);
+
+        (void)dispatcher.send(request, &tester);
+        context.execute();
+    }
+    if (tester._positiveResponses != static_cast<size_t>(state.iterations()))
+    {
+        state.SkipWithError("not all requests have been answered positively");
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+    for (auto& did : dids)
+    {
+        jobRoot.removeAbstractDiagJob(did);
+    }
+    jobRoot.removeAbstractDiagJob(readDataByIdentifier);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(ReadDataByIdentifierDispatch, false)->Name("ReadDataByIdentifier500DidsList");
+BENCHMARK_TEMPLATE(ReadDataByIdentifierDispatch, true)->Name("ReadDataByIdentifier500DidsIndex");
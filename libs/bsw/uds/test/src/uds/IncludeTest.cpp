@@ -27,6 +27,7 @@
 #include "uds/authentication/DefaultDiagAuthenticator.h"
 #include "uds/authentication/IDiagAuthenticator.h"
 #include "uds/base/AbstractDiagJob.h"
+#include "uds/base/DiagJobIndex.h"
 #include "uds/base/DiagJobRoot.h"
 #include "uds/base/DiagJobWithAuthentication.h"
 #include "uds/base/DiagJobWithAuthenticationAndSessionControl.h"
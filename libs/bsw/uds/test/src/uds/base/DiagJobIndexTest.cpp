@@ -0,0 +1,258 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+/**
+ * Contains unit tests for uds::DiagJobIndex.
+ */
+#include "uds/base/DiagJobIndex.h"
+
+#include "uds/base/AbstractDiagJob.h"
+#include "uds/connection/IncomingDiagConnection.h"
+#include "uds/session/ApplicationDefaultSession.h"
+#include "uds/session/ApplicationExtendedSession.h"
+#include "uds/session/DiagSessionManagerMock.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace ::uds;
+using namespace ::testing;
+
+/**
+ * Job that is responsible for all requests starting with its implemented
+ * request following the prefix, or for all requests if it has no implemented
+ * request.
+ */
+class CountingDiagJob : public AbstractDiagJob
+{
+public:
+    CountingDiagJob(
+        uint8_t const implementedRequest[],
+        uint8_t const requestLength,
+        uint8_t const prefixLength,
+        DiagSessionMask const sessionMask = DiagSession::ALL_SESSIONS())
+    : AbstractDiagJob(implementedRequest, requestLength, prefixLength, sessionMask)
+    , fPrefixLength(prefixLength)
+    {}
+
+    DiagReturnCode::Type verify(uint8_t const request[], uint16_t const requestLength) override
+    {
+        ++fVerifyCount;
+        uint8_t const keyLength = getRequestLength() - fPrefixLength;
+        if ((requestLength < keyLength)
+            || (!compare(request, getImplementedRequest() + fPrefixLength, keyLength)))
+        {
+            return DiagReturnCode::NOT_RESPONSIBLE;
+        }
+        return DiagReturnCode::OK;
+    }
+
+    DiagReturnCode::Type
+    process(IncomingDiagConnection& connection, uint8_t const request[], uint16_t requestLength)
+        override
+    {
+        ++fProcessCount;
+        return AbstractDiagJob::process(connection, request, requestLength);
+    }
+
+    using AbstractDiagJob::setDefaultDiagReturnCode;
+
+    uint8_t const fPrefixLength;
+    uint32_t fVerifyCount  = 0U;
+    uint32_t fProcessCount = 0U;
+};
+
+struct DiagJobIndexTest : Test
+{
+    DiagJobIndexTest()
+    {
+        AbstractDiagJob::setDefaultDiagSessionManager(fSessionManager);
+        ON_CALL(fSessionManager, getActiveSession()).WillByDefault(ReturnRef(fDefaultSession));
+        fService.setDefaultDiagReturnCode(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE);
+    }
+
+    DiagReturnCode::Type processService(uint8_t const request[], uint16_t const requestLength)
+    {
+        return fService.execute(fIncomingConnection, request, requestLength);
+    }
+
+    NiceMock<DiagSessionManagerMock> fSessionManager;
+    ApplicationDefaultSession fDefaultSession;
+    IncomingDiagConnection fIncomingConnection{::async::CONTEXT_INVALID};
+
+    uint8_t const fServiceRequest[1] = {0x22U};
+    uint8_t const fDid1Request[3]    = {0x22U, 0xF1U, 0x90U};
+    uint8_t const fDid2Request[3]    = {0x22U, 0x01U, 0x00U};
+    uint8_t const fDid3Request[3]    = {0x22U, 0xF1U, 0x80U};
+    CountingDiagJob fService{fServiceRequest, 1U, 0U};
+    CountingDiagJob fDid1{fDid1Request, 3U, 1U};
+    CountingDiagJob fDid2{fDid2Request, 3U, 1U};
+    CountingDiagJob fDid3{fDid3Request, 3U, 1U};
+    declare::DiagJobIndex<4U> fIndex;
+};
+
+/**
+ * \desc
+ * Jobs are looked up by the bytes of their implemented request following the prefix.
+ */
+TEST_F(DiagJobIndexTest, find_returns_job_with_matching_key)
+{
+    EXPECT_TRUE(fIndex.add(fDid1));
+    EXPECT_TRUE(fIndex.add(fDid2));
+    EXPECT_TRUE(fIndex.add(fDid3));
+    EXPECT_EQ(2U, fIndex.getKeyLength());
+    EXPECT_EQ(0U, fIndex.getUnindexedJobCount());
+
+    uint8_t const request1[] = {0xF1U, 0x90U};
+    uint8_t const request2[] = {0x01U, 0x00U, 0x55U};
+    uint8_t const request3[] = {0xF1U, 0x80U};
+    uint8_t const unknown[]  = {0xF1U, 0x91U};
+    EXPECT_EQ(&fDid1, fIndex.find(request1, sizeof(request1)));
+    EXPECT_EQ(&fDid2, fIndex.find(request2, sizeof(request2)));
+    EXPECT_EQ(&fDid3, fIndex.find(request3, sizeof(request3)));
+    EXPECT_EQ(nullptr, fIndex.find(unknown, sizeof(unknown)));
+    EXPECT_EQ(nullptr, fIndex.find(request1, 1U));
+    EXPECT_FALSE(fIndex.covers(1U));
+    EXPECT_TRUE(fIndex.covers(2U));
+}
+
+/**
+ * \desc
+ * Jobs with a different key length or exceeding the capacity are only counted.
+ */
+TEST_F(DiagJobIndexTest, jobs_which_cannot_be_indexed_are_counted)
+{
+    uint8_t const subfunctionRequest[] = {0x22U, 0x01U};
+    CountingDiagJob subfunction{subfunctionRequest, 2U, 1U};
+    uint8_t const did4Request[] = {0x22U, 0x00U, 0x01U};
+    CountingDiagJob did4{did4Request, 3U, 1U};
+    uint8_t const did5Request[] = {0x22U, 0x00U, 0x02U};
+    CountingDiagJob did5{did5Request, 3U, 1U};
+
+    EXPECT_TRUE(fIndex.add(fDid1));
+    EXPECT_FALSE(fIndex.add(subfunction));
+    EXPECT_TRUE(fIndex.add(fDid2));
+    EXPECT_TRUE(fIndex.add(fDid3));
+    EXPECT_TRUE(fIndex.add(did4));
+    EXPECT_FALSE(fIndex.add(did5));
+    EXPECT_EQ(2U, fIndex.getUnindexedJobCount());
+
+    fIndex.remove(did5);
+    fIndex.remove(subfunction);
+    EXPECT_EQ(0U, fIndex.getUnindexedJobCount());
+
+    fIndex.remove(fDid1);
+    uint8_t const request1[] = {0xF1U, 0x90U};
+    EXPECT_EQ(nullptr, fIndex.find(request1, sizeof(request1)));
+
+    fIndex.clear();
+    EXPECT_EQ(0U, fIndex.getKeyLength());
+    EXPECT_TRUE(fIndex.add(subfunction));
+    EXPECT_EQ(1U, fIndex.getKeyLength());
+}
+
+/**
+ * \desc
+ * With a dispatch index, only the responsible child job is asked.
+ */
+TEST_F(DiagJobIndexTest, process_asks_indexed_job_only)
+{
+    fService.setDispatchIndex(fIndex);
+    ASSERT_EQ(AbstractDiagJob::JOB_ADDED, fService.addAbstractDiagJob(fDid1));
+    ASSERT_EQ(AbstractDiagJob::JOB_ADDED, fService.addAbstractDiagJob(fDid2));
+    ASSERT_EQ(AbstractDiagJob::JOB_ADDED, fService.addAbstractDiagJob(fDid3));
+
+    uint8_t const request[] = {0x22U, 0xF1U, 0x80U};
+    EXPECT_EQ(DiagReturnCode::ISO_GENERAL_REJECT, processService(request, sizeof(request)));
+    EXPECT_EQ(0U, fDid1.fVerifyCount);
+    EXPECT_EQ(0U, fDid2.fVerifyCount);
+    EXPECT_EQ(1U, fDid3.fVerifyCount);
+    EXPECT_EQ(1U, fDid3.fProcessCount);
+
+    uint8_t const unknown[] = {0x22U, 0xF1U, 0x81U};
+    EXPECT_EQ(DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, processService(unknown, sizeof(unknown)));
+    EXPECT_EQ(0U, fDid1.fVerifyCount);
+    EXPECT_EQ(0U, fDid2.fVerifyCount);
+    EXPECT_EQ(1U, fDid3.fVerifyCount);
+}
+
+/**
+ * \desc
+ * Child jobs which are not indexed are asked after the indexed job, as are all child jobs if
+ * the request is shorter than the keys.
+ */
+TEST_F(DiagJobIndexTest, process_asks_unindexed_jobs_afterwards)
+{
+    uint8_t const subfunctionRequest[] = {0x22U, 0x01U};
+    CountingDiagJob subfunction{subfunctionRequest, 2U, 1U};
+
+    ASSERT_EQ(AbstractDiagJob::JOB_ADDED, fService.addAbstractDiagJob(fDid1));
+    ASSERT_EQ(AbstractDiagJob::JOB_ADDED, fService.addAbstractDiagJob(subfunction));
+    ASSERT_EQ(AbstractDiagJob::JOB_ADDED, fService.addAbstractDiagJob(fDid2));
+    // jobs added before are indexed when setting the index
+    fService.setDispatchIndex(fIndex);
+    EXPECT_EQ(1U, fIndex.getUnindexedJobCount());
+
+    uint8_t const request[] = {0x22U, 0x01U, 0x01U};
+    EXPECT_EQ(DiagReturnCode::ISO_GENERAL_REJECT, processService(request, sizeof(request)));
+    EXPECT_EQ(0U, fDid1.fVerifyCount);
+    EXPECT_EQ(1U, subfunction.fVerifyCount);
+    EXPECT_EQ(0U, fDid2.fVerifyCount);
+
+    uint8_t const shortRequest[] = {0x22U, 0x01U};
+    EXPECT_EQ(
+        DiagReturnCode::ISO_GENERAL_REJECT, processService(shortRequest, sizeof(shortRequest)));
+    EXPECT_EQ(1U, fDid1.fVerifyCount);
+    EXPECT_EQ(2U, subfunction.fVerifyCount);
+    EXPECT_EQ(0U, fDid2.fVerifyCount);
+}
+
+/**
+ * \desc
+ * Session checks of indexed jobs behave as without index.
+ */
+TEST_F(DiagJobIndexTest, process_checks_session_of_indexed_job)
+{
+    CountingDiagJob extendedDid{
+        fDid1Request,
+        3U,
+        1U,
+        DiagSession::DiagSessionMask::getInstance()
+            << DiagSession::APPLICATION_EXTENDED_SESSION()};
+    fService.setDispatchIndex(fIndex);
+    ASSERT_EQ(AbstractDiagJob::JOB_ADDED, fService.addAbstractDiagJob(extendedDid));
+
+    uint8_t const request[] = {0x22U, 0xF1U, 0x90U};
+    EXPECT_EQ(
+        DiagReturnCode::ISO_REQUEST_OUT_OF_RANGE, processService(request, sizeof(request)));
+    EXPECT_EQ(1U, extendedDid.fVerifyCount);
+    EXPECT_EQ(0U, extendedDid.fProcessCount);
+}
+
+/**
+ * \desc
+ * Removed child jobs are removed from the index.
+ */
+TEST_F(DiagJobIndexTest, removed_job_is_removed_from_index)
+{
+    fService.setDispatchIndex(fIndex);
+    ASSERT_EQ(AbstractDiagJob::JOB_ADDED, fService.addAbstractDiagJob(fDid1));
+    ASSERT_EQ(AbstractDiagJob::JOB_ADDED, fService.addAbstractDiagJob(fDid2));
+    fService.removeAbstractDiagJob(fDid2);
+
+    uint8_t const request[] = {0x01U, 0x00U};
+    EXPECT_EQ(nullptr, fIndex.find(request, sizeof(request)));
+    EXPECT_EQ(0U, fIndex.getUnindexedJobCount());
+    ASSERT_EQ(AbstractDiagJob::JOB_ADDED, fService.addAbstractDiagJob(fDid2));
+    EXPECT_EQ(&fDid2, fIndex.find(request, sizeof(request)));
+}
+
+} // namespace
@@ -168,9 +168,11 @@ public:
 
     MOCK_METHOD(uint8_t, getDidLimit, (::transport::TransportMessage const& message));
     MOCK_METHOD(bool, checkResponse, (DiagReturnCode::Type, DiagReturnCode::Type&));
+    MOCK_METHOD(bool, prefetch, (uint16_t identifier, uint8_t generation));
 
 protected:
     static uint8_t const NUM_INCOMING_CONNECTIONS = 1;
+    static uint32_t const PREFETCH_TIMEOUT_MS     = 100U;
 
     async::TestContext fContext;
     async::AsyncMock fAsyncMock;
@@ -187,6 +189,7 @@ protected:
     ::etl::queue<TransportJob, 1> _sendJobQueue;
     DiagDispatcher fUdsDispatcher;
     DiagJobRoot fDiagJobRoot;
+    uint8_t fPrefetchGeneration = 0U;
 
     static uint8_t const SOURCE_ID = 0xF1U;
     static uint8_t const TARGET_ID = 0x10U;
@@ -957,4 +960,374 @@ TEST_F(MultipleReadDataByIdentifierTest, get_did_limit_is_called_and_returns_ISO
     CONTEXT_EXECUTE;
 }
 
+TEST_F(
+    MultipleReadDataByIdentifierTest,
+    execute_prefetches_dataIdentifiers_in_parallel_and_processes_them_in_order_when_all_are_done)
+{
+    uint8_t const DATA_IDENTIFIERS_REQUEST[]
+        = {ServiceId::READ_DATA_BY_IDENTIFIER,
+           VALID_DATA_IDENTIFIER_1[0U],
+           VALID_DATA_IDENTIFIER_1[1U],
+           VALID_DATA_IDENTIFIER_2[0U],
+           VALID_DATA_IDENTIFIER_2[1U],
+           VALID_DATA_IDENTIFIER_1[0U],
+           VALID_DATA_IDENTIFIER_1[1U]};
+
+    uint8_t const EXPECTED_RESPONSE[] = {
+        0x62U, // Positive response to 0x22 (ReadDataByIdentifier)
+        0xF1U, // ReadProductionDate dataIdentifier
+        0x8BU, // ReadProductionDate dataIdentifier
+        0x10U,
+        0x07U,
+        0x01U, // Production date
+        0xF1U, // ReadProductionDate dataIdentifier
+        0x8BU, // ReadProductionDate dataIdentifier
+        0x16U,
+        0x11U,
+        0x15U // Production date
+    };
+
+    fMyMultipleReadDataByIdentifier.setPrefetch(
+        MultipleReadDataByIdentifier::PrefetchType::create<
+            MultipleReadDataByIdentifierTest,
+            &MultipleReadDataByIdentifierTest::prefetch>(*this),
+        2U,
+        PREFETCH_TIMEOUT_MS);
+
+    TransportMessageWithBuffer pRequest(
+        SOURCE_ID, TARGET_ID, DATA_IDENTIFIERS_REQUEST, AbstractDiagJob::VARIABLE_RESPONSE_LENGTH);
+
+    fIncomingDiagConnection.requestMessage     = pRequest.get();
+    fIncomingDiagConnection.messageSender      = &fUdsDispatcher;
+    fIncomingDiagConnection.diagSessionManager = &fSessionManager;
+
+    EXPECT_CALL(fSessionManager, getActiveSession())
+        .WillRepeatedly(ReturnRef(DiagSession::APPLICATION_DEFAULT_SESSION()));
+    EXPECT_CALL(fSessionManager, acceptedJob(_, _, _, _))
+        .WillRepeatedly(Return(uds::DiagReturnCode::OK));
+
+    // only two prefetches run in parallel, no DID job is processed before they are done
+    EXPECT_CALL(*this, prefetch(0xF18BU, _))
+        .WillOnce(DoAll(SaveArg<1>(&fPrefetchGeneration), Return(true)));
+    EXPECT_CALL(*this, prefetch(0xA07FU, _))
+        .WillOnce(DoAll(SaveArg<1>(&fPrefetchGeneration), Return(true)));
+    EXPECT_EQ(
+        DiagReturnCode::OK,
+        fMyMultipleReadDataByIdentifier.execute(
+            fIncomingDiagConnection, DATA_IDENTIFIERS_REQUEST, sizeof(DATA_IDENTIFIERS_REQUEST)));
+    CONTEXT_EXECUTE;
+    Mock::VerifyAndClearExpectations(this);
+
+    EXPECT_CALL(*this, prefetch(0xF18BU, _))
+        .WillOnce(DoAll(SaveArg<1>(&fPrefetchGeneration), Return(true)));
+    fMyMultipleReadDataByIdentifier.prefetchDone(fPrefetchGeneration);
+    CONTEXT_EXECUTE;
+    Mock::VerifyAndClearExpectations(this);
+
+    fMyMultipleReadDataByIdentifier.prefetchDone(fPrefetchGeneration);
+    CONTEXT_EXECUTE;
+
+    EXPECT_CALL(fDiagJob, verify(_, _)).WillOnce(Return(DiagReturnCode::OK));
+    EXPECT_CALL(fDiagJob, process(_, _, _))
+        .WillOnce(DoAll(
+            SendPositiveResponseReadProductionDate1(
+                &fIncomingDiagConnection, &fDiagJob, ::uds::ErrorCode::OK),
+            Return(DiagReturnCode::OK)));
+    EXPECT_CALL(fIncomingDiagConnection, terminate());
+    fMyMultipleReadDataByIdentifier.prefetchDone(fPrefetchGeneration);
+    CONTEXT_EXECUTE;
+
+    Mock::VerifyAndClearExpectations(&fDiagJob);
+    Mock::VerifyAndClearExpectations(&fIncomingDiagConnection);
+
+    EXPECT_CALL(fDiagJob, verify(_, _))
+        .WillOnce(Return(DiagReturnCode::NOT_RESPONSIBLE))
+        .WillOnce(Return(DiagReturnCode::OK));
+    EXPECT_CALL(fDiagJob, process(_, _, _))
+        .WillOnce(DoAll(
+            SendPositiveResponseReadProductionDate2(
+                &fIncomingDiagConnection, &fDiagJob, ::uds::ErrorCode::OK),
+            Return(DiagReturnCode::OK)));
+
+    EXPECT_CALL(fIncomingDiagConnection, terminate()); // terminate 1st request
+    fIncomingDiagConnection.terminateNestedRequest();
+    CONTEXT_EXECUTE;
+
+    Mock::VerifyAndClearExpectations(&fDiagJob);
+    Mock::VerifyAndClearExpectations(&fIncomingDiagConnection);
+
+    EXPECT_CALL(
+        fSessionManager,
+        responseSent(Ref(fIncomingDiagConnection), DiagReturnCode::OK, NotNull(), 10U));
+    EXPECT_CALL(fIncomingDiagConnection, terminate()); // terminate 3rd request
+    fIncomingDiagConnection.terminateNestedRequest();
+    CONTEXT_EXECUTE;
+
+    Mock::VerifyAndClearExpectations(&fIncomingDiagConnection);
+    Mock::VerifyAndClearExpectations(&fSessionManager);
+
+    auto buffer = ::etl::span<uint8_t const>(
+        fIncomingDiagConnection.responseMessage->getPayload(),
+        fIncomingDiagConnection.responseMessage->getPayloadLength());
+
+    EXPECT_THAT(buffer, ElementsAreArray(EXPECTED_RESPONSE));
+}
+
+TEST_F(
+    MultipleReadDataByIdentifierTest,
+    execute_processes_dataIdentifiers_immediately_if_no_prefetch_has_been_started)
+{
+    uint8_t const DATA_IDENTIFIERS_REQUEST[]
+        = {ServiceId::READ_DATA_BY_IDENTIFIER,
+           VALID_DATA_IDENTIFIER_1[0U],
+           VALID_DATA_IDENTIFIER_1[1U],
+           INVALID_DATA_IDENTIFIER_1[0U],
+           INVALID_DATA_IDENTIFIER_1[1U]};
+
+    fMyMultipleReadDataByIdentifier.setPrefetch(
+        MultipleReadDataByIdentifier::PrefetchType::create<
+            MultipleReadDataByIdentifierTest,
+            &MultipleReadDataByIdentifierTest::prefetch>(*this),
+        2U,
+        PREFETCH_TIMEOUT_MS);
+
+    TransportMessageWithBuffer pRequest(
+        SOURCE_ID, TARGET_ID, DATA_IDENTIFIERS_REQUEST, AbstractDiagJob::VARIABLE_RESPONSE_LENGTH);
+
+    fIncomingDiagConnection.requestMessage     = pRequest.get();
+    fIncomingDiagConnection.messageSender      = &fUdsDispatcher;
+    fIncomingDiagConnection.diagSessionManager = &fSessionManager;
+
+    EXPECT_CALL(fSessionManager, getActiveSession())
+        .WillRepeatedly(ReturnRef(DiagSession::APPLICATION_DEFAULT_SESSION()));
+    EXPECT_CALL(fSessionManager, acceptedJob(_, _, _, _))
+        .WillRepeatedly(Return(uds::DiagReturnCode::OK));
+
+    EXPECT_CALL(*this, prefetch(0xF18BU, _)).WillOnce(Return(false));
+    EXPECT_CALL(*this, prefetch(0x4444U, _)).WillOnce(Return(false));
+    EXPECT_CALL(fDiagJob, verify(_, _)).WillOnce(Return(DiagReturnCode::OK));
+    EXPECT_CALL(fDiagJob, process(_, _, _))
+        .WillOnce(DoAll(
+            SendPositiveResponseReadProductionDate1(
+                &fIncomingDiagConnection, &fDiagJob, ::uds::ErrorCode::OK),
+            Return(DiagReturnCode::OK)));
+    EXPECT_CALL(fIncomingDiagConnection, terminate());
+
+    EXPECT_EQ(
+        DiagReturnCode::OK,
+        fMyMultipleReadDataByIdentifier.execute(
+            fIncomingDiagConnection, DATA_IDENTIFIERS_REQUEST, sizeof(DATA_IDENTIFIERS_REQUEST)));
+    CONTEXT_EXECUTE;
+
+    Mock::VerifyAndClearExpectations(&fDiagJob);
+    Mock::VerifyAndClearExpectations(&fIncomingDiagConnection);
+
+    EXPECT_CALL(fDiagJob, verify(_, _)).WillOnce(Return(DiagReturnCode::OK));
+    EXPECT_CALL(fDiagJob, process(_, _, _)).WillOnce(Return(DiagReturnCode::NOT_RESPONSIBLE));
+    EXPECT_CALL(
+        fSessionManager,
+        responseSent(Ref(fIncomingDiagConnection), DiagReturnCode::OK, NotNull(), 5U));
+    EXPECT_CALL(fIncomingDiagConnection, terminate());
+    fIncomingDiagConnection.terminateNestedRequest();
+    CONTEXT_EXECUTE;
+}
+
+TEST_F(
+    MultipleReadDataByIdentifierTest,
+    execute_drops_the_request_if_the_connection_is_closed_before_the_prefetches_are_done)
+{
+    uint8_t const DATA_IDENTIFIERS_REQUEST[]
+        = {ServiceId::READ_DATA_BY_IDENTIFIER,
+           VALID_DATA_IDENTIFIER_1[0U],
+           VALID_DATA_IDENTIFIER_1[1U],
+           INVALID_DATA_IDENTIFIER_1[0U],
+           INVALID_DATA_IDENTIFIER_1[1U]};
+
+    fMyMultipleReadDataByIdentifier.setPrefetch(
+        MultipleReadDataByIdentifier::PrefetchType::create<
+            MultipleReadDataByIdentifierTest,
+            &MultipleReadDataByIdentifierTest::prefetch>(*this),
+        1U,
+        PREFETCH_TIMEOUT_MS);
+
+    TransportMessageWithBuffer pRequest(
+        SOURCE_ID, TARGET_ID, DATA_IDENTIFIERS_REQUEST, AbstractDiagJob::VARIABLE_RESPONSE_LENGTH);
+
+    fIncomingDiagConnection.requestMessage     = pRequest.get();
+    fIncomingDiagConnection.messageSender      = &fUdsDispatcher;
+    fIncomingDiagConnection.diagSessionManager = &fSessionManager;
+
+    EXPECT_CALL(fSessionManager, getActiveSession())
+        .WillRepeatedly(ReturnRef(DiagSession::APPLICATION_DEFAULT_SESSION()));
+    EXPECT_CALL(fSessionManager, acceptedJob(_, _, _, _))
+        .WillRepeatedly(Return(uds::DiagReturnCode::OK));
+
+    EXPECT_CALL(*this, prefetch(0xF18BU, _))
+        .WillOnce(DoAll(SaveArg<1>(&fPrefetchGeneration), Return(true)));
+    EXPECT_EQ(
+        DiagReturnCode::OK,
+        fMyMultipleReadDataByIdentifier.execute(
+            fIncomingDiagConnection, DATA_IDENTIFIERS_REQUEST, sizeof(DATA_IDENTIFIERS_REQUEST)));
+    CONTEXT_EXECUTE;
+
+    // no DID job is processed
+    fIncomingDiagConnection.isOpen = false;
+    fMyMultipleReadDataByIdentifier.prefetchDone(fPrefetchGeneration);
+    CONTEXT_EXECUTE;
+}
+
+TEST_F(
+    MultipleReadDataByIdentifierTest,
+    execute_returns_negative_response_if_the_prefetches_are_not_done_in_time)
+{
+    uint8_t const DATA_IDENTIFIERS_REQUEST[]
+        = {ServiceId::READ_DATA_BY_IDENTIFIER,
+           VALID_DATA_IDENTIFIER_1[0U],
+           VALID_DATA_IDENTIFIER_1[1U],
+           INVALID_DATA_IDENTIFIER_1[0U],
+           INVALID_DATA_IDENTIFIER_1[1U]};
+
+    uint8_t const EXPECTED_RESPONSE[] = {
+        0x7FU, // Negative Response Identifier
+        0x22U, // ReadDataByIdentifier SID
+        0x22U  // Negative Response Code if the prefetches time out
+    };
+
+    fMyMultipleReadDataByIdentifier.setPrefetch(
+        MultipleReadDataByIdentifier::PrefetchType::create<
+            MultipleReadDataByIdentifierTest,
+            &MultipleReadDataByIdentifierTest::prefetch>(*this),
+        2U,
+        PREFETCH_TIMEOUT_MS);
+
+    TransportMessageWithBuffer pRequest(
+        SOURCE_ID, TARGET_ID, DATA_IDENTIFIERS_REQUEST, AbstractDiagJob::VARIABLE_RESPONSE_LENGTH);
+
+    fIncomingDiagConnection.requestMessage     = pRequest.get();
+    fIncomingDiagConnection.messageSender      = &fUdsDispatcher;
+    fIncomingDiagConnection.diagSessionManager = &fSessionManager;
+
+    EXPECT_CALL(fSessionManager, getActiveSession())
+        .WillRepeatedly(ReturnRef(DiagSession::APPLICATION_DEFAULT_SESSION()));
+    EXPECT_CALL(fSessionManager, acceptedJob(_, _, _, _))
+        .WillRepeatedly(Return(uds::DiagReturnCode::OK));
+
+    EXPECT_CALL(*this, prefetch(0xF18BU, _))
+        .WillOnce(DoAll(SaveArg<1>(&fPrefetchGeneration), Return(true)));
+    EXPECT_CALL(*this, prefetch(0x4444U, _)).WillOnce(Return(false));
+    EXPECT_EQ(
+        DiagReturnCode::OK,
+        fMyMultipleReadDataByIdentifier.execute(
+            fIncomingDiagConnection, DATA_IDENTIFIERS_REQUEST, sizeof(DATA_IDENTIFIERS_REQUEST)));
+    CONTEXT_EXECUTE;
+
+    fContext.elapse((PREFETCH_TIMEOUT_MS - 1U) * 1000U);
+    fContext.expireAndExecute();
+
+    EXPECT_CALL(
+        fSessionManager,
+        responseSent(
+            Ref(fIncomingDiagConnection),
+            DiagReturnCode::ISO_CONDITIONS_NOT_CORRECT,
+            NotNull(),
+            0U));
+    EXPECT_CALL(fIncomingDiagConnection, terminate());
+    fContext.elapse(1000U);
+    fContext.expireAndExecute();
+
+    Mock::VerifyAndClearExpectations(&fSessionManager);
+    Mock::VerifyAndClearExpectations(&fIncomingDiagConnection);
+
+    auto buffer = ::etl::span<uint8_t const>(
+        fIncomingDiagConnection.responseMessage->getPayload(),
+        fIncomingDiagConnection.responseMessage->getPayloadLength());
+
+    EXPECT_THAT(buffer, ElementsAreArray(EXPECTED_RESPONSE));
+
+    // a late acquisition doesn't start the DID jobs
+    fMyMultipleReadDataByIdentifier.prefetchDone(fPrefetchGeneration);
+    CONTEXT_EXECUTE;
+}
+
+TEST_F(MultipleReadDataByIdentifierTest, execute_ignores_prefetches_of_a_previous_request)
+{
+    uint8_t const DATA_IDENTIFIERS_REQUEST[]
+        = {ServiceId::READ_DATA_BY_IDENTIFIER,
+           VALID_DATA_IDENTIFIER_1[0U],
+           VALID_DATA_IDENTIFIER_1[1U],
+           INVALID_DATA_IDENTIFIER_1[0U],
+           INVALID_DATA_IDENTIFIER_1[1U]};
+
+    fMyMultipleReadDataByIdentifier.setPrefetch(
+        MultipleReadDataByIdentifier::PrefetchType::create<
+            MultipleReadDataByIdentifierTest,
+            &MultipleReadDataByIdentifierTest::prefetch>(*this),
+        1U,
+        PREFETCH_TIMEOUT_MS);
+
+    TransportMessageWithBuffer pRequest(
+        SOURCE_ID, TARGET_ID, DATA_IDENTIFIERS_REQUEST, AbstractDiagJob::VARIABLE_RESPONSE_LENGTH);
+
+    fIncomingDiagConnection.requestMessage     = pRequest.get();
+    fIncomingDiagConnection.messageSender      = &fUdsDispatcher;
+    fIncomingDiagConnection.diagSessionManager = &fSessionManager;
+
+    EXPECT_CALL(fSessionManager, getActiveSession())
+        .WillRepeatedly(ReturnRef(DiagSession::APPLICATION_DEFAULT_SESSION()));
+    EXPECT_CALL(fSessionManager, acceptedJob(_, _, _, _))
+        .WillRepeatedly(Return(uds::DiagReturnCode::OK));
+
+    // the first request is dropped while its acquisition is still running
+    uint8_t staleGeneration = 0U;
+    EXPECT_CALL(*this, prefetch(0xF18BU, _))
+        .WillOnce(DoAll(SaveArg<1>(&staleGeneration), Return(true)));
+    EXPECT_EQ(
+        DiagReturnCode::OK,
+        fMyMultipleReadDataByIdentifier.execute(
+            fIncomingDiagConnection, DATA_IDENTIFIERS_REQUEST, sizeof(DATA_IDENTIFIERS_REQUEST)));
+    CONTEXT_EXECUTE;
+    fIncomingDiagConnection.isOpen = false;
+    fContext.elapse(PREFETCH_TIMEOUT_MS * 1000U);
+    fContext.expireAndExecute();
+    Mock::VerifyAndClearExpectations(this);
+
+    fIncomingDiagConnection.isOpen = true;
+    EXPECT_CALL(*this, prefetch(0xF18BU, _))
+        .WillOnce(DoAll(SaveArg<1>(&fPrefetchGeneration), Return(true)));
+    EXPECT_EQ(
+        DiagReturnCode::OK,
+        fMyMultipleReadDataByIdentifier.execute(
+            fIncomingDiagConnection, DATA_IDENTIFIERS_REQUEST, sizeof(DATA_IDENTIFIERS_REQUEST)));
+    CONTEXT_EXECUTE;
+    Mock::VerifyAndClearExpectations(this);
+    EXPECT_NE(staleGeneration, fPrefetchGeneration);
+
+    // the late acquisition of the first request doesn't count for the second one
+    fMyMultipleReadDataByIdentifier.prefetchDone(staleGeneration);
+    CONTEXT_EXECUTE;
+
+    EXPECT_CALL(*this, prefetch(0x4444U, _)).WillOnce(Return(false));
+    EXPECT_CALL(fDiagJob, verify(_, _)).WillOnce(Return(DiagReturnCode::OK));
+    EXPECT_CALL(fDiagJob, process(_, _, _))
+        .WillOnce(DoAll(
+            SendPositiveResponseReadProductionDate1(
+                &fIncomingDiagConnection, &fDiagJob, ::uds::ErrorCode::OK),
+            Return(DiagReturnCode::OK)));
+    EXPECT_CALL(fIncomingDiagConnection, terminate());
+    fMyMultipleReadDataByIdentifier.prefetchDone(fPrefetchGeneration);
+    CONTEXT_EXECUTE;
+
+    Mock::VerifyAndClearExpectations(&fDiagJob);
+    Mock::VerifyAndClearExpectations(&fIncomingDiagConnection);
+
+    EXPECT_CALL(fDiagJob, verify(_, _)).WillOnce(Return(DiagReturnCode::OK));
+    EXPECT_CALL(fDiagJob, process(_, _, _)).WillOnce(Return(DiagReturnCode::NOT_RESPONSIBLE));
+    EXPECT_CALL(
+        fSessionManager,
+        responseSent(Ref(fIncomingDiagConnection), DiagReturnCode::OK, NotNull(), 5U));
+    EXPECT_CALL(fIncomingDiagConnection, terminate());
+    fIncomingDiagConnection.terminateNestedRequest();
+    CONTEXT_EXECUTE;
+}
+
 } // namespace
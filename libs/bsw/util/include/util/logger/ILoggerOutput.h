@@ -12,6 +12,9 @@
 
 #include "util/logger/ComponentInfo.h"
 #include "util/logger/LevelInfo.h"
+#include "util/logger/LogArgument.h"
+
+#include <etl/span.h>
 
 #include <cstdarg>
 
@@ -44,9 +47,37 @@ public:
         ComponentInfo const& componentInfo, LevelInfo const& levelInfo, char const* str, va_list ap)
         = 0;
 
+    /**
+     * Called for each filtered log message that has been emitted with typed arguments, see
+     * Logger::logf(). The datatype of each argument is known, so the format string doesn't need
+     * to be scanned for reading the arguments.
+     * \param componentInfo reference to component info holding a human readable name of the
+     * component
+     * \param levelInfo reference to the level info holding a human readable text for the severity
+     * of the message
+     * \param str Printf-like format string
+     * \param arguments typed arguments in the order of the format string
+     * \return false if typed arguments aren't supported, the message is emitted again by calling
+     * logOutput() in this case. The default implementation returns false.
+     */
+    virtual bool logTypedOutput(
+        ComponentInfo const& componentInfo,
+        LevelInfo const& levelInfo,
+        char const* str,
+        ::etl::span<LogArgument const> const& arguments);
+
 protected:
     ILoggerOutput() = default;
 };
 
+inline bool ILoggerOutput::logTypedOutput(
+    ComponentInfo const& /* componentInfo */,
+    LevelInfo const& /* levelInfo */,
+    char const* const /* str */,
+    ::etl::span<LogArgument const> const& /* arguments */)
+{
+    return false;
+}
+
 } // namespace logger
 } // namespace util
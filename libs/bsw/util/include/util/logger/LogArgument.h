@@ -0,0 +1,104 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include "util/format/Printf.h"
+#include "util/string/ConstString.h"
+
+#include <etl/type_traits.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace util
+{
+namespace logger
+{
+/**
+ * A single argument of a log message together with its datatype. Arguments are created with
+ * makeLogArgument(), which determines the datatype from the C++ type of the value at compile time,
+ * so the format string doesn't need to be scanned for reading the arguments.
+ */
+struct LogArgument
+{
+    ::util::format::ParamDatatype _datatype;
+    ::util::format::ParamVariant _value;
+};
+
+/**
+ * Create a log argument from a value. The datatype follows the default argument promotions of
+ * a variadic call, i.e. a value is stored the same way a printf-like function would read it.
+ * Types that can't be printed, e.g. floating point values, are rejected at compile time.
+ * \param value value of the argument
+ * \return argument holding the value and its datatype
+ */
+template<class T>
+inline LogArgument makeLogArgument(T const value)
+{
+    if constexpr (::etl::is_enum<T>::value)
+    {
+        return makeLogArgument(static_cast<typename ::etl::underlying_type<T>::type>(value));
+    }
+    else
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access): tagged by _datatype
+        LogArgument argument{};
+        if constexpr (::etl::is_same<T, ::std::nullptr_t>::value)
+        {
+            argument._datatype            = ::util::format::ParamDatatype::VOIDPTR;
+            argument._value._voidPtrValue = nullptr;
+        }
+        else if constexpr (::etl::is_integral<T>::value && (sizeof(T) < sizeof(int32_t)))
+        {
+            // promoted to int
+            argument._datatype           = ::util::format::ParamDatatype::SINT32;
+            argument._value._sint32Value = static_cast<int32_t>(value);
+        }
+        else if constexpr (::etl::is_integral<T>::value && (sizeof(T) == sizeof(int32_t)))
+        {
+            argument._datatype           = ::etl::is_unsigned<T>::value
+                                               ? ::util::format::ParamDatatype::UINT32
+                                               : ::util::format::ParamDatatype::SINT32;
+            argument._value._uint32Value = static_cast<uint32_t>(value);
+        }
+        else if constexpr (::etl::is_integral<T>::value)
+        {
+            static_assert(sizeof(T) == sizeof(int64_t), "unsupported integral type");
+            argument._datatype           = ::etl::is_unsigned<T>::value
+                                               ? ::util::format::ParamDatatype::UINT64
+                                               : ::util::format::ParamDatatype::SINT64;
+            argument._value._uint64Value = static_cast<uint64_t>(value);
+        }
+        else if constexpr (::etl::is_same<T, char const*>::value || ::etl::is_same<T, char*>::value)
+        {
+            argument._datatype            = ::util::format::ParamDatatype::CHARPTR;
+            argument._value._charPtrValue = value;
+        }
+        else if constexpr (
+            ::etl::is_same<T, ::util::string::PlainSizedString const*>::value
+            || ::etl::is_same<T, ::util::string::PlainSizedString*>::value)
+        {
+            argument._datatype                 = ::util::format::ParamDatatype::SIZEDCHARPTR;
+            argument._value._sizedCharPtrValue = value;
+        }
+        else
+        {
+            static_assert(::etl::is_pointer<T>::value, "unsupported type of log argument");
+            argument._datatype            = ::util::format::ParamDatatype::VOIDPTR;
+            argument._value._voidPtrValue = value;
+        }
+        return argument;
+        // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+    }
+}
+
+} // namespace logger
+} // namespace util
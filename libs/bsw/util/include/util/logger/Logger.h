@@ -51,6 +51,10 @@
 #ifndef LOGGER_NO_LEGACY_API
 
 #include "util/logger/IComponentMapping.h"
+#include "util/logger/LogArgument.h"
+
+#include <etl/span.h>
+#include <etl/type_traits.h>
 
 namespace util
 {
@@ -163,8 +167,59 @@ public:
      */
     static void critical(uint8_t componentIndex, char const* str, ...);
 
+    /**
+     * Emit a log message with typed arguments for a given component and severity. The datatype
+     * of each argument is determined at compile time, so outputs supporting typed arguments
+     * (see ILoggerOutput::logTypedOutput()) don't need to scan the format string and the
+     * arguments aren't passed through a va_list.
+     * \param componentIndex index of the logger component
+     * \param level severity of message
+     * \param str printf-format string for message
+     * \param args integral, enum or pointer arguments depending on format string
+     */
+    template<class... Args>
+    static void logf(uint8_t componentIndex, Level level, char const* str, Args const... args);
+
+    /**
+     * Emit a log message of severity LEVEL_INFO with typed arguments, see logf().
+     */
+    template<class... Args>
+    static void infof(uint8_t componentIndex, char const* str, Args const... args);
+
+    /**
+     * Emit a log message of severity LEVEL_DEBUG with typed arguments, see logf().
+     */
+    template<class... Args>
+    static void debugf(uint8_t componentIndex, char const* str, Args const... args);
+
+    /**
+     * Emit a log message of severity LEVEL_WARN with typed arguments, see logf().
+     */
+    template<class... Args>
+    static void warnf(uint8_t componentIndex, char const* str, Args const... args);
+
+    /**
+     * Emit a log message of severity LEVEL_ERROR with typed arguments, see logf().
+     */
+    template<class... Args>
+    static void errorf(uint8_t componentIndex, char const* str, Args const... args);
+
+    /**
+     * Emit a log message of severity LEVEL_CRITICAL with typed arguments, see logf().
+     */
+    template<class... Args>
+    static void criticalf(uint8_t componentIndex, char const* str, Args const... args);
+
 private:
     static void doLog(uint8_t componentIndex, Level level, char const* str, va_list ap);
+    static void doLogVariadic(uint8_t componentIndex, Level level, char const* str, ...);
+    template<class T>
+    static auto toVariadicArgument(T value);
+    static bool doLogTyped(
+        uint8_t componentIndex,
+        Level level,
+        char const* str,
+        ::etl::span<LogArgument const> const& arguments);
 
     static IComponentMapping* _componentMapping;
     static ILoggerOutput* _output;
@@ -237,6 +292,86 @@ Logger::log(uint8_t const componentIndex, Level const level, char const* const s
     }
 }
 
+inline void Logger::doLogVariadic(
+    uint8_t const componentIndex, Level const level, char const* const str, ...)
+{
+    va_list ap;
+    va_start(ap, str);
+    doLog(componentIndex, level, str, ap);
+    va_end(ap);
+}
+
+template<class T>
+inline auto Logger::toVariadicArgument(T const value)
+{
+    // scoped enums aren't promoted in variadic calls
+    if constexpr (::etl::is_enum<T>::value)
+    {
+        return static_cast<typename ::etl::underlying_type<T>::type>(value);
+    }
+    else
+    {
+        return value;
+    }
+}
+
+template<class... Args>
+inline void Logger::logf(
+    uint8_t const componentIndex, Level const level, char const* const str, Args const... args)
+{
+#ifndef DISABLE_LOGGING
+    if (isEnabled(componentIndex, level))
+    {
+        // one additional element avoids a zero-sized array for messages without arguments
+        LogArgument const arguments[sizeof...(Args) + 1U] = {makeLogArgument(args)..., {}};
+        if (!doLogTyped(
+                componentIndex,
+                level,
+                str,
+                ::etl::span<LogArgument const>(&arguments[0], sizeof...(Args))))
+        {
+            doLogVariadic(componentIndex, level, str, toVariadicArgument(args)...);
+        }
+    }
+#else
+    (void)componentIndex;
+    (void)level;
+    (void)str;
+    ((void)args, ...);
+#endif
+}
+
+template<class... Args>
+inline void Logger::infof(uint8_t const componentIndex, char const* const str, Args const... args)
+{
+    logf(componentIndex, LEVEL_INFO, str, args...);
+}
+
+template<class... Args>
+inline void Logger::debugf(uint8_t const componentIndex, char const* const str, Args const... args)
+{
+    logf(componentIndex, LEVEL_DEBUG, str, args...);
+}
+
+template<class... Args>
+inline void Logger::warnf(uint8_t const componentIndex, char const* const str, Args const... args)
+{
+    logf(componentIndex, LEVEL_WARN, str, args...);
+}
+
+template<class... Args>
+inline void Logger::errorf(uint8_t const componentIndex, char const* const str, Args const... args)
+{
+    logf(componentIndex, LEVEL_ERROR, str, args...);
+}
+
+template<class... Args>
+inline void
+Logger::criticalf(uint8_t const componentIndex, char const* const str, Args const... args)
+{
+    logf(componentIndex, LEVEL_CRITICAL, str, args...);
+}
+
 // NOLINTEND(cppcoreguidelines-pro-type-vararg)
 
 } // namespace logger
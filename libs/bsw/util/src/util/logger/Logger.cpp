@@ -44,6 +44,17 @@ void Logger::doLog(
     _output->logOutput(componentInfo, levelInfo, str, ap);
 }
 
+bool Logger::doLogTyped(
+    uint8_t const componentIndex,
+    Level const level,
+    char const* const str,
+    ::etl::span<LogArgument const> const& arguments)
+{
+    ComponentInfo const componentInfo = _componentMapping->getComponentInfo(componentIndex);
+    LevelInfo const levelInfo         = _componentMapping->getLevelInfo(level);
+    return _output->logTypedOutput(componentInfo, levelInfo, str, arguments);
+}
+
 Level Logger::getLevel(uint8_t const componentIndex)
 {
     return (_componentMapping != nullptr) ? _componentMapping->getLevel(componentIndex)
@@ -14,6 +14,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 using namespace ::util::logger;
 using namespace ::util::format;
 
@@ -77,6 +79,27 @@ struct LoggerTest
         _logStr = buffer;
     }
 
+    bool logTypedOutput(
+        ComponentInfo const& componentInfo,
+        LevelInfo const& levelInfo,
+        char const* str,
+        ::etl::span<LogArgument const> const& arguments) override
+    {
+        if (!_typedOutputSupported)
+        {
+            return false;
+        }
+        _outComponentInfo = componentInfo;
+        _outLevelInfo     = levelInfo;
+        _logStr           = str;
+        _typedDatatypes.clear();
+        for (auto const& argument : arguments)
+        {
+            _typedDatatypes.push_back(argument._datatype);
+        }
+        return true;
+    }
+
     bool checkAndResetLog(
         uint8_t componentIndex,
         Level level,
@@ -105,6 +128,13 @@ struct LoggerTest
     std::string _logStr;
     LevelInfo _outLevelInfo;
     ComponentInfo _outComponentInfo;
+    bool _typedOutputSupported = false;
+    std::vector<ParamDatatype> _typedDatatypes;
+};
+
+enum class ScopedEnum : uint8_t
+{
+    VALUE = 200U
 };
 } // anonymous namespace
 
@@ -193,4 +223,90 @@ TEST_F(LoggerTest, testUninitializedUsage)
     ASSERT_EQ(LEVEL_NONE, Logger::getLevel(0));
 }
 
+TEST_F(LoggerTest, testTypedLoggingFallsBackToLogOutput)
+{
+    Logger::init(*this, *this);
+
+    ComponentInfo::PlainInfo constComponentInfo
+        = {{"abc", {Color::DEFAULT_COLOR, 0U, Color::DEFAULT_COLOR}}};
+    ComponentInfo componentInfo(12, &constComponentInfo);
+
+    _enabled       = true;
+    _componentInfo = componentInfo;
+    _levelInfo     = LevelInfo(LevelInfo::getDefaultTable() + LEVEL_DEBUG);
+
+    Logger::logf(1, LEVEL_INFO, "abc: %d %s", 12, "log");
+    ASSERT_TRUE(checkAndResetLog(1, LEVEL_INFO, 12, LEVEL_DEBUG, "abc: 12 log"));
+
+    Logger::debugf(2, "abc: %d %s", static_cast<uint8_t>(13), "debug");
+    ASSERT_TRUE(checkAndResetLog(2, LEVEL_DEBUG, 12, LEVEL_DEBUG, "abc: 13 debug"));
+
+    Logger::infof(3, "abc: %u %s", 14U, "info");
+    ASSERT_TRUE(checkAndResetLog(3, LEVEL_INFO, 12, LEVEL_DEBUG, "abc: 14 info"));
+
+    Logger::warnf(4, "abc: %lld %s", 14LL, "warn");
+    ASSERT_TRUE(checkAndResetLog(4, LEVEL_WARN, 12, LEVEL_DEBUG, "abc: 14 warn"));
+
+    Logger::errorf(5, "abc: %d %s", ScopedEnum::VALUE, "error");
+    ASSERT_TRUE(checkAndResetLog(5, LEVEL_ERROR, 12, LEVEL_DEBUG, "abc: 200 error"));
+
+    Logger::criticalf(6, "abc: critical");
+    ASSERT_TRUE(checkAndResetLog(6, LEVEL_CRITICAL, 12, LEVEL_DEBUG, "abc: critical"));
+}
+
+TEST_F(LoggerTest, testTypedLogging)
+{
+    Logger::init(*this, *this);
+
+    ComponentInfo::PlainInfo constComponentInfo
+        = {{"abc", {Color::DEFAULT_COLOR, 0U, Color::DEFAULT_COLOR}}};
+    ComponentInfo componentInfo(12, &constComponentInfo);
+
+    _enabled              = true;
+    _typedOutputSupported = true;
+    _componentInfo        = componentInfo;
+    _levelInfo            = LevelInfo(LevelInfo::getDefaultTable() + LEVEL_DEBUG);
+
+    int32_t value = 0;
+    Logger::debugf(
+        2,
+        "%d %d %u %lld %llu %d %s %p",
+        static_cast<uint8_t>(1U),
+        -2,
+        3U,
+        static_cast<int64_t>(4),
+        static_cast<uint64_t>(5U),
+        ScopedEnum::VALUE,
+        "str",
+        &value);
+    ASSERT_TRUE(checkAndResetLog(2, LEVEL_DEBUG, 12, LEVEL_DEBUG, "%d %d %u %lld %llu %d %s %p"));
+    std::vector<ParamDatatype> const expectedDatatypes
+        = {ParamDatatype::SINT32,
+           ParamDatatype::SINT32,
+           ParamDatatype::UINT32,
+           ParamDatatype::SINT64,
+           ParamDatatype::UINT64,
+           ParamDatatype::SINT32,
+           ParamDatatype::CHARPTR,
+           ParamDatatype::VOIDPTR};
+    ASSERT_EQ(expectedDatatypes, _typedDatatypes);
+
+    _enabled = false;
+    _typedDatatypes.clear();
+    Logger::errorf(3, "abc %d", 1);
+    ASSERT_TRUE(_typedDatatypes.empty());
+    ASSERT_TRUE(_logStr.empty());
+}
+
+TEST_F(LoggerTest, testTypedUninitializedUsage)
+{
+    Logger::logf(0, LEVEL_DEBUG, "abc", 1, 2, 3);
+    Logger::infof(1, "abc", 1, 2, 3);
+    Logger::debugf(2, "abc", 1, 2, 3);
+    Logger::warnf(3, "abc", 1, 2, 3);
+    Logger::errorf(4, "abc", 1, 2, 3);
+    Logger::criticalf(5, "abc", 1, 2, 3);
+    ASSERT_TRUE(_logStr.empty());
+}
+
 // NOLINTEND(cppcoreguidelines-pro-type-vararg)
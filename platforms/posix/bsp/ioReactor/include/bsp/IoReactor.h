@@ -0,0 +1,134 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <async/Async.h>
+#include <etl/delegate.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace bsp
+{
+
+/**
+ * Waits with one epoll instance for file descriptors to become readable and executes the runnable
+ * of each ready source in the source's async context.
+ *
+ * After start(), a thread of the reactor blocks in epoll_wait() without a timeout. FreeRTOS and
+ * ThreadX tasks of the POSIX ports can't be signaled from foreign threads, therefore the thread
+ * only collects the ready sources and calls the interrupt function, which is expected to enter
+ * an interrupt of the RTOS port and call dispatch() from there.
+ */
+class IoReactor
+{
+public:
+    /**
+     * Raises the interrupt that calls dispatch(), called from the reactor thread.
+     */
+    using InterruptFunction = ::etl::delegate<void()>;
+
+    /**
+     * A file descriptor watched by the reactor.
+     *
+     * Sources are one-shot: once the source is ready, it isn't watched until rearm() is called,
+     * typically after having read all available data in its runnable.
+     */
+    class Source
+    {
+    public:
+        Source(::async::ContextType context, ::async::RunnableType& runnable);
+
+        Source(Source const&)            = delete;
+        Source& operator=(Source const&) = delete;
+
+        int getFileDescriptor() const { return _fileDescriptor; }
+
+    private:
+        friend class IoReactor;
+
+        ::async::RunnableType& _runnable;
+        ::async::ContextType _context;
+        int _fileDescriptor;
+        Source* _next;
+    };
+
+    IoReactor();
+
+    IoReactor(IoReactor const&)            = delete;
+    IoReactor& operator=(IoReactor const&) = delete;
+
+    bool open();
+    void close();
+
+    /**
+     * Starts watching \p fileDescriptor for \p source.
+     *
+     * \return false if the reactor isn't open or the file descriptor can't be watched, e.g.
+     * because it refers to a regular file
+     */
+    bool add(Source& source, int fileDescriptor);
+
+    /**
+     * Stops watching the file descriptor of \p source, which stays open. A source that was
+     * already ready is still executed once.
+     */
+    void remove(Source& source);
+
+    /**
+     * Watches a one-shot source again.
+     */
+    void rearm(Source& source);
+
+    /**
+     * Waits at most \p timeoutInMs milliseconds for sources to become ready and executes their
+     * runnables from the calling context, without the reactor thread.
+     *
+     * \return number of ready sources
+     */
+    size_t wait(int timeoutInMs);
+
+    /**
+     * Starts the reactor thread, which calls \p interrupt whenever sources have become ready.
+     * The thread is created with all signals blocked.
+     *
+     * \return false if the reactor isn't open or already started
+     */
+    bool start(InterruptFunction interrupt);
+
+    /**
+     * Stops and joins the reactor thread.
+     */
+    void stop();
+
+    /**
+     * Executes the runnables of all sources that have become ready since the last call. Meant to
+     * be called from the interrupt raised by the interrupt function.
+     */
+    void dispatch();
+
+private:
+    static constexpr size_t MAX_EVENTS_PER_WAIT = 8U;
+
+    size_t collect(int timeoutInMs);
+    void run();
+
+    InterruptFunction _interrupt;
+    ::std::thread _thread;
+    ::std::atomic<Source*> _readySources;
+    ::std::atomic_bool _running;
+    int _epollFileDescriptor;
+    int _stopFileDescriptor;
+};
+
+} // namespace bsp
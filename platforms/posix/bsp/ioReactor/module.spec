@@ -0,0 +1 @@
+oss: true
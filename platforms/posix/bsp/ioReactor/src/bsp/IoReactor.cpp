@@ -0,0 +1,201 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "bsp/IoReactor.h"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#include <csignal>
+#include <cstdint>
+#include <pthread.h>
+#include <unistd.h>
+
+namespace bsp
+{
+
+IoReactor::Source::Source(::async::ContextType const context, ::async::RunnableType& runnable)
+: _runnable(runnable), _context(context), _fileDescriptor(-1), _next(nullptr)
+{}
+
+IoReactor::IoReactor()
+: _interrupt()
+, _thread()
+, _readySources(nullptr)
+, _running(false)
+, _epollFileDescriptor(-1)
+, _stopFileDescriptor(-1)
+{}
+
+bool IoReactor::open()
+{
+    if (_epollFileDescriptor >= 0)
+    {
+        return true;
+    }
+    _epollFileDescriptor = epoll_create1(EPOLL_CLOEXEC);
+    _stopFileDescriptor  = eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+    // the stop event is the only one without a source
+    epoll_event event{};
+    event.events   = EPOLLIN;
+    event.data.ptr = nullptr;
+    if ((_epollFileDescriptor < 0) || (_stopFileDescriptor < 0)
+        || (epoll_ctl(_epollFileDescriptor, EPOLL_CTL_ADD, _stopFileDescriptor, &event) < 0))
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void IoReactor::close()
+{
+    stop();
+    if (_epollFileDescriptor >= 0)
+    {
+        (void)::close(_epollFileDescriptor);
+        _epollFileDescriptor = -1;
+    }
+    if (_stopFileDescriptor >= 0)
+    {
+        (void)::close(_stopFileDescriptor);
+        _stopFileDescriptor = -1;
+    }
+}
+
+bool IoReactor::add(Source& source, int const fileDescriptor)
+{
+    if ((_epollFileDescriptor < 0) || (source._fileDescriptor >= 0))
+    {
+        return false;
+    }
+    epoll_event event{};
+    event.events   = EPOLLIN | EPOLLONESHOT;
+    event.data.ptr = &source;
+    if (epoll_ctl(_epollFileDescriptor, EPOLL_CTL_ADD, fileDescriptor, &event) < 0)
+    {
+        return false;
+    }
+    source._fileDescriptor = fileDescriptor;
+    return true;
+}
+
+void IoReactor::remove(Source& source)
+{
+    if (source._fileDescriptor < 0)
+    {
+        return;
+    }
+    if (_epollFileDescriptor >= 0)
+    {
+        (void)epoll_ctl(_epollFileDescriptor, EPOLL_CTL_DEL, source._fileDescriptor, nullptr);
+    }
+    source._fileDescriptor = -1;
+}
+
+void IoReactor::rearm(Source& source)
+{
+    if ((_epollFileDescriptor < 0) || (source._fileDescriptor < 0))
+    {
+        return;
+    }
+    epoll_event event{};
+    event.events   = EPOLLIN | EPOLLONESHOT;
+    event.data.ptr = &source;
+    (void)epoll_ctl(_epollFileDescriptor, EPOLL_CTL_MOD, source._fileDescriptor, &event);
+}
+
+size_t IoReactor::wait(int const timeoutInMs)
+{
+    size_t const count = collect(timeoutInMs);
+    dispatch();
+    return count;
+}
+
+bool IoReactor::start(InterruptFunction const interrupt)
+{
+    if ((_epollFileDescriptor < 0) || _thread.joinable())
+    {
+        return false;
+    }
+    _interrupt = interrupt;
+    _running.store(true);
+    // The signals of the RTOS ports must only be delivered to the task threads, the created
+    // thread inherits the blocked signals.
+    sigset_t set, oldSet;
+    sigfillset(&set);
+    (void)pthread_sigmask(SIG_SETMASK, &set, &oldSet);
+    _thread = ::std::thread([this] { run(); });
+    (void)pthread_sigmask(SIG_SETMASK, &oldSet, nullptr);
+    return true;
+}
+
+void IoReactor::stop()
+{
+    if (!_thread.joinable())
+    {
+        return;
+    }
+    _running.store(false);
+    uint64_t const value = 1U;
+    (void)::write(_stopFileDescriptor, &value, sizeof(value));
+    _thread.join();
+}
+
+void IoReactor::dispatch()
+{
+    // The sources are one-shot, a source can't become ready again before its runnable has been
+    // executed and it has been rearmed, i.e. a source is never pushed twice.
+    Source* source = _readySources.exchange(nullptr);
+    while (source != nullptr)
+    {
+        Source* const next = source->_next;
+        ::async::execute(source->_context, source->_runnable);
+        source = next;
+    }
+}
+
+size_t IoReactor::collect(int const timeoutInMs)
+{
+    if (_epollFileDescriptor < 0)
+    {
+        return 0U;
+    }
+    epoll_event events[MAX_EVENTS_PER_WAIT];
+    int const count = epoll_wait(_epollFileDescriptor, events, MAX_EVENTS_PER_WAIT, timeoutInMs);
+    size_t readyCount = 0U;
+    for (int i = 0; i < count; ++i)
+    {
+        Source* const source = static_cast<Source*>(events[i].data.ptr);
+        if (source == nullptr)
+        {
+            uint64_t value = 0U;
+            (void)::read(_stopFileDescriptor, &value, sizeof(value));
+            continue;
+        }
+        source->_next = _readySources.load();
+        while (!_readySources.compare_exchange_weak(source->_next, source)) {}
+        ++readyCount;
+    }
+    return readyCount;
+}
+
+void IoReactor::run()
+{
+    while (_running.load())
+    {
+        if (collect(-1) > 0U)
+        {
+            _interrupt();
+        }
+    }
+}
+
+} // namespace bsp
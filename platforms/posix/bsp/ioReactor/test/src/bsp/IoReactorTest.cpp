@@ -0,0 +1,227 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "bsp/IoReactor.h"
+
+#include <async/AsyncMock.h>
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <fcntl.h>
+#include <mutex>
+#include <unistd.h>
+
+namespace
+{
+using namespace ::testing;
+
+::async::ContextType const CONTEXT = 2U;
+
+class RunnableMock : public ::async::RunnableType
+{
+public:
+    MOCK_METHOD(void, execute, (), (override));
+};
+
+class IoReactorTest : public Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_TRUE(_reactor.open());
+        ASSERT_EQ(0, ::pipe2(_pipe, O_CLOEXEC | O_NONBLOCK));
+    }
+
+    void TearDown() override
+    {
+        _reactor.close();
+        closeWriteEnd();
+        (void)::close(_pipe[0]);
+    }
+
+    void writeByte()
+    {
+        uint8_t const data = 0x55U;
+        ASSERT_EQ(1, ::write(_pipe[1], &data, sizeof(data)));
+    }
+
+    void readByte()
+    {
+        uint8_t data = 0U;
+        ASSERT_EQ(1, ::read(_pipe[0], &data, sizeof(data)));
+    }
+
+    void interrupt()
+    {
+        ::std::lock_guard<::std::mutex> const lock(_mutex);
+        ++_interruptCount;
+        _interrupted.notify_all();
+    }
+
+    bool waitForInterrupts(size_t const count)
+    {
+        ::std::unique_lock<::std::mutex> lock(_mutex);
+        return _interrupted.wait_for(
+            lock, ::std::chrono::seconds(5), [this, count] { return _interruptCount >= count; });
+    }
+
+    ::bsp::IoReactor::InterruptFunction getInterruptFunction()
+    {
+        return ::bsp::IoReactor::InterruptFunction::create<IoReactorTest, &IoReactorTest::interrupt>(
+            *this);
+    }
+
+    void closeWriteEnd()
+    {
+        if (_pipe[1] >= 0)
+        {
+            (void)::close(_pipe[1]);
+            _pipe[1] = -1;
+        }
+    }
+
+protected:
+    StrictMock<::async::AsyncMock> _asyncMock;
+    RunnableMock _runnable;
+    ::bsp::IoReactor _reactor;
+    int _pipe[2] = {-1, -1};
+    ::std::mutex _mutex;
+    ::std::condition_variable _interrupted;
+    size_t _interruptCount = 0U;
+};
+
+/**
+ * \desc
+ * Without a ready file descriptor, wait() returns after the timeout without executing anything.
+ */
+TEST_F(IoReactorTest, testWaitTimesOutWithoutReadySources)
+{
+    ::bsp::IoReactor::Source source(CONTEXT, _runnable);
+    ASSERT_TRUE(_reactor.add(source, _pipe[0]));
+    EXPECT_EQ(_pipe[0], source.getFileDescriptor());
+    EXPECT_EQ(0U, _reactor.wait(0));
+}
+
+/**
+ * \desc
+ * A readable file descriptor executes the runnable of its source in the source's context once,
+ * until the source is rearmed.
+ */
+TEST_F(IoReactorTest, testReadySourceIsExecutedOnceUntilRearmed)
+{
+    ::bsp::IoReactor::Source source(CONTEXT, _runnable);
+    ASSERT_TRUE(_reactor.add(source, _pipe[0]));
+    writeByte();
+
+    EXPECT_CALL(_asyncMock, execute(CONTEXT, Ref(_runnable)));
+    EXPECT_EQ(1U, _reactor.wait(0));
+    Mock::VerifyAndClearExpectations(&_asyncMock);
+
+    // still readable, but not rearmed
+    writeByte();
+    EXPECT_EQ(0U, _reactor.wait(0));
+
+    EXPECT_CALL(_asyncMock, execute(CONTEXT, Ref(_runnable)));
+    _reactor.rearm(source);
+    EXPECT_EQ(1U, _reactor.wait(0));
+    Mock::VerifyAndClearExpectations(&_asyncMock);
+
+    // all data read before rearming
+    readByte();
+    readByte();
+    _reactor.rearm(source);
+    EXPECT_EQ(0U, _reactor.wait(0));
+}
+
+/**
+ * \desc
+ * A removed source isn't watched anymore and its file descriptor stays open.
+ */
+TEST_F(IoReactorTest, testRemovedSourceIsNotExecuted)
+{
+    ::bsp::IoReactor::Source source(CONTEXT, _runnable);
+    ASSERT_TRUE(_reactor.add(source, _pipe[0]));
+    _reactor.remove(source);
+    EXPECT_EQ(-1, source.getFileDescriptor());
+    writeByte();
+    EXPECT_EQ(0U, _reactor.wait(0));
+    readByte();
+
+    // a removed source can be added again
+    EXPECT_TRUE(_reactor.add(source, _pipe[0]));
+}
+
+/**
+ * \desc
+ * A source can only watch one file descriptor, and only while the reactor is open.
+ */
+TEST_F(IoReactorTest, testAddFails)
+{
+    ::bsp::IoReactor::Source source(CONTEXT, _runnable);
+    ASSERT_TRUE(_reactor.add(source, _pipe[0]));
+    EXPECT_FALSE(_reactor.add(source, _pipe[1]));
+
+    ::bsp::IoReactor::Source other(CONTEXT, _runnable);
+    EXPECT_FALSE(_reactor.add(other, -1));
+
+    _reactor.close();
+    EXPECT_FALSE(_reactor.add(other, _pipe[1]));
+}
+
+/**
+ * \desc
+ * The reactor thread raises the interrupt once a source is ready, and dispatch() executes the
+ * runnable of the source in the source's context.
+ */
+TEST_F(IoReactorTest, testThreadRaisesInterruptForReadySources)
+{
+    ::bsp::IoReactor::Source source(CONTEXT, _runnable);
+    ASSERT_TRUE(_reactor.add(source, _pipe[0]));
+    ASSERT_TRUE(_reactor.start(getInterruptFunction()));
+
+    writeByte();
+    ASSERT_TRUE(waitForInterrupts(1U));
+    EXPECT_CALL(_asyncMock, execute(CONTEXT, Ref(_runnable)));
+    _reactor.dispatch();
+    Mock::VerifyAndClearExpectations(&_asyncMock);
+
+    // nothing left to dispatch
+    _reactor.dispatch();
+
+    readByte();
+    _reactor.rearm(source);
+    writeByte();
+    ASSERT_TRUE(waitForInterrupts(2U));
+    _reactor.stop();
+    EXPECT_CALL(_asyncMock, execute(CONTEXT, Ref(_runnable)));
+    _reactor.dispatch();
+    Mock::VerifyAndClearExpectations(&_asyncMock);
+}
+
+/**
+ * \desc
+ * The reactor thread can only be started once while the reactor is open, and it can be started
+ * again after having been stopped.
+ */
+TEST_F(IoReactorTest, testStartAndStop)
+{
+    ASSERT_TRUE(_reactor.start(getInterruptFunction()));
+    EXPECT_FALSE(_reactor.start(getInterruptFunction()));
+    _reactor.stop();
+    _reactor.stop();
+    EXPECT_TRUE(_reactor.start(getInterruptFunction()));
+    _reactor.close();
+    EXPECT_FALSE(_reactor.start(getInterruptFunction()));
+    EXPECT_EQ(0U, _interruptCount);
+}
+
+} // namespace
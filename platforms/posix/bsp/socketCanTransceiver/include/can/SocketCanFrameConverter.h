@@ -0,0 +1,71 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <can/canframes/CANFrame.h>
+#include <linux/can.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace can
+{
+
+/**
+ * Conversion between CANFrame and the SocketCAN frame structures, as used by
+ * SocketCanTransceiver.
+ */
+class SocketCanFrameConverter
+{
+    SocketCanFrameConverter();
+
+public:
+    /**
+     * Rounds a payload length up to the next valid CAN FD data length, i.e. 0 to 8, 12, 16, 20,
+     * 24, 32, 48 or 64. Lengths above 64 are limited to 64.
+     */
+    static uint8_t toFdLength(uint8_t length);
+
+    /**
+     * Converts a CanId value into a SocketCAN identifier, extended identifiers get CAN_EFF_FLAG.
+     */
+    static canid_t toSocketCanId(uint32_t id);
+
+    /**
+     * Converts a SocketCAN identifier into a CanId value. The CAN_RTR_FLAG and CAN_ERR_FLAG bits
+     * are ignored.
+     */
+    static uint32_t toCanId(canid_t socketCanId);
+
+    /**
+     * Fills \p socketCanFrame with \p frame and returns the number of bytes to send, CAN_MTU for
+     * a classic frame or CANFD_MTU for a CAN FD frame.
+     *
+     * The frame is sent in the CAN FD format if it is longer than 8 bytes or if \p canFd is set
+     * and its identifier hasn't CanId::isForceNoFd() set. A CAN FD frame is zero-padded to the
+     * next valid CAN FD data length and gets CANFD_BRS if \p bitRateSwitch is set. CANFD_ESI is
+     * never set, it is only set by the controller of an error passive node.
+     */
+    static size_t toSocketCanFrame(
+        CANFrame const& frame, bool canFd, bool bitRateSwitch, canfd_frame& socketCanFrame);
+
+    /**
+     * Fills \p frame with \p socketCanFrame of \p size bytes as received from the socket.
+     *
+     * The CANFD_BRS and CANFD_ESI flags are ignored, as CANFrame has no representation for them.
+     *
+     * \return false if \p size is neither CAN_MTU nor CANFD_MTU or if the frame is longer than
+     *         CANFrame::MAX_FRAME_LENGTH, \p frame isn't changed then
+     */
+    static bool toCanFrame(canfd_frame const& socketCanFrame, size_t size, CANFrame& frame);
+};
+
+} // namespace can
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <can/transceiver/AbstractCANTransceiver.h>
+#include <etl/delegate.h>
 #include <io/MemoryQueue.h>
 
 #include <atomic>
@@ -25,6 +26,14 @@ namespace can
  * run in the same task context. The deviation from this can result in unobvious UBs.
  * The transceiver state change detection is currently not implemented,
  * the corresponding callback is never called.
+ *
+ * Frames are sent and received in batches with one system call each. Received frames are
+ * timestamped with the kernel receive time, converted to getSystemTimeUs32Bit().
+ *
+ * Classic and CAN FD frames are received. With DeviceConfig::canFd, frames are sent in the
+ * CAN FD format with their length rounded up to the next valid CAN FD data length, frames with
+ * CanId::isForceNoFd() are sent as classic frames. Frames longer than 8 bytes are always sent in
+ * the CAN FD format.
  */
 class SocketCanTransceiver final : public AbstractCANTransceiver
 {
@@ -37,10 +46,17 @@ public:
      */
     struct DeviceConfig
     {
-        char const* name; /// SocketCAN interface name
-        uint8_t busId;    /// currently not used
+        char const* name;   /// SocketCAN interface name
+        uint8_t busId;      /// currently not used
+        bool canFd;         /// send CAN FD frames unless CanId::isForceNoFd()
+        bool bitRateSwitch; /// send CAN FD frames with bit rate switch (BRS)
     };
 
+    /**
+     * Called from write() when run() has frames to send.
+     */
+    using WakeupFunction = ::etl::delegate<void()>;
+
     explicit SocketCanTransceiver(DeviceConfig const& config);
 
     SocketCanTransceiver(SocketCanTransceiver const&)            = delete;
@@ -49,6 +65,14 @@ public:
     ICanTransceiver::ErrorCode init() final;
     ICanTransceiver::ErrorCode open() final;
     ICanTransceiver::ErrorCode open(CANFrame const& frame) final;
+
+    /**
+     * Opens the transceiver on an already opened and bound socket, e.g. one inherited from
+     * another process, instead of opening DeviceConfig::name. The transceiver takes ownership of
+     * \p fileDescriptor and closes it in close().
+     */
+    ICanTransceiver::ErrorCode open(int fileDescriptor);
+
     ICanTransceiver::ErrorCode close() final;
     void shutdown() final;
 
@@ -67,7 +91,40 @@ public:
      */
     void run(int maxSentPerRun, int maxReceivedPerRun);
 
+    /**
+     * Enables the event-driven mode.
+     *
+     * run() only receives frames after setReadable() and only sends frames after write(), and
+     * returns without any system call otherwise. The optional \p wakeup function is called from
+     * write(), it shall only signal the owning task context.
+     */
+    void enableEventMode(WakeupFunction wakeup);
+
+    /**
+     * Returns the socket, e.g. to wait for it to become readable, or -1 if it isn't open.
+     */
+    int getFileDescriptor() const { return _fileDescriptor; }
+
+    /**
+     * Marks the socket as readable in the event-driven mode. The following runs receive frames
+     * until the socket has no more frames, see isReadable().
+     */
+    void setReadable();
+
+    /**
+     * Returns whether the socket may have frames left after the last run() in the event-driven
+     * mode. The socket needs to be watched again once this returns false after setReadable().
+     */
+    bool isReadable() const;
+
+    /**
+     * Returns whether run() has frames to receive or to send. Always true if the event-driven
+     * mode is not enabled.
+     */
+    bool hasPendingEvents() const;
+
 private:
+    static constexpr size_t RX_BATCH_SIZE         = 16U;
     static constexpr size_t TX_NUM_ELEMENTS       = 16U;
     static constexpr size_t TX_ELEMENT_SIZE_BYTES = sizeof(CANFrame) + sizeof(void*);
 
@@ -85,6 +142,8 @@ private:
     void guardedOpen();
     void guardedClose();
     void guardedRun(int maxSentPerRun, int maxReceivedPerRun);
+    void sendFrames(int maxSentPerRun);
+    int receiveFrames(int maxReceivedPerRun);
 
     TxQueue _txQueue;
     ::io::MemoryQueueReader<TxQueue> _txReader;
@@ -95,6 +154,11 @@ private:
     int _fileDescriptor;
 
     ::std::atomic_bool _writable;
+
+    WakeupFunction _wakeup;
+    ::std::atomic_bool _txPending;
+    bool _rxPending;
+    bool _eventMode;
 };
 
 } // namespace can
@@ -0,0 +1,81 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "can/SocketCanFrameConverter.h"
+
+#include <can/canframes/CanId.h>
+
+#include <cstring>
+
+namespace can
+{
+
+uint8_t SocketCanFrameConverter::toFdLength(uint8_t const length)
+{
+    static uint8_t const FD_LENGTHS[] = {12U, 16U, 20U, 24U, 32U, 48U, 64U};
+    if (length <= CAN_MAX_DLEN)
+    {
+        return length;
+    }
+    for (uint8_t const fdLength : FD_LENGTHS)
+    {
+        if (length <= fdLength)
+        {
+            return fdLength;
+        }
+    }
+    return CANFD_MAX_DLEN;
+}
+
+canid_t SocketCanFrameConverter::toSocketCanId(uint32_t const id)
+{
+    return CanId::rawId(id) | (CanId::isExtended(id) ? CAN_EFF_FLAG : 0U);
+}
+
+uint32_t SocketCanFrameConverter::toCanId(canid_t const socketCanId)
+{
+    bool const isExtended = (socketCanId & CAN_EFF_FLAG) != 0U;
+    return CanId::id(socketCanId & (isExtended ? CAN_EFF_MASK : CAN_SFF_MASK), isExtended);
+}
+
+size_t SocketCanFrameConverter::toSocketCanFrame(
+    CANFrame const& frame, bool const canFd, bool const bitRateSwitch, canfd_frame& socketCanFrame)
+{
+    ::std::memset(&socketCanFrame, 0, sizeof(socketCanFrame));
+    uint32_t const id     = frame.getId();
+    socketCanFrame.can_id = toSocketCanId(id);
+    uint8_t const length  = frame.getPayloadLength();
+    ::std::memcpy(socketCanFrame.data, frame.getPayload(), length);
+    if ((length > CAN_MAX_DLEN) || (canFd && !CanId::isForceNoFd(id)))
+    {
+        // The padding bytes up to the valid CAN FD data length are zero
+        socketCanFrame.len   = toFdLength(length);
+        socketCanFrame.flags = bitRateSwitch ? CANFD_BRS : 0U;
+        return CANFD_MTU;
+    }
+    socketCanFrame.len = length;
+    return CAN_MTU;
+}
+
+bool SocketCanFrameConverter::toCanFrame(
+    canfd_frame const& socketCanFrame, size_t const size, CANFrame& frame)
+{
+    // A classic can_frame has the same layout as the beginning of a canfd_frame
+    if (((size != CAN_MTU) && (size != CANFD_MTU))
+        || (socketCanFrame.len > CANFrame::MAX_FRAME_LENGTH))
+    {
+        return false;
+    }
+    frame.setId(toCanId(socketCanFrame.can_id));
+    frame.setPayload(socketCanFrame.data, socketCanFrame.len);
+    return true;
+}
+
+} // namespace can
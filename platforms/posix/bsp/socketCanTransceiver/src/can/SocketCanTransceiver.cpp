@@ -10,19 +10,26 @@
 
 #include "can/SocketCanTransceiver.h"
 
+#include "can/SocketCanFrameConverter.h"
+
+#include <bsp/timer/SystemTimer.h>
 #include <can/CanLogger.h>
 #include <can/canframes/ICANFrameSentListener.h>
 #include <linux/can.h>
 #include <linux/can/raw.h>
+#include <linux/net_tstamp.h>
 #include <net/if.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 
 #include <fcntl.h>
 #include <signal.h>
+#include <time.h>
 #include <type_traits>
 #include <unistd.h>
 
+#include <etl/algorithm.h>
+#include <etl/array.h>
 #include <etl/char_traits.h>
 #include <etl/error_handler.h>
 #include <etl/span.h>
@@ -52,6 +59,42 @@ void signalGuarded(F&& function)
     pthread_sigmask(SIG_SETMASK, &oldSet, nullptr);
 }
 
+// Space for the three timespec values of SCM_TIMESTAMPING
+size_t const RX_CONTROL_SIZE = CMSG_SPACE(3U * sizeof(timespec));
+
+/**
+ * Converts a kernel timestamp (CLOCK_REALTIME) into the time base of getSystemTimeUs32Bit()
+ * by its age relative to \p now.
+ */
+uint32_t toSystemTimeUs(timespec const& timestamp, timespec const& now, uint32_t const systemTimeUs)
+{
+    int64_t const ageUs = ((static_cast<int64_t>(now.tv_sec) - timestamp.tv_sec) * 1000000)
+                          + ((static_cast<int64_t>(now.tv_nsec) - timestamp.tv_nsec) / 1000);
+    return (ageUs > 0) ? (systemTimeUs - static_cast<uint32_t>(ageUs)) : systemTimeUs;
+}
+
+/**
+ * Returns the software receive timestamp of a message or the current system time if there is
+ * none.
+ */
+uint32_t getTimestamp(msghdr& message, timespec const& now, uint32_t const systemTimeUs)
+{
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&message); cmsg != nullptr;
+         cmsg          = CMSG_NXTHDR(&message, cmsg))
+    {
+        if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_TIMESTAMPING))
+        {
+            timespec timestamp;
+            ::std::memcpy(&timestamp, CMSG_DATA(cmsg), sizeof(timestamp));
+            if ((timestamp.tv_sec != 0) || (timestamp.tv_nsec != 0))
+            {
+                return toSystemTimeUs(timestamp, now, systemTimeUs);
+            }
+        }
+    }
+    return systemTimeUs;
+}
+
 } // namespace
 
 // needed if ODR-used
@@ -65,6 +108,10 @@ SocketCanTransceiver::SocketCanTransceiver(DeviceConfig const& config)
 , _config(config)
 , _fileDescriptor(-1)
 , _writable(false)
+, _wakeup()
+, _txPending(false)
+, _rxPending(false)
+, _eventMode(false)
 {}
 
 ICanTransceiver::ErrorCode SocketCanTransceiver::init()
@@ -89,6 +136,18 @@ ICanTransceiver::ErrorCode SocketCanTransceiver::open()
     return ErrorCode::CAN_ERR_OK;
 }
 
+ICanTransceiver::ErrorCode SocketCanTransceiver::open(int const fileDescriptor)
+{
+    if (!isInState(State::INITIALIZED))
+    {
+        return ErrorCode::CAN_ERR_ILLEGAL_STATE;
+    }
+    _fileDescriptor = fileDescriptor;
+    setState(State::OPEN);
+    _writable.store(true);
+    return ErrorCode::CAN_ERR_OK;
+}
+
 ICanTransceiver::ErrorCode SocketCanTransceiver::open(CANFrame const& /* frame */)
 {
     ETL_ASSERT_FAIL(ETL_ERROR_GENERIC("not implemented"));
@@ -135,6 +194,10 @@ SocketCanTransceiver::writeImpl(CANFrame const& frame, ICANFrameSentListener* li
     ::std::memcpy(memory.data(), &frame, sizeof(frame));
     ::std::memcpy(memory.data() + sizeof(frame), static_cast<void*>(&listener), sizeof(void*));
     _txWriter.commit();
+    if (_eventMode && !_txPending.exchange(true) && _wakeup.is_valid())
+    {
+        _wakeup();
+    }
     return ErrorCode::CAN_ERR_OK;
 }
 
@@ -164,8 +227,27 @@ uint32_t SocketCanTransceiver::getBaudrate() const { return 500000U; }
 
 uint16_t SocketCanTransceiver::getHwQueueTimeout() const { return 1U; }
 
+void SocketCanTransceiver::enableEventMode(WakeupFunction const wakeup)
+{
+    _wakeup    = wakeup;
+    _eventMode = true;
+}
+
+void SocketCanTransceiver::setReadable() { _rxPending = _eventMode; }
+
+bool SocketCanTransceiver::isReadable() const { return _rxPending; }
+
+bool SocketCanTransceiver::hasPendingEvents() const
+{
+    return (!_eventMode) || _rxPending || _txPending.load();
+}
+
 void SocketCanTransceiver::run(int maxSentPerRun, int maxReceivedPerRun)
 {
+    if (!hasPendingEvents())
+    {
+        return;
+    }
     signalGuarded([this, maxSentPerRun, maxReceivedPerRun]
                   { guardedRun(maxSentPerRun, maxReceivedPerRun); });
 }
@@ -205,6 +287,18 @@ void SocketCanTransceiver::guardedOpen()
         return;
     }
 
+    int const timestamping = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+    error = setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &timestamping, sizeof(timestamping));
+    if (error < 0)
+    {
+        // Received frames will be timestamped with the time of reception by run()
+        Logger::warn(
+            CAN,
+            "[SocketCanTransceiver] Failed to enable timestamping (node=%s, error=%d)",
+            name,
+            error);
+    }
+
     error = fcntl(fd, F_SETFL, O_NONBLOCK);
     if (error < 0)
     {
@@ -237,72 +331,152 @@ void SocketCanTransceiver::guardedClose()
 {
     ::close(_fileDescriptor);
     _fileDescriptor = -1;
+    _rxPending      = false;
 }
 
 void SocketCanTransceiver::guardedRun(int maxSentPerRun, int maxReceivedPerRun)
+{
+    sendFrames(maxSentPerRun);
+
+    if (!_eventMode)
+    {
+        (void)receiveFrames(maxReceivedPerRun);
+    }
+    else if (_rxPending)
+    {
+        // All frames have been received if the socket returned fewer frames than requested.
+        _rxPending = (receiveFrames(maxReceivedPerRun) >= maxReceivedPerRun);
+    }
+}
+
+void SocketCanTransceiver::sendFrames(int const maxSentPerRun)
 {
     // MUTED condition does not affect the messages already in the write queue;
     // the idea is that once we confirmed that we had accepted the message for delivery,
     // we shall try to deliver it.
-    for (int count = 0; count < maxSentPerRun; ++count)
+    // All frames of one run are peeked, sent with one system call and released at once, the sent
+    // callbacks are called after releasing them, so that listeners can immediately write into the
+    // freed queue entries.
+    _txPending.store(false);
+    ::etl::array<::etl::span<uint8_t>, TX_NUM_ELEMENTS> txEntries;
+    size_t const maxSent
+        = ::etl::min(static_cast<size_t>(::etl::max(maxSentPerRun, 0)), TX_NUM_ELEMENTS);
+    size_t const numEntries
+        = _txReader.peekMany(::etl::span<::etl::span<uint8_t>>(txEntries.data(), maxSent));
+
+    ::etl::array<CANFrame, TX_NUM_ELEMENTS> sentFrames;
+    ::etl::array<ICANFrameSentListener*, TX_NUM_ELEMENTS> sentListeners;
+    canfd_frame socketCanFrames[TX_NUM_ELEMENTS];
+    iovec vectors[TX_NUM_ELEMENTS];
+    mmsghdr messages[TX_NUM_ELEMENTS];
+    size_t numFrames = 0U;
+    while (numFrames < numEntries)
     {
-        auto memory = _txReader.peek();
+        auto const memory = txEntries[numFrames];
         if (memory.size() < TX_ELEMENT_SIZE_BYTES)
         {
             break;
         }
-        CANFrame canFrame;
+        CANFrame& canFrame = sentFrames[numFrames];
         ::std::memcpy(static_cast<void*>(&canFrame), memory.data(), sizeof(canFrame));
-        ICANFrameSentListener* listener = nullptr;
         ::std::memcpy(
-            static_cast<void*>(&listener), memory.data() + sizeof(canFrame), sizeof(void*));
-        _txReader.release();
-        can_frame socketCanFrame;
-        ::std::memset(&socketCanFrame, 0, sizeof(socketCanFrame));
-        socketCanFrame.can_id  = canFrame.getId();
-        int length             = canFrame.getPayloadLength();
-        socketCanFrame.can_dlc = length;
-        ::std::memcpy(socketCanFrame.data, canFrame.getPayload(), length);
-        ::std::memset(socketCanFrame.data + length, 0, sizeof(socketCanFrame.data) - length);
-        ssize_t const bytesWritten = ::write(_fileDescriptor, &socketCanFrame, CAN_MTU);
-        if (bytesWritten != CAN_MTU)
-        {
-            break;
-        }
-        if (listener != nullptr)
+            static_cast<void*>(&sentListeners[numFrames]),
+            memory.data() + sizeof(canFrame),
+            sizeof(void*));
+        vectors[numFrames].iov_base = &socketCanFrames[numFrames];
+        vectors[numFrames].iov_len  = SocketCanFrameConverter::toSocketCanFrame(
+            canFrame, _config.canFd, _config.bitRateSwitch, socketCanFrames[numFrames]);
+        ::std::memset(&messages[numFrames], 0, sizeof(messages[numFrames]));
+        messages[numFrames].msg_hdr.msg_iov    = &vectors[numFrames];
+        messages[numFrames].msg_hdr.msg_iovlen = 1U;
+        ++numFrames;
+    }
+    if (numFrames == 0U)
+    {
+        return;
+    }
+
+    int const result = sendmmsg(_fileDescriptor, messages, numFrames, MSG_DONTWAIT);
+    size_t const numSent = (result > 0) ? static_cast<size_t>(result) : 0U;
+    // The first frame which failed to be sent is dropped.
+    size_t const numReleased = (numSent < numFrames) ? (numSent + 1U) : numSent;
+    _txReader.releaseMany(numReleased);
+    if (_txReader.peek().size() > 0U)
+    {
+        _txPending.store(true);
+    }
+
+    for (size_t i = 0U; i < numSent; ++i)
+    {
+        if (sentListeners[i] != nullptr)
         {
-            listener->canFrameSent(canFrame);
+            sentListeners[i]->canFrameSent(sentFrames[i]);
         }
-        notifySentListeners(canFrame);
+        notifySentListeners(sentFrames[i]);
     }
+}
+
+int SocketCanTransceiver::receiveFrames(int const maxReceivedPerRun)
+{
+    canfd_frame socketCanFrames[RX_BATCH_SIZE];
+    iovec vectors[RX_BATCH_SIZE];
+    alignas(cmsghdr) uint8_t controls[RX_BATCH_SIZE][RX_CONTROL_SIZE];
+    mmsghdr messages[RX_BATCH_SIZE];
 
-    for (int count = 0; count < maxReceivedPerRun; ++count)
+    int count = 0;
+    while (count < maxReceivedPerRun)
     {
-        alignas(can_frame) uint8_t buffer[CANFD_MTU];
-        ssize_t const length = read(_fileDescriptor, buffer, CANFD_MTU);
-        if (length < 0)
+        size_t const batchSize
+            = ::etl::min(static_cast<size_t>(maxReceivedPerRun - count), RX_BATCH_SIZE);
+        for (size_t i = 0U; i < batchSize; ++i)
+        {
+            vectors[i].iov_base = &socketCanFrames[i];
+            vectors[i].iov_len  = CANFD_MTU;
+            ::std::memset(&messages[i], 0, sizeof(messages[i]));
+            messages[i].msg_hdr.msg_iov        = &vectors[i];
+            messages[i].msg_hdr.msg_iovlen     = 1U;
+            messages[i].msg_hdr.msg_control    = controls[i];
+            messages[i].msg_hdr.msg_controllen = RX_CONTROL_SIZE;
+        }
+        int const result = recvmmsg(_fileDescriptor, messages, batchSize, MSG_DONTWAIT, nullptr);
+        if (result <= 0)
         {
             break;
         }
-        if (length == CAN_MTU)
+        count += result;
+
+        timespec now;
+        (void)clock_gettime(CLOCK_REALTIME, &now);
+        uint32_t const systemTimeUs = getSystemTimeUs32Bit();
+        for (int i = 0; i < result; ++i)
         {
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-            can_frame const& socketCanFrame = *reinterpret_cast<can_frame const*>(buffer);
+            canfd_frame const& socketCanFrame = socketCanFrames[i];
+            CANFrame canFrame;
+            if (!SocketCanFrameConverter::toCanFrame(
+                    socketCanFrame, messages[i].msg_len, canFrame))
+            {
+                continue;
+            }
+            bool const isFd = (messages[i].msg_len == CANFD_MTU);
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg): Logger API is variadic by design.
             Logger::debug(
                 CAN,
-                "[SocketCanTransceiver] received CAN frame, id=0x%X, length=%d",
-                static_cast<int>(::can::CanId::rawId(socketCanFrame.can_id)),
-                static_cast<int>(socketCanFrame.can_dlc));
-            CANFrame canFrame;
-            canFrame.setId(socketCanFrame.can_id);
-            canFrame.setPayload(socketCanFrame.data, socketCanFrame.can_dlc);
-            canFrame.setPayloadLength(socketCanFrame.can_dlc);
-            canFrame.setTimestamp(0);
+                "[SocketCanTransceiver] received CAN%s frame, id=0x%X, length=%d, flags=0x%X",
+                isFd ? " FD" : "",
+                static_cast<int>(socketCanFrame.can_id & CAN_EFF_MASK),
+                static_cast<int>(socketCanFrame.len),
+                static_cast<int>(isFd ? socketCanFrame.flags : 0U));
+            canFrame.setTimestamp(getTimestamp(messages[i].msg_hdr, now, systemTimeUs));
 
             notifyListeners(canFrame);
         }
+        if (static_cast<size_t>(result) < batchSize)
+        {
+            // The socket has no more frames
+            break;
+        }
     }
+    return count;
 }
 
 } // namespace can
@@ -0,0 +1,200 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "can/SocketCanFrameConverter.h"
+
+#include <can/canframes/CanId.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace ::testing;
+using ::can::CanId;
+using ::can::CANFrame;
+using ::can::SocketCanFrameConverter;
+
+uint8_t const PAYLOAD[] = {0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U};
+
+struct FdLength
+{
+    uint8_t from;
+    uint8_t to;
+    uint8_t fdLength;
+};
+
+/**
+ * \desc
+ * Verifies that all lengths from 0 to 64 are rounded up to the next valid CAN FD data length and
+ * that longer lengths are limited to 64.
+ */
+TEST(SocketCanFrameConverterTest, fd_length)
+{
+    FdLength const table[] = {
+        {0U, 0U, 0U},
+        {1U, 1U, 1U},
+        {2U, 2U, 2U},
+        {3U, 3U, 3U},
+        {4U, 4U, 4U},
+        {5U, 5U, 5U},
+        {6U, 6U, 6U},
+        {7U, 7U, 7U},
+        {8U, 8U, 8U},
+        {9U, 12U, 12U},
+        {13U, 16U, 16U},
+        {17U, 20U, 20U},
+        {21U, 24U, 24U},
+        {25U, 32U, 32U},
+        {33U, 48U, 48U},
+        {49U, 64U, 64U},
+        {65U, 255U, 64U},
+    };
+    for (FdLength const& entry : table)
+    {
+        for (uint32_t length = entry.from; length <= entry.to; ++length)
+        {
+            EXPECT_EQ(
+                entry.fdLength, SocketCanFrameConverter::toFdLength(static_cast<uint8_t>(length)))
+                << "length=" << length;
+        }
+    }
+    EXPECT_EQ(16U, SocketCanFrameConverter::toFdLength(13U));
+}
+
+/**
+ * \desc
+ * Verifies the mapping of base and extended identifiers to SocketCAN identifiers and back.
+ */
+TEST(SocketCanFrameConverterTest, id_mapping)
+{
+    struct
+    {
+        uint32_t id;
+        canid_t socketCanId;
+    } const table[] = {
+        {CanId::Base<0x000U>::value, 0x000U},
+        {CanId::Base<0x123U>::value, 0x123U},
+        {CanId::Base<0x7FFU>::value, 0x7FFU},
+        {CanId::Extended<0x00000000U>::value, CAN_EFF_FLAG},
+        {CanId::Extended<0x00000123U>::value, CAN_EFF_FLAG | 0x00000123U},
+        {CanId::Extended<0x1FFFFFFFU>::value, CAN_EFF_FLAG | 0x1FFFFFFFU},
+    };
+    for (auto const& entry : table)
+    {
+        EXPECT_EQ(entry.socketCanId, SocketCanFrameConverter::toSocketCanId(entry.id));
+        EXPECT_EQ(entry.id, SocketCanFrameConverter::toCanId(entry.socketCanId));
+    }
+
+    // the force no FD bit isn't sent
+    EXPECT_EQ(0x123U, SocketCanFrameConverter::toSocketCanId(CanId::forceNoFd(0x123U)));
+    // the RTR and error flags are ignored
+    EXPECT_EQ(
+        CanId::Base<0x123U>::value,
+        SocketCanFrameConverter::toCanId(CAN_RTR_FLAG | CAN_ERR_FLAG | 0x123U));
+    EXPECT_EQ(
+        CanId::Extended<0x1234567U>::value,
+        SocketCanFrameConverter::toCanId(CAN_EFF_FLAG | CAN_RTR_FLAG | 0x1234567U));
+}
+
+/**
+ * \desc
+ * Verifies that frames are sent as classic frames unless CAN FD is enabled, and that CAN FD
+ * frames are zero-padded to the next valid CAN FD data length, with BRS if enabled and never with
+ * ESI.
+ */
+TEST(SocketCanFrameConverterTest, to_socket_can_frame)
+{
+    for (uint8_t length = 0U; length <= CANFrame::MAX_FRAME_LENGTH; ++length)
+    {
+        CANFrame const frame(CanId::Extended<0x1234567U>::value, PAYLOAD, length);
+        canfd_frame socketCanFrame;
+
+        EXPECT_EQ(
+            CAN_MTU, SocketCanFrameConverter::toSocketCanFrame(frame, false, true, socketCanFrame));
+        EXPECT_EQ(CAN_EFF_FLAG | 0x1234567U, socketCanFrame.can_id);
+        EXPECT_EQ(length, socketCanFrame.len);
+        EXPECT_EQ(0U, socketCanFrame.flags);
+        EXPECT_EQ(0, memcmp(PAYLOAD, socketCanFrame.data, length));
+
+        EXPECT_EQ(
+            CANFD_MTU,
+            SocketCanFrameConverter::toSocketCanFrame(frame, true, false, socketCanFrame));
+        EXPECT_EQ(SocketCanFrameConverter::toFdLength(length), socketCanFrame.len);
+        EXPECT_EQ(0U, socketCanFrame.flags);
+        EXPECT_EQ(0, memcmp(PAYLOAD, socketCanFrame.data, length));
+        for (size_t i = length; i < CANFD_MAX_DLEN; ++i)
+        {
+            EXPECT_EQ(0U, socketCanFrame.data[i]);
+        }
+
+        EXPECT_EQ(
+            CANFD_MTU,
+            SocketCanFrameConverter::toSocketCanFrame(frame, true, true, socketCanFrame));
+        EXPECT_EQ(CANFD_BRS, socketCanFrame.flags);
+    }
+}
+
+/**
+ * \desc
+ * Verifies that frames with CanId::isForceNoFd() are sent as classic frames with CAN FD enabled.
+ */
+TEST(SocketCanFrameConverterTest, to_socket_can_frame_force_no_fd)
+{
+    CANFrame const frame(CanId::forceNoFd(CanId::Base<0x123U>::value), PAYLOAD, 3U);
+    canfd_frame socketCanFrame;
+
+    EXPECT_EQ(
+        CAN_MTU, SocketCanFrameConverter::toSocketCanFrame(frame, true, true, socketCanFrame));
+    EXPECT_EQ(0x123U, socketCanFrame.can_id);
+    EXPECT_EQ(3U, socketCanFrame.len);
+    EXPECT_EQ(0U, socketCanFrame.flags);
+}
+
+/**
+ * \desc
+ * Verifies that received classic and CAN FD frames are converted regardless of their BRS and ESI
+ * flags, and that frames with an invalid size or a length above CANFrame::MAX_FRAME_LENGTH are
+ * rejected.
+ */
+TEST(SocketCanFrameConverterTest, to_can_frame)
+{
+    canfd_frame socketCanFrame{};
+    socketCanFrame.can_id = CAN_EFF_FLAG | 0x1234567U;
+    memcpy(socketCanFrame.data, PAYLOAD, sizeof(PAYLOAD));
+
+    for (uint8_t length = 0U; length <= CANFrame::MAX_FRAME_LENGTH; ++length)
+    {
+        socketCanFrame.len = length;
+        for (int const flags : {0, CANFD_BRS, CANFD_ESI, CANFD_BRS | CANFD_ESI})
+        {
+            socketCanFrame.flags = static_cast<uint8_t>(flags);
+            for (size_t const size : {CAN_MTU, CANFD_MTU})
+            {
+                CANFrame frame;
+                EXPECT_TRUE(SocketCanFrameConverter::toCanFrame(socketCanFrame, size, frame));
+                EXPECT_EQ(CanId::Extended<0x1234567U>::value, frame.getId());
+                EXPECT_EQ(length, frame.getPayloadLength());
+                EXPECT_EQ(0, memcmp(PAYLOAD, frame.getPayload(), length));
+            }
+        }
+    }
+
+    CANFrame frame(CanId::Base<0x321U>::value, PAYLOAD, 1U);
+    socketCanFrame.len = 2U;
+    EXPECT_FALSE(SocketCanFrameConverter::toCanFrame(socketCanFrame, CAN_MTU - 1U, frame));
+    EXPECT_FALSE(SocketCanFrameConverter::toCanFrame(socketCanFrame, CANFD_MTU + 1U, frame));
+    socketCanFrame.len = CANFrame::MAX_FRAME_LENGTH + 1U;
+    EXPECT_FALSE(SocketCanFrameConverter::toCanFrame(socketCanFrame, CANFD_MTU, frame));
+    EXPECT_EQ(CanId::Base<0x321U>::value, frame.getId());
+    EXPECT_EQ(1U, frame.getPayloadLength());
+}
+
+} // namespace
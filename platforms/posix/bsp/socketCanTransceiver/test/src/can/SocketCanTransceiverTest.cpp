@@ -10,12 +10,30 @@
 
 #include "can/SocketCanTransceiver.h"
 
-#include <gtest/gtest.h>
+#include "bsp/timer/SystemTimerMock.h"
+
+#include <can/canframes/CANFrameSentListenerMock.h>
+#include <can/canframes/CanId.h>
+#include <can/framemgmt/AbstractIntervalFilteredCANFrameListener.h>
+#include <linux/can.h>
+#include <sys/socket.h>
+
+#include <unistd.h>
+
+#include <gmock/gmock.h>
+
+#include <vector>
 
 namespace
 {
 
 using namespace ::testing;
+using ::can::CanId;
+using ::can::CANFrame;
+using ::can::ICanTransceiver;
+using ::can::SocketCanTransceiver;
+
+uint8_t const PAYLOAD[] = {0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U};
 
 /**
  * \desc
@@ -23,9 +41,241 @@ using namespace ::testing;
  */
 TEST(SocketCanTransceiverTest, transceiver_creation)
 {
-    ::can::SocketCanTransceiver::DeviceConfig config{"vcan0", {}};
+    ::can::SocketCanTransceiver::DeviceConfig config{"vcan0", {}, false, false};
     ::can::SocketCanTransceiver transceiver{config};
     EXPECT_EQ(transceiver.getState(), ::can::ICanTransceiver::State::CLOSED);
 }
 
+/**
+ * \desc
+ * Verifies that run() always has work to do in polling mode, and that in event-driven mode it
+ * only has pending events after write() or setReadable(), until the socket has no more frames.
+ */
+TEST(SocketCanTransceiverTest, pending_events_in_event_mode)
+{
+    ::can::SocketCanTransceiver::DeviceConfig config{"vcan0", {}, false, false};
+    ::can::SocketCanTransceiver transceiver{config};
+    EXPECT_TRUE(transceiver.hasPendingEvents());
+    transceiver.setReadable();
+    EXPECT_FALSE(transceiver.isReadable());
+
+    transceiver.enableEventMode(::can::SocketCanTransceiver::WakeupFunction());
+    EXPECT_FALSE(transceiver.hasPendingEvents());
+    transceiver.run(3, 3);
+    EXPECT_FALSE(transceiver.hasPendingEvents());
+
+    // nothing to receive from a closed socket
+    transceiver.setReadable();
+    EXPECT_TRUE(transceiver.isReadable());
+    EXPECT_TRUE(transceiver.hasPendingEvents());
+    transceiver.run(3, 3);
+    EXPECT_FALSE(transceiver.isReadable());
+    EXPECT_FALSE(transceiver.hasPendingEvents());
+}
+
+/**
+ * Listener collecting all received base frames.
+ */
+class FrameCollector : public ::can::AbstractIntervalFilteredCANFrameListener
+{
+public:
+    FrameCollector() { fFilter.open(); }
+
+    void frameReceived(CANFrame const& frame) override { frames.push_back(frame); }
+
+    std::vector<CANFrame> frames;
+};
+
+/**
+ * Runs the transceiver on one end of a sequenced packet socket pair, which keeps the message
+ * boundaries of sendmmsg() and recvmmsg() like a CAN_RAW socket. The test plays the CAN bus on
+ * the other end.
+ */
+class SocketCanTransceiverSocketTest : public Test
+{
+public:
+    SocketCanTransceiverSocketTest()
+    : _config{"vcan0", {}, false, false}, _transceiver(_config), _peer(-1), _wakeupCount(0U)
+    {
+        int sockets[2];
+        EXPECT_EQ(0, socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sockets));
+        _peer = sockets[1];
+        EXPECT_EQ(ICanTransceiver::ErrorCode::CAN_ERR_OK, _transceiver.init());
+        EXPECT_EQ(ICanTransceiver::ErrorCode::CAN_ERR_OK, _transceiver.open(sockets[0]));
+        _transceiver.addCANFrameListener(_collector);
+    }
+
+    ~SocketCanTransceiverSocketTest() override
+    {
+        _transceiver.removeCANFrameListener(_collector);
+        (void)_transceiver.close();
+        (void)::close(_peer);
+    }
+
+    static CANFrame frame(uint32_t const index)
+    {
+        return CANFrame(CanId::Base<0x100U>::value + index, PAYLOAD, index % 9U);
+    }
+
+    /// Sends frame(index) for each index in [from, to) from the peer as classic frames.
+    void sendFromPeer(uint32_t const from, uint32_t const to)
+    {
+        for (uint32_t index = from; index < to; ++index)
+        {
+            can_frame socketCanFrame{};
+            CANFrame const canFrame = frame(index);
+            socketCanFrame.can_id   = CanId::rawId(canFrame.getId());
+            socketCanFrame.len      = canFrame.getPayloadLength();
+            ::std::memcpy(socketCanFrame.data, canFrame.getPayload(), socketCanFrame.len);
+            ASSERT_EQ(
+                static_cast<ssize_t>(CAN_MTU),
+                send(_peer, &socketCanFrame, CAN_MTU, MSG_DONTWAIT));
+        }
+    }
+
+    /// Returns the sizes of all messages waiting at the peer, and checks them against frame().
+    std::vector<size_t> receiveAtPeer(uint32_t const firstIndex)
+    {
+        std::vector<size_t> sizes;
+        canfd_frame socketCanFrame;
+        ssize_t size;
+        while ((size = recv(_peer, &socketCanFrame, sizeof(socketCanFrame), MSG_DONTWAIT)) > 0)
+        {
+            CANFrame const expected = frame(firstIndex + static_cast<uint32_t>(sizes.size()));
+            EXPECT_EQ(CanId::rawId(expected.getId()), socketCanFrame.can_id);
+            EXPECT_EQ(expected.getPayloadLength(), socketCanFrame.len);
+            EXPECT_EQ(
+                0, ::std::memcmp(expected.getPayload(), socketCanFrame.data, socketCanFrame.len));
+            sizes.push_back(static_cast<size_t>(size));
+        }
+        return sizes;
+    }
+
+    /// Checks that the collector has received frame(index) for each index in [from, to).
+    void expectReceived(uint32_t const from, uint32_t const to)
+    {
+        ASSERT_EQ(to - from, _collector.frames.size());
+        for (uint32_t index = from; index < to; ++index)
+        {
+            EXPECT_EQ(frame(index), _collector.frames[index - from]);
+        }
+        _collector.frames.clear();
+    }
+
+    void wakeup() { ++_wakeupCount; }
+
+protected:
+    NiceMock<SystemTimerMock> _systemTimerMock;
+    SocketCanTransceiver::DeviceConfig _config;
+    SocketCanTransceiver _transceiver;
+    FrameCollector _collector;
+    int _peer;
+    size_t _wakeupCount;
+};
+
+/**
+ * \desc
+ * Verifies that the queued frames are sent in order, at most maxSentPerRun per run, and that the
+ * sent listeners are called for each sent frame.
+ */
+TEST_F(SocketCanTransceiverSocketTest, send_frames_in_batches)
+{
+    StrictMock<::can::CANFrameSentListenerMock> sentListener;
+    for (uint32_t index = 0U; index < 5U; ++index)
+    {
+        EXPECT_EQ(
+            ICanTransceiver::ErrorCode::CAN_ERR_OK,
+            _transceiver.write(frame(index), sentListener));
+    }
+
+    EXPECT_CALL(sentListener, canFrameSent(frame(0U)));
+    EXPECT_CALL(sentListener, canFrameSent(frame(1U)));
+    EXPECT_CALL(sentListener, canFrameSent(frame(2U)));
+    _transceiver.run(3, 0);
+    EXPECT_THAT(receiveAtPeer(0U), ElementsAre(CAN_MTU, CAN_MTU, CAN_MTU));
+    Mock::VerifyAndClearExpectations(&sentListener);
+
+    EXPECT_CALL(sentListener, canFrameSent(frame(3U)));
+    EXPECT_CALL(sentListener, canFrameSent(frame(4U)));
+    _transceiver.run(3, 0);
+    EXPECT_THAT(receiveAtPeer(3U), ElementsAre(CAN_MTU, CAN_MTU));
+}
+
+/**
+ * \desc
+ * Verifies that frames are sent in the CAN FD format if configured.
+ */
+TEST_F(SocketCanTransceiverSocketTest, send_fd_frames)
+{
+    _config.canFd = true;
+    EXPECT_EQ(ICanTransceiver::ErrorCode::CAN_ERR_OK, _transceiver.write(frame(0U)));
+    _transceiver.run(3, 0);
+    EXPECT_THAT(receiveAtPeer(0U), ElementsAre(CANFD_MTU));
+}
+
+/**
+ * \desc
+ * Verifies that more frames than fit into one batch of recvmmsg() are received in order, and that
+ * a run receives at most maxReceivedPerRun frames.
+ */
+TEST_F(SocketCanTransceiverSocketTest, receive_frames_in_batches)
+{
+    sendFromPeer(0U, 40U);
+    _transceiver.run(0, 10);
+    expectReceived(0U, 10U);
+    _transceiver.run(0, 100);
+    expectReceived(10U, 40U);
+    _transceiver.run(0, 100);
+    expectReceived(40U, 40U);
+}
+
+/**
+ * \desc
+ * Verifies that in event-driven mode write() calls the wakeup function once until the next run,
+ * and that run() only receives frames after setReadable() until the socket has no more frames.
+ */
+TEST_F(SocketCanTransceiverSocketTest, event_mode)
+{
+    _transceiver.enableEventMode(
+        SocketCanTransceiver::WakeupFunction::
+            create<SocketCanTransceiverSocketTest, &SocketCanTransceiverSocketTest::wakeup>(*this));
+    EXPECT_FALSE(_transceiver.hasPendingEvents());
+
+    EXPECT_EQ(ICanTransceiver::ErrorCode::CAN_ERR_OK, _transceiver.write(frame(0U)));
+    EXPECT_EQ(1U, _wakeupCount);
+    EXPECT_EQ(ICanTransceiver::ErrorCode::CAN_ERR_OK, _transceiver.write(frame(1U)));
+    EXPECT_EQ(1U, _wakeupCount);
+    EXPECT_TRUE(_transceiver.hasPendingEvents());
+    _transceiver.run(1, 8);
+    EXPECT_THAT(receiveAtPeer(0U), ElementsAre(CAN_MTU));
+    // a frame is left in the queue
+    EXPECT_TRUE(_transceiver.hasPendingEvents());
+    _transceiver.run(1, 8);
+    EXPECT_THAT(receiveAtPeer(1U), ElementsAre(CAN_MTU));
+    EXPECT_FALSE(_transceiver.hasPendingEvents());
+
+    EXPECT_EQ(ICanTransceiver::ErrorCode::CAN_ERR_OK, _transceiver.write(frame(2U)));
+    EXPECT_EQ(2U, _wakeupCount);
+    _transceiver.run(8, 8);
+    EXPECT_THAT(receiveAtPeer(2U), ElementsAre(CAN_MTU));
+
+    // frames are only received after setReadable()
+    sendFromPeer(0U, 20U);
+    EXPECT_FALSE(_transceiver.hasPendingEvents());
+    _transceiver.run(8, 8);
+    expectReceived(0U, 0U);
+
+    _transceiver.setReadable();
+    _transceiver.run(8, 8);
+    expectReceived(0U, 8U);
+    EXPECT_TRUE(_transceiver.isReadable());
+    _transceiver.run(8, 8);
+    expectReceived(8U, 16U);
+    EXPECT_TRUE(_transceiver.isReadable());
+    _transceiver.run(8, 8);
+    expectReceived(16U, 20U);
+    EXPECT_FALSE(_transceiver.isReadable());
+    EXPECT_FALSE(_transceiver.hasPendingEvents());
+}
+
 } // namespace
@@ -12,6 +12,7 @@
 
 #include "etl/array.h"
 #include "etl/queue_spsc_atomic.h"
+#include "etl/span.h"
 #include "lwipSocket/netif/LwipNetworkInterface.h"
 #include "lwipSocket/utils/LwipHelper.h"
 
@@ -27,13 +28,38 @@ static constexpr uint16_t VID_MASK       = 0x0FFFU;
 /**
  * Driver for a TAP interface.
  *
+ * Received frames are read into buffers of a preallocated pool. Each buffer is handed to lwip as a
+ * custom pbuf which returns the buffer to the pool when lwip frees it. The pool is a single
+ * producer single consumer queue: buffers are taken in the driver context and returned in the lwip
+ * context.
+ *
  * \note
  * This driver currently supports one netif only.
  */
 class TapEthernetDriver
 {
 public:
-    explicit TapEthernetDriver(::etl::array<uint8_t const, 6> macAddr);
+    static constexpr uint8_t LENGTH_VLAN_TAG   = 4U;
+    static constexpr uint16_t MAX_FRAME_LENGTH = 1518U + LENGTH_VLAN_TAG;
+
+    using RxFrameBuffer = ::etl::array<uint8_t, MAX_FRAME_LENGTH>;
+    using RxPool        = ::etl::iqueue_spsc_atomic<::lwiputils::RxCustomPbuf*>;
+
+    struct RxStatistics
+    {
+        /** Number of frames passed to lwip. */
+        uint32_t framesReceived = 0U;
+        /** Number of times reading was stopped because all buffers were held by lwip. */
+        uint32_t poolExhausted  = 0U;
+        /** Number of times reading was stopped because the pbuf queue was full. */
+        uint32_t queueFull      = 0U;
+    };
+
+    TapEthernetDriver(
+        ::etl::array<uint8_t const, 6> macAddr,
+        ::etl::span<::lwiputils::RxCustomPbuf> rxPbufs,
+        ::etl::span<RxFrameBuffer> rxFrameBuffers,
+        RxPool& rxPool);
 
     TapEthernetDriver(TapEthernetDriver const&)            = delete;
     TapEthernetDriver& operator=(TapEthernetDriver const&) = delete;
@@ -48,12 +74,28 @@ public:
 
     void stop();
 
-    void readFrame();
+    /**
+     * Reads a single frame from the tap interface into a buffer of the pool.
+     *
+     * \return true if a frame has been queued for lwip
+     */
+    bool readFrame();
 
-    bool writeFrame(pbuf* buf) const;
+    /**
+     * Reads frames until the tap interface has no more data, no buffer is available or
+     * \p budget frames have been read.
+     *
+     * \return number of frames queued for lwip
+     */
+    size_t readFrames(size_t budget);
 
-    static constexpr uint8_t LENGTH_VLAN_TAG   = 4U;
-    static constexpr uint16_t MAX_FRAME_LENGTH = 1518U + LENGTH_VLAN_TAG;
+    /**
+     * \return true if a buffer is available and the pbuf queue isn't full, i.e. reading only
+     * depends on the tap interface having data
+     */
+    bool canReadFrame() const;
+
+    bool writeFrame(pbuf* buf) const;
 
     /**
      * TODO: NYI
@@ -62,6 +104,8 @@ public:
 
     int getTapInterfaceFd() const { return _tapFd; }
 
+    RxStatistics const& getRxStatistics() const { return _rxStatistics; }
+
     // Input prepared lwip pbufs to their interfaces. To be called from the lwip async context.
     void inputPbufs();
 
@@ -70,6 +114,42 @@ public:
 
     // Queue of pbufs filled in the main thread and consumed in the lwip async context.
     ::lwiputils::PbufQueue _queue;
+
+protected:
+    /** Fills the pool with all buffers. To be called once the storage has been constructed. */
+    void initRxPool();
+
+private:
+    static void freeRxPbuf(pbuf* p);
+
+    ::etl::span<::lwiputils::RxCustomPbuf> const _rxPbufs;
+    ::etl::span<RxFrameBuffer> const _rxFrameBuffers;
+    RxPool& _rxPool;
+    RxStatistics _rxStatistics;
+};
+
+namespace declare
+{
+/**
+ * TapEthernetDriver with storage for \p NUM_RX_FRAMES received frames.
+ *
+ * \tparam NUM_RX_FRAMES Number of frames that can be held by lwip at the same time.
+ */
+template<size_t NUM_RX_FRAMES>
+class TapEthernetDriver : public ::ethernet::TapEthernetDriver
+{
+public:
+    explicit TapEthernetDriver(::etl::array<uint8_t const, 6> const macAddr)
+    : ::ethernet::TapEthernetDriver(macAddr, _rxPbufs, _rxFrameBuffers, _rxPoolQueue)
+    {
+        initRxPool();
+    }
+
+private:
+    ::etl::array<::lwiputils::RxCustomPbuf, NUM_RX_FRAMES> _rxPbufs{};
+    ::etl::array<RxFrameBuffer, NUM_RX_FRAMES> _rxFrameBuffers{};
+    ::etl::queue_spsc_atomic<::lwiputils::RxCustomPbuf*, NUM_RX_FRAMES> _rxPoolQueue;
 };
+} // namespace declare
 
 } // namespace ethernet
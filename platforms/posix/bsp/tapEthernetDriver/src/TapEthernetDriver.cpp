@@ -59,6 +59,14 @@ static int allocTapInterface(char const* const ifName)
         return -1;
     }
 
+    // frames are read in batches until the interface has no more data
+    result = fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    if (result < 0)
+    {
+        close(fd);
+        return -1;
+    }
+
     return fd;
 }
 
@@ -68,10 +76,30 @@ namespace ethernet
 void TapEthernetDriver::setGroupcastAddressRecognition(::etl::array<uint8_t, 6> const /*mac*/) const
 {}
 
-TapEthernetDriver::TapEthernetDriver(::etl::array<uint8_t const, 6> const macAddr)
-: _macAddr(macAddr), _tapFd(-1)
+TapEthernetDriver::TapEthernetDriver(
+    ::etl::array<uint8_t const, 6> const macAddr,
+    ::etl::span<::lwiputils::RxCustomPbuf> const rxPbufs,
+    ::etl::span<RxFrameBuffer> const rxFrameBuffers,
+    RxPool& rxPool)
+: _macAddr(macAddr)
+, _tapFd(-1)
+, _rxPbufs(rxPbufs)
+, _rxFrameBuffers(rxFrameBuffers)
+, _rxPool(rxPool)
+, _rxStatistics()
 {}
 
+void TapEthernetDriver::initRxPool()
+{
+    _rxPool.clear();
+    for (size_t i = 0U; i < _rxPbufs.size(); ++i)
+    {
+        _rxPbufs[i].driver = this;
+        _rxPbufs[i].slot   = _rxFrameBuffers[i].data();
+        (void)_rxPool.push(&_rxPbufs[i]);
+    }
+}
+
 bool TapEthernetDriver::start(char const* const ifName)
 {
     if (_tapFd >= 0)
@@ -98,23 +126,30 @@ void TapEthernetDriver::stop()
     }
 }
 
-void TapEthernetDriver::readFrame()
+bool TapEthernetDriver::readFrame()
 {
     if (_queue.full())
     {
-        // TODO: increment queue full stat counter
-        return;
+        ++_rxStatistics.queueFull;
+        return false;
     }
 
-    auto* const frameData = new uint8_t[::ethernet::TapEthernetDriver::MAX_FRAME_LENGTH];
+    if (_rxPool.empty())
+    {
+        ++_rxStatistics.poolExhausted;
+        return false;
+    }
+
+    // The buffer is only taken from the pool once a frame has been read into it, so that the
+    // pool is never refilled from this context.
+    ::lwiputils::RxCustomPbuf* const frameBuf = _rxPool.front();
+    auto* const frameData                     = static_cast<uint8_t*>(frameBuf->slot);
     auto const nread = read(_tapFd, frameData, ::ethernet::TapEthernetDriver::MAX_FRAME_LENGTH);
     if ((nread <= 0) || (nread > MAX_FRAME_LENGTH))
     {
-        delete[] frameData;
-        return;
+        return false;
     }
-
-    auto* const frameBuf = new ::lwiputils::RxCustomPbuf;
+    (void)_rxPool.pop();
 
     // This lwip function is thread safe, so we can call it outside the lwip thread
     pbuf_alloced_custom(
@@ -124,19 +159,32 @@ void TapEthernetDriver::readFrame()
         &frameBuf->buf,
         frameData,
         ::ethernet::TapEthernetDriver::MAX_FRAME_LENGTH);
-    frameBuf->slot                     = frameData;
-    frameBuf->buf.custom_free_function = [](pbuf* p)
-    {
-        // We can "upcast" here since the initial allocation was made as RxCustimPbuf
-        // The pbuf is embedded as the first memeber so the address stays the same.
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): lwIP pbuf container-of
-        auto* driverPbuf = reinterpret_cast<::lwiputils::RxCustomPbuf*>(p);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): freeing original uint8_t[]
-        delete[] reinterpret_cast<uint8_t*>(driverPbuf->slot);
-        delete driverPbuf;
-    };
+    frameBuf->buf.custom_free_function = &freeRxPbuf;
 
     _queue.push(&frameBuf->buf.pbuf);
+    ++_rxStatistics.framesReceived;
+    return true;
+}
+
+size_t TapEthernetDriver::readFrames(size_t const budget)
+{
+    size_t count = 0U;
+    while ((count < budget) && readFrame())
+    {
+        ++count;
+    }
+    return count;
+}
+
+bool TapEthernetDriver::canReadFrame() const { return (!_queue.full()) && (!_rxPool.empty()); }
+
+void TapEthernetDriver::freeRxPbuf(pbuf* const p)
+{
+    // We can "upcast" here since the initial allocation was made as RxCustimPbuf
+    // The pbuf is embedded as the first memeber so the address stays the same.
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): lwIP pbuf container-of
+    auto* const driverPbuf = reinterpret_cast<::lwiputils::RxCustomPbuf*>(p);
+    (void)static_cast<TapEthernetDriver*>(driverPbuf->driver)->_rxPool.push(driverPbuf);
 }
 
 bool TapEthernetDriver::writeFrame(pbuf* const buf) const
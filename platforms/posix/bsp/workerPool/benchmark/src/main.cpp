@@ -0,0 +1,76 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include <benchmark/benchmark.h>
+#include <bsp/WorkerPool.h>
+
+#include <array>
+#include <atomic>
+#include <thread>
+
+namespace
+{
+constexpr size_t RUNNABLE_COUNT = 256U;
+constexpr size_t WORK_PER_RUN   = 20000U;
+
+std::atomic<size_t> finishedCount{0U};
+
+/**
+ * CPU bound runnable, e.g. a stage of a routing or formatting pipeline.
+ */
+class WorkRunnable : public ::async::IRunnable
+{
+public:
+    void execute() override
+    {
+        uint32_t hash = 2166136261U;
+        for (size_t i = 0U; i < WORK_PER_RUN; ++i)
+        {
+            hash = (hash ^ static_cast<uint32_t>(i)) * 16777619U;
+        }
+        benchmark::DoNotOptimize(hash);
+        ++finishedCount;
+    }
+};
+
+/**
+ * Executes RUNNABLE_COUNT runnables of one context with WorkerCount workers. A single worker
+ * corresponds to a context served by its task.
+ */
+template<size_t WorkerCount>
+void BM_execute_cpu_bound(benchmark::State& state)
+{
+    ::bsp::declare::WorkerPool<WorkerCount> pool;
+    std::array<WorkRunnable, RUNNABLE_COUNT> runnables;
+    pool.start();
+    for (auto _ : state)
+    {
+        finishedCount = 0U;
+        for (auto& runnable : runnables)
+        {
+            pool.execute(runnable);
+        }
+        while (finishedCount < RUNNABLE_COUNT)
+        {
+            std::this_thread::yield();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * RUNNABLE_COUNT));
+    pool.stop();
+}
+
+BENCHMARK_TEMPLATE(BM_execute_cpu_bound, 1U)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_execute_cpu_bound, 2U)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_execute_cpu_bound, 4U)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_execute_cpu_bound, 8U)->UseRealTime();
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,124 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#pragma once
+
+#include <async/IExecutor.h>
+#include <etl/array.h>
+#include <etl/span.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+namespace bsp
+{
+
+/**
+ * Executes runnables in a pool of worker threads. With setContextExecutor() of the async adapter
+ * (FreeRtosAdapter or ThreadXAdapter), the pool serves the runnables of a context.
+ *
+ * Each worker has a queue of its own. Runnables enqueued by a worker go to its queue, other
+ * runnables are distributed over the workers. A worker without runnables steals them from the
+ * queues of the others. A runnable is never executed by two workers at the same time: it stays
+ * enqueued while it is executed, and if it is enqueued again meanwhile, it is executed once more
+ * afterwards.
+ *
+ * The workers aren't tasks of the RTOS port, so the pool only suits contexts whose runnables are
+ * plain computations. Runnables executed by the workers may only use their own data, std::mutex
+ * or std::atomic and ::async::execute() into the context served by the pool. Any other async call,
+ * e.g. the async locks, getCurrentTaskContext() or execute() into a task context, and the Logger,
+ * which relies on the async locks, is reserved for tasks of the RTOS port. Results can be passed
+ * on e.g. through a file descriptor watched by the IoReactor.
+ *
+ * A runnable must not be enqueued into a task context while a worker executes it, the
+ * RunnableExecutor of the task context asserts this (see ::async::QueueNode::isRunning()).
+ */
+class WorkerPool : public ::async::IExecutor
+{
+public:
+    class Worker
+    {
+    public:
+        Worker();
+
+        Worker(Worker const&)            = delete;
+        Worker& operator=(Worker const&) = delete;
+
+    private:
+        friend class WorkerPool;
+
+        std::mutex _mutex;
+        ::async::IRunnable* _first;
+        ::async::IRunnable* _last;
+        std::thread _thread;
+    };
+
+    explicit WorkerPool(::etl::span<Worker> workers);
+    ~WorkerPool();
+
+    WorkerPool(WorkerPool const&)            = delete;
+    WorkerPool& operator=(WorkerPool const&) = delete;
+
+    /**
+     * Starts the worker threads. All signals are blocked in the workers, so that signals of the
+     * RTOS port, e.g. its tick, are only delivered to its tasks.
+     */
+    void start();
+
+    /**
+     * Stops the worker threads after they have finished their current runnables. Runnables that
+     * haven't been executed yet stay enqueued until the pool is started again.
+     */
+    void stop();
+
+    /** Thread-safe, can be called from any thread. */
+    void execute(::async::IRunnable& runnable) override;
+
+    size_t getWorkerCount() const { return _workers.size(); }
+
+private:
+    void push(Worker& worker, ::async::IRunnable& runnable);
+    ::async::IRunnable* pop(Worker& worker);
+    ::async::IRunnable* take(size_t workerIndex);
+    void finish(size_t workerIndex, ::async::IRunnable& runnable);
+    void wait();
+    void run(size_t workerIndex);
+
+    ::etl::span<Worker> _workers;
+    std::mutex _idleMutex;
+    std::condition_variable _idleCondition;
+    std::atomic<size_t> _pendingCount;
+    std::atomic<size_t> _idleWorkerCount;
+    std::atomic<size_t> _nextWorker;
+    std::atomic<bool> _running;
+};
+
+namespace declare
+{
+
+template<size_t WorkerCount>
+class WorkerPool : public ::bsp::WorkerPool
+{
+public:
+    WorkerPool() : ::bsp::WorkerPool(_workers) {}
+
+    // the worker threads need to be joined before the workers are destroyed
+    ~WorkerPool() { stop(); }
+
+private:
+    ::etl::array<Worker, WorkerCount> _workers;
+};
+
+} // namespace declare
+
+} // namespace bsp
@@ -0,0 +1,213 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "bsp/WorkerPool.h"
+
+#include <signal.h>
+
+#include <utility>
+
+namespace bsp
+{
+namespace
+{
+// links of runnables that aren't in a queue, see ::async::QueueNode
+::async::IRunnable* const NOT_ENQUEUED         = reinterpret_cast<::async::IRunnable*>(1U);
+::async::IRunnable* const RUNNING              = ::async::IRunnable::running();
+::async::IRunnable* const RUNNING_AND_ENQUEUED = ::async::IRunnable::runningAndEnqueued();
+
+size_t const NO_WORKER = static_cast<size_t>(-1);
+
+thread_local WorkerPool const* currentPool = nullptr;
+thread_local size_t currentWorker          = NO_WORKER;
+
+template<typename F>
+void signalGuarded(F&& function)
+{
+    sigset_t set, oldSet;
+    sigfillset(&set);
+    pthread_sigmask(SIG_SETMASK, &set, &oldSet);
+    ::std::forward<F>(function)();
+    pthread_sigmask(SIG_SETMASK, &oldSet, nullptr);
+}
+} // namespace
+
+WorkerPool::Worker::Worker() : _mutex(), _first(nullptr), _last(nullptr), _thread() {}
+
+WorkerPool::WorkerPool(::etl::span<Worker> const workers)
+: _workers(workers)
+, _idleMutex()
+, _idleCondition()
+, _pendingCount(0U)
+, _idleWorkerCount(0U)
+, _nextWorker(0U)
+, _running(false)
+{}
+
+WorkerPool::~WorkerPool() { stop(); }
+
+void WorkerPool::start()
+{
+    if (_running.exchange(true))
+    {
+        return;
+    }
+    // the workers inherit the blocked signals, the signals of the RTOS port must only reach its
+    // tasks
+    signalGuarded(
+        [this]()
+        {
+            for (size_t i = 0U; i < _workers.size(); ++i)
+            {
+                _workers[i]._thread = std::thread(&WorkerPool::run, this, i);
+            }
+        });
+}
+
+void WorkerPool::stop()
+{
+    {
+        std::lock_guard<std::mutex> const lock(_idleMutex);
+        if (!_running.exchange(false))
+        {
+            return;
+        }
+    }
+    _idleCondition.notify_all();
+    for (Worker& worker : _workers)
+    {
+        worker._thread.join();
+    }
+}
+
+void WorkerPool::execute(::async::IRunnable& runnable)
+{
+    while (true)
+    {
+        if (runnable.tryEnqueue())
+        {
+            size_t const workerIndex
+                = ((currentPool == this) ? currentWorker : _nextWorker++) % _workers.size();
+            push(_workers[workerIndex], runnable);
+            return;
+        }
+        if (runnable.compareAndSetNext(RUNNING, RUNNING_AND_ENQUEUED))
+        {
+            // executed again by the worker executing it now
+            return;
+        }
+        ::async::IRunnable* const next = runnable.getNext();
+        if ((next != NOT_ENQUEUED) && (next != RUNNING))
+        {
+            // in a queue or already enqueued again
+            return;
+        }
+        // the runnable has just been finished or started, try again
+    }
+}
+
+void WorkerPool::push(Worker& worker, ::async::IRunnable& runnable)
+{
+    {
+        std::lock_guard<std::mutex> const lock(worker._mutex);
+        if (worker._last != nullptr)
+        {
+            worker._last->setNext(&runnable);
+        }
+        else
+        {
+            worker._first = &runnable;
+        }
+        worker._last = &runnable;
+        ++_pendingCount;
+    }
+    if (_idleWorkerCount > 0U)
+    {
+        {
+            // a worker going to wait has either seen the pending runnable or is waiting now
+            std::lock_guard<std::mutex> const lock(_idleMutex);
+        }
+        _idleCondition.notify_one();
+    }
+}
+
+::async::IRunnable* WorkerPool::pop(Worker& worker)
+{
+    std::lock_guard<std::mutex> const lock(worker._mutex);
+    ::async::IRunnable* const runnable = worker._first;
+    if (runnable != nullptr)
+    {
+        worker._first = runnable->getNext();
+        if (worker._last == runnable)
+        {
+            worker._last = nullptr;
+        }
+        // stays enqueued while running
+        runnable->setNext(RUNNING);
+        --_pendingCount;
+    }
+    return runnable;
+}
+
+::async::IRunnable* WorkerPool::take(size_t const workerIndex)
+{
+    size_t const workerCount = _workers.size();
+    for (size_t i = 0U; i < workerCount; ++i)
+    {
+        // the own queue first, then steal from the others
+        ::async::IRunnable* const runnable = pop(_workers[(workerIndex + i) % workerCount]);
+        if (runnable != nullptr)
+        {
+            return runnable;
+        }
+    }
+    return nullptr;
+}
+
+void WorkerPool::finish(size_t const workerIndex, ::async::IRunnable& runnable)
+{
+    if (!runnable.compareAndSetNext(RUNNING, NOT_ENQUEUED))
+    {
+        // enqueued again while running
+        runnable.setNext(nullptr);
+        push(_workers[workerIndex], runnable);
+    }
+}
+
+void WorkerPool::wait()
+{
+    std::unique_lock<std::mutex> lock(_idleMutex);
+    ++_idleWorkerCount;
+    _idleCondition.wait(lock, [this]() { return (!_running) || (_pendingCount > 0U); });
+    --_idleWorkerCount;
+}
+
+void WorkerPool::run(size_t const workerIndex)
+{
+    currentPool   = this;
+    currentWorker = workerIndex;
+    while (_running)
+    {
+        ::async::IRunnable* const runnable = take(workerIndex);
+        if (runnable != nullptr)
+        {
+            runnable->execute();
+            finish(workerIndex, *runnable);
+        }
+        else
+        {
+            wait();
+        }
+    }
+    currentPool   = nullptr;
+    currentWorker = NO_WORKER;
+}
+
+} // namespace bsp
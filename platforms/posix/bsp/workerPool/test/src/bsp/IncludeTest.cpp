@@ -0,0 +1,22 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "bsp/WorkerPool.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace ::testing;
+
+TEST(IncludeTest, TestIncludes) {}
+
+} // namespace
@@ -0,0 +1,282 @@
+/********************************************************************************
+ * Copyright (c) 2026 Accenture
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ********************************************************************************/
+
+#include "bsp/WorkerPool.h"
+
+#include <gmock/gmock.h>
+#include <signal.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+size_t const WORKER_COUNT = 4U;
+
+/**
+ * Waits until none of the runnables is enqueued.
+ */
+bool waitUntilFinished(::etl::span<::async::IRunnable* const> const runnables)
+{
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        bool enqueued = false;
+        for (auto const* const runnable : runnables)
+        {
+            enqueued = enqueued || runnable->isEnqueued();
+        }
+        if (!enqueued)
+        {
+            return true;
+        }
+        std::this_thread::yield();
+    }
+    return false;
+}
+
+template<class Runnables>
+bool waitUntilAllFinished(Runnables& runnables)
+{
+    std::vector<::async::IRunnable*> pointers;
+    for (auto& runnable : runnables)
+    {
+        pointers.push_back(&runnable);
+    }
+    return waitUntilFinished(::etl::span<::async::IRunnable* const>(pointers));
+}
+
+bool waitUntilFinished(::async::IRunnable& runnable)
+{
+    ::async::IRunnable* const pointer = &runnable;
+    return waitUntilFinished(::etl::span<::async::IRunnable* const>(&pointer, 1U));
+}
+
+class CountingRunnable : public ::async::IRunnable
+{
+public:
+    void execute() override
+    {
+        if (++_running != 1U)
+        {
+            _overlapped = true;
+        }
+        _lastRequest = _request.load();
+        ++_executions;
+        std::this_thread::yield();
+        --_running;
+    }
+
+    std::atomic<size_t> _request{0U};
+    std::atomic<size_t> _lastRequest{0U};
+    std::atomic<size_t> _executions{0U};
+    std::atomic<size_t> _running{0U};
+    std::atomic<bool> _overlapped{false};
+};
+
+class WorkerPoolTest : public Test
+{
+protected:
+    ::bsp::declare::WorkerPool<WORKER_COUNT> _cut;
+};
+
+TEST_F(WorkerPoolTest, testExecute)
+{
+    std::array<CountingRunnable, 16U> runnables;
+    EXPECT_EQ(WORKER_COUNT, _cut.getWorkerCount());
+    _cut.start();
+    for (auto& runnable : runnables)
+    {
+        _cut.execute(runnable);
+    }
+    ASSERT_TRUE(waitUntilAllFinished(runnables));
+    for (auto const& runnable : runnables)
+    {
+        EXPECT_EQ(1U, runnable._executions);
+    }
+    _cut.stop();
+}
+
+TEST_F(WorkerPoolTest, testExecuteBeforeStart)
+{
+    CountingRunnable runnable;
+    _cut.execute(runnable);
+    // expect an enqueued runnable not to be enqueued twice
+    _cut.execute(runnable);
+    EXPECT_TRUE(runnable.isEnqueued());
+    EXPECT_EQ(0U, runnable._executions);
+    _cut.start();
+    ASSERT_TRUE(waitUntilFinished(runnable));
+    EXPECT_EQ(1U, runnable._executions);
+    _cut.stop();
+    // expect stop and start to be repeatable
+    _cut.stop();
+    _cut.start();
+    _cut.execute(runnable);
+    ASSERT_TRUE(waitUntilFinished(runnable));
+    EXPECT_EQ(2U, runnable._executions);
+}
+
+class SignalMaskRunnable : public ::async::IRunnable
+{
+public:
+    void execute() override
+    {
+        sigset_t set;
+        pthread_sigmask(SIG_SETMASK, nullptr, &set);
+        _alarmBlocked = (sigismember(&set, SIGALRM) == 1);
+    }
+
+    std::atomic<bool> _alarmBlocked{false};
+};
+
+TEST_F(WorkerPoolTest, testWorkersBlockSignals)
+{
+    SignalMaskRunnable runnable;
+    _cut.start();
+    _cut.execute(runnable);
+    ASSERT_TRUE(waitUntilFinished(runnable));
+    EXPECT_TRUE(runnable._alarmBlocked);
+    _cut.stop();
+    // expect the signal mask of the starting thread to be restored
+    sigset_t set;
+    pthread_sigmask(SIG_SETMASK, nullptr, &set);
+    EXPECT_EQ(0, sigismember(&set, SIGALRM));
+}
+
+class RunningStateRunnable : public ::async::IRunnable
+{
+public:
+    void execute() override { _running = isRunning(); }
+
+    std::atomic<bool> _running{false};
+};
+
+TEST_F(WorkerPoolTest, testExecutedRunnableIsMarkedAsRunning)
+{
+    RunningStateRunnable runnable;
+    _cut.start();
+    _cut.execute(runnable);
+    ASSERT_TRUE(waitUntilFinished(runnable));
+    // expect task contexts to detect a runnable executed by a worker, see RunnableExecutor
+    EXPECT_TRUE(runnable._running);
+    EXPECT_FALSE(runnable.isRunning());
+    _cut.stop();
+}
+
+TEST_F(WorkerPoolTest, testConcurrentExecuteIsSerializedPerRunnable)
+{
+    static size_t const PRODUCER_COUNT = 4U;
+    static size_t const REQUEST_COUNT  = 20000U;
+
+    std::array<CountingRunnable, 8U> runnables;
+    _cut.start();
+    std::vector<std::thread> producers;
+    for (size_t producer = 0U; producer < PRODUCER_COUNT; ++producer)
+    {
+        producers.emplace_back(
+            [&, producer]()
+            {
+                for (size_t request = 1U; request <= REQUEST_COUNT; ++request)
+                {
+                    CountingRunnable& runnable = runnables[(request + producer) % runnables.size()];
+                    ++runnable._request;
+                    _cut.execute(runnable);
+                }
+            });
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    ASSERT_TRUE(waitUntilAllFinished(runnables));
+    for (auto const& runnable : runnables)
+    {
+        // expect no runnable to be executed by two workers at the same time
+        EXPECT_FALSE(runnable._overlapped);
+        // expect each runnable to be executed after it has been enqueued the last time
+        EXPECT_EQ(runnable._request, runnable._lastRequest);
+        EXPECT_GT(runnable._executions, 0U);
+    }
+    _cut.stop();
+}
+
+class ChildRunnable : public ::async::IRunnable
+{
+public:
+    void execute() override
+    {
+        std::lock_guard<std::mutex> const lock(_mutex);
+        _threads.insert(std::this_thread::get_id());
+    }
+
+    static std::mutex _mutex;
+    static std::set<std::thread::id> _threads;
+};
+
+std::mutex ChildRunnable::_mutex;
+std::set<std::thread::id> ChildRunnable::_threads;
+
+class ProducingRunnable : public ::async::IRunnable
+{
+public:
+    ProducingRunnable(::bsp::WorkerPool& pool, ::etl::span<ChildRunnable> children)
+    : _pool(pool), _children(children)
+    {}
+
+    void execute() override
+    {
+        _thread = std::this_thread::get_id();
+        // all children are enqueued to the queue of the executing worker
+        for (auto& child : _children)
+        {
+            _pool.execute(child);
+        }
+        _produced = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    std::thread::id _thread;
+    std::atomic<bool> _produced{false};
+
+private:
+    ::bsp::WorkerPool& _pool;
+    ::etl::span<ChildRunnable> _children;
+};
+
+TEST_F(WorkerPoolTest, testIdleWorkersSteal)
+{
+    std::array<ChildRunnable, 64U> children;
+    ProducingRunnable producer(_cut, children);
+    _cut.start();
+    _cut.execute(producer);
+    while (!producer._produced)
+    {
+        std::this_thread::yield();
+    }
+    ASSERT_TRUE(waitUntilAllFinished(children));
+    // expect children to be executed by other workers while their worker is still busy
+    EXPECT_TRUE(producer.isEnqueued());
+    {
+        std::lock_guard<std::mutex> const lock(ChildRunnable::_mutex);
+        EXPECT_GT(ChildRunnable::_threads.size(), 0U);
+        EXPECT_EQ(0U, ChildRunnable::_threads.count(producer._thread));
+    }
+    ASSERT_TRUE(waitUntilFinished(producer));
+    _cut.stop();
+}
+
+} // namespace
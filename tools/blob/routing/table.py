@@ -36,6 +36,7 @@ from blob.routing.utils import (
     destination_offset_generator,
     get_first_id,
     message_id_generator,
+    message_id_index_generator,
     message_length_generator,
     pdu_length_offset_generator,
 )
@@ -83,6 +84,7 @@ class RxAdapter:
             pdu_length_offsets=pdu_length_offset_generator(table, channel_id),
             pdu_lengths=input_pdu_length_generator(table, channel_id),
             pdu_offsets=input_pdu_offset_generator(table, channel_id),
+            message_id_index=message_id_index_generator(table, channel_id),
         )
 
     def __init__(
@@ -95,6 +97,7 @@ class RxAdapter:
         pdu_length_offsets=None,
         pdu_lengths=None,
         pdu_offsets=None,
+        message_id_index=None,
     ):
         self._channel_id = channel_id
         self._channel_type = channel_type
@@ -104,6 +107,7 @@ class RxAdapter:
         self._pdu_length_offsets = default_or(pdu_length_offsets)
         self._pdu_lengths = default_or(pdu_lengths)
         self._pdu_offsets = default_or(pdu_offsets)
+        self._message_id_index = default_or(message_id_index)
 
     def create_blob_element_list(self):
         return config(
@@ -117,6 +121,7 @@ class RxAdapter:
                 ),
                 prepend_size(iter_to_blob_element_list(self._pdu_lengths, "pdu lengths", "length", ">I")),
                 prepend_size(iter_to_blob_element_list(self._pdu_offsets, "pdu offsets", "offset", ">I")),
+                prepend_size(iter_to_blob_element_list(self._message_id_index, "message id index", "index", ">I")),
             ],
             reserved=[
                 BlobElement("channel type", bytes(self._channel_type)),
@@ -120,6 +120,11 @@ def message_id_generator(table, channel_id):
             yield r
 
 
+def message_id_index_generator(table, channel_id):
+    message_ids = list(message_id_generator(table, channel_id))
+    yield from sorted(range(len(message_ids)), key=lambda index: message_ids[index])
+
+
 def message_length_generator(table, channel_id):
     input_message_ids = list(input_message_id_generator(table, channel_id))
     non_zero_input_message_lengths = list(
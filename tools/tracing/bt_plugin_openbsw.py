@@ -64,23 +64,23 @@ class OpenBSWSource(bt2._UserSourceComponent, message_iterator_class=OpenBSWSour
                 )
             )
 
-        if len(inputs) != 1:
+        if len(inputs) < 1:
             raise ValueError(
-                "OpenBSWSource: expecting `inputs` parameter to be of length, got {}".format(
-                    len(inputs)
-                )
+                "OpenBSWSource: expecting `inputs` parameter to contain at least one file"
             )
 
-        if type(inputs[0]) != bt2._StringValueConst:
-            raise TypeError(
-                "OpenBSWSource: expecting `inputs[0]` parameter to be a string, got a {}".format(
-                    type(inputs[0])
+        for i, input in enumerate(inputs):
+            if type(input) != bt2._StringValueConst:
+                raise TypeError(
+                    "OpenBSWSource: expecting `inputs[{}]` parameter to be a string, got a {}".format(
+                        i, type(input)
+                    )
                 )
-            )
 
         trace_class = self._create_metadata()
 
-        self._add_output_port("out", (str(inputs[0]), trace_class))
+        # several inputs are the files of one trace streamed in ring mode
+        self._add_output_port("out", ([str(input) for input in inputs], trace_class))
 
     def _create_event_class(self, trace_class, event_id, name, arg) -> None:
         stream_class = trace_class[0]
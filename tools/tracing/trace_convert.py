@@ -8,7 +8,9 @@
 # SPDX-License-Identifier: Apache-2.0
 # *******************************************************************************
 
+import argparse
 import datetime
+import json
 import os
 import sys
 from dataclasses import dataclass
@@ -18,6 +20,7 @@ class Event:
     timestamp: int
     id: int
     arg: int
+    cycles: int = 0
 
     TRACE_BYTE_ORDER = 'little'
 
@@ -42,52 +45,126 @@ class Event:
         return f"[{self.timestamp} ns] Event '{self.name()}' (id={self.id}, arg={self.arg})"
 
 class TraceParser:
-    def __init__(self, filename: str):
-        if not isinstance(filename, str):
-            raise TypeError(f"Expected a string, but got {type(filename).__name__}.")
-        if not os.path.isfile(filename):
-            raise ValueError(f"The file '{filename}' does not exist or is not a valid file.")
-        self.filename = filename
+    """
+    Reads traces of runtime::Tracer.
+
+    A trace either is a dump of the buffer in linear mode, a dump of the buffer in ring mode or
+    a stream of blocks drained in ring mode. Streams may be split into several files, e.g. one
+    per drain() call or UDP packet. Their blocks are ordered by sequence number, duplicates are
+    dropped and gaps are reported, so the events form a single timeline.
+    """
+
+    BLOCK_MARKER = 0xFF
+    BLOCK_HEADER_WORDS = 3
+
+    def __init__(self, filenames):
+        if isinstance(filenames, str):
+            filenames = [filenames]
+        for filename in filenames:
+            if not isinstance(filename, str):
+                raise TypeError(f"Expected a string, but got {type(filename).__name__}.")
+            if not os.path.isfile(filename):
+                raise ValueError(
+                    f"The file '{filename}' does not exist or is not a valid file.")
+        self.filenames = list(filenames)
 
     def read(self) -> list[Event]:
         events = []
-        with open(self.filename, "rb") as f:
-            bytes_raw = f.read(4)
-            if not bytes_raw or len(bytes_raw) != 4:
-                print("Error: unexpected end of file while reading first cyclesPerSec bytes",
-                        file=sys.stderr)
-            self._cycles_per_sec = int.from_bytes(bytes_raw, byteorder=Event.TRACE_BYTE_ORDER)
-
-            while True:
-                bytes_raw = f.read(4)
-                if not bytes_raw:
-                    # Assuming end of event messages
-                    break
-                if len(bytes_raw) != 4:
-                    print("Error: unexpected end of file while reading frame bytes",
-                            file=sys.stderr)
-                    break
+        blocks = {}
+        for filename in self.filenames:
+            words = TraceParser._read_words(filename)
+            if not words:
+                print(f"Error: '{filename}' doesn't contain a trace", file=sys.stderr)
+            elif TraceParser._is_block(words, 0):
+                # stream of drained blocks
+                self._collect_blocks(words, 0, blocks)
+            elif TraceParser._is_block(words, 1):
+                # dump of the buffer in ring mode
+                self._collect_blocks(words, 1, blocks)
+            else:
+                self._cycles_per_sec = words[0]
+                events.extend(self._read_frames(words, 1, len(words)))
+        if blocks:
+            events.extend(self._read_blocks(blocks))
+        return events
 
-                v = int.from_bytes(bytes_raw, byteorder=Event.TRACE_BYTE_ORDER)
-                ext, id, arg, rel_cycles = TraceParser._parse_normal_frame(v)
+    @staticmethod
+    def _read_words(filename: str) -> list[int]:
+        with open(filename, "rb") as f:
+            data = f.read()
+        if len(data) % 4 != 0:
+            print(f"Error: unexpected end of file '{filename}' while reading frame bytes",
+                    file=sys.stderr)
+        return [int.from_bytes(data[i:i + 4], byteorder=Event.TRACE_BYTE_ORDER)
+                for i in range(0, len(data) - 3, 4)]
 
-                if ext == 0:
-                    if rel_cycles == 0:
-                        # Assuming end of event messages – reached zeroed-out area
-                        break
+    @staticmethod
+    def _is_block(words: list[int], index: int) -> bool:
+        return (index + TraceParser.BLOCK_HEADER_WORDS <= len(words)
+                and (words[index] >> 24) == TraceParser.BLOCK_MARKER)
+
+    def _collect_blocks(self, words: list[int], index: int, blocks: dict) -> None:
+        while TraceParser._is_block(words, index):
+            block_size = (words[index] >> 12) & 0xFFF
+            used_size = words[index] & 0xFFF
+            if block_size < TraceParser.BLOCK_HEADER_WORDS:
+                print("Error: invalid block header", file=sys.stderr)
+                break
+            sequence = words[index + 1]
+            end = index + (used_size if used_size != 0 else block_size)
+            # a block that is still written (used size 0) ends with the first zero word
+            blocks.setdefault(sequence, (words[index + 2],
+                    words[index + TraceParser.BLOCK_HEADER_WORDS:min(end, len(words))]))
+            index += block_size
+
+    def _read_blocks(self, blocks: dict) -> list[Event]:
+        events = []
+        prev_sequence = None
+        offset = 0
+        prev_cycles = 0
+        for sequence in sorted(blocks):
+            self._cycles_per_sec, frames = blocks[sequence]
+            if prev_sequence is not None and sequence != prev_sequence + 1:
+                print(f"Warning: {sequence - prev_sequence - 1} blocks lost before block "
+                        f"{sequence}", file=sys.stderr)
+            prev_sequence = sequence
+            block_events = self._read_frames(frames, 0, len(frames), offset)
+            if block_events and block_events[0].cycles < prev_cycles:
+                # the 32 bit cycle counter has wrapped since the previous block
+                offset += 1 << 32
+                block_events = self._read_frames(frames, 0, len(frames), offset)
+            if block_events:
+                prev_cycles = block_events[-1].cycles
+            events.extend(block_events)
+        return events
 
-                    cycles += rel_cycles
-                else:
-                    bytes_raw = f.read(4)
-                    if not bytes_raw or len(bytes_raw) != 4:
-                        print("Error: unexpected end of file while reading abs_cycles bytes",
-                                file=sys.stderr)
-                        break
-                    cycles = int.from_bytes(bytes_raw, byteorder=Event.TRACE_BYTE_ORDER)
+    def _read_frames(self, words: list[int], index: int, end: int, offset: int = 0) -> list[Event]:
+        events = []
+        cycles = 0
+        while index < end:
+            ext, id, arg, rel_cycles = TraceParser._parse_normal_frame(words[index])
+            index += 1
+
+            if ext == 0:
+                if rel_cycles == 0:
+                    # Assuming end of event messages – reached zeroed-out area
+                    break
 
-                ts = self._get_timestamp(cycles)
+                cycles += rel_cycles
+            else:
+                if index >= end:
+                    print("Error: unexpected end of trace while reading abs_cycles bytes",
+                            file=sys.stderr)
+                    break
+                cycles = words[index] + offset
+                index += 1
+                if events and cycles < events[-1].cycles:
+                    # the 32 bit cycle counter has wrapped within the block
+                    offset += 1 << 32
+                    cycles += 1 << 32
 
-                events.append(Event(timestamp=ts, id=id, arg=arg))
+            events.append(Event(timestamp=self._get_timestamp(cycles), id=id, arg=arg,
+                    cycles=cycles))
 
         return events
 
@@ -112,25 +189,61 @@ class TraceParser:
         rel_cycles = (rel_cycles_high << 16) | rel_cycles_low
         return ext, id, arg, rel_cycles
 
+def print_text(events: list[Event]) -> None:
+    last_ts = 0
+    for e in events:
+        total_seconds = e.timestamp / 1_000_000_000
+        dt = datetime.datetime.utcfromtimestamp(total_seconds)
+        nanos = e.timestamp % 1_000_000_000
+        timestamp_str = dt.strftime("%H:%M:%S") + f".{nanos:09d}"
+
+        if last_ts == 0:
+            delta_str = "(+?.?????????)"
+        else:
+            delta_ns = e.timestamp - last_ts
+            delta_sec = delta_ns / 1_000_000_000
+            delta_str = f"(+{delta_sec:.9f})"
+
+        print(f"[{timestamp_str}] {delta_str} {e.name()}: {{ id = {e.arg} }}")
+        last_ts = e.timestamp
+
+def print_perfetto(events: list[Event]) -> None:
+    """
+    Prints the events in the JSON trace event format, which is opened by Perfetto UI and
+    chrome://tracing. Tasks are shown as threads of process 0, ISR groups as threads of process 1.
+    """
+    phases = {0x0: "E", 0x1: "B", 0x2: "B", 0x3: "E", 0x4: "i"}
+    trace_events = [
+        {"name": "process_name", "ph": "M", "pid": 0, "args": {"name": "tasks"}},
+        {"name": "process_name", "ph": "M", "pid": 1, "args": {"name": "isr groups"}},
+    ]
+    for e in events:
+        is_isr = e.id in (0x2, 0x3)
+        name = f"isr group {e.arg}" if is_isr else f"task {e.arg}"
+        trace_event = {
+            "name": name if e.id != 0x4 else f"user {e.arg}",
+            "ph": phases.get(e.id, "i"),
+            "ts": e.timestamp / 1000,
+            "pid": 1 if is_isr else 0,
+            "tid": e.arg,
+        }
+        if trace_event["ph"] == "i":
+            trace_event["s"] = "g"
+        trace_events.append(trace_event)
+    json.dump({"traceEvents": trace_events, "displayTimeUnit": "ns"}, sys.stdout)
+
 if __name__ == "__main__":
-    if len(sys.argv) < 2:
-        print("Error: No trace filename provided.")
+    arg_parser = argparse.ArgumentParser(
+        description="Converts traces of runtime::Tracer. Several files of a trace streamed in "
+                    "ring mode are stitched into one timeline.")
+    arg_parser.add_argument("--format", choices=["text", "perfetto"], default="text",
+            help="output format, perfetto writes the JSON trace event format")
+    arg_parser.add_argument("filenames", nargs="+", help="trace files in the order of capture")
+    args = arg_parser.parse_args()
+
+    parser = TraceParser(args.filenames)
+    events = parser.read()
+    if args.format == "perfetto":
+        print_perfetto(events)
     else:
-        parser = TraceParser(sys.argv[1])
-        events = parser.read()
-        last_ts = 0
-        for e in events:
-            total_seconds = e.timestamp / 1_000_000_000
-            dt = datetime.datetime.utcfromtimestamp(total_seconds)
-            nanos = e.timestamp % 1_000_000_000
-            timestamp_str = dt.strftime("%H:%M:%S") + f".{nanos:09d}"
-
-            if last_ts == 0:
-                delta_str = "(+?.?????????)"
-            else:
-                delta_ns = e.timestamp - last_ts
-                delta_sec = delta_ns / 1_000_000_000
-                delta_str = f"(+{delta_sec:.9f})"
-
-            print(f"[{timestamp_str}] {delta_str} {e.name()}: {{ id = {e.arg} }}")
-            last_ts = e.timestamp
+        print_text(events)